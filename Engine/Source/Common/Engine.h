@@ -2,17 +2,54 @@
 #define ENGINE_H_
 
 // library includes
+#include <stdint.h>
+#if defined(_WIN32)
 #include <Windows.h>
+#endif
 
+// forward declarations
 namespace engine {
+namespace render {
+    class InterfaceRenderBackend;
+}
+}
 
+namespace engine {
+
+// start up with a renderer that draws with i_render_backend, the engine owns it & deletes it at the end of Shutdown
+// the backend is allocated through the engine's allocators, so engine::memory::CreateAllocators must be called first
+bool StartUp(engine::render::InterfaceRenderBackend* i_render_backend);
+#if defined(_WIN32)
+// start up with a renderer that draws into a GLib window
 bool StartUp(HINSTANCE i_h_instance, int i_n_cmd_show, const char* i_window_name, unsigned int i_window_width, unsigned int i_window_height);
+#endif
+// start up without a window or GPU & with the frame limiter disabled, for simulation servers & benchmarks
+bool StartUpHeadless();
 void Run();
 
 void Pause();
 void Resume();
 bool IsPaused();
 
+// run collision detection & physics in steps of 1 / i_frequency seconds, at most i_max_steps_per_frame steps every frame
+// renderables are drawn between the last two steps, physics is stepped at the frame rate when disabled
+void EnableFixedTimestep(float i_frequency, uint8_t i_max_steps_per_frame);
+void DisableFixedTimestep();
+bool IsFixedTimestepEnabled();
+
+// draw every frame on the renderer's own thread while the next frame is simulated, frames then take as long as the slower
+// of the two, frames are simulated & drawn on the same thread when disabled, takes effect the next time Run is called
+// only render backends that can draw on any thread are pipelined, GLib's window is always drawn on the window's thread
+void EnablePipelinedRendering();
+void DisablePipelinedRendering();
+bool IsPipelinedRenderingEnabled();
+
+// sleep to keep frames at 60 FPS & measure how long every frame really took
+// when disabled, every frame advances time by exactly 1/60th of a second & starts right after the last one
+void EnableFrameLimiter();
+void DisableFrameLimiter();
+bool IsFrameLimiterEnabled();
+
 void InitiateShutdown();
 void Shutdown();
 
@@ -1,4 +1,4 @@
-#include "Common\Engine.h"
+#include "Common/Engine.h"
 
 // library includes
 #include <stdlib.h>
@@ -6,33 +6,38 @@
 //#include <time.h>
 
 // engine includes
-#include "Data\StringPool.h"
-#include "Events\EventDispatcher.h"
-#include "Input\Input.h"
-#include "Jobs\JobSystem.h"
-#include "Memory\AllocatorUtil.h"
-#include "Physics\Collider.h"
-#include "Physics\Physics.h"
-#include "Renderer\Renderer.h"
-#include "Time\TimerUtil.h"
-#include "Time\Updater.h"
-#include "Util\FileUtils.h"
-#include "Util\Profiler.h"
+#include "Common/HelperMacros.h"
+#include "Data/StringPool.h"
+#include "Events/EventDispatcher.h"
+#include "Input/Input.h"
+#include "Jobs/JobSystem.h"
+#include "Memory/AllocatorUtil.h"
+#include "Memory/FrameAllocator.h"
+#include "Physics/Collider.h"
+#include "Physics/Physics.h"
+#include "Renderer/NullRenderBackend.h"
+#include "Renderer/Renderer.h"
+#include "Time/FixedTimestep.h"
+#include "Time/TimerUtil.h"
+#include "Time/Updater.h"
+#include "Util/FileUtils.h"
+#include "Util/Profiler.h"
 
 namespace engine {
 
 static bool is_paused_ = false;
 static bool shutdown_requested_ = false;
+static bool is_fixed_timestep_enabled_ = true;
+static bool is_pipelined_rendering_enabled_ = true;
+static bool is_frame_limiter_enabled_ = true;
+static engine::time::FixedTimestep fixed_timestep_;
+static engine::render::InterfaceRenderBackend* render_backend_ = nullptr;
 
-bool StartUp(HINSTANCE i_h_instance, int i_n_cmd_show, const char* i_window_name, unsigned int i_window_width, unsigned int i_window_height)
+bool StartUp(engine::render::InterfaceRenderBackend* i_render_backend)
 {
-    // create allocators
-    engine::memory::CreateAllocators();
-    
-    // initialize GLib
-    bool success = GLib::Initialize(i_h_instance, i_n_cmd_show, i_window_name, -1, i_window_width, i_window_height);
-    ASSERT(success);
-    
+    // validate input
+    ASSERT(i_render_backend);
+
     // create string pools
     engine::data::StringPool::Create();
 
@@ -59,7 +64,8 @@ bool StartUp(HINSTANCE i_h_instance, int i_n_cmd_show, const char* i_window_name
     engine::physics::Physics::Create();
 
     // create renderer
-    engine::render::Renderer::Create();
+    render_backend_ = i_render_backend;
+    engine::render::Renderer::Create(render_backend_);
 
 #if defined(ENABLE_PROFILING)
     // create profiler
@@ -72,41 +78,96 @@ bool StartUp(HINSTANCE i_h_instance, int i_n_cmd_show, const char* i_window_name
 
     is_paused_ = false;
     shutdown_requested_ = false;
+    fixed_timestep_.Reset();
 
     return true;
 }
 
+bool StartUpHeadless()
+{
+    // create allocators
+    engine::memory::CreateAllocators();
+
+    // nobody is watching, so simulate as fast as possible
+    is_frame_limiter_enabled_ = false;
+
+    return StartUp(new engine::render::NullRenderBackend());
+}
+
 void Run()
 {
     // calculate the ideal delta to run at 60 FPS
     static const float ideal_dt = 1000.0f / 60.0f;
 
-    // save pointers to the modules that need ticking
-    static engine::time::Updater* updater = engine::time::Updater::Get();
-    static engine::physics::Collider* collider = engine::physics::Collider::Get();
-    static engine::physics::Physics* physics = engine::physics::Physics::Get();
-    static engine::render::Renderer* renderer = engine::render::Renderer::Get();
+    // save pointers to the modules that need ticking, they're recreated every time the engine starts up
+    engine::time::Updater* updater = engine::time::Updater::Get();
+    engine::physics::Collider* collider = engine::physics::Collider::Get();
+    engine::physics::Physics* physics = engine::physics::Physics::Get();
+    engine::render::Renderer* renderer = engine::render::Renderer::Get();
+    engine::memory::FrameAllocator* frame_allocator = engine::memory::FrameAllocator::Get();
+
+    // the renderer draws the last frame while the loop simulates the next one
+    if (is_pipelined_rendering_enabled_)
+    {
+        renderer->StartRenderThread();
+    }
 
     while (!shutdown_requested_)
     {
+        // release last frame's transient data
+        frame_allocator->Reset();
+
         // get delta
         float dt = engine::time::TimerUtil::CalculateLastFrameTime_ms();
+        if (!is_frame_limiter_enabled_)
+        {
+            dt = ideal_dt;
+        }
 
-        GLib::Service(shutdown_requested_);
+        render_backend_->Service(shutdown_requested_);
 
         // update modules
+        float interpolation = 1.0f;
         if (!is_paused_)
         {
             updater->Run(dt);
-            collider->Run(dt);
-            physics->Run(dt);
+
+            if (is_fixed_timestep_enabled_)
+            {
+                // step collision detection & physics by a fixed amount, as many times as the frame's time allows
+                const uint8_t num_steps = fixed_timestep_.Advance(dt);
+                const float step_dt = fixed_timestep_.GetStepTime();
+                for (uint8_t i = 0; i < num_steps; ++i)
+                {
+                    collider->Run(step_dt);
+                    physics->Run(step_dt);
+                }
+                interpolation = fixed_timestep_.GetInterpolation();
+                PROFILE_VALUE("PhysicsSteps", num_steps);
+            }
+            else
+            {
+                collider->Run(dt);
+                physics->Run(dt);
+            }
+        }
+        else if (is_fixed_timestep_enabled_)
+        {
+            // hold the last interpolated positions while paused
+            interpolation = fixed_timestep_.GetInterpolation();
         }
-        renderer->Run(dt);
+        renderer->Run(interpolation);
 
         // ensure we have a steady 60 frames per second
-        const float diff_dt = ideal_dt - dt;
-        engine::time::TimerUtil::CustomSleep(uint32_t(diff_dt > 0.0f ? diff_dt : 0.0f));
+        if (is_frame_limiter_enabled_)
+        {
+            const float diff_dt = ideal_dt - dt;
+            engine::time::TimerUtil::CustomSleep(uint32_t(diff_dt > 0.0f ? diff_dt : 0.0f));
+        }
     }
+
+    // the game shuts down after this, so the last frame must be drawn first
+    renderer->StopRenderThread();
 }
 
 void Pause()
@@ -132,6 +193,53 @@ bool IsPaused()
     return is_paused_;
 }
 
+void EnableFixedTimestep(float i_frequency, uint8_t i_max_steps_per_frame)
+{
+    fixed_timestep_.SetFrequency(i_frequency);
+    fixed_timestep_.SetMaxSteps(i_max_steps_per_frame);
+    is_fixed_timestep_enabled_ = true;
+}
+
+void DisableFixedTimestep()
+{
+    is_fixed_timestep_enabled_ = false;
+}
+
+bool IsFixedTimestepEnabled()
+{
+    return is_fixed_timestep_enabled_;
+}
+
+void EnablePipelinedRendering()
+{
+    is_pipelined_rendering_enabled_ = true;
+}
+
+void DisablePipelinedRendering()
+{
+    is_pipelined_rendering_enabled_ = false;
+}
+
+bool IsPipelinedRenderingEnabled()
+{
+    return is_pipelined_rendering_enabled_;
+}
+
+void EnableFrameLimiter()
+{
+    is_frame_limiter_enabled_ = true;
+}
+
+void DisableFrameLimiter()
+{
+    is_frame_limiter_enabled_ = false;
+}
+
+bool IsFrameLimiterEnabled()
+{
+    return is_frame_limiter_enabled_;
+}
+
 void InitiateShutdown()
 {
     if (shutdown_requested_)
@@ -175,8 +283,11 @@ void Shutdown()
     // delete string pools
     engine::data::StringPool::Destroy();
 
-    // cleanup GLib
-    GLib::Shutdown();
+    // delete the render backend last, renderables held by the modules above release their sprites through it
+    SAFE_DELETE(render_backend_);
+
+    // StartUpHeadless switches the frame limiter off, the next start up mustn't inherit that
+    is_frame_limiter_enabled_ = true;
 
     // delete allocators
     engine::memory::DestroyAllocators();
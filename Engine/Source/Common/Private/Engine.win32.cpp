@@ -0,0 +1,25 @@
+#include "Common/Engine.h"
+
+// external includes
+#include "GLib.h"
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Memory/AllocatorUtil.h"
+#include "Renderer/GLibRenderBackend.h"
+
+namespace engine {
+
+bool StartUp(HINSTANCE i_h_instance, int i_n_cmd_show, const char* i_window_name, unsigned int i_window_width, unsigned int i_window_height)
+{
+    // create allocators
+    engine::memory::CreateAllocators();
+
+    // initialize GLib
+    bool success = GLib::Initialize(i_h_instance, i_n_cmd_show, i_window_name, -1, i_window_width, i_window_height);
+    ASSERT(success);
+
+    return StartUp(new engine::render::GLibRenderBackend());
+}
+
+} // namespace engine
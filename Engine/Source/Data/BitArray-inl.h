@@ -2,9 +2,12 @@
 
 // library includes
 #include <algorithm>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 // engine includes
-#include "Assert\Assert.h"
+#include "Assert/Assert.h"
 
 namespace engine {
 namespace data {
@@ -15,30 +18,16 @@ namespace data {
         if (this != &i_bit_array)
         {
             std::swap(buckets_, i_bit_array.buckets_);
+            std::swap(full_buckets_, i_bit_array.full_buckets_);
+            std::swap(non_empty_buckets_, i_bit_array.non_empty_buckets_);
             num_buckets_ = i_bit_array.num_buckets_;
+            num_summary_buckets_ = i_bit_array.num_summary_buckets_;
             num_bits_ = i_bit_array.num_bits_;
+            search_hint_ = i_bit_array.search_hint_;
         }
         return *this;
     }
 
-    inline void BitArray::ClearAll()
-    {
-        memset(buckets_, 0, sizeof(buckets_) * num_buckets_);
-    }
-
-    inline void BitArray::SetAll()
-    {
-        memset(buckets_, ~0, sizeof(buckets_) * num_buckets_);
-    }
-
-    inline void BitArray::ToggleAll()
-    {
-        for (size_t i = 0; i < num_buckets_; ++i)
-        {
-            buckets_[i] = ~buckets_[i];
-        }
-    }
-
     inline bool BitArray::IsBitSet(size_t i_bit_index) const
     {
         // validate input
@@ -48,7 +37,7 @@ namespace data {
         // calculate the bucket index
         size_t bucket_index = i_bit_index / bit_depth_;
 
-        return (buckets_[bucket_index] >> i_bit_index) & static_cast<size_t>(1);
+        return (buckets_[bucket_index] >> (i_bit_index % bit_depth_)) & static_cast<size_t>(1);
     }
 
     inline bool BitArray::IsBitClear(size_t i_bit_index) const
@@ -68,8 +57,47 @@ namespace data {
 
     inline size_t BitArray::GetRequiredMemorySize(size_t i_num_bits)
     {
-        const size_t num_buckets = ((i_num_bits & (bit_depth_ - 1)) ? 1 : 0) + i_num_bits / bit_depth_;
-        return sizeof(BitArray) + sizeof(size_t) * num_buckets;
+        const size_t num_buckets = GetNumBuckets(i_num_bits);
+        return sizeof(BitArray) + sizeof(size_t) * (num_buckets + GetNumBuckets(num_buckets) * 2);
+    }
+
+    inline size_t BitArray::GetNumBuckets(size_t i_num_bits)
+    {
+        return ((i_num_bits & (bit_depth_ - 1)) ? 1 : 0) + i_num_bits / bit_depth_;
+    }
+
+    inline size_t BitArray::GetLowestSetBit(size_t i_value)
+    {
+        ASSERT(i_value != 0);
+#if defined(_MSC_VER)
+        unsigned long bit_index_long = 0;
+#if defined(_WIN64)
+        _BitScanForward64(&bit_index_long, i_value);
+#else
+        _BitScanForward(&bit_index_long, i_value);
+#endif
+        return size_t(bit_index_long);
+#else
+        return sizeof(size_t) > 4 ? size_t(__builtin_ctzll(i_value)) : size_t(__builtin_ctz(unsigned(i_value)));
+#endif
+    }
+
+    // Returns a mask of the bits in a bucket that map to actual bits, only the last bucket can have fewer than bit_depth_
+    inline size_t BitArray::GetValidBitsMask(size_t i_bucket_index) const
+    {
+        const size_t num_last_bits = num_bits_ % bit_depth_;
+        return (i_bucket_index == num_buckets_ - 1 && num_last_bits) ? ((static_cast<size_t>(1) << num_last_bits) - 1) : ~static_cast<size_t>(0);
+    }
+
+    inline void BitArray::UpdateSummary(size_t i_bucket_index)
+    {
+        const size_t valid_bits = GetValidBitsMask(i_bucket_index);
+        const size_t bucket = buckets_[i_bucket_index] & valid_bits;
+        const size_t summary_index = i_bucket_index / bit_depth_;
+        const size_t summary_bit = static_cast<size_t>(1) << (i_bucket_index % bit_depth_);
+
+        full_buckets_[summary_index] = bucket == valid_bits ? (full_buckets_[summary_index] | summary_bit) : (full_buckets_[summary_index] & ~summary_bit);
+        non_empty_buckets_[summary_index] = bucket != 0 ? (non_empty_buckets_[summary_index] | summary_bit) : (non_empty_buckets_[summary_index] & ~summary_bit);
     }
 
 } // namespace data
@@ -1,6 +1,9 @@
 #ifndef ENGINE_BIT_ARRAY_H_
 #define ENGINE_BIT_ARRAY_H_
 
+// library includes
+#include <stddef.h>
+
 namespace engine {
 namespace data {
 
@@ -9,6 +12,10 @@ namespace data {
         - Creates and maintains an array of bits
         - Bits can be set, cleared or toggled both individually and altogether
         - Needs to be provided raw memory to create an instance of itself
+        - Keeps a summary level with one bit per bucket for full buckets & one for non-empty buckets,
+          so searches skip an entire bucket of bucket_depth_ bits with every summary bit
+        - FindClearBit starts where the previous search left off, which keeps finding a clear bit
+          near constant time even when most bits are set
     */
 
     class BitArray
@@ -16,6 +23,13 @@ namespace data {
     private:
         explicit BitArray(size_t i_num_bits, void* i_memory, bool i_start_set = false);
 
+        inline size_t GetValidBitsMask(size_t i_bucket_index) const;
+        inline void UpdateSummary(size_t i_bucket_index);
+        void RebuildSummary();
+
+        static inline size_t GetNumBuckets(size_t i_num_bits);
+        static inline size_t GetLowestSetBit(size_t i_value);
+
         // disable copy constructor & copy assignment operator
         BitArray(const BitArray& i_copy) = delete;
         inline BitArray& operator=(const BitArray& i_bit_array) = delete;
@@ -28,9 +42,9 @@ namespace data {
 
         inline BitArray& operator=(BitArray&& i_bit_array);
 
-        inline void ClearAll();
-        inline void SetAll();
-        inline void ToggleAll();
+        void ClearAll();
+        void SetAll();
+        void ToggleAll();
 
         bool AreAllClear() const;
         bool AreAllSet() const;
@@ -44,6 +58,8 @@ namespace data {
 
         bool GetFirstSetBit(size_t &o_bit_index) const;
         bool GetFirstClearBit(size_t &o_bit_index) const;
+        // Finds any clear bit, starting the search where the previous one ended
+        bool FindClearBit(size_t &o_bit_index);
 
         inline bool Get(size_t i_bit_index) const;
         inline size_t Size() const;
@@ -52,8 +68,12 @@ namespace data {
 
     private:
         size_t*                                         buckets_;
+        size_t*                                         full_buckets_;              // one bit per bucket, set when all of the bucket's bits are set
+        size_t*                                         non_empty_buckets_;         // one bit per bucket, set when any of the bucket's bits are set
         size_t                                          num_buckets_;
+        size_t                                          num_summary_buckets_;
         size_t                                          num_bits_;
+        size_t                                          search_hint_;               // summary bucket that FindClearBit starts searching from
         static const size_t                             bit_depth_;
 
     }; // class BitArray
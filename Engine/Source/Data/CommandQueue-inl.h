@@ -0,0 +1,59 @@
+#include "CommandQueue.h"
+
+namespace engine {
+namespace data {
+
+template<class T>
+CommandQueue<T>::CommandQueue() : head_(nullptr)
+{}
+
+template<class T>
+CommandQueue<T>::~CommandQueue()
+{
+    Apply([](T&) {});
+}
+
+template<class T>
+inline void CommandQueue<T>::Push(const T& i_command)
+{
+    Node* node = new Node{ i_command, head_.load(std::memory_order_relaxed) };
+    while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template<class T>
+inline bool CommandQueue<T>::IsEmpty() const
+{
+    return head_.load(std::memory_order_relaxed) == nullptr;
+}
+
+template<class T>
+template<class TFunction>
+inline size_t CommandQueue<T>::Apply(TFunction i_function)
+{
+    // take every command pushed so far, newest first
+    Node* node = head_.exchange(nullptr, std::memory_order_acquire);
+
+    // reverse the list so the commands are applied in the order they were pushed
+    Node* oldest = nullptr;
+    while (node)
+    {
+        Node* next = node->next;
+        node->next = oldest;
+        oldest = node;
+        node = next;
+    }
+
+    size_t num_commands = 0;
+    while (oldest)
+    {
+        Node* next = oldest->next;
+        i_function(oldest->command);
+        delete oldest;
+        oldest = next;
+        ++num_commands;
+    }
+    return num_commands;
+}
+
+} // namespace data
+} // namespace engine
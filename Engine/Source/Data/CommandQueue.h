@@ -0,0 +1,56 @@
+#ifndef COMMAND_QUEUE_H_
+#define COMMAND_QUEUE_H_
+
+// library includes
+#include <atomic>
+#include <stddef.h>
+
+namespace engine {
+namespace data {
+
+/*
+    CommandQueue
+    - A multiple producer, single consumer queue of commands that any thread can push to without taking a lock
+    - Commands are pushed onto an intrusive list with a single compare & swap
+    - The consumer takes the whole list with a single exchange & applies the commands in the order they were pushed,
+      so commands can be queued at any time & applied at a point where nothing else reads the state they change
+*/
+template<class T>
+class CommandQueue
+{
+    struct Node
+    {
+        T                                       command;
+        Node*                                   next;
+    };
+
+public:
+    CommandQueue();
+    // commands that were never applied are dropped
+    ~CommandQueue();
+
+    // any thread
+    inline void Push(const T& i_command);
+    inline bool IsEmpty() const;
+
+    // consumer only, calls i_function on every queued command, oldest first, & returns how many there were
+    template<class TFunction>
+    inline size_t Apply(TFunction i_function);
+
+private:
+    CommandQueue(const CommandQueue&) = delete;
+    CommandQueue(CommandQueue&&) = delete;
+
+    CommandQueue& operator=(const CommandQueue&) = delete;
+    CommandQueue& operator=(CommandQueue&&) = delete;
+
+    std::atomic<Node*>                          head_;                              // the newest command
+
+}; // class CommandQueue
+
+} // namespace data
+} // namespace engine
+
+#include "CommandQueue-inl.h"
+
+#endif // COMMAND_QUEUE_H_
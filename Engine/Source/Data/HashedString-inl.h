@@ -4,7 +4,7 @@
 #include <string.h>
 
 // engine includes
-#include "Assert\Assert.h"
+#include "Assert/Assert.h"
 
 namespace engine {
 namespace data {
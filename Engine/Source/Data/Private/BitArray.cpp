@@ -1,13 +1,12 @@
-#include "Data\BitArray.h"
+#include "Data/BitArray.h"
 
 // library includes
-#include <intrin.h>
 #include <string.h>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Memory\AllocatorOverrides.h"
-#include "Memory\AllocatorUtil.h"
+#include "Assert/Assert.h"
+#include "Memory/AllocatorOverrides.h"
+#include "Memory/AllocatorUtil.h"
 
 namespace engine {
 namespace data {
@@ -15,13 +14,22 @@ namespace data {
     const size_t BitArray::bit_depth_ = sizeof(size_t) * 8;
 
     BitArray::BitArray(size_t i_num_bits, void* i_memory, bool i_start_set) : buckets_(static_cast<size_t*>(i_memory)),
-        num_buckets_(((i_num_bits & (bit_depth_ - 1)) ? 1 : 0) + i_num_bits / bit_depth_),
-        num_bits_(i_num_bits)
+        full_buckets_(nullptr),
+        non_empty_buckets_(nullptr),
+        num_buckets_(GetNumBuckets(i_num_bits)),
+        num_summary_buckets_(GetNumBuckets(num_buckets_)),
+        num_bits_(i_num_bits),
+        search_hint_(0)
     {
         ASSERT(buckets_);
         ASSERT(num_bits_ > 0);
 
+        // the summary follows the buckets
+        full_buckets_ = buckets_ + num_buckets_;
+        non_empty_buckets_ = full_buckets_ + num_summary_buckets_;
+
         memset(buckets_, i_start_set ? ~0 : 0, sizeof(buckets_) * num_buckets_);
+        RebuildSummary();
     }
 
     BitArray* BitArray::Create(size_t i_num_bits, void* i_memory, bool i_start_set)
@@ -42,10 +50,50 @@ namespace data {
     {}
 
     BitArray::BitArray(BitArray&& i_copy) : buckets_(i_copy.buckets_),
+        full_buckets_(i_copy.full_buckets_),
+        non_empty_buckets_(i_copy.non_empty_buckets_),
         num_buckets_(i_copy.num_buckets_),
-        num_bits_(i_copy.num_bits_)
+        num_summary_buckets_(i_copy.num_summary_buckets_),
+        num_bits_(i_copy.num_bits_),
+        search_hint_(i_copy.search_hint_)
     {
         i_copy.buckets_ = nullptr;
+        i_copy.full_buckets_ = nullptr;
+        i_copy.non_empty_buckets_ = nullptr;
+    }
+
+    void BitArray::RebuildSummary()
+    {
+        // summary bits past the last bucket read as full & empty so that searches never stop on them
+        memset(full_buckets_, ~0, sizeof(full_buckets_) * num_summary_buckets_);
+        memset(non_empty_buckets_, 0, sizeof(non_empty_buckets_) * num_summary_buckets_);
+
+        for (size_t i = 0; i < num_buckets_; ++i)
+        {
+            UpdateSummary(i);
+        }
+        search_hint_ = 0;
+    }
+
+    void BitArray::ClearAll()
+    {
+        memset(buckets_, 0, sizeof(buckets_) * num_buckets_);
+        RebuildSummary();
+    }
+
+    void BitArray::SetAll()
+    {
+        memset(buckets_, ~0, sizeof(buckets_) * num_buckets_);
+        RebuildSummary();
+    }
+
+    void BitArray::ToggleAll()
+    {
+        for (size_t i = 0; i < num_buckets_; ++i)
+        {
+            buckets_[i] = ~buckets_[i];
+        }
+        RebuildSummary();
     }
 
     bool BitArray::AreAllClear() const
@@ -78,7 +126,8 @@ namespace data {
         size_t bucket_index = i_bit_index / bit_depth_;
 
         // set the respective bit in the respective bucket
-        buckets_[bucket_index] |= static_cast<size_t>(1) << i_bit_index;
+        buckets_[bucket_index] |= static_cast<size_t>(1) << (i_bit_index % bit_depth_);
+        UpdateSummary(bucket_index);
     }
 
     void BitArray::ClearBit(size_t i_bit_index)
@@ -91,7 +140,8 @@ namespace data {
         size_t bucket_index = i_bit_index / bit_depth_;
 
         // set the respective bit in the respective bucket
-        buckets_[bucket_index] &= ~(static_cast<size_t>(1) << i_bit_index);
+        buckets_[bucket_index] &= ~(static_cast<size_t>(1) << (i_bit_index % bit_depth_));
+        UpdateSummary(bucket_index);
     }
 
     void BitArray::ToggleBit(size_t i_bit_index)
@@ -103,39 +153,24 @@ namespace data {
         // calculate the bucket index
         size_t bucket_index = i_bit_index / bit_depth_;
 
-        buckets_[bucket_index] ^= static_cast<size_t>(1) << i_bit_index;
+        buckets_[bucket_index] ^= static_cast<size_t>(1) << (i_bit_index % bit_depth_);
+        UpdateSummary(bucket_index);
     }
 
     bool BitArray::GetFirstSetBit(size_t &o_bit_index) const
     {
-        size_t bucket_index = 0;
-        unsigned long bit_index_long = 0;
-
-        // quick skip buckets where no bits are set
-        while (buckets_[bucket_index] == 0 && bucket_index < num_buckets_)
+        // quick skip summary buckets where no bucket has a set bit
+        for (size_t summary_index = 0; summary_index < num_summary_buckets_; ++summary_index)
         {
-            ++bucket_index;
-        }
-
-        // were all bits clear?
-        if (bucket_index >= num_buckets_)
-        {
-            return false;
-        }
-
-#if defined(_WIN64)
-        char is_non_zero = _BitScanForward64(&bit_index_long, buckets_[bucket_index]);
-#else
-        char is_non_zero = _BitScanForward(&bit_index_long, buckets_[bucket_index]);
-#endif
-        if (is_non_zero)
-        {
-            size_t new_bit_index = bucket_index * bit_depth_ + bit_index_long;
-            if (new_bit_index < num_bits_)
+            if (non_empty_buckets_[summary_index] == 0)
             {
-                o_bit_index = new_bit_index;
-                return true;
+                continue;
             }
+
+            const size_t bucket_index = summary_index * bit_depth_ + GetLowestSetBit(non_empty_buckets_[summary_index]);
+            o_bit_index = bucket_index * bit_depth_ + GetLowestSetBit(buckets_[bucket_index] & GetValidBitsMask(bucket_index));
+            ASSERT(o_bit_index < num_bits_);
+            return true;
         }
 
         return false;
@@ -143,38 +178,44 @@ namespace data {
 
     bool BitArray::GetFirstClearBit(size_t &o_bit_index) const
     {
-        size_t bucket_index = 0;
-        unsigned long bit_index_long = 0;
-
-        // quick skip buckets where no bits are clear
-        while (buckets_[bucket_index] == ~0 && bucket_index < num_buckets_)
+        // quick skip summary buckets where every bucket is full
+        for (size_t summary_index = 0; summary_index < num_summary_buckets_; ++summary_index)
         {
-            ++bucket_index;
-        }
+            if (full_buckets_[summary_index] == ~static_cast<size_t>(0))
+            {
+                continue;
+            }
 
-        // were all bits set?
-        if (bucket_index >= num_buckets_)
-        {
-            return false;
+            const size_t bucket_index = summary_index * bit_depth_ + GetLowestSetBit(~full_buckets_[summary_index]);
+            o_bit_index = bucket_index * bit_depth_ + GetLowestSetBit(~buckets_[bucket_index] & GetValidBitsMask(bucket_index));
+            ASSERT(o_bit_index < num_bits_);
+            return true;
         }
 
-#if defined(_WIN64)
-        char is_non_zero = _BitScanForward64(&bit_index_long, ~(buckets_[bucket_index]));
-#else
-        char is_non_zero = _BitScanForward(&bit_index_long, ~(buckets_[bucket_index]));
-#endif
-        if (is_non_zero)
+        return false;
+    }
+
+    bool BitArray::FindClearBit(size_t &o_bit_index)
+    {
+        // start at the summary bucket where the last clear bit was found & wrap around
+        size_t summary_index = search_hint_;
+        for (size_t i = 0; i < num_summary_buckets_; ++i)
         {
-            size_t new_bit_index = bucket_index * bit_depth_ + bit_index_long;
-            if (new_bit_index < num_bits_)
+            if (full_buckets_[summary_index] != ~static_cast<size_t>(0))
             {
-                o_bit_index = new_bit_index;
+                const size_t bucket_index = summary_index * bit_depth_ + GetLowestSetBit(~full_buckets_[summary_index]);
+                o_bit_index = bucket_index * bit_depth_ + GetLowestSetBit(~buckets_[bucket_index] & GetValidBitsMask(bucket_index));
+                ASSERT(o_bit_index < num_bits_);
+
+                search_hint_ = summary_index;
                 return true;
             }
+
+            summary_index = (summary_index + 1 < num_summary_buckets_) ? summary_index + 1 : 0;
         }
 
         return false;
-    }   
+    }
 
 } // namespace data
 } // namespace engine
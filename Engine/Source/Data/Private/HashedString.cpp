@@ -1,4 +1,4 @@
-#include "Data\HashedString.h"
+#include "Data/HashedString.h"
 
 namespace engine {
 namespace data {
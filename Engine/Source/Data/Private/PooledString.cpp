@@ -1,4 +1,4 @@
-#include "Data\PooledString.h"
+#include "Data/PooledString.h"
 
 namespace engine {
 namespace data {
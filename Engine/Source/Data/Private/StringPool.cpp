@@ -1,14 +1,14 @@
-#include "Data\StringPool.h"
+#include "Data/StringPool.h"
 
 // library includes
 #include <new> // for placement new
 #include <string.h>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Common\HelperMacros.h"
-#include "Logger\Logger.h"
-#include "Memory\BlockAllocator.h"
+#include "Assert/Assert.h"
+#include "Common/HelperMacros.h"
+#include "Logger/Logger.h"
+#include "Memory/BlockAllocator.h"
 
 namespace engine {
 namespace data {
@@ -88,7 +88,7 @@ const char* StringPool::Add(const char* i_string)
     *string_size = input_string_length;
 
     // copy the string
-    memcpy_s((pool_end_ + sizeof(size_t)), remaining_memory - sizeof(size_t), i_string, input_string_length);
+    memcpy((pool_end_ + sizeof(size_t)), i_string, input_string_length);
 
     // add null-termination
     *(pool_end_ + sizeof(size_t) + input_string_length - 1) = '\0';
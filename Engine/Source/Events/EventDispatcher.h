@@ -7,7 +7,7 @@
 
 // engine includes
 #include "KeyboardEvent.h"
-#include "Memory\SharedPointer.h"
+#include "Memory/SharedPointer.h"
 
 namespace engine {
 namespace events {
@@ -5,7 +5,7 @@
 #include <functional>
 
 // engine includes
-#include "Memory\SharedPointer.h"
+#include "Memory/SharedPointer.h"
 
 namespace engine {
 namespace events {
@@ -1,9 +1,9 @@
-#include "Events\EventDispatcher.h"
+#include "Events/EventDispatcher.h"
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Common\HelperMacros.h"
-#include "Logger\Logger.h"
+#include "Assert/Assert.h"
+#include "Common/HelperMacros.h"
+#include "Logger/Logger.h"
 
 namespace engine {
 namespace events {
@@ -1,4 +1,4 @@
-#include "Events\KeyboardEvent.h"
+#include "Events/KeyboardEvent.h"
 
 namespace engine {
 namespace events {
@@ -1,4 +1,4 @@
-#include "Events\TimerEvent.h"
+#include "Events/TimerEvent.h"
 
 namespace engine {
 namespace events {
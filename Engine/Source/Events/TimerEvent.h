@@ -6,7 +6,7 @@
 #include <stdint.h>
 
 // engine includes
-#include "Memory\SharedPointer.h"
+#include "Memory/SharedPointer.h"
 
 namespace engine {
 
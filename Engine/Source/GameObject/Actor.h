@@ -2,18 +2,19 @@
 #define ACTOR_H_
 
 // engine includes
-#include "Data\HashedString.h"
-#include "Data\PooledString.h"
-#include "GameObject\GameObject.h"
-#include "Memory\SharedPointer.h"
-#include "Memory\WeakPointer.h"
-#include "Physics\PhysicsObject.h"
-#include "Renderer\RenderableObject.h"
+#include "Data/HashedString.h"
+#include "Data/PooledString.h"
+#include "GameObject/GameObject.h"
+#include "Memory/RefCounted.h"
+#include "Memory/SharedPointer.h"
+#include "Memory/WeakPointer.h"
+#include "Physics/PhysicsObject.h"
+#include "Renderer/RenderableObject.h"
 
 namespace engine {
 namespace gameobject {
 
-class Actor
+class Actor : public engine::memory::RefCounted
 {
 public:
     inline static engine::memory::SharedPointer<Actor> Create();
@@ -6,13 +6,13 @@
 #include <vector>
 
 // engine includes
-#include "Data\PooledString.h"
-#include "GameObject\Actor.h"
-#include "Memory\SharedPointer.h"
-#include "Memory\WeakPointer.h"
-#include "Physics\Physics.h"
-#include "Renderer\Renderer.h"
-#include "Util\FileUtils.h"
+#include "Data/PooledString.h"
+#include "GameObject/Actor.h"
+#include "Memory/SharedPointer.h"
+#include "Memory/WeakPointer.h"
+#include "Physics/Physics.h"
+#include "Renderer/Renderer.h"
+#include "Util/FileUtils.h"
 
 // forward declarations
 struct lua_State;
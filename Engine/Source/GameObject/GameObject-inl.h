@@ -13,6 +13,7 @@ inline GameObject& GameObject::operator=(const GameObject& i_game_object)
     if (this != &i_game_object)
     {
         transform_ = i_game_object.transform_;
+        previous_position_ = i_game_object.previous_position_;
         aabb_ = i_game_object.aabb_;
         owner_ = i_game_object.owner_;
     }
@@ -27,6 +28,7 @@ inline const engine::math::Transform& GameObject::GetTransform() const
 inline void GameObject::SetTransform(const engine::math::Transform& i_transform)
 {
     transform_ = i_transform;
+    previous_position_ = transform_.GetPosition();
 }
 
 inline const engine::math::Vec3D& GameObject::GetPosition() const
@@ -37,6 +39,22 @@ inline const engine::math::Vec3D& GameObject::GetPosition() const
 inline void GameObject::SetPosition(const engine::math::Vec3D& i_position)
 {
     transform_.SetPosition(i_position);
+    previous_position_ = i_position;
+}
+
+inline const engine::math::Vec3D& GameObject::GetPreviousPosition() const
+{
+    return previous_position_;
+}
+
+inline void GameObject::SetPreviousPosition(const engine::math::Vec3D& i_previous_position)
+{
+    previous_position_ = i_previous_position;
+}
+
+inline engine::math::Vec3D GameObject::GetInterpolatedPosition(float i_interpolation) const
+{
+    return previous_position_ + (transform_.GetPosition() - previous_position_) * i_interpolation;
 }
 
 inline const engine::math::Vec3D& GameObject::GetRotation() const
@@ -2,10 +2,11 @@
 #define ENGINE_GAME_OBJECT_H_
 
 // engine includes
-#include "Math\AABB.h"
-#include "Math\Transform.h"
-#include "Memory\SharedPointer.h"
-#include "Memory\WeakPointer.h"
+#include "Math/AABB.h"
+#include "Math/Transform.h"
+#include "Memory/RefCounted.h"
+#include "Memory/SharedPointer.h"
+#include "Memory/WeakPointer.h"
 
 namespace engine {
 namespace gameobject {
@@ -16,8 +17,9 @@ class Actor;
 /*
     GameObject
     - A simple class that uses a transform to represent an object in space.
+    - Reference counted intrusively, so its shared pointers don't need a separate counter allocation
 */
-class GameObject
+class GameObject : public engine::memory::RefCounted
 {
 public:
     inline static engine::memory::SharedPointer<GameObject> Create(const engine::math::AABB& i_aabb = engine::math::AABB::ZERO,
@@ -26,7 +28,9 @@ public:
 
     // copy constructor
     GameObject(const GameObject& i_copy) : 
+        engine::memory::RefCounted(),
         transform_(i_copy.transform_),
+        previous_position_(i_copy.previous_position_),
         aabb_(i_copy.aabb_),
         owner_(i_copy.owner_)
     {}
@@ -37,9 +41,15 @@ public:
     inline const engine::math::Transform& GetTransform() const;
     inline void SetTransform(const engine::math::Transform& i_transform);
 
+    // setting the position or the transform moves the object instantly, without interpolation
     inline const engine::math::Vec3D& GetPosition() const;
     inline void SetPosition(const engine::math::Vec3D& i_position);
 
+    // the position before the last physics step, rendering interpolates from there to the current position
+    inline const engine::math::Vec3D& GetPreviousPosition() const;
+    inline void SetPreviousPosition(const engine::math::Vec3D& i_previous_position);
+    inline engine::math::Vec3D GetInterpolatedPosition(float i_interpolation) const;
+
     inline const engine::math::Vec3D& GetRotation() const;
     inline void SetRotation(const engine::math::Vec3D& i_rotation);
 
@@ -57,12 +67,14 @@ private:
         const engine::math::Transform& i_transform = engine::math::Transform::ZERO,
         const engine::memory::WeakPointer<Actor>& i_owner = nullptr) :
             transform_(i_transform),
+            previous_position_(i_transform.GetPosition()),
             aabb_(i_aabb),
             owner_(i_owner)
     {}
 
 private:
     engine::math::Transform                 transform_;
+    engine::math::Vec3D                     previous_position_;
     engine::math::AABB                      aabb_;
     engine::memory::WeakPointer<Actor>      owner_;
 }; // class GameObject
@@ -2,7 +2,7 @@
 #define ENGINE_GAME_OBJECT_CONTROLLER_H_
 
 // engine includes
-#include "Memory\SharedPointer.h"
+#include "Memory/SharedPointer.h"
 
 namespace engine {
 namespace gameobject {
@@ -1,8 +1,8 @@
-#include "GameObject\Actor.h"
+#include "GameObject/Actor.h"
 
 // engine includes
-#include "Physics\Physics.h"
-#include "Renderer\Renderer.h"
+#include "Physics/Physics.h"
+#include "Renderer/Renderer.h"
 
 namespace engine {
 namespace gameobject {
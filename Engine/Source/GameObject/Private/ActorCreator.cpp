@@ -1,15 +1,15 @@
-#include "GameObject\ActorCreator.h"
+#include "GameObject/ActorCreator.h"
 
 // external includes
 #include "lua.hpp"
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Data\PooledString.h"
-#include "Jobs\FileLoadJob.h"
-#include "Jobs\JobSystem.h"
-#include "Util\FileUtils.h"
-#include "Util\LuaHelper.h"
+#include "Assert/Assert.h"
+#include "Data/PooledString.h"
+#include "Jobs/FileLoadJob.h"
+#include "Jobs/JobSystem.h"
+#include "Util/FileUtils.h"
+#include "Util/LuaHelper.h"
 
 namespace engine {
 namespace gameobject {
@@ -203,7 +203,7 @@ bool ActorCreator::CreatePhysicsObject(lua_State* i_lua_state, const engine::mem
 
     bool has_physics = false;
     float physics_mass = 0.0f, physics_drag = 0.0f;
-    static engine::data::HashedString types[3] = { "static", "kinematic", "dynamic" };
+    static engine::data::HashedString types[3] = { engine::data::HashedString("static"), engine::data::HashedString("kinematic"), engine::data::HashedString("dynamic") };
 
     if (type == LUA_TTABLE)
     {
@@ -216,7 +216,10 @@ bool ActorCreator::CreatePhysicsObject(lua_State* i_lua_state, const engine::mem
         float drag = engine::util::LuaHelper::CreateFloat(i_lua_state, "drag");
 
         bool is_collidable = engine::util::LuaHelper::CreateBool(i_lua_state, "collide");
-        uint16_t collision_filter = 1 << (engine::util::LuaHelper::CreateInt(i_lua_state, "collision_filter") % 16);
+        // actors collide with their own layer, unless they have a mask of the layers they collide with
+        const uint16_t collision_category = engine::physics::GetCollisionCategory(uint8_t(engine::util::LuaHelper::CreateInt(i_lua_state, "collision_filter") % MAX_COLLISION_LAYERS));
+        const uint16_t collision_mask = uint16_t(engine::util::LuaHelper::CreateInt(i_lua_state, "collision_mask"));
+        const engine::physics::CollisionFilter collision_filter = { collision_category, collision_mask != 0 ? collision_mask : collision_category };
 
         o_physics_object = engine::physics::Physics::Get()->CreatePhysicsObject(i_game_object, mass, drag, type, collision_filter, is_collidable);
     }
@@ -4,8 +4,8 @@
 #include <algorithm>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Logger\Logger.h"
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
 
 namespace engine {
 namespace input {
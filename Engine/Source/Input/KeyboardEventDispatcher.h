@@ -6,7 +6,7 @@
 
 // engine includes
 #include "KeyboardEvent.h"
-#include "Memory\SharedPointer.h"
+#include "Memory/SharedPointer.h"
 
 namespace engine {
 namespace input {
@@ -1,17 +1,14 @@
-#include "Input\Input.h"
+#include "Input/Input.h"
 
 // engine includes
-#include "GLib.h"
-#include "Events\EventDispatcher.h"
+#include "Events/EventDispatcher.h"
 
 namespace engine {
 namespace input {
 
 bool StartUp()
 {
-    // register the key callback
-    GLib::SetKeyStateChangeCallback(engine::input::KeyCallback);
-
+    // key presses are fed to KeyCallback by the render backend's window, if it has one
     return true;
 }
 
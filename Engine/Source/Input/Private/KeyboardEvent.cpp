@@ -1,4 +1,4 @@
-#include "Input\KeyboardEvent.h"
+#include "Input/KeyboardEvent.h"
 
 namespace engine {
 namespace input {
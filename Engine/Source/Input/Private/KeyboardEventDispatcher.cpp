@@ -1,7 +1,7 @@
-#include "Input\KeyboardEventDispatcher.h"
+#include "Input/KeyboardEventDispatcher.h"
 
 // engine includes
-#include "Common\HelperMacros.h"
+#include "Common/HelperMacros.h"
 
 namespace engine {
 namespace input {
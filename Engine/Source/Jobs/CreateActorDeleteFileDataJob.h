@@ -5,11 +5,11 @@
 #include <functional>
 
 // engine includes
-#include "GameObject\Actor.h"
-#include "GameObject\ActorCreator.h"
-#include "Jobs\InterfaceJob.h"
-#include "Memory\SharedPointer.h"
-#include "Util\FileUtils.h"
+#include "GameObject/Actor.h"
+#include "GameObject/ActorCreator.h"
+#include "Jobs/InterfaceJob.h"
+#include "Memory/SharedPointer.h"
+#include "Util/FileUtils.h"
 
 namespace engine {
 namespace jobs {
@@ -1,7 +1,7 @@
 #include "CreateActorFromFileAtPositionJob.h"
 
 // engine includes
-#include "Assert\Assert.h"
+#include "Assert/Assert.h"
 
 namespace engine {
 namespace jobs {
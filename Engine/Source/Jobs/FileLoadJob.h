@@ -5,9 +5,9 @@
 #include <functional>
 
 // engine includes
-#include "Data\PooledString.h"
-#include "Jobs\InterfaceJob.h"
-#include "Util\FileUtils.h"
+#include "Data/PooledString.h"
+#include "Jobs/InterfaceJob.h"
+#include "Util/FileUtils.h"
 
 namespace engine {
 namespace jobs {
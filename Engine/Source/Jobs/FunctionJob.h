@@ -0,0 +1,41 @@
+#ifndef FUNCTION_JOB_H_
+#define FUNCTION_JOB_H_
+
+// library includes
+#include <functional>
+
+// engine includes
+#include "Data/PooledString.h"
+#include "Jobs/InterfaceJob.h"
+
+namespace engine {
+namespace jobs {
+
+/*
+    FunctionJob
+    - A job that simply calls a function
+    - Handy for small continuations that don't deserve a job class of their own
+*/
+class FunctionJob : public InterfaceJob
+{
+public:
+    FunctionJob(const std::function<void(void)>& i_function, const engine::data::PooledString& i_name = "FunctionJob");
+    ~FunctionJob();
+
+    // implement InterfaceJob
+    void DoWork() override;
+
+private:
+    FunctionJob(const FunctionJob&) = delete;
+    FunctionJob(FunctionJob&&) = delete;
+
+    FunctionJob& operator=(const FunctionJob&) = delete;
+    FunctionJob& operator=(FunctionJob&&) = delete;
+
+    std::function<void(void)>                                                   function_;
+};
+
+} // namespace jobs
+} // namespace engine
+
+#endif // FUNCTION_JOB_H_
@@ -2,7 +2,8 @@
 #define INTERFACE_JOB_H_
 
 // engine includes
-#include "Data\PooledString.h"
+#include "Data/PooledString.h"
+#include "Jobs/JobCounter.h"
 
 namespace engine {
 namespace jobs {
@@ -14,6 +15,9 @@ public:
     virtual ~InterfaceJob() {};
 
     virtual void DoWork() = 0;
+    // called once the job system is done with a job, whether it ran or not
+    // jobs that don't live on their own on the heap override this
+    virtual void Release() { delete this; }
 
     inline const engine::data::PooledString& GetName() const { return name_; }
     inline void SetName(const engine::data::PooledString& i_name) { name_ = i_name; }
@@ -21,6 +25,11 @@ public:
 protected:
     engine::data::PooledString name_;
 
+private:
+    JobHandle counter_;                 // the counter this job is counted against, if any
+
+    friend class JobSystem;
+
 }; // class InterfaceJob
 
 } // namespace jobs
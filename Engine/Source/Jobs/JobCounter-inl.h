@@ -0,0 +1,38 @@
+#include "JobCounter.h"
+
+// engine includes
+#include "Assert/Assert.h"
+
+namespace engine {
+namespace jobs {
+
+inline JobHandle JobCounter::Create()
+{
+    return engine::memory::MakeShared<JobCounter>();
+}
+
+inline int32_t JobCounter::GetNumPending() const
+{
+    return num_pending_.load(std::memory_order_acquire);
+}
+
+inline bool JobCounter::IsDone() const
+{
+    return GetNumPending() == 0;
+}
+
+inline void JobCounter::Increment(int32_t i_count)
+{
+    num_pending_.fetch_add(i_count, std::memory_order_relaxed);
+}
+
+inline bool JobCounter::Decrement()
+{
+    // acquire-release so whoever sees zero also sees the work of every job counted against this counter
+    const int32_t num_pending = num_pending_.fetch_sub(1, std::memory_order_acq_rel);
+    ASSERT(num_pending > 0);
+    return num_pending == 1;
+}
+
+} // namespace jobs
+} // namespace engine
@@ -0,0 +1,73 @@
+#ifndef JOB_COUNTER_H_
+#define JOB_COUNTER_H_
+
+// library includes
+#include <atomic>
+#include <mutex>
+#include <stdint.h>
+#include <vector>
+
+// engine includes
+#include "Data/PooledString.h"
+#include "Memory/SharedPointer.h"
+
+namespace engine {
+namespace jobs {
+
+// forward declarations
+class InterfaceJob;
+class JobCounter;
+
+typedef engine::memory::SharedPointer<JobCounter> JobHandle;
+
+/*
+    JobCounter
+    - Counts the jobs of a group that haven't finished yet
+    - JobSystem::AddJob counts a job against a counter & the counter drops by one once that job has finished
+    - Jobs added with JobSystem::AddJobAfter are held by the counter they depend on until it drops to zero,
+      at which point they are added to their teams by whichever thread finished the last job
+    - JobSystem::Wait lets the calling thread run the team's jobs until a counter drops to zero
+    - Counters are always shared through a JobHandle, create one with JobCounter::Create
+*/
+class JobCounter
+{
+    struct Continuation
+    {
+        InterfaceJob*                       job_;
+        engine::data::PooledString          team_name_;
+    };
+
+public:
+    JobCounter();
+    ~JobCounter();
+
+    static inline JobHandle Create();
+
+    inline int32_t GetNumPending() const;
+    inline bool IsDone() const;
+
+private:
+    JobCounter(const JobCounter&) = delete;
+    JobCounter(JobCounter&&) = delete;
+
+    JobCounter& operator=(const JobCounter&) = delete;
+    JobCounter& operator=(JobCounter&&) = delete;
+
+    inline void Increment(int32_t i_count = 1);
+    // returns true when the last pending job has finished
+    inline bool Decrement();
+
+    std::atomic<int32_t>                        num_pending_;
+    std::mutex                                  continuations_mutex_;
+    std::vector<Continuation>                   continuations_;                     // jobs waiting for this counter to drop to zero
+
+    friend class JobSystem;
+
+}; // class JobCounter
+
+} // namespace jobs
+} // namespace engine
+
+#include "JobCounter-inl.h"
+
+#endif // JOB_COUNTER_H_
@@ -5,7 +5,7 @@ namespace jobs {
 
 inline void JobQueue::RequestShutdown()
 {
-    std::lock_guard<std::mutex> lock(shutdown_mutex_);
+    std::lock_guard<std::mutex> lock(queue_mutex_);
     shutdown_requested_ = true;
     start_searching_.notify_all();
 }
@@ -15,6 +15,11 @@ inline bool JobQueue::HasShutdownBeenRequested() const
     return shutdown_requested_;
 }
 
+inline SchedulingPolicy JobQueue::GetPolicy() const
+{
+    return policy_;
+}
+
 inline const engine::data::PooledString& JobQueue::GetID() const
 {
     return id_;
@@ -2,31 +2,58 @@
 #define JOB_QUEUE_H_
 
 // library includes
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
+#include <vector>
 
 // engine includes
-#include "Data\PooledString.h"
+#include "Data/PooledString.h"
 
 namespace engine {
 namespace jobs {
 
-// forward declaration
+// forward declarations
 class InterfaceJob;
+class WorkStealingQueue;
 
+#define JOB_QUEUE_REFILL_BATCH_SIZE 32
+
+enum class SchedulingPolicy : uint8_t
+{
+    SharedQueue = 0,                    // every worker takes jobs from the team's queue
+    WorkStealing                        // every worker has its own deque & steals from its peers when it runs dry
+};
+
+/*
+    JobQueue
+    - Holds the jobs of a team until its workers pick them up
+    - With the SharedQueue policy, all jobs go through a single queue behind one mutex
+    - With the WorkStealing policy, every worker also owns a WorkStealingQueue:
+        - Jobs added from one of the team's workers go onto that worker's own deque without taking a lock
+        - Jobs added from any other thread go onto the shared queue, which workers drain in batches into their deques
+        - An idle worker steals from its peers before it goes to sleep
+*/
 class JobQueue
 {
 public:
-    JobQueue(const engine::data::PooledString& i_id);
+    JobQueue(const engine::data::PooledString& i_id, SchedulingPolicy i_policy = SchedulingPolicy::SharedQueue, size_t i_num_workers = 0);
     ~JobQueue();
 
     bool AddJob(InterfaceJob* i_new_job);
-    InterfaceJob* GetJob();
+    // adds all the jobs with a single lock & wakes as many workers as needed at once
+    bool AddJobs(InterfaceJob* const* i_new_jobs, size_t i_num_jobs);
+    // blocks until there is a job for the worker at i_worker_index or shutdown has been requested
+    InterfaceJob* GetJob(size_t i_worker_index = 0);
+    // returns a job if one can be found right away, never blocks
+    InterfaceJob* TryGetJob();
 
     inline void RequestShutdown();
     inline bool HasShutdownBeenRequested() const;
 
+    inline SchedulingPolicy GetPolicy() const;
+
     inline const engine::data::PooledString& GetID() const;
     inline void SetID(const engine::data::PooledString& i_id);
 
@@ -37,15 +64,27 @@ private:
     JobQueue& operator=(const JobQueue&) = delete;
     JobQueue& operator=(JobQueue&&) = delete;
 
+    InterfaceJob* GetSharedJob();
+    InterfaceJob* GetStolenJob(size_t i_worker_index);
+    InterfaceJob* RefillFromSharedQueue(size_t i_worker_index);
+    void WakeWorker(size_t i_num_jobs = 1);
+
     engine::data::PooledString                  id_;
     std::condition_variable                     start_searching_;
 
-    std::mutex                                  shutdown_mutex_;
-    bool                                        shutdown_requested_;
+    std::atomic<bool>                           shutdown_requested_;
 
     std::mutex                                  queue_mutex_;
     std::queue<InterfaceJob*>                   job_queue_;
 
+    SchedulingPolicy                            policy_;
+    std::vector<WorkStealingQueue*>             local_queues_;                      // one deque per worker, work stealing only
+    std::atomic<size_t>                         num_queued_jobs_;                   // jobs in the shared queue & all deques, work stealing only
+    std::atomic<size_t>                         num_sleeping_workers_;              // workers waiting for jobs, work stealing only
+
+    static thread_local JobQueue*               current_queue_;                     // the queue the calling thread works for, if any
+    static thread_local size_t                  current_worker_index_;              // the calling thread's index within current_queue_
+
 }; // class JobQueue
 
 } // namespace jobs
@@ -53,4 +92,4 @@ private:
 
 #include "JobQueue-inl.h"
 
-#endif // JOB_QUEUE_H_
\ No newline at end of file
+#endif // JOB_QUEUE_H_
@@ -2,12 +2,15 @@
 #define JOB_SYSTEM_H_
 
 // library includes
+#include <functional>
 #include <map>
 #include <vector>
 
 // engine includes
-#include "Data\HashedString.h"
-#include "Data\PooledString.h"
+#include "Data/HashedString.h"
+#include "Data/PooledString.h"
+#include "Jobs/JobCounter.h"
+#include "Jobs/JobQueue.h"
 
 // TODO: Figure out why winspool conflicts and handle this more gracefully
 #undef AddJob
@@ -17,9 +20,14 @@ namespace jobs {
 
 // forward declarations
 class InterfaceJob;
-class JobQueue;
 class Worker;
 
+/*
+    JobSystem
+    - Owns the teams of workers & the job queue of each team
+    - Jobs can be counted against a JobCounter & added after another JobCounter drops to zero,
+      which lets a group of jobs run as a graph of dependencies instead of chaining callbacks
+*/
 class JobSystem
 {
     struct Team
@@ -34,8 +42,18 @@ public:
     static void Destroy();
     static inline JobSystem* Get() { return JobSystem::instance_; }
 
-    bool CreateTeam(const engine::data::PooledString& i_team_name, const size_t num_workers);
-    bool AddJob(InterfaceJob* i_job, const engine::data::PooledString& i_team_name);
+    bool CreateTeam(const engine::data::PooledString& i_team_name, const size_t num_workers, SchedulingPolicy i_policy = SchedulingPolicy::SharedQueue);
+    // adds a job to a team, the job is counted against i_counter until it has finished
+    bool AddJob(InterfaceJob* i_job, const engine::data::PooledString& i_team_name, const JobHandle& i_counter = nullptr);
+    // adds a batch of jobs to a team with a single lock, every job is counted against i_counter until it has finished
+    bool AddJobs(InterfaceJob* const* i_jobs, size_t i_num_jobs, const engine::data::PooledString& i_team_name, const JobHandle& i_counter = nullptr);
+    // adds a job to a team once i_dependency has dropped to zero, the job is counted against i_counter right away
+    bool AddJobAfter(InterfaceJob* i_job, const engine::data::PooledString& i_team_name, const JobHandle& i_dependency, const JobHandle& i_counter = nullptr);
+    // runs the team's jobs on the calling thread until i_counter drops to zero, returns false if the team was shutdown first
+    bool Wait(const JobHandle& i_counter, const engine::data::PooledString& i_team_name);
+    // splits [i_begin, i_end) into chunks of i_grain_size & calls i_function(chunk_begin, chunk_end) for each of them
+    // the team's workers help the calling thread, which returns once every chunk is done
+    void ParallelFor(size_t i_begin, size_t i_end, size_t i_grain_size, const std::function<void(size_t, size_t)>& i_function, const engine::data::PooledString& i_team_name);
     void Shutdown();
 
 private:
@@ -49,6 +67,13 @@ private:
     JobSystem& operator=(const JobSystem&) = delete;
     JobSystem& operator=(JobSystem&&) = delete;
 
+    // runs & releases a job, then updates the counter it was counted against
+    static void RunJob(InterfaceJob* i_job);
+    // updates a counter & adds the jobs waiting for it once it drops to zero
+    static void FinishJob(const JobHandle& i_counter);
+
+    friend class Worker;
+
     std::map<engine::data::HashedString, Team*>                             teams_;
     bool                                                                    shutdown_requested_;
 
@@ -0,0 +1,26 @@
+#include "ParallelForJob.h"
+
+// engine includes
+#include "Assert/Assert.h"
+
+namespace engine {
+namespace jobs {
+
+inline bool ParallelForBatch::IsDone() const
+{
+    return num_chunks_done_.load(std::memory_order_acquire) == num_chunks_;
+}
+
+inline size_t ParallelForBatch::GetNumHelpers() const
+{
+    return num_helpers_;
+}
+
+inline ParallelForJob* ParallelForBatch::GetHelper(size_t i_index)
+{
+    ASSERT(i_index < num_helpers_);
+    return &helpers_[i_index];
+}
+
+} // namespace jobs
+} // namespace engine
@@ -0,0 +1,91 @@
+#ifndef PARALLEL_FOR_JOB_H_
+#define PARALLEL_FOR_JOB_H_
+
+// library includes
+#include <atomic>
+#include <functional>
+
+// engine includes
+#include "Jobs/InterfaceJob.h"
+
+// most jobs that can help a single parallel loop
+#define PARALLEL_FOR_MAX_HELPERS                16
+
+namespace engine {
+namespace jobs {
+
+// forward declarations
+class ParallelForBatch;
+
+/*
+    ParallelForJob
+    - Helps the caller of JobSystem::ParallelFor by running chunks of its loop until there are none left
+    - Lives inline in a ParallelForBatch, so a parallel loop costs a single allocation no matter how many workers help
+*/
+class ParallelForJob : public InterfaceJob
+{
+public:
+    ParallelForJob();
+    ~ParallelForJob();
+
+    // implement InterfaceJob
+    void DoWork() override;
+    // lets go of the batch instead of deleting this job
+    void Release() override;
+
+private:
+    ParallelForJob(const ParallelForJob&) = delete;
+    ParallelForJob(ParallelForJob&&) = delete;
+
+    ParallelForJob& operator=(const ParallelForJob&) = delete;
+    ParallelForJob& operator=(ParallelForJob&&) = delete;
+
+    ParallelForBatch*                           batch_;
+
+    friend class ParallelForBatch;
+};
+
+/*
+    ParallelForBatch
+    - The state shared by the caller of JobSystem::ParallelFor & the jobs that help it
+    - Chunks are claimed from an atomic index, so the caller only ever runs its own loop while it waits
+    - Deleted by whoever lets go of it last, so helpers that only start after the loop has finished simply let go
+*/
+class ParallelForBatch
+{
+public:
+    ParallelForBatch(size_t i_begin, size_t i_end, size_t i_grain_size, const std::function<void(size_t, size_t)>& i_function, size_t i_num_helpers);
+    ~ParallelForBatch();
+
+    // claims & runs chunks until there are none left to claim
+    void RunChunks();
+    // lets go of the batch, the last one to let go deletes it
+    void Release();
+
+    inline bool IsDone() const;
+    inline size_t GetNumHelpers() const;
+    inline ParallelForJob* GetHelper(size_t i_index);
+
+private:
+    ParallelForBatch(const ParallelForBatch&) = delete;
+    ParallelForBatch& operator=(const ParallelForBatch&) = delete;
+
+    const std::function<void(size_t, size_t)>*  function_;                          // only valid until the last chunk is done
+    size_t                                      begin_;
+    size_t                                      end_;
+    size_t                                      grain_size_;
+    size_t                                      num_chunks_;
+    size_t                                      num_helpers_;
+    std::atomic<size_t>                         next_chunk_;                        // the next chunk to be claimed
+    std::atomic<size_t>                         num_chunks_done_;
+    std::atomic<size_t>                         num_references_;                    // the caller & every helper that was handed out
+    ParallelForJob                              helpers_[PARALLEL_FOR_MAX_HELPERS];
+
+}; // class ParallelForBatch
+
+} // namespace jobs
+} // namespace engine
+
+#include "ParallelForJob-inl.h"
+
+#endif // PARALLEL_FOR_JOB_H_
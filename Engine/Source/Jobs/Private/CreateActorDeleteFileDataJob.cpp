@@ -1,4 +1,4 @@
-#include "Jobs\CreateActorDeleteFileDataJob.h"
+#include "Jobs/CreateActorDeleteFileDataJob.h"
 
 namespace engine {
 namespace jobs {
@@ -1,4 +1,4 @@
-#include "Jobs\CreateActorFromFileAtPositionJob.h"
+#include "Jobs/CreateActorFromFileAtPositionJob.h"
 
 namespace engine {
 namespace jobs {
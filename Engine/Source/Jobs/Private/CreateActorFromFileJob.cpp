@@ -1,4 +1,4 @@
-#include "Jobs\CreateActorFromFileJob.h"
+#include "Jobs/CreateActorFromFileJob.h"
 
 namespace engine {
 namespace jobs {
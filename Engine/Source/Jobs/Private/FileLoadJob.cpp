@@ -1,7 +1,7 @@
-#include "Jobs\FileLoadJob.h"
+#include "Jobs/FileLoadJob.h"
 
 // engine includes
-#include "Util\FileUtils.h"
+#include "Util/FileUtils.h"
 
 namespace engine {
 namespace jobs {
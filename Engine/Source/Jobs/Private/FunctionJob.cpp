@@ -0,0 +1,27 @@
+#include "Jobs/FunctionJob.h"
+
+// engine includes
+#include "Assert/Assert.h"
+
+namespace engine {
+namespace jobs {
+
+FunctionJob::FunctionJob(const std::function<void(void)>& i_function, const engine::data::PooledString& i_name) :
+    function_(i_function)
+{
+    // validate inputs
+    ASSERT(function_);
+
+    SetName(i_name);
+}
+
+FunctionJob::~FunctionJob()
+{}
+
+void FunctionJob::DoWork()
+{
+    function_();
+}
+
+} // namespace jobs
+} // namespace engine
@@ -0,0 +1,30 @@
+#include "Jobs/JobCounter.h"
+
+// engine includes
+#include "Jobs/InterfaceJob.h"
+#include "Logger/Logger.h"
+
+namespace engine {
+namespace jobs {
+
+JobCounter::JobCounter() : num_pending_(0)
+{}
+
+JobCounter::~JobCounter()
+{
+    // continuations are only left behind when the jobs they were waiting for were dropped at shutdown
+#ifdef BUILD_DEBUG
+    if (continuations_.size() > 0)
+    {
+        LOG("JobCounter deleted %zu continuations that never ran.", continuations_.size());
+    }
+#endif
+    for (Continuation& continuation : continuations_)
+    {
+        continuation.job_->Release();
+    }
+    continuations_.clear();
+}
+
+} // namespace jobs
+} // namespace engine
@@ -1,16 +1,36 @@
-#include "Jobs\JobQueue.h"
+#include "Jobs/JobQueue.h"
+
+// library includes
+#include <thread>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Jobs\InterfaceJob.h"
-#include "Logger\Logger.h"
+#include "Assert/Assert.h"
+#include "Jobs/InterfaceJob.h"
+#include "Jobs/WorkStealingQueue.h"
+#include "Logger/Logger.h"
 
 namespace engine {
 namespace jobs {
 
-JobQueue::JobQueue(const engine::data::PooledString& i_id) : id_(i_id),
-    shutdown_requested_(false)
+// static member initialization
+thread_local JobQueue* JobQueue::current_queue_ = nullptr;
+thread_local size_t JobQueue::current_worker_index_ = 0;
+
+JobQueue::JobQueue(const engine::data::PooledString& i_id, SchedulingPolicy i_policy, size_t i_num_workers) : id_(i_id),
+    shutdown_requested_(false),
+    policy_(i_policy),
+    num_queued_jobs_(0),
+    num_sleeping_workers_(0)
 {
+    if (policy_ == SchedulingPolicy::WorkStealing)
+    {
+        ASSERT(i_num_workers > 0);
+        local_queues_.reserve(i_num_workers);
+        for (size_t i = 0; i < i_num_workers; ++i)
+        {
+            local_queues_.push_back(new WorkStealingQueue());
+        }
+    }
     VERBOSE("JobQueue-%s created.", id_.GetString());
 }
 
@@ -24,9 +44,23 @@ JobQueue::~JobQueue()
 #ifdef BUILD_DEBUG
         ++num_unfinished_jobs;
 #endif
-        delete job_queue_.front();
+        job_queue_.front()->Release();
         job_queue_.pop();
     }
+
+    for (WorkStealingQueue* local_queue : local_queues_)
+    {
+        for (InterfaceJob* job = local_queue->Pop(); job != nullptr; job = local_queue->Pop())
+        {
+#ifdef BUILD_DEBUG
+            ++num_unfinished_jobs;
+#endif
+            job->Release();
+        }
+        delete local_queue;
+    }
+    local_queues_.clear();
+
 #ifdef BUILD_DEBUG
     if (num_unfinished_jobs > 0)
     {
@@ -41,9 +75,12 @@ bool JobQueue::AddJob(InterfaceJob* i_new_job)
     // validate inputs
     ASSERT(i_new_job);
 
-    bool result = false;
+    if (shutdown_requested_)
+    {
+        return false;
+    }
 
-    if (shutdown_requested_ == false)
+    if (policy_ == SchedulingPolicy::SharedQueue)
     {
         {
             std::lock_guard<std::mutex> lock(queue_mutex_);
@@ -52,46 +89,268 @@ bool JobQueue::AddJob(InterfaceJob* i_new_job)
             VERBOSE("\t\tJobQueue-%s added a new job:%s and now has a total of %zu jobs", id_.GetString(), i_new_job->GetName().GetString(), job_queue_.size());
 #endif
         }
-        result = true;
         start_searching_.notify_one();
+        return true;
     }
 
-    return result;
+    // count the job before it becomes visible so the count never drops below the number of jobs that can be found
+    num_queued_jobs_.fetch_add(1);
+
+    // the team's own workers push onto their deques, everyone else goes through the shared queue
+    if (current_queue_ != this || !local_queues_[current_worker_index_]->Push(i_new_job))
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        job_queue_.push(i_new_job);
+    }
+
+    WakeWorker();
+    return true;
 }
 
-InterfaceJob* JobQueue::GetJob()
+bool JobQueue::AddJobs(InterfaceJob* const* i_new_jobs, size_t i_num_jobs)
+{
+    // validate inputs
+    ASSERT(i_new_jobs || i_num_jobs == 0);
+
+    if (shutdown_requested_)
+    {
+        return false;
+    }
+
+    if (i_num_jobs == 0)
+    {
+        return true;
+    }
+
+    if (policy_ == SchedulingPolicy::SharedQueue)
+    {
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            for (size_t i = 0; i < i_num_jobs; ++i)
+            {
+                ASSERT(i_new_jobs[i]);
+                job_queue_.push(i_new_jobs[i]);
+            }
+#ifdef BUILD_DEBUG
+            VERBOSE("\t\tJobQueue-%s added %zu new jobs and now has a total of %zu jobs", id_.GetString(), i_num_jobs, job_queue_.size());
+#endif
+        }
+        if (i_num_jobs > 1)
+        {
+            start_searching_.notify_all();
+        }
+        else
+        {
+            start_searching_.notify_one();
+        }
+        return true;
+    }
+
+    // count the jobs before they become visible so the count never drops below the number of jobs that can be found
+    num_queued_jobs_.fetch_add(i_num_jobs);
+
+    // the team's own workers push onto their deques until they fill up, the rest go through the shared queue
+    size_t num_pushed = 0;
+    if (current_queue_ == this)
+    {
+        while (num_pushed < i_num_jobs && local_queues_[current_worker_index_]->Push(i_new_jobs[num_pushed]))
+        {
+            ++num_pushed;
+        }
+    }
+    if (num_pushed < i_num_jobs)
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        for (size_t i = num_pushed; i < i_num_jobs; ++i)
+        {
+            ASSERT(i_new_jobs[i]);
+            job_queue_.push(i_new_jobs[i]);
+        }
+    }
+
+    WakeWorker(i_num_jobs);
+    return true;
+}
+
+InterfaceJob* JobQueue::GetJob(size_t i_worker_index)
+{
+    if (policy_ == SchedulingPolicy::SharedQueue)
+    {
+        return GetSharedJob();
+    }
+
+    ASSERT(i_worker_index < local_queues_.size());
+    current_queue_ = this;
+    current_worker_index_ = i_worker_index;
+
+    while (!shutdown_requested_)
+    {
+        // own deque first, then the shared queue, then the peers
+        InterfaceJob* job = local_queues_[i_worker_index]->Pop();
+        if (job == nullptr)
+        {
+            job = RefillFromSharedQueue(i_worker_index);
+        }
+        if (job == nullptr)
+        {
+            job = GetStolenJob(i_worker_index);
+        }
+
+        if (job)
+        {
+            num_queued_jobs_.fetch_sub(1);
+            return job;
+        }
+
+        if (num_queued_jobs_.load() > 0)
+        {
+            // a job is on its way into a deque or another worker beat us to it, look again
+            std::this_thread::yield();
+            continue;
+        }
+
+        // sleep until a job is added, AddJob checks for sleeping workers after counting its job
+        num_sleeping_workers_.fetch_add(1);
+        {
+            std::unique_lock<std::mutex> u_lock(queue_mutex_);
+            start_searching_.wait(u_lock, [this]() { return shutdown_requested_ || num_queued_jobs_.load() > 0; });
+        }
+        num_sleeping_workers_.fetch_sub(1);
+    }
+
+    return nullptr;
+}
+
+InterfaceJob* JobQueue::TryGetJob()
 {
     if (shutdown_requested_)
     {
         return nullptr;
     }
 
+    // the team's own workers look in their deque first
     InterfaceJob* job = nullptr;
+    if (current_queue_ == this)
+    {
+        job = local_queues_[current_worker_index_]->Pop();
+    }
+
+    if (job == nullptr)
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        if (!job_queue_.empty())
+        {
+            job = job_queue_.front();
+            job_queue_.pop();
+        }
+    }
 
-    if (job_queue_.empty())
+    if (job == nullptr && policy_ == SchedulingPolicy::WorkStealing)
     {
-        std::unique_lock<std::mutex> u_lock(queue_mutex_);
-        start_searching_.wait(u_lock);
-        u_lock.unlock();
+        const size_t num_workers = local_queues_.size();
+        for (size_t i = 0; i < num_workers && job == nullptr; ++i)
+        {
+            if (current_queue_ != this || i != current_worker_index_)
+            {
+                job = local_queues_[i]->Steal();
+            }
+        }
+    }
+
+    if (job && policy_ == SchedulingPolicy::WorkStealing)
+    {
+        num_queued_jobs_.fetch_sub(1);
     }
-    
+    return job;
+}
+
+InterfaceJob* JobQueue::GetSharedJob()
+{
+    std::unique_lock<std::mutex> u_lock(queue_mutex_);
+    start_searching_.wait(u_lock, [this]() { return shutdown_requested_ || !job_queue_.empty(); });
+
     if (shutdown_requested_)
     {
         return nullptr;
     }
 
-    std::lock_guard<std::mutex> lock(queue_mutex_);
-    if (!job_queue_.empty())
-    {
-        job = job_queue_.front();
-        job_queue_.pop();
+    InterfaceJob* job = job_queue_.front();
+    job_queue_.pop();
 #ifdef BUILD_DEBUG
-        VERBOSE("\t\tJobQueue-%s removed job-%s and now has %zu jobs remaining", id_.GetString(), job->GetName().GetString(), job_queue_.size());
+    VERBOSE("\t\tJobQueue-%s removed job-%s and now has %zu jobs remaining", id_.GetString(), job->GetName().GetString(), job_queue_.size());
 #endif
+    return job;
+}
+
+InterfaceJob* JobQueue::GetStolenJob(size_t i_worker_index)
+{
+    const size_t num_workers = local_queues_.size();
+    for (size_t i = 1; i < num_workers; ++i)
+    {
+        InterfaceJob* job = local_queues_[(i_worker_index + i) % num_workers]->Steal();
+        if (job)
+        {
+            return job;
+        }
     }
+    return nullptr;
+}
 
-    return job;
+InterfaceJob* JobQueue::RefillFromSharedQueue(size_t i_worker_index)
+{
+    InterfaceJob* jobs[JOB_QUEUE_REFILL_BATCH_SIZE];
+    size_t num_jobs = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+
+        // take a fair share so the other workers find something in the shared queue or in this worker's deque
+        const size_t fair_share = job_queue_.size() / local_queues_.size() + 1;
+        const size_t max_jobs = fair_share < JOB_QUEUE_REFILL_BATCH_SIZE ? fair_share : JOB_QUEUE_REFILL_BATCH_SIZE;
+        while (num_jobs < max_jobs && !job_queue_.empty())
+        {
+            jobs[num_jobs++] = job_queue_.front();
+            job_queue_.pop();
+        }
+    }
+
+    if (num_jobs == 0)
+    {
+        return nullptr;
+    }
+
+    // keep the first job & make the rest available to thieves
+    for (size_t i = 1; i < num_jobs; ++i)
+    {
+        bool success = local_queues_[i_worker_index]->Push(jobs[i]);
+        ASSERT(success);
+    }
+
+    if (num_jobs > 1)
+    {
+        WakeWorker();
+    }
+    return jobs[0];
+}
+
+void JobQueue::WakeWorker(size_t i_num_jobs)
+{
+    if (num_sleeping_workers_.load() > 0)
+    {
+        // taking the lock guarantees a worker that just found nothing is either still checking the count or already waiting
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+        }
+        if (i_num_jobs > 1)
+        {
+            start_searching_.notify_all();
+        }
+        else
+        {
+            start_searching_.notify_one();
+        }
+    }
 }
 
 } // namespace jobs
-} // namespace engine
\ No newline at end of file
+} // namespace engine
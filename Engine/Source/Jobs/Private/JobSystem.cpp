@@ -1,11 +1,15 @@
-#include "Jobs\JobSystem.h"
+#include "Jobs/JobSystem.h"
+
+// library includes
+#include <thread>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Jobs\InterfaceJob.h"
-#include "Jobs\JobQueue.h"
-#include "Jobs\Worker.h"
-#include "Logger\Logger.h"
+#include "Assert/Assert.h"
+#include "Jobs/InterfaceJob.h"
+#include "Jobs/JobQueue.h"
+#include "Jobs/ParallelForJob.h"
+#include "Jobs/Worker.h"
+#include "Logger/Logger.h"
 
 namespace engine {
 namespace jobs {
@@ -40,7 +44,7 @@ void JobSystem::Destroy()
     }
 }
 
-bool JobSystem::CreateTeam(const engine::data::PooledString& i_team_name, const size_t num_workers)
+bool JobSystem::CreateTeam(const engine::data::PooledString& i_team_name, const size_t num_workers, SchedulingPolicy i_policy)
 {
     // validate inputs
     ASSERT(teams_.find(i_team_name) == teams_.end());
@@ -54,7 +58,7 @@ bool JobSystem::CreateTeam(const engine::data::PooledString& i_team_name, const
     team->name_ = i_team_name;
 
     // create a job queue for this team
-    team->job_queue_ = new JobQueue(i_team_name);
+    team->job_queue_ = new JobQueue(i_team_name, i_policy, num_workers);
     ASSERT(team->job_queue_);
 
     // create the number of workers requested
@@ -69,14 +73,227 @@ bool JobSystem::CreateTeam(const engine::data::PooledString& i_team_name, const
     return result;
 }
 
-bool JobSystem::AddJob(InterfaceJob* i_job, const engine::data::PooledString& i_team_name)
+bool JobSystem::AddJob(InterfaceJob* i_job, const engine::data::PooledString& i_team_name, const JobHandle& i_counter)
+{
+    // validate inputs
+    ASSERT(i_job);
+    std::map<engine::data::HashedString, Team*>::iterator team_it = teams_.find(i_team_name);
+    ASSERT(team_it != teams_.end());
+
+    // count the job before it is added, it could finish before AddJob returns
+    if (i_counter)
+    {
+        i_counter->Increment();
+        i_job->counter_ = i_counter;
+    }
+
+    if (team_it->second->job_queue_->AddJob(i_job))
+    {
+        return true;
+    }
+
+    // the job was not added, the caller still owns it
+    if (i_counter)
+    {
+        i_job->counter_ = nullptr;
+        FinishJob(i_counter);
+    }
+    return false;
+}
+
+bool JobSystem::AddJobs(InterfaceJob* const* i_jobs, size_t i_num_jobs, const engine::data::PooledString& i_team_name, const JobHandle& i_counter)
+{
+    // validate inputs
+    ASSERT(i_jobs || i_num_jobs == 0);
+    std::map<engine::data::HashedString, Team*>::iterator team_it = teams_.find(i_team_name);
+    ASSERT(team_it != teams_.end());
+
+    // count the jobs before they are added, they could finish before AddJobs returns
+    if (i_counter)
+    {
+        i_counter->Increment(static_cast<int32_t>(i_num_jobs));
+        for (size_t i = 0; i < i_num_jobs; ++i)
+        {
+            i_jobs[i]->counter_ = i_counter;
+        }
+    }
+
+    if (team_it->second->job_queue_->AddJobs(i_jobs, i_num_jobs))
+    {
+        return true;
+    }
+
+    // the jobs were not added, the caller still owns them
+    if (i_counter)
+    {
+        for (size_t i = 0; i < i_num_jobs; ++i)
+        {
+            i_jobs[i]->counter_ = nullptr;
+            FinishJob(i_counter);
+        }
+    }
+    return false;
+}
+
+bool JobSystem::AddJobAfter(InterfaceJob* i_job, const engine::data::PooledString& i_team_name, const JobHandle& i_dependency, const JobHandle& i_counter)
 {
     // validate inputs
     ASSERT(i_job);
+    ASSERT(i_dependency);
+    ASSERT(teams_.find(i_team_name) != teams_.end());
+
+    // hold the job with its dependency while there is anything left to finish
+    // the last job to finish takes this lock before it adds the continuations, so nothing can be missed
+    {
+        std::lock_guard<std::mutex> lock(i_dependency->continuations_mutex_);
+        if (i_dependency->GetNumPending() > 0)
+        {
+            if (i_counter)
+            {
+                i_counter->Increment();
+                i_job->counter_ = i_counter;
+            }
+
+            JobCounter::Continuation continuation;
+            continuation.job_ = i_job;
+            continuation.team_name_ = i_team_name;
+            i_dependency->continuations_.push_back(continuation);
+            return true;
+        }
+    }
+
+    return AddJob(i_job, i_team_name, i_counter);
+}
+
+bool JobSystem::Wait(const JobHandle& i_counter, const engine::data::PooledString& i_team_name)
+{
+    // validate inputs
+    ASSERT(i_counter);
     std::map<engine::data::HashedString, Team*>::iterator team_it = teams_.find(i_team_name);
     ASSERT(team_it != teams_.end());
 
-    return team_it->second->job_queue_->AddJob(i_job);
+    JobQueue* job_queue = team_it->second->job_queue_;
+    while (!i_counter->IsDone())
+    {
+        if (job_queue->HasShutdownBeenRequested())
+        {
+            return false;
+        }
+
+        // help out instead of blocking
+        InterfaceJob* job = job_queue->TryGetJob();
+        if (job)
+        {
+            RunJob(job);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    return true;
+}
+
+void JobSystem::ParallelFor(size_t i_begin, size_t i_end, size_t i_grain_size, const std::function<void(size_t, size_t)>& i_function, const engine::data::PooledString& i_team_name)
+{
+    // validate inputs
+    ASSERT(i_begin <= i_end);
+    ASSERT(i_grain_size > 0);
+    ASSERT(i_function);
+    std::map<engine::data::HashedString, Team*>::iterator team_it = teams_.find(i_team_name);
+    ASSERT(team_it != teams_.end());
+
+    // a loop that fits in one chunk isn't worth waking anyone up for
+    const size_t num_chunks = (i_end - i_begin + i_grain_size - 1) / i_grain_size;
+    if (num_chunks <= 1)
+    {
+        if (i_end > i_begin)
+        {
+            i_function(i_begin, i_end);
+        }
+        return;
+    }
+
+    // the calling thread takes a share too, so there's no point in more helpers than remaining chunks
+    size_t num_helpers = num_chunks - 1;
+    num_helpers = num_helpers < team_it->second->workers_.size() ? num_helpers : team_it->second->workers_.size();
+    num_helpers = num_helpers < PARALLEL_FOR_MAX_HELPERS ? num_helpers : PARALLEL_FOR_MAX_HELPERS;
+
+    ParallelForBatch* batch = new ParallelForBatch(i_begin, i_end, i_grain_size, i_function, num_helpers);
+    ASSERT(batch);
+
+    InterfaceJob* helpers[PARALLEL_FOR_MAX_HELPERS];
+    for (size_t i = 0; i < num_helpers; ++i)
+    {
+        helpers[i] = batch->GetHelper(i);
+    }
+
+    if (!team_it->second->job_queue_->AddJobs(helpers, num_helpers))
+    {
+        // the team is shutting down, run the whole loop on this thread
+        for (size_t i = 0; i < num_helpers; ++i)
+        {
+            helpers[i]->Release();
+        }
+    }
+
+    // chip in & then wait for the chunks the helpers have claimed
+    batch->RunChunks();
+    while (!batch->IsDone())
+    {
+        std::this_thread::yield();
+    }
+
+    batch->Release();
+}
+
+void JobSystem::RunJob(InterfaceJob* i_job)
+{
+    // validate inputs
+    ASSERT(i_job);
+
+    JobHandle counter(std::move(i_job->counter_));
+
+    i_job->DoWork();
+    i_job->Release();
+
+    if (counter)
+    {
+        FinishJob(counter);
+    }
+}
+
+void JobSystem::FinishJob(const JobHandle& i_counter)
+{
+    // validate inputs
+    ASSERT(i_counter);
+
+    if (!i_counter->Decrement())
+    {
+        return;
+    }
+
+    std::vector<JobCounter::Continuation> continuations;
+    {
+        std::lock_guard<std::mutex> lock(i_counter->continuations_mutex_);
+        continuations.swap(i_counter->continuations_);
+    }
+
+    for (JobCounter::Continuation& continuation : continuations)
+    {
+        // continuations were counted when they were added, so they're added without a counter here
+        JobHandle counter = continuation.job_->counter_;
+        if (JobSystem::instance_ == nullptr || !JobSystem::instance_->AddJob(continuation.job_, continuation.team_name_))
+        {
+            LOG_ERROR("JobSystem could not add continuation:%s", continuation.job_->GetName().GetString());
+            continuation.job_->Release();
+            if (counter)
+            {
+                FinishJob(counter);
+            }
+        }
+    }
 }
 
 void JobSystem::Shutdown()
@@ -87,11 +304,15 @@ void JobSystem::Shutdown()
     }
     shutdown_requested_ = true;
 
+    // ask every team's queue to shutdown before joining any worker
+    // workers can add jobs to other teams, so no queue may be deleted while any worker is still running
     for (std::map<engine::data::HashedString, Team*>::iterator it = teams_.begin(); it != teams_.end(); ++it)
     {
-        // ask this team's queue to shutdown
         it->second->job_queue_->RequestShutdown();
+    }
 
+    for (std::map<engine::data::HashedString, Team*>::iterator it = teams_.begin(); it != teams_.end(); ++it)
+    {
         const size_t num_workers = it->second->workers_.size();
         for (size_t i = 0; i < num_workers; ++i)
         {
@@ -100,7 +321,10 @@ void JobSystem::Shutdown()
             delete it->second->workers_[i];
         }
         it->second->workers_.clear();
+    }
 
+    for (std::map<engine::data::HashedString, Team*>::iterator it = teams_.begin(); it != teams_.end(); ++it)
+    {
         // delete this team's queue
         delete it->second->job_queue_;
 
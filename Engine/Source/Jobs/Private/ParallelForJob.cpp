@@ -0,0 +1,72 @@
+#include "Jobs/ParallelForJob.h"
+
+namespace engine {
+namespace jobs {
+
+ParallelForJob::ParallelForJob() : batch_(nullptr)
+{
+    SetName("ParallelForJob");
+}
+
+ParallelForJob::~ParallelForJob()
+{}
+
+void ParallelForJob::DoWork()
+{
+    batch_->RunChunks();
+}
+
+void ParallelForJob::Release()
+{
+    batch_->Release();
+}
+
+ParallelForBatch::ParallelForBatch(size_t i_begin, size_t i_end, size_t i_grain_size, const std::function<void(size_t, size_t)>& i_function, size_t i_num_helpers) : 
+    function_(&i_function),
+    begin_(i_begin),
+    end_(i_end),
+    grain_size_(i_grain_size),
+    num_chunks_((i_end - i_begin + i_grain_size - 1) / i_grain_size),
+    num_helpers_(i_num_helpers),
+    next_chunk_(0),
+    num_chunks_done_(0),
+    num_references_(i_num_helpers + 1)
+{
+    // validate inputs
+    ASSERT(i_begin <= i_end);
+    ASSERT(i_grain_size > 0);
+    ASSERT(i_function);
+    ASSERT(i_num_helpers <= PARALLEL_FOR_MAX_HELPERS);
+
+    for (size_t i = 0; i < num_helpers_; ++i)
+    {
+        helpers_[i].batch_ = this;
+    }
+}
+
+ParallelForBatch::~ParallelForBatch()
+{}
+
+void ParallelForBatch::RunChunks()
+{
+    // the function must not be touched once every chunk has been claimed, the caller may have returned
+    for (size_t chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed); chunk < num_chunks_; chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed))
+    {
+        const size_t chunk_begin = begin_ + chunk * grain_size_;
+        const size_t chunk_end = (end_ - chunk_begin) > grain_size_ ? chunk_begin + grain_size_ : end_;
+        (*function_)(chunk_begin, chunk_end);
+
+        num_chunks_done_.fetch_add(1, std::memory_order_release);
+    }
+}
+
+void ParallelForBatch::Release()
+{
+    if (num_references_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        delete this;
+    }
+}
+
+} // namespace jobs
+} // namespace engine
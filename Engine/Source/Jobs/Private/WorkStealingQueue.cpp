@@ -0,0 +1,30 @@
+#include "Jobs/WorkStealingQueue.h"
+
+// engine includes
+#include "Jobs/InterfaceJob.h"
+
+namespace engine {
+namespace jobs {
+
+WorkStealingQueue::WorkStealingQueue() : top_(0),
+    bottom_(0)
+{
+    for (size_t i = 0; i < WORK_STEALING_QUEUE_CAPACITY; ++i)
+    {
+        jobs_[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+WorkStealingQueue::~WorkStealingQueue()
+{
+    // release jobs that were never run
+    InterfaceJob* job = Pop();
+    while (job)
+    {
+        job->Release();
+        job = Pop();
+    }
+}
+
+} // namespace jobs
+} // namespace engine
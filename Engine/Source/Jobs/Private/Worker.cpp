@@ -1,10 +1,11 @@
-#include "Jobs\Worker.h"
+#include "Jobs/Worker.h"
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Jobs\InterfaceJob.h"
-#include "Jobs\JobQueue.h"
-#include "Logger\Logger.h"
+#include "Assert/Assert.h"
+#include "Jobs/InterfaceJob.h"
+#include "Jobs/JobQueue.h"
+#include "Jobs/JobSystem.h"
+#include "Logger/Logger.h"
 
 namespace engine {
 namespace jobs {
@@ -35,16 +36,15 @@ void Worker::DoJob(JobQueue* i_job_queue)
     {
         VERBOSE("\t\t\tWorker-%d starting to look for a job.", id_);
 
-        InterfaceJob* job = i_job_queue->GetJob();
+        InterfaceJob* job = i_job_queue->GetJob(id_);
         if (job)
         {
             VERBOSE("\t\t\tWorker-%d found job:%s", id_, job->GetName().GetString());
-            
-            job->DoWork();
-            
-            VERBOSE("\t\t\tWorker-%d finished job:%s", id_, job->GetName().GetString());
 
-            delete job;
+            // the job is released once it has finished
+            JobSystem::RunJob(job);
+
+            VERBOSE("\t\t\tWorker-%d finished a job", id_);
 
             stop_working = i_job_queue->HasShutdownBeenRequested();
         }
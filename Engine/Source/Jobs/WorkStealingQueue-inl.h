@@ -0,0 +1,72 @@
+#include "WorkStealingQueue.h"
+
+namespace engine {
+namespace jobs {
+
+inline bool WorkStealingQueue::Push(InterfaceJob* i_job)
+{
+    const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    const int64_t top = top_.load(std::memory_order_acquire);
+    if (bottom - top >= WORK_STEALING_QUEUE_CAPACITY)
+    {
+        return false;
+    }
+
+    jobs_[bottom & (WORK_STEALING_QUEUE_CAPACITY - 1)].store(i_job, std::memory_order_relaxed);
+    bottom_.store(bottom + 1, std::memory_order_release);
+    return true;
+}
+
+inline InterfaceJob* WorkStealingQueue::Pop()
+{
+    // claim the bottom slot before looking at top so a thief can't take it unnoticed
+    const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    bottom_.store(bottom, std::memory_order_seq_cst);
+    int64_t top = top_.load(std::memory_order_seq_cst);
+
+    if (top > bottom)
+    {
+        // the deque was empty
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    InterfaceJob* job = jobs_[bottom & (WORK_STEALING_QUEUE_CAPACITY - 1)].load(std::memory_order_relaxed);
+    if (top == bottom)
+    {
+        // last job, race the thieves for it
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            job = nullptr;
+        }
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+inline InterfaceJob* WorkStealingQueue::Steal()
+{
+    int64_t top = top_.load(std::memory_order_seq_cst);
+    const int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+
+    if (top >= bottom)
+    {
+        return nullptr;
+    }
+
+    InterfaceJob* job = jobs_[top & (WORK_STEALING_QUEUE_CAPACITY - 1)].load(std::memory_order_relaxed);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        // lost the race to the owner or another thief
+        return nullptr;
+    }
+    return job;
+}
+
+inline bool WorkStealingQueue::IsEmpty() const
+{
+    return top_.load(std::memory_order_relaxed) >= bottom_.load(std::memory_order_relaxed);
+}
+
+} // namespace jobs
+} // namespace engine
@@ -0,0 +1,58 @@
+#ifndef WORK_STEALING_QUEUE_H_
+#define WORK_STEALING_QUEUE_H_
+
+// library includes
+#include <atomic>
+#include <stdint.h>
+
+namespace engine {
+namespace jobs {
+
+// forward declaration
+class InterfaceJob;
+
+#define WORK_STEALING_QUEUE_CAPACITY 1024
+
+/*
+    WorkStealingQueue
+    - A fixed capacity Chase-Lev deque of jobs owned by a single worker
+    - Only the owning worker may Push & Pop, which work on the bottom end without taking any locks
+    - Any other thread may Steal from the top end, competing with each other & the owner through a single compare & swap
+    - Push fails when the deque is full so the caller can fall back to its team's shared queue
+*/
+class WorkStealingQueue
+{
+public:
+    WorkStealingQueue();
+    ~WorkStealingQueue();
+
+    // owner only
+    inline bool Push(InterfaceJob* i_job);
+    inline InterfaceJob* Pop();
+
+    // any thread
+    inline InterfaceJob* Steal();
+    inline bool IsEmpty() const;
+
+private:
+    WorkStealingQueue(const WorkStealingQueue&) = delete;
+    WorkStealingQueue(WorkStealingQueue&&) = delete;
+
+    WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+    WorkStealingQueue& operator=(WorkStealingQueue&&) = delete;
+
+    // top & bottom are padded apart since thieves write one & the owner writes the other
+    std::atomic<int64_t>                        top_;
+    uint8_t                                     top_padding_[64 - sizeof(std::atomic<int64_t>)];
+    std::atomic<int64_t>                        bottom_;
+    uint8_t                                     bottom_padding_[64 - sizeof(std::atomic<int64_t>)];
+    std::atomic<InterfaceJob*>                  jobs_[WORK_STEALING_QUEUE_CAPACITY];
+
+}; // class WorkStealingQueue
+
+} // namespace jobs
+} // namespace engine
+
+#include "WorkStealingQueue-inl.h"
+
+#endif // WORK_STEALING_QUEUE_H_
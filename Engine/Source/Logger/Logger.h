@@ -25,12 +25,12 @@
 #if defined(BUILD_DEBUG)
     // in debug mode, enable verbose, log & error when level is 1
     #if defined(VERBOSITY_LEVEL) && (VERBOSITY_LEVEL > 0)
-        #define LOG(format, ...)            engine::Print("DEBUG: ", (format), __VA_ARGS__)
-        #define LOG_ERROR(format, ...)      engine::Print("ERROR: ", (format), __VA_ARGS__)
-        #define VERBOSE(format, ...)        engine::Print("VERBOSE: ", (format), __VA_ARGS__)
+        #define LOG(format, ...)            engine::Print("DEBUG: ", (format), ##__VA_ARGS__)
+        #define LOG_ERROR(format, ...)      engine::Print("ERROR: ", (format), ##__VA_ARGS__)
+        #define VERBOSE(format, ...)        engine::Print("VERBOSE: ", (format), ##__VA_ARGS__)
     #else
-        #define LOG(format, ...)            engine::Print("DEBUG: ", (format), __VA_ARGS__)
-        #define LOG_ERROR(format, ...)      engine::Print("ERROR: ", (format), __VA_ARGS__)
+        #define LOG(format, ...)            engine::Print("DEBUG: ", (format), ##__VA_ARGS__)
+        #define LOG_ERROR(format, ...)      engine::Print("ERROR: ", (format), ##__VA_ARGS__)
         #define VERBOSE(format, ...)        void(0)
     #endif
 #else
@@ -39,8 +39,8 @@
 
     // in release mode, enable log & error when level is 1
     #if defined(VERBOSITY_LEVEL) && (VERBOSITY_LEVEL > 0)
-        #define LOG(format, ...)            engine::Print("DEBUG: ", (format), __VA_ARGS__)
-        #define LOG_ERROR(format, ...)      engine::Print("ERROR: ", (format), __VA_ARGS__)
+        #define LOG(format, ...)            engine::Print("DEBUG: ", (format), ##__VA_ARGS__)
+        #define LOG_ERROR(format, ...)      engine::Print("ERROR: ", (format), ##__VA_ARGS__)
     #else
         #define LOG(format, ...)            void(0)
         #define LOG_ERROR(format, ...)      void(0)
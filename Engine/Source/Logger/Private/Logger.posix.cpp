@@ -0,0 +1,48 @@
+#include "Logger/Logger.h"
+
+// library includes
+#include <stdarg.h>
+#include <stdio.h>
+
+namespace engine
+{
+    void Print(const char* i_type, const char* i_format, ...)
+    {
+        const size_t len_temp = 256;
+        char str_temp[len_temp] = { 0 };
+
+        snprintf(str_temp, len_temp, "%s%s\n", i_type, i_format);
+
+        const size_t len_output = len_temp + 1024;
+        char str_output[len_output] = { 0 };
+
+        va_list args;
+        va_start(args, i_format);
+        vsnprintf(str_output, len_output, str_temp, args);
+        va_end(args);
+
+        // there's no debugger output window, servers log to stderr
+        fputs(str_output, stderr);
+    }
+
+#if defined(VERBOSITY_LEVEL) && (VERBOSITY_LEVEL > 1)
+    void Print(const char* i_function_name, const int i_line_number, const char* i_format, ...)
+    {
+        const size_t len_temp = 256;
+        char str_temp[len_temp] = { 0 };
+
+        snprintf(str_temp, len_temp, "VERBOSE - %s - %d: %s\n", i_function_name, i_line_number, i_format);
+
+        const size_t len_output = len_temp + 1024;
+        char str_output[len_output] = { 0 };
+
+        va_list args;
+        va_start(args, i_format);
+        vsnprintf(str_output, len_output, str_temp, args);
+        va_end(args);
+
+        fputs(str_output, stderr);
+    }
+#endif // defined(VERBOSITY_LEVEL) && (VERBOSITY_LEVEL > 1)
+
+} // namespace engine
@@ -1,4 +1,4 @@
-#include "Logger\Logger.h"
+#include "Logger/Logger.h"
 
 // library includes
 #include <stdarg.h>
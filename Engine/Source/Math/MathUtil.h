@@ -4,6 +4,8 @@
 // library includes
 #include <math.h>
 
+// POSIX's math.h defines a double M_PI, the engine's is a float
+#undef M_PI
 #define M_PI                    3.14159265358979323846f  /* pi */
 #define MIN_EPSILON             0.000000001f
 #define MAX_EPSILON             0.0001f
@@ -1,4 +1,4 @@
-#include "Math\AABB.h"
+#include "Math/AABB.h"
 
 namespace engine {
 namespace math {
@@ -1,15 +1,15 @@
-#include "Math\Mat44-SSE.h"
+#include "Math/Mat44-SSE.h"
 
 // library includes
 #include <math.h>
 #include <stdint.h>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Logger\Logger.h"
-#include "Math\MathUtil.h"
-#include "Math\Vec4D-SSE.h"
-#include "Math\Vec3D-SSE.h"
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+#include "Math/MathUtil.h"
+#include "Math/Vec4D-SSE.h"
+#include "Math/Vec3D-SSE.h"
 
 namespace engine {
 namespace math {
@@ -39,10 +39,6 @@ Mat44::Mat44(float i_11, float i_12, float i_13, float i_14,
     float i_21, float i_22, float i_23, float i_24,
     float i_31, float i_32, float i_33, float i_34,
     float i_41, float i_42, float i_43, float i_44) :
-    f11(i_11), f12(i_12), f13(i_13), f14(i_14),
-    f21(i_21), f22(i_22), f23(i_23), f24(i_24),
-    f31(i_31), f32(i_32), f33(i_33), f34(i_34),
-    f41(i_41), f42(i_42), f43(i_43), f44(i_44),
     row1(_mm_setr_ps(i_11, i_12, i_13, i_14)),
     row2(_mm_setr_ps(i_21, i_22, i_23, i_24)),
     row3(_mm_setr_ps(i_31, i_32, i_33, i_34)),
@@ -105,10 +101,6 @@ void Mat44::Set(const __m128& i_row1, const __m128& i_row2, const __m128& i_row3
 }
 
 Mat44::Mat44(const Mat44& i_copy) :
-    f11(i_copy.f11), f12(i_copy.f12), f13(i_copy.f13), f14(i_copy.f14),
-    f21(i_copy.f21), f22(i_copy.f22), f23(i_copy.f23), f24(i_copy.f24),
-    f31(i_copy.f31), f32(i_copy.f32), f33(i_copy.f33), f34(i_copy.f34),
-    f41(i_copy.f41), f42(i_copy.f42), f43(i_copy.f43), f44(i_copy.f44),
     row1(i_copy.row1), row2(i_copy.row2), row3(i_copy.row3), row4(i_copy.row4)
 {}
 
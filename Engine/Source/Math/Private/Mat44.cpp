@@ -1,13 +1,13 @@
-#include "Math\Mat44.h"
+#include "Math/Mat44.h"
 
 // library includes
 #include <math.h>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Logger\Logger.h"
-#include "Math\MathUtil.h"
-#include "Math\Vec4D.h"
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+#include "Math/MathUtil.h"
+#include "Math/Vec4D.h"
 
 namespace engine {
 namespace math {
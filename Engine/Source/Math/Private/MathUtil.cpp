@@ -1,14 +1,14 @@
-#include "Math\MathUtil.h"
+#include "Math/MathUtil.h"
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Math\AABB.h"
-#include "Math\Mat44.h"
-#include "Math\Mat44-SSE.h"
-#include "Math\Transform.h"
-#include "Math\Vec2D.h"
-#include "Math\Vec3D.h"
-#include "Math\Vec3D-SSE.h"
+#include "Assert/Assert.h"
+#include "Math/AABB.h"
+#include "Math/Mat44.h"
+#include "Math/Mat44-SSE.h"
+#include "Math/Transform.h"
+#include "Math/Vec2D.h"
+#include "Math/Vec3D.h"
+#include "Math/Vec3D-SSE.h"
 
 namespace engine {
 namespace math {
@@ -1,4 +1,4 @@
-#include "Math\Rect.h"
+#include "Math/Rect.h"
 
 namespace engine {
 namespace math {
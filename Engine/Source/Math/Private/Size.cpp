@@ -1,4 +1,4 @@
-#include "Math\Size.h"
+#include "Math/Size.h"
 
 namespace engine {
 namespace math {
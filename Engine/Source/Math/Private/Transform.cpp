@@ -1,4 +1,4 @@
-#include "Math\Transform.h"
+#include "Math/Transform.h"
 
 namespace engine {
 namespace math {
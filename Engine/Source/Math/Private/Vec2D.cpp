@@ -1,11 +1,11 @@
-#include "Math\Vec2D.h"
+#include "Math/Vec2D.h"
 
 // library includes
 #include <cmath>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Math\MathUtil.h"
+#include "Assert/Assert.h"
+#include "Math/MathUtil.h"
 
 namespace engine {
 namespace math {
@@ -27,7 +27,7 @@ namespace math {
 
     float Vec2D::Length() const
     {
-        return std::sqrtf(LengthSquared());
+        return std::sqrt(LengthSquared());
     }
 
     void Vec2D::Normalize()
@@ -40,7 +40,7 @@ namespace math {
             return;
         }
 
-        float length = std::sqrtf(length_squared);
+        float length = std::sqrt(length_squared);
         length = 1.0f / length;
 
         x_ *= length;
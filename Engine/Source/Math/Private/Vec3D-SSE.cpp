@@ -1,7 +1,7 @@
-#include "Math\Vec3D-SSE.h"
+#include "Math/Vec3D-SSE.h"
 
 // engine includes
-#include "Math\Vec3D.h"
+#include "Math/Vec3D.h"
 
 namespace engine {
 namespace math {
@@ -13,10 +13,7 @@ const Vec3D Vec3D::UNIT_X(_mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f));
 const Vec3D Vec3D::UNIT_Y(_mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f));
 const Vec3D Vec3D::UNIT_Z(_mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f));
 
-Vec3D::Vec3D(float i_x, float i_y, float i_z) : x_(i_x),
-y_(i_y),
-z_(i_z),
-vec_(_mm_setr_ps(i_x, i_y, i_z, 0.0f))
+Vec3D::Vec3D(float i_x, float i_y, float i_z) : vec_(_mm_setr_ps(i_x, i_y, i_z, 0.0f))
 {
     ASSERT(!(IsNaN(i_x) || IsNaN(i_y) || IsNaN(i_z)));
 }
@@ -24,16 +21,10 @@ vec_(_mm_setr_ps(i_x, i_y, i_z, 0.0f))
 Vec3D::Vec3D(const __m128 i_vec) : vec_(i_vec)
 {}
 
-Vec3D::Vec3D(const engine::math::Vec3D& i_copy) : x_(i_copy.x()),
-    y_(i_copy.y()),
-    z_(i_copy.z()),
-    vec_(_mm_setr_ps(i_copy.x(), i_copy.y(), i_copy.z(), 0.0f))
+Vec3D::Vec3D(const engine::math::Vec3D& i_copy) : vec_(_mm_setr_ps(i_copy.x(), i_copy.y(), i_copy.z(), 0.0f))
 {}
 
-Vec3D::Vec3D(const Vec3D& i_copy) : x_(i_copy.x_),
-y_(i_copy.y_),
-z_(i_copy.z_),
-vec_(i_copy.vec_)
+Vec3D::Vec3D(const Vec3D& i_copy) : vec_(i_copy.vec_)
 {}
 
 float Vec3D::Length() const
@@ -1,10 +1,10 @@
-#include "Math\Vec3D.h"
+#include "Math/Vec3D.h"
 
 // library includes
 #include <cmath>
 
 // engine includes
-#include "Math\Vec3D-SSE.h"
+#include "Math/Vec3D-SSE.h"
 
 namespace engine {
 namespace math {
@@ -36,7 +36,7 @@ Vec3D::Vec3D(const Vec3D& i_copy) : x_(i_copy.x_),
 
 float Vec3D::Length() const
 {
-    return std::sqrtf(LengthSquared());
+    return std::sqrt(LengthSquared());
 }
 
 void Vec3D::Normalize()
@@ -49,7 +49,7 @@ void Vec3D::Normalize()
         return;
     }
 
-    float length = std::sqrtf(length_squared);
+    float length = std::sqrt(length_squared);
     length = 1.0f / length;
 
     x_ *= length;
@@ -1,7 +1,7 @@
-#include "Math\Vec4D-SSE.h"
+#include "Math/Vec4D-SSE.h"
 
 // engine includes
-#include "Math\Vec3D-SSE.h"
+#include "Math/Vec3D-SSE.h"
 
 namespace engine {
 namespace math {
@@ -14,11 +14,7 @@ const Vec4D Vec4D::UNIT_Y(_mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f));
 const Vec4D Vec4D::UNIT_Z(_mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f));
 const Vec4D Vec4D::UNIT_W(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
 
-Vec4D::Vec4D(float i_x, float i_y, float i_z, float i_w) : x_(i_x),
-y_(i_y),
-z_(i_z),
-w_(i_w),
-vec_(_mm_setr_ps(i_x, i_y, i_z, i_w))
+Vec4D::Vec4D(float i_x, float i_y, float i_z, float i_w) : vec_(_mm_setr_ps(i_x, i_y, i_z, i_w))
 {
     ASSERT(!IsNaN(i_x) && !IsNaN(i_y) && !IsNaN(i_z) && !IsNaN(i_w));
 }
@@ -26,18 +22,10 @@ vec_(_mm_setr_ps(i_x, i_y, i_z, i_w))
 Vec4D::Vec4D(const __m128& i_vec) : vec_(i_vec)
 {}
 
-Vec4D::Vec4D(const Vec3D& i_vec3, float i_w) : x_(i_vec3.x()),
-y_(i_vec3.y()),
-z_(i_vec3.z()),
-w_(i_w),
-vec_(_mm_setr_ps(i_vec3.x(), i_vec3.y(), i_vec3.z(), i_w))
+Vec4D::Vec4D(const Vec3D& i_vec3, float i_w) : vec_(_mm_setr_ps(i_vec3.x(), i_vec3.y(), i_vec3.z(), i_w))
 {}
 
-Vec4D::Vec4D(const Vec4D& i_copy) : x_(i_copy.x_),
-y_(i_copy.y_),
-z_(i_copy.z_),
-w_(i_copy.w_),
-vec_(i_copy.vec_)
+Vec4D::Vec4D(const Vec4D& i_copy) : vec_(i_copy.vec_)
 {}
 
 float Vec4D::Length() const
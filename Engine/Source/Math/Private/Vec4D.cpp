@@ -1,4 +1,4 @@
-#include "Math\Vec4D.h"
+#include "Math/Vec4D.h"
 
 // library includes
 #include <cmath>
@@ -35,7 +35,7 @@ Vec4D::Vec4D(const Vec4D& i_copy) : x_(i_copy.x_),
 
 float Vec4D::Length() const
 {
-    return std::sqrtf(LengthSquared());
+    return std::sqrt(LengthSquared());
 }
 
 void Vec4D::Normalize()
@@ -48,7 +48,7 @@ void Vec4D::Normalize()
         return;
     }
 
-    float length = std::sqrtf(length_squared);
+    float length = std::sqrt(length_squared);
     length = 1.0f / length;
 
     x_ *= length;
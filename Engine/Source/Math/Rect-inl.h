@@ -1,8 +1,8 @@
 #include "Rect.h"
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Math\MathUtil.h"
+#include "Assert/Assert.h"
+#include "Math/MathUtil.h"
 
 namespace engine {
 namespace math {
@@ -1,8 +1,8 @@
 #include "Vec2D.h"
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Math\MathUtil.h"
+#include "Assert/Assert.h"
+#include "Math/MathUtil.h"
 
 namespace engine {
 namespace math {
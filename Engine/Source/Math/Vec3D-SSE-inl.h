@@ -1,7 +1,7 @@
 #include "Vec3D-SSE.h"
 
 // engine includes
-#include "Assert\Assert.h"
+#include "Assert/Assert.h"
 
 namespace engine {
 namespace math {
@@ -6,7 +6,7 @@
 #include <smmintrin.h>
 
 // engine includes
-#include "Math\MathUtil.h"
+#include "Math/MathUtil.h"
 
 namespace engine {
 namespace math {
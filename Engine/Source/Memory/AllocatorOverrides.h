@@ -2,6 +2,7 @@
 #define CUSTOM_NEW_H_
 
 // library includes
+#include <stddef.h>
 //#include <corecrt.h>
 //#include <corecrt_malloc.h>
 
@@ -39,10 +40,10 @@ _ACRTIMP
 void __cdecl free(_Pre_maybenull_ _Post_invalid_ void* i_pointer);*/
 
 void* operator new(size_t i_size);
-void operator delete(void* i_pointer);
+void operator delete(void* i_pointer) noexcept;
 
 void* operator new[](size_t i_size);
-void operator delete[](void* i_pointer);
+void operator delete[](void* i_pointer) noexcept;
 
 void* operator new(size_t i_size, engine::memory::AlignmentType i_alignment);
 void operator delete(void* i_pointer, engine::memory::AlignmentType i_alignment);
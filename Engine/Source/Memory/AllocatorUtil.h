@@ -1,6 +1,7 @@
 #ifndef ENGINE_ALLOCATOR_UTIL_H_
 #define ENGINE_ALLOCATOR_UTIL_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 // global defines used across allocators
@@ -19,6 +20,10 @@ namespace memory {
 void CreateAllocators();
 void DestroyAllocators();
 
+// memory straight from the system's heap for allocators to manage, aligned to i_alignment bytes
+void* AlignedMalloc(size_t i_size, size_t i_alignment);
+void AlignedFree(void* i_memory);
+
 #ifdef BUILD_DEBUG
 
 struct AllocatorStatistics
@@ -1,10 +1,13 @@
 #include "BlockAllocator.h"
 
 // library includes
+#if defined(_MSC_VER)
+#include <intrin.h>         // for _BitScanReverse
+#endif
 #include <string.h>         // for memset
 
 // engine includes
-#include "Assert\Assert.h"
+#include "Assert/Assert.h"
 
 namespace engine {
 namespace memory {
@@ -19,6 +22,30 @@ namespace memory {
         return size_of_BD_;
     }
 
+    inline BD* BlockAllocator::GetPhysicalNext(const BD* i_bd) const
+    {
+        ASSERT(i_bd != nullptr);
+        uint8_t* next_bd = i_bd->block_pointer + i_bd->block_size;
+        return next_bd < (block_ + total_block_size_) ? reinterpret_cast<BD*>(next_bd) : nullptr;
+    }
+
+    // Returns the index of the highest set bit i.e. floor(log2(i_size))
+    inline size_t BlockAllocator::GetSizeClass(const size_t i_size)
+    {
+        ASSERT(i_size > 0);
+#if defined(_MSC_VER)
+        unsigned long bit_index_long = 0;
+#if defined(_WIN64)
+        _BitScanReverse64(&bit_index_long, i_size);
+#else
+        _BitScanReverse(&bit_index_long, i_size);
+#endif
+        return size_t(bit_index_long);
+#else
+        return size_t(63 - __builtin_clzll(i_size));
+#endif
+    }
+
 #ifdef BUILD_DEBUG
     inline void BlockAllocator::ClearBlock(BD* i_bd, const unsigned char i_fill)
     {
@@ -42,6 +69,19 @@ namespace memory {
     inline const size_t BlockAllocator::GetTotalFreeMemorySize() const
     {
         size_t total_size = 0;
+        if (policy_ == AllocationPolicy::SegregatedFit)
+        {
+            // loop every size class
+            for (size_t i = 0; i < MAX_SIZE_CLASSES; ++i)
+            {
+                for (BD* bd = size_classes_[i]; bd != nullptr; bd = bd->next)
+                {
+                    total_size += bd->block_size;
+                }
+            }
+            return total_size;
+        }
+
         // loop the free list
         BD* bd = free_list_head_;
         while (bd != nullptr)
@@ -63,6 +103,11 @@ namespace memory {
         return num_outstanding_blocks;
     }
 
+    inline AllocationPolicy BlockAllocator::GetPolicy() const
+    {
+        return policy_;
+    }
+
 #ifdef BUILD_DEBUG
     inline const AllocatorStatistics& BlockAllocator::GetStatistics() const
     {
@@ -12,12 +12,26 @@ namespace engine {
 namespace memory {
 
 #define MAX_BLOCK_ALLOCATORS 5
+#define MAX_SIZE_CLASSES (sizeof(size_t) * 8)
+
+/*
+    AllocationPolicy
+    - FirstFit walks a single address sorted free list and defragments only when a request cannot be serviced
+    - SegregatedFit keeps free blocks in power-of-two size classes along with a bitmap of non-empty classes,
+      so that finding a block & releasing it (including merging with its neighbours) takes constant time
+*/
+enum class AllocationPolicy : uint8_t
+{
+    FirstFit = 0,
+    SegregatedFit
+};
 
 /*
     BlockDescriptor
     - A struct that describes a block of memory managed by the block allocator
     - It contains a pointer to a block of memory as well as its size
     - It contains a pointer to the next & previous descriptor in a list or nullptr if its not part of a list
+    - With the segregated-fit policy, it also knows the descriptor placed right before it in memory and whether it is free
     - In debug mode, it contains an integer id that can be used to track memory leaks
 */
 typedef struct BlockDescriptor
@@ -27,6 +41,8 @@ public:
     BlockDescriptor*        previous;               // pointer to the previous block descriptor
     uint8_t*                block_pointer;          // pointer to the actual block of data
     size_t                  block_size;             // size of the actual block of data
+    BlockDescriptor*        physical_previous;      // pointer to the descriptor right before this one in memory (segregated-fit only)
+    bool                    is_free;                // whether this descriptor is in a size class (segregated-fit only)
 
 #ifdef BUILD_DEBUG
     size_t                  user_size;              // size of the block requested by the user
@@ -39,6 +55,7 @@ public:
     - A simple block allocator that uses a linked list to keep track of allocations
     - It needs to be provided raw memory to operate on
     - It provides functions to allocate, free and defragment memory on demand
+    - It can either search a single free list (first-fit) or use segregated size classes (see AllocationPolicy)
     - To allocate memory, users must pass in the desired size and desired byte alignment (defaults to 4-byte alignment)
     - In debug mode, it checks for memory overwrites by adding guardbands around the memory returned to the user
     - In debug mode, it provides functions to track allocations by uniquely identifying each descriptor to user memory
@@ -53,7 +70,7 @@ private:
     BlockAllocator(const BlockAllocator& i_copy) = delete;
     BlockAllocator& operator=(const BlockAllocator& i_ba) = delete;
 
-    BlockAllocator(void* i_memory, size_t i_block_size);
+    BlockAllocator(void* i_memory, size_t i_block_size, AllocationPolicy i_policy);
     ~BlockAllocator() {}
 
     void InitFirstBlockDescriptor();
@@ -61,13 +78,25 @@ private:
     void AddToList(BD** i_head, BD** i_bd, bool i_enable_sort);
     void RemoveFromList(BD** i_head, BD** i_bd);
 
+    // first-fit helpers
+    BD* FindFirstFitBlock(const size_t i_size, const size_t i_alignment);
+
+    // segregated-fit helpers
+    BD* FindSegregatedFitBlock(const size_t i_size, const size_t i_alignment);
+    BD* SplitBlock(BD* i_free_bd, const size_t i_size, const size_t i_alignment);
+    BD* MergeWithNeighbours(BD* i_bd);
+    void AddToSizeClass(BD* i_bd);
+    void RemoveFromSizeClass(BD* i_bd);
+    inline BD* GetPhysicalNext(const BD* i_bd) const;
+    static inline size_t GetSizeClass(const size_t i_size);
+
 #ifdef BUILD_DEBUG
     bool CheckMemoryOverwrite(BD* i_bd) const;
     inline void ClearBlock(BD* i_bd, const unsigned char i_fill);
 #endif
 
 public:
-    static BlockAllocator* Create(void* i_memory, size_t i_block_size);
+    static BlockAllocator* Create(void* i_memory, size_t i_block_size, AllocationPolicy i_policy = AllocationPolicy::FirstFit);
     static void Destroy(BlockAllocator* i_allocator);
 
     static BlockAllocator* GetDefaultAllocator();
@@ -84,7 +113,7 @@ public:
     // Deallocate a block of memory
     bool Free(void* i_pointer);
 
-    // Run defragmentation
+    // Run defragmentation (segregated-fit allocators merge on every free so this does nothing for them)
     void Defragment();
 
     // Query whether a given pointer is within this allocator's range
@@ -97,6 +126,7 @@ public:
     inline const size_t GetTotalFreeMemorySize() const;
 
     inline const size_t GetNumOustandingBlocks() const;
+    inline AllocationPolicy GetPolicy() const;
 
 #ifdef BUILD_DEBUG
     inline unsigned int GetID() const;
@@ -116,7 +146,11 @@ private:
     BD*                                             free_list_head_;                                        // list of block descriptors describing free blocks
     BD*                                             user_list_head_;                                        // list of block descriptors describing allocated blocks
     
+    BD*                                             size_classes_[MAX_SIZE_CLASSES];                        // free descriptors binned by the highest set bit of their block size (segregated-fit only)
+    size_t                                          non_empty_size_classes_;                                // bit i is set when size_classes_[i] is not empty (segregated-fit only)
+
     size_t                                          total_block_size_;                                      // total size of block
+    AllocationPolicy                                policy_;                                                // how free blocks are tracked & searched
     static size_t                                   size_of_BD_;                                            // size of a BlockDescriptor object
 
     std::mutex                                      allocator_mutex_;                                       // makes this allocator thread safe
@@ -4,8 +4,8 @@
 #include <string.h>         // for memset
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Data\BitArray.h"
+#include "Assert/Assert.h"
+#include "Data/BitArray.h"
 
 namespace engine {
 namespace memory {
@@ -25,6 +25,28 @@ namespace memory {
 #endif
     }
 
+    inline bool FixedSizeAllocator::IsBlockHeld(const size_t i_bit_index) const
+    {
+        ASSERT(i_bit_index < num_blocks_);
+        return (user_state_[i_bit_index / USER_STATE_BIT_DEPTH].load(std::memory_order_relaxed) & (size_t(1) << (i_bit_index % USER_STATE_BIT_DEPTH))) != 0;
+    }
+
+    // Returns true if the block was not already held by a user
+    inline bool FixedSizeAllocator::SetBlockHeld(const size_t i_bit_index)
+    {
+        ASSERT(i_bit_index < num_blocks_);
+        const size_t mask = size_t(1) << (i_bit_index % USER_STATE_BIT_DEPTH);
+        return (user_state_[i_bit_index / USER_STATE_BIT_DEPTH].fetch_or(mask, std::memory_order_relaxed) & mask) == 0;
+    }
+
+    // Returns true if the block was held by a user
+    inline bool FixedSizeAllocator::ClearBlockHeld(const size_t i_bit_index)
+    {
+        ASSERT(i_bit_index < num_blocks_);
+        const size_t mask = size_t(1) << (i_bit_index % USER_STATE_BIT_DEPTH);
+        return (user_state_[i_bit_index / USER_STATE_BIT_DEPTH].fetch_and(~mask, std::memory_order_relaxed) & mask) != 0;
+    }
+
 #ifdef BUILD_DEBUG
     inline void FixedSizeAllocator::ClearBlock(size_t i_bit_index, const unsigned char i_fill)
     {
@@ -2,6 +2,7 @@
 #define ENGINE_FIXED_SIZE_ALLOCATOR_H_
 
 // library includes
+#include <atomic>
 #include <stdint.h>
 #include <mutex>
 
@@ -31,6 +32,8 @@ class BlockAllocator;
     - No more than 15 (MAX_FIXED_SIZE_ALLOCATORS) instances of this class must be created & no two instances can have the same block size
     - In order to be within overridden versions of new, delete, malloc & free, an instance must be "registered" using
       the static AddFixedSizeAllocator function
+    - Blocks can be handed out to a ThreadCache in batches. Each block also has a bit that is only set while a user holds it,
+      so IsAllocated never reports blocks that are sitting in a cache
 */
 class FixedSizeAllocator
 {
@@ -43,6 +46,11 @@ private:
     ~FixedSizeAllocator();
 
     inline uint8_t* GetPointerForBlock(const size_t i_bit_index) const;
+    bool GetBitIndexForPointer(const void* i_pointer, size_t& o_bit_index) const;
+
+    inline bool IsBlockHeld(const size_t i_bit_index) const;
+    inline bool SetBlockHeld(const size_t i_bit_index);
+    inline bool ClearBlockHeld(const size_t i_bit_index);
 
 #ifdef BUILD_DEBUG
     bool CheckMemoryOverwrite(const size_t i_bit_index) const;
@@ -65,6 +73,15 @@ public:
     // deallocate a block of memory
     bool Free(void* i_pointer);
 
+    // move up to i_count free blocks into o_blocks, returns the number of blocks moved
+    size_t AllocBatch(void** o_blocks, const size_t i_count);
+    // return i_count blocks that were moved out by AllocBatch
+    void FreeBatch(void* const* i_blocks, const size_t i_count);
+    // hand a block that was moved out by AllocBatch to a user (does not lock)
+    void* TakeCachedBlock(void* i_block, const size_t i_size);
+    // take a block back from a user without returning it to the allocator (does not lock)
+    bool CacheBlock(void* i_pointer);
+
     // Query whether a given pointer is within this allocator's range
     inline bool Contains(const void* i_pointer) const;
     // Query whether a given pointer is an outstanding allocation
@@ -89,6 +106,7 @@ private:
     size_t                                          num_blocks_;                                            // total number of fixed blocks
     BlockAllocator*                                 block_allocator_;                                       // the block allocator used for the initial allocation
     engine::data::BitArray*                         block_state_;                                           // a bit array to maintain the state (available = 0, allocated = 1) of each block of memory
+    std::atomic<size_t>*                            user_state_;                                            // one bit per block that is set while a user holds the block
 
     std::mutex                                      allocator_mutex_;                                       // makes this allocator thread safe
 
@@ -111,6 +129,8 @@ private:
     static FixedSizeAllocator*                      available_allocators_[MAX_FIXED_SIZE_ALLOCATORS];       // an array of pointers to all available fixed size allocators
     static FSASort                                  FSASorter;                                              // a custom function object to sort available fixed size allocators
 
+    static const size_t                             USER_STATE_BIT_DEPTH = sizeof(size_t) * 8;              // number of blocks tracked by each element of user_state_
+
 }; // class FixedSizeAllocator
 
 } // namespace memory
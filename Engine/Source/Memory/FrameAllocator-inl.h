@@ -0,0 +1,64 @@
+#include "FrameAllocator.h"
+
+// library includes
+#include <new>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Memory/AllocatorOverrides.h"
+
+namespace engine {
+namespace memory {
+
+    inline FrameAllocator* FrameAllocator::Get()
+    {
+        return instance_;
+    }
+
+    inline bool FrameAllocator::Contains(const void* i_pointer) const
+    {
+        return (static_cast<const uint8_t*>(i_pointer) >= memory_ && static_cast<const uint8_t*>(i_pointer) < (memory_ + size_));
+    }
+
+    inline size_t FrameAllocator::GetSize() const
+    {
+        return size_;
+    }
+
+    inline size_t FrameAllocator::GetUsedSize() const
+    {
+        const size_t offset = offset_.load(std::memory_order_relaxed);
+        return offset < size_ ? offset : size_;
+    }
+
+    inline size_t FrameAllocator::GetHighWaterMark() const
+    {
+        return high_water_mark_;
+    }
+
+    template<typename T>
+    inline T* FrameAllocatorAdapter<T>::allocate(const size_t i_count)
+    {
+        FrameAllocator* frame_allocator = FrameAllocator::Get();
+        void* pointer = frame_allocator ? frame_allocator->Alloc(i_count * sizeof(T), alignof(T)) : nullptr;
+        if (pointer == nullptr)
+        {
+            // the heap only guarantees the default alignment, so ask for more when the type needs it (e.g. SSE matrices)
+            pointer = alignof(T) > DEFAULT_BYTE_ALIGNMENT ? ::operator new(i_count * sizeof(T), static_cast<AlignmentType>(alignof(T))) : ::operator new(i_count * sizeof(T));
+        }
+        return static_cast<T*>(pointer);
+    }
+
+    template<typename T>
+    inline void FrameAllocatorAdapter<T>::deallocate(T* i_pointer, const size_t i_count)
+    {
+        // frame memory is released all at once by the reset
+        FrameAllocator* frame_allocator = FrameAllocator::Get();
+        if (frame_allocator == nullptr || !frame_allocator->Contains(i_pointer))
+        {
+            ::operator delete(i_pointer);
+        }
+    }
+
+} // namespace memory
+} // namespace engine
@@ -0,0 +1,99 @@
+#ifndef ENGINE_FRAME_ALLOCATOR_H_
+#define ENGINE_FRAME_ALLOCATOR_H_
+
+// library includes
+#include <atomic>
+#include <stdint.h>
+#include <vector>
+
+// engine includes
+#include "AllocatorUtil.h"
+
+namespace engine {
+namespace memory {
+
+// forward declarations
+class BlockAllocator;
+
+/*
+    FrameAllocator
+    - A linear allocator for data that only lives until the end of the current tick
+    - Allocating simply bumps an offset (lock-free, so jobs can allocate too) & freeing is a no-op
+    - The engine resets it once at the start of every iteration of engine::Run(), which releases everything at once
+    - Nothing allocated from it may be held across a reset
+    - It records the most memory used in any one frame & reports it to the profiler
+*/
+class FrameAllocator
+{
+private:
+    FrameAllocator(uint8_t* i_memory, const size_t i_size, BlockAllocator* i_allocator);
+    ~FrameAllocator();
+    static FrameAllocator* instance_;
+
+    // disable copy constructor & assignment operator
+    FrameAllocator(const FrameAllocator& i_copy) = delete;
+    FrameAllocator& operator=(const FrameAllocator& i_copy) = delete;
+
+public:
+    static FrameAllocator* Create(const size_t i_size, BlockAllocator* i_allocator);
+    static void Destroy();
+    static inline FrameAllocator* Get();
+
+    // allocate memory that is valid until the next reset, returns nullptr when the frame's memory is exhausted
+    void* Alloc(const size_t i_size, const size_t i_alignment = DEFAULT_BYTE_ALIGNMENT);
+    // release everything allocated this frame
+    void Reset();
+
+    // query whether a given pointer is within this allocator's range
+    inline bool Contains(const void* i_pointer) const;
+
+    inline size_t GetSize() const;
+    inline size_t GetUsedSize() const;
+    inline size_t GetHighWaterMark() const;
+
+private:
+    uint8_t*                                        memory_;                                                // start of the frame's memory
+    size_t                                          size_;                                                  // size of the frame's memory
+    std::atomic<size_t>                             offset_;                                                // offset of the next free byte
+    size_t                                          high_water_mark_;                                       // most memory used in a single frame
+    BlockAllocator*                                 allocator_;                                             // the allocator that owns the frame's memory
+
+}; // class FrameAllocator
+
+/*
+    FrameAllocatorAdapter
+    - An STL compatible allocator that takes its memory from the FrameAllocator
+    - Deallocation is free for memory that came from the FrameAllocator
+    - Falls back to the heap if there is no FrameAllocator or the frame's memory is exhausted
+    - Containers using it must be emptied & have their storage released before the next reset
+*/
+template<typename T>
+class FrameAllocatorAdapter
+{
+public:
+    typedef T value_type;
+
+    FrameAllocatorAdapter() = default;
+    template<typename U>
+    FrameAllocatorAdapter(const FrameAllocatorAdapter<U>&) {}
+
+    inline T* allocate(const size_t i_count);
+    inline void deallocate(T* i_pointer, const size_t i_count);
+
+    template<typename U>
+    inline bool operator==(const FrameAllocatorAdapter<U>&) const { return true; }
+    template<typename U>
+    inline bool operator!=(const FrameAllocatorAdapter<U>&) const { return false; }
+
+}; // class FrameAllocatorAdapter
+
+// a vector whose storage only lives until the end of the current tick
+template<typename T>
+using FrameVector = std::vector<T, FrameAllocatorAdapter<T>>;
+
+} // namespace memory
+} // namespace engine
+
+#include "FrameAllocator-inl.h"
+
+#endif // ENGINE_FRAME_ALLOCATOR_H_
@@ -1,14 +1,14 @@
 #ifdef BUILD_DEBUG
 
-#include "Memory\AllocationCounter.h"
+#include "Memory/AllocationCounter.h"
 
 // library includes
 #include <algorithm>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Common\HelperMacros.h"
-#include "Logger\Logger.h"
+#include "Assert/Assert.h"
+#include "Common/HelperMacros.h"
+#include "Logger/Logger.h"
 
 namespace engine {
 namespace memory {
@@ -1,13 +1,11 @@
-#include "Memory\AllocatorOverrides.h"
-
-// library includes
-#include <mutex>
+#include "Memory/AllocatorOverrides.h"
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Logger\Logger.h"
-#include "Memory\BlockAllocator.h"
-#include "Memory\FixedSizeAllocator.h"
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+#include "Memory/BlockAllocator.h"
+#include "Memory/FixedSizeAllocator.h"
+#include "Memory/ThreadCache.h"
 
 //_Check_return_ _Ret_maybenull_ _Post_writable_byte_size_(i_size)
 ///*_ACRTIMP*/ _CRTALLOCATOR _CRT_JIT_INTRINSIC _CRTRESTRICT
@@ -27,7 +25,7 @@ void* operator new(size_t i_size)
     return engine::memory::DoAlloc(i_size, __FUNCTION__);
 }
 
-void operator delete(void* i_pointer)
+void operator delete(void* i_pointer) noexcept
 {
     engine::memory::DoFree(i_pointer, __FUNCTION__);
 }
@@ -37,7 +35,7 @@ void* operator new[](size_t i_size)
     return engine::memory::DoAlloc(i_size, __FUNCTION__);
 }
 
-void operator delete[](void* i_pointer)
+void operator delete[](void* i_pointer) noexcept
 {
     engine::memory::DoFree(i_pointer, __FUNCTION__);
 }
@@ -194,13 +192,16 @@ void operator delete(void* i_pointer, const char* i_file_name, unsigned int i_li
 namespace engine {
 namespace memory {
 
-std::mutex allocator_util_mutex;
+// Allocators must be registered before other threads start allocating, which is why
+// the lists of registered allocators are read here without a lock.
+// Each allocator is thread safe on its own & the thread cache lets most requests skip the fixed size allocators' locks.
 
 void* DoAlloc(size_t i_size, const char* i_function_name)
 {
     void* pointer = nullptr;
 
-    std::lock_guard<std::mutex> lock(allocator_util_mutex);
+    // get the calling thread's cache
+    engine::memory::ThreadCache* thread_cache = engine::memory::ThreadCache::Get();
 
     // loop over the available fixed size allocators to find the best fit
     engine::memory::FixedSizeAllocator** const available_fsas = engine::memory::FixedSizeAllocator::GetAvailableFixedSizeAllocators();
@@ -209,7 +210,7 @@ void* DoAlloc(size_t i_size, const char* i_function_name)
         // if the FSA exists and is big enough to service this request
         if (available_fsas[i] && available_fsas[i]->GetBlockSize() >= i_size)
         {
-            pointer = available_fsas[i]->Alloc(i_size);
+            pointer = thread_cache ? thread_cache->Alloc(i, available_fsas[i], i_size) : available_fsas[i]->Alloc(i_size);
             if (pointer)
             {
 #ifdef BUILD_DEBUG
@@ -240,16 +241,18 @@ void DoFree(void* i_pointer, const char* i_function_name)
 {
     ASSERT(i_pointer);
 
+    // get the calling thread's cache
+    engine::memory::ThreadCache* thread_cache = engine::memory::ThreadCache::Get();
+
     // get all available fixed size allocators
     engine::memory::FixedSizeAllocator** const fixed_size_allocators = engine::memory::FixedSizeAllocator::GetAvailableFixedSizeAllocators();
 
-    std::lock_guard<std::mutex> lock(allocator_util_mutex);
-
     // free the pointer from the appropriate allocator
     uint8_t num_fixed_size_allocators = MAX_FIXED_SIZE_ALLOCATORS;
     while (num_fixed_size_allocators > 0)
     {
-        if (fixed_size_allocators[num_fixed_size_allocators - 1] && fixed_size_allocators[num_fixed_size_allocators - 1]->Free(i_pointer))
+        engine::memory::FixedSizeAllocator* fsa = fixed_size_allocators[num_fixed_size_allocators - 1];
+        if (fsa && fsa->Contains(i_pointer) && (thread_cache ? thread_cache->Free(num_fixed_size_allocators - 1, fsa, i_pointer) : fsa->Free(i_pointer)))
         {
 #ifdef BUILD_DEBUG
             VERBOSE("Called %s(i_pointer = %p) on FixedSizeAllocator-%d with fixed_block_size:%zu", i_function_name, i_pointer, fixed_size_allocators[num_fixed_size_allocators - 1]->GetID(), fixed_size_allocators[num_fixed_size_allocators - 1]->GetBlockSize());
@@ -1,11 +1,16 @@
-#include "Memory\AllocatorUtil.h"
+#include "Memory/AllocatorUtil.h"
+
+// library includes
+#include <stdlib.h>         // for _aligned_malloc & posix_memalign
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Logger\Logger.h"
-#include "Memory\AllocationCounter.h"
-#include "Memory\BlockAllocator.h"
-#include "Memory\FixedSizeAllocator.h"
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+#include "Memory/AllocationCounter.h"
+#include "Memory/BlockAllocator.h"
+#include "Memory/FixedSizeAllocator.h"
+#include "Memory/FrameAllocator.h"
+#include "Memory/ThreadCache.h"
 
 namespace engine {
 namespace memory {
@@ -30,6 +35,12 @@ void CreateAllocators()
     fsa = FixedSizeAllocator::Create(base_size * 9, 300, default_allocator);
     FixedSizeAllocator::AddFixedSizeAllocator(fsa);
 
+    // initialize the frame allocator for per-tick data
+    FrameAllocator::Create(DEFAULT_BLOCK_SIZE, default_allocator);
+
+    // all fixed size allocators are registered so threads can start caching their blocks
+    ThreadCache::Enable();
+
 #ifdef BUILD_DEBUG
     // initialize the allocation counter
     AllocationCounter::Create();
@@ -38,11 +49,17 @@ void CreateAllocators()
 
 void DestroyAllocators()
 {
+    // return this thread's cached blocks & stop caching
+    ThreadCache::Disable();
+
 #ifdef BUILD_DEBUG
     AllocationCounter::Get()->Dump();
     AllocationCounter::Destroy();
 #endif
 
+    // destroy the frame allocator
+    FrameAllocator::Destroy();
+
     // destroy the fixed size allocators
     FixedSizeAllocator** const registered_fsas = FixedSizeAllocator::GetAvailableFixedSizeAllocators();
 
@@ -59,5 +76,25 @@ void DestroyAllocators()
     BlockAllocator::DestroyDefaultAllocator();
 }
 
+void* AlignedMalloc(size_t i_size, size_t i_alignment)
+{
+#if defined(_MSC_VER)
+    return _aligned_malloc(i_size, i_alignment);
+#else
+    // posix_memalign can't align to less than a pointer
+    void* memory = nullptr;
+    return posix_memalign(&memory, i_alignment < sizeof(void*) ? sizeof(void*) : i_alignment, i_size) == 0 ? memory : nullptr;
+#endif
+}
+
+void AlignedFree(void* i_memory)
+{
+#if defined(_MSC_VER)
+    _aligned_free(i_memory);
+#else
+    free(i_memory);
+#endif
+}
+
 } // namespace memory
 } // namespace engine
\ No newline at end of file
@@ -1,21 +1,20 @@
-#include "Memory\BlockAllocator.h"
+#include "Memory/BlockAllocator.h"
 
 // library includes
 #include <limits>           // for numeric_limits
 #include <new>              // for placement new
-#include <stdlib.h>         // for _aligned_malloc & _aligned_free
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Logger\Logger.h"
-#include "Memory\AllocationCounter.h"
-#include "Memory\AllocatorUtil.h"
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+#include "Memory/AllocationCounter.h"
+#include "Memory/AllocatorUtil.h"
 
 namespace engine {
 namespace memory {
 
 // initialize static members
-const size_t                BlockAllocator::DEFAULT_ALLOCATOR_SIZE = 10 * 1024 * 1024;
+const size_t                BlockAllocator::DEFAULT_ALLOCATOR_SIZE = 16 * 1024 * 1024;
 size_t                      BlockAllocator::size_of_BD_ = sizeof(BD);
 BlockAllocator*             BlockAllocator::available_allocators_[MAX_BLOCK_ALLOCATORS] = { nullptr };
 
@@ -23,10 +22,13 @@ BlockAllocator*             BlockAllocator::available_allocators_[MAX_BLOCK_ALLO
 uint8_t                     BlockAllocator::counter_ = 0;
 #endif
 
-BlockAllocator::BlockAllocator(void* i_memory, size_t i_block_size) : block_(static_cast<uint8_t*>(i_memory)),
+BlockAllocator::BlockAllocator(void* i_memory, size_t i_block_size, AllocationPolicy i_policy) : block_(static_cast<uint8_t*>(i_memory)),
     user_list_head_(nullptr),
     free_list_head_(nullptr),
-    total_block_size_(i_block_size)
+    size_classes_{ nullptr },
+    non_empty_size_classes_(0),
+    total_block_size_(i_block_size),
+    policy_(i_policy)
 {
     // validate input
     ASSERT(block_);
@@ -45,7 +47,7 @@ BlockAllocator::BlockAllocator(void* i_memory, size_t i_block_size) : block_(sta
     InitFirstBlockDescriptor();
 }
 
-BlockAllocator* BlockAllocator::Create(void* i_memory, size_t i_block_size)
+BlockAllocator* BlockAllocator::Create(void* i_memory, size_t i_block_size, AllocationPolicy i_policy)
 {
     // validate input
     ASSERT(i_memory);
@@ -59,7 +61,7 @@ BlockAllocator* BlockAllocator::Create(void* i_memory, size_t i_block_size)
     i_block_size -= sizeof(BlockAllocator);
 
     // create the allocator
-    BlockAllocator* block_allocator = new (i_memory) BlockAllocator(block_allocator_memory, i_block_size);
+    BlockAllocator* block_allocator = new (i_memory) BlockAllocator(block_allocator_memory, i_block_size, i_policy);
     ASSERT(block_allocator);
 
     return block_allocator;
@@ -100,7 +102,7 @@ void BlockAllocator::CreateDefaultAllocator()
     size_t default_block_size = DEFAULT_ALLOCATOR_SIZE;
 
     // allocate aligned memory for the default allocator
-    void* default_allocator_memory = _aligned_malloc(default_block_size, 4);
+    void* default_allocator_memory = AlignedMalloc(default_block_size, DEFAULT_BYTE_ALIGNMENT);
     ASSERT(default_allocator_memory);
 
     // add the allocator to the start of the aligned memory block
@@ -111,14 +113,15 @@ void BlockAllocator::CreateDefaultAllocator()
     default_block_size -= sizeof(BlockAllocator);
 
     // create the default allocator
-    available_allocators_[0] = new (default_allocator_memory) BlockAllocator(block_allocator_memory, default_block_size);
+    // it services every allocation that the fixed size allocators can't, so it uses segregated size classes to keep Alloc & Free constant time
+    available_allocators_[0] = new (default_allocator_memory) BlockAllocator(block_allocator_memory, default_block_size, AllocationPolicy::SegregatedFit);
     if (!available_allocators_[0])
     {
         // spit out an error
         LOG_ERROR("Could not create the default allocator!");
 
         // free the aligned memory
-        _aligned_free(default_allocator_memory);
+        AlignedFree(default_allocator_memory);
         default_allocator_memory = nullptr;
         return;
     }
@@ -128,7 +131,7 @@ void BlockAllocator::DestroyDefaultAllocator()
 {
     Destroy(available_allocators_[0]);
 
-    _aligned_free(available_allocators_[0]);
+    AlignedFree(available_allocators_[0]);
     available_allocators_[0] = nullptr;
 }
 
@@ -190,12 +193,21 @@ void BlockAllocator::InitFirstBlockDescriptor()
     BD* first_bd = reinterpret_cast<BD*>(block_);
     first_bd->block_pointer = block_ + size_of_BD_;
     first_bd->block_size = total_block_size_ - size_of_BD_;
+    first_bd->physical_previous = nullptr;
+    first_bd->is_free = false;
 #ifdef BUILD_DEBUG
     first_bd->id = descriptor_counter_++;
 #endif
 
     // add the descriptor to the free list
-    AddToList(&free_list_head_, &first_bd, false);
+    if (policy_ == AllocationPolicy::SegregatedFit)
+    {
+        AddToSizeClass(first_bd);
+    }
+    else
+    {
+        AddToList(&free_list_head_, &first_bd, false);
+    }
 }
 
 void BlockAllocator::AddToList(BD** i_head, BD** i_bd, bool i_enable_sort)
@@ -314,6 +326,60 @@ void* BlockAllocator::Alloc(const size_t i_size, const size_t i_alignment)
     // alignment should be power of two!
     ASSERT((i_alignment & (i_alignment - 1)) == 0);
 
+#ifdef BUILD_DEBUG
+    const size_t    guardband_size = DEFAULT_GUARDBAND_SIZE;
+#else
+    const size_t    guardband_size = 0;
+#endif
+
+    // find a block descriptor to service this request
+    BD*             new_bd = policy_ == AllocationPolicy::SegregatedFit ? FindSegregatedFitBlock(i_size, i_alignment) : FindFirstFitBlock(i_size, i_alignment);
+
+    // this means we couldn't find a block
+    if (new_bd == nullptr)
+    {
+#ifdef BUILD_DEBUG
+        LOG_ERROR("BlockAllocator-%d ran out of memory!", id_);
+#else
+        LOG_ERROR("A BlockAllocator ran out of memory!");
+#endif
+        return nullptr;
+    }
+
+#ifdef BUILD_DEBUG
+    // clear the block
+    ClearBlock(new_bd, CLEAN_FILL);
+
+    // add guardbands
+    for (uint8_t i = 0; i < guardband_size; ++i)
+    {
+        *(new_bd->block_pointer + i) = GUARDBAND_FILL;
+        *(new_bd->block_pointer + guardband_size + i_size + i) = GUARDBAND_FILL;
+    }
+
+    // save the size requested by the user for future use
+    new_bd->user_size = i_size;
+#endif
+
+    // add the descriptor to the user list
+    AddToList(&user_list_head_, &new_bd, false);
+
+#ifdef BUILD_DEBUG
+    // update diagnostic information
+    ++stats_.num_allocated;
+    ++stats_.num_outstanding;
+    stats_.max_num_outstanding = stats_.max_num_outstanding < stats_.num_outstanding ? stats_.num_outstanding : stats_.max_num_outstanding;
+    stats_.allocated_memory_size += (size_of_BD_ + new_bd->block_size);
+    stats_.available_memory_size -= (size_of_BD_ + new_bd->block_size);
+    stats_.max_allocated_memory_size = stats_.max_allocated_memory_size < stats_.allocated_memory_size ? stats_.allocated_memory_size : stats_.max_allocated_memory_size;
+    COUNT_ALLOC(i_size);
+#endif
+
+    return (new_bd->block_pointer + guardband_size);
+}
+
+BD* BlockAllocator::FindFirstFitBlock(const size_t i_size, const size_t i_alignment)
+{
 #ifdef BUILD_DEBUG
     const size_t    guardband_size = DEFAULT_GUARDBAND_SIZE;
 #else
@@ -345,6 +411,8 @@ void* BlockAllocator::Alloc(const size_t i_size, const size_t i_alignment)
                 new_bd = reinterpret_cast<BD*>(new_block_pointer);
                 new_bd->block_pointer = new_block_pointer + size_of_BD_;
                 new_bd->block_size = i_size + alignment_offset + guardband_size * 2;
+                new_bd->physical_previous = nullptr;
+                new_bd->is_free = false;
 #ifdef BUILD_DEBUG
                 new_bd->id = descriptor_counter_++;
                 descriptor_counter_ = (descriptor_counter_ >= std::numeric_limits<uint32_t>::max() ? 0 : descriptor_counter_);
@@ -378,72 +446,191 @@ void* BlockAllocator::Alloc(const size_t i_size, const size_t i_alignment)
         free_bd = free_bd->next;
 
         // have we reached the end of the free list?
-        if (free_bd == nullptr)
+        if (free_bd == nullptr && !did_defrag)
         {
-            // this means we still haven't found a free block that's big enough         
-            if (!did_defrag)
-            {
-                // defragment but only ONCE
-                did_defrag = true;
-                Defragment();
+            // this means we still haven't found a free block that's big enough
+            // defragment but only ONCE
+            did_defrag = true;
+            Defragment();
 
-                // start again at the front of the free list
-                free_bd = free_list_head_;
-            }
-            else
-            {
+            // start again at the front of the free list
+            free_bd = free_list_head_;
+        }
+
+    } // end of while loop to search for free blocks
+
+    return new_bd;
+}
+
+BD* BlockAllocator::FindSegregatedFitBlock(const size_t i_size, const size_t i_alignment)
+{
 #ifdef BUILD_DEBUG
-                LOG_ERROR("BlockAllocator-%d ran out of memory!", id_);
+    const size_t    guardband_size = DEFAULT_GUARDBAND_SIZE;
 #else
-                LOG_ERROR("A BlockAllocator ran out of memory!");
+    const size_t    guardband_size = 0;
 #endif
-                return nullptr;
-            }
-        }
 
-    } // end of while loop to search for free blocks
+    // the most memory this request could take out of a free block that must be fragmented
+    const size_t    worst_case_size = size_of_BD_ + guardband_size * 2 + i_size + (i_alignment - 1) + MAX_EXTRA_MEMORY;
+    const size_t    size_class = GetSizeClass(worst_case_size);
 
-    // this means we couldn't find a block even after defragmenting
-    if (new_bd == nullptr)
+    // every block in a size class strictly higher than the request's size class is big enough,
+    // so the lowest such non-empty class is found with a single bit scan instead of a search
+    const size_t    first_fitting_class = (size_t(1) << size_class) == worst_case_size ? size_class : size_class + 1;
+    const size_t    fitting_classes = first_fitting_class < MAX_SIZE_CLASSES ? (non_empty_size_classes_ & ~((size_t(1) << first_fitting_class) - 1)) : 0;
+    if (fitting_classes != 0)
     {
-#ifdef BUILD_DEBUG
-        LOG_ERROR("BlockAllocator-%d ran out of memory!", id_);
+        unsigned long bit_index_long = 0;
+#if defined(_MSC_VER)
+#if defined(_WIN64)
+        _BitScanForward64(&bit_index_long, fitting_classes);
 #else
-        LOG_ERROR("A BlockAllocator ran out of memory!");
+        _BitScanForward(&bit_index_long, fitting_classes);
+#endif
+#else
+        bit_index_long = static_cast<unsigned long>(__builtin_ctzll(fitting_classes));
 #endif
+        return SplitBlock(size_classes_[bit_index_long], i_size, i_alignment);
+    }
+
+    // the request's own size class may still have a block that fits but only its head is checked to keep this constant time
+    BD*             free_bd = size_classes_[size_class];
+    if (free_bd == nullptr)
+    {
         return nullptr;
     }
 
+    // check if this block can be fragmented
+    uint8_t*        new_block_pointer = free_bd->block_pointer + free_bd->block_size - size_of_BD_ - guardband_size * 2 - i_size;
+    const size_t    alignment_offset = reinterpret_cast<uintptr_t>(new_block_pointer + size_of_BD_ + guardband_size) & (i_alignment - 1);
+    if ((size_of_BD_ + guardband_size * 2 + i_size + alignment_offset + MAX_EXTRA_MEMORY) <= free_bd->block_size)
+    {
+        return SplitBlock(free_bd, i_size, i_alignment);
+    }
+
+    // check if this block can be used as is
+    if ((i_size + guardband_size * 2) <= free_bd->block_size && (reinterpret_cast<uintptr_t>(free_bd->block_pointer + guardband_size) & (i_alignment - 1)) == 0)
+    {
+        RemoveFromSizeClass(free_bd);
+        free_bd->is_free = false;
+        return free_bd;
+    }
+
+    return nullptr;
+}
+
+BD* BlockAllocator::SplitBlock(BD* i_free_bd, const size_t i_size, const size_t i_alignment)
+{
+    // validate input
+    ASSERT(i_free_bd != nullptr && i_free_bd->is_free);
+
 #ifdef BUILD_DEBUG
-    // clear the block
-    ClearBlock(new_bd, CLEAN_FILL);
+    const size_t    guardband_size = DEFAULT_GUARDBAND_SIZE;
+#else
+    const size_t    guardband_size = 0;
+#endif
 
-    // add guardbands
-    for (uint8_t i = 0; i < guardband_size; ++i)
+    // carve the new block out of the end of the free block so that the free block keeps its descriptor
+    uint8_t*        new_block_pointer = i_free_bd->block_pointer + i_free_bd->block_size - size_of_BD_ - guardband_size * 2 - i_size;
+    const size_t    alignment_offset = reinterpret_cast<uintptr_t>(new_block_pointer + size_of_BD_ + guardband_size) & (i_alignment - 1);
+    new_block_pointer -= alignment_offset;
+    ASSERT((size_of_BD_ + guardband_size * 2 + i_size + alignment_offset + MAX_EXTRA_MEMORY) <= i_free_bd->block_size);
+
+    // the free block's size is about to change so take it out of its size class
+    RemoveFromSizeClass(i_free_bd);
+
+    // initialize the new block's descriptor
+    BD*             new_bd = reinterpret_cast<BD*>(new_block_pointer);
+    new_bd->block_pointer = new_block_pointer + size_of_BD_;
+    new_bd->block_size = i_size + alignment_offset + guardband_size * 2;
+    new_bd->physical_previous = i_free_bd;
+    new_bd->is_free = false;
+#ifdef BUILD_DEBUG
+    new_bd->id = descriptor_counter_++;
+    descriptor_counter_ = (descriptor_counter_ >= std::numeric_limits<uint32_t>::max() ? 0 : descriptor_counter_);
+#endif
+
+    // the block after the new block now sits right after the new block's descriptor
+    BD*             next_bd = GetPhysicalNext(new_bd);
+    if (next_bd != nullptr)
     {
-        *(new_bd->block_pointer + i) = GUARDBAND_FILL;
-        *(new_bd->block_pointer + guardband_size + i_size + i) = GUARDBAND_FILL;
+        next_bd->physical_previous = new_bd;
     }
 
-    // save the size requested by the user for future use
-    new_bd->user_size = i_size;
+    // splice the free block & put it back in the size class for its new size
+    i_free_bd->block_size -= (size_of_BD_ + new_bd->block_size);
+    AddToSizeClass(i_free_bd);
+
+    return new_bd;
+}
+
+BD* BlockAllocator::MergeWithNeighbours(BD* i_bd)
+{
+    // validate input
+    ASSERT(i_bd != nullptr);
+
+    // absorb the next block if it is free
+    BD* next_bd = GetPhysicalNext(i_bd);
+    if (next_bd != nullptr && next_bd->is_free)
+    {
+#ifdef BUILD_DEBUG
+        VERBOSE("Merging %zu bytes from block-%d & block-%d", (next_bd->block_size + size_of_BD_), i_bd->id, next_bd->id);
 #endif
+        RemoveFromSizeClass(next_bd);
+        i_bd->block_size += (size_of_BD_ + next_bd->block_size);
 
-    // add the descriptor to the user list
-    AddToList(&user_list_head_, &new_bd, false);
+        next_bd = GetPhysicalNext(i_bd);
+        if (next_bd != nullptr)
+        {
+            next_bd->physical_previous = i_bd;
+        }
+    }
 
+    // get absorbed by the previous block if it is free
+    BD* previous_bd = i_bd->physical_previous;
+    if (previous_bd != nullptr && previous_bd->is_free)
+    {
 #ifdef BUILD_DEBUG
-    // update diagnostic information
-    ++stats_.num_allocated;
-    ++stats_.num_outstanding;
-    stats_.max_num_outstanding = stats_.max_num_outstanding < stats_.num_outstanding ? stats_.num_outstanding : stats_.max_num_outstanding;
-    stats_.allocated_memory_size += (size_of_BD_ + new_bd->block_size);
-    stats_.available_memory_size -= (size_of_BD_ + new_bd->block_size);
-    stats_.max_allocated_memory_size = stats_.max_allocated_memory_size < stats_.allocated_memory_size ? stats_.allocated_memory_size : stats_.max_allocated_memory_size;
-    COUNT_ALLOC(i_size);
+        VERBOSE("Merging %zu bytes from block-%d & block-%d", (i_bd->block_size + size_of_BD_), previous_bd->id, i_bd->id);
 #endif
+        RemoveFromSizeClass(previous_bd);
+        previous_bd->block_size += (size_of_BD_ + i_bd->block_size);
 
-    return (new_bd->block_pointer + guardband_size);
+        next_bd = GetPhysicalNext(previous_bd);
+        if (next_bd != nullptr)
+        {
+            next_bd->physical_previous = previous_bd;
+        }
+
+        i_bd = previous_bd;
+    }
+
+    return i_bd;
+}
+
+void BlockAllocator::AddToSizeClass(BD* i_bd)
+{
+    // validate input
+    ASSERT(i_bd != nullptr && !i_bd->is_free);
+
+    const size_t size_class = GetSizeClass(i_bd->block_size);
+    AddToList(&size_classes_[size_class], &i_bd, false);
+    non_empty_size_classes_ |= (size_t(1) << size_class);
+    i_bd->is_free = true;
+}
+
+void BlockAllocator::RemoveFromSizeClass(BD* i_bd)
+{
+    // validate input
+    ASSERT(i_bd != nullptr && i_bd->is_free);
+
+    const size_t size_class = GetSizeClass(i_bd->block_size);
+    RemoveFromList(&size_classes_[size_class], &i_bd);
+    if (size_classes_[size_class] == nullptr)
+    {
+        non_empty_size_classes_ &= ~(size_t(1) << size_class);
+    }
+    i_bd->is_free = false;
 }
 
 // Deallocate a block of memory
@@ -481,12 +668,7 @@ bool BlockAllocator::Free(void* i_pointer)
 
     // reset the user size
     bd->user_size = 0;
-#endif
-
-    // add the descriptor to the free list
-    AddToList(&free_list_head_, &bd, true);
 
-#ifdef BUILD_DEBUG
     // update diagnostic information
     ++stats_.num_freed;
     --stats_.num_outstanding;
@@ -494,12 +676,29 @@ bool BlockAllocator::Free(void* i_pointer)
     stats_.available_memory_size += (bd->block_size);
 #endif
 
+    // add the descriptor to the free list
+    if (policy_ == AllocationPolicy::SegregatedFit)
+    {
+        // merge with free neighbours right away so there is never anything left to defragment
+        AddToSizeClass(MergeWithNeighbours(bd));
+    }
+    else
+    {
+        AddToList(&free_list_head_, &bd, true);
+    }
+
     return true;
 }
 
 // Run defragmentation
 void BlockAllocator::Defragment()
 {
+    // free blocks are merged with their neighbours as soon as they are freed
+    if (policy_ == AllocationPolicy::SegregatedFit)
+    {
+        return;
+    }
+
 #ifdef BUILD_DEBUG
     VERBOSE("Defragmenting...");
     size_t              num_blocks_combined = 0;
@@ -583,6 +782,11 @@ const size_t BlockAllocator::GetLargestFreeBlockSize(const size_t i_alignment) c
     size_t largest_size = 0;
     // loop the free list
     BD* bd = free_list_head_;
+    if (policy_ == AllocationPolicy::SegregatedFit && non_empty_size_classes_ != 0)
+    {
+        // the largest block must be in the highest non-empty size class
+        bd = size_classes_[GetSizeClass(non_empty_size_classes_)];
+    }
     while (bd != nullptr)
     {
         // check actual block size not user block size
@@ -620,7 +824,21 @@ void BlockAllocator::PrintAllDescriptors() const
 void BlockAllocator::PrintFreeDescriptors() const
 {
     VERBOSE("---------- %s ----------", __FUNCTION__);
-    if (free_list_head_ != nullptr)
+    if (policy_ == AllocationPolicy::SegregatedFit && non_empty_size_classes_ != 0)
+    {
+        size_t count = 0;
+        VERBOSE("FREE:");
+        for (size_t i = 0; i < MAX_SIZE_CLASSES; ++i)
+        {
+            for (BD* bd = size_classes_[i]; bd != nullptr; bd = bd->next)
+            {
+                VERBOSE("BD.id:%d size:%zu class:%zu", bd->id, bd->block_size, i);
+                ++count;
+            }
+        }
+        VERBOSE("FREE LIST SIZE:%d", count);
+    }
+    else if (free_list_head_ != nullptr)
     {
         size_t count = 0;
         VERBOSE("FREE:");
@@ -1,12 +1,15 @@
-#include "Memory\FixedSizeAllocator.h"
+#include "Memory/FixedSizeAllocator.h"
+
+// library includes
+#include <new>              // for placement new
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Data\BitArray.h"
-#include "Logger\Logger.h"
-#include "Memory\AllocationCounter.h"
-#include "Memory\AllocatorUtil.h"
-#include "Memory\BlockAllocator.h"
+#include "Assert/Assert.h"
+#include "Data/BitArray.h"
+#include "Logger/Logger.h"
+#include "Memory/AllocationCounter.h"
+#include "Memory/AllocatorUtil.h"
+#include "Memory/BlockAllocator.h"
 
 namespace engine {
 namespace memory {
@@ -24,7 +27,8 @@ FixedSizeAllocator::FixedSizeAllocator(void* i_memory, const size_t i_total_bloc
     fixed_block_size_(i_fixed_block_size),
     num_blocks_(i_num_blocks),
     block_allocator_(i_allocator),
-    block_state_(nullptr)
+    block_state_(nullptr),
+    user_state_(nullptr)
 {
     // validate input
     ASSERT(block_);
@@ -42,6 +46,18 @@ FixedSizeAllocator::FixedSizeAllocator(void* i_memory, const size_t i_total_bloc
     // reduce the usable memory
     total_block_size_ -= bit_array_memory_size;
 
+    // create the user state at the start of the block
+    const size_t num_user_state_buckets = (num_blocks_ + USER_STATE_BIT_DEPTH - 1) / USER_STATE_BIT_DEPTH;
+    user_state_ = reinterpret_cast<std::atomic<size_t>*>(block_);
+    for (size_t i = 0; i < num_user_state_buckets; ++i)
+    {
+        new (&user_state_[i]) std::atomic<size_t>(0);
+    }
+
+    // move up the usable memory
+    block_ += num_user_state_buckets * sizeof(std::atomic<size_t>);
+    total_block_size_ -= num_user_state_buckets * sizeof(std::atomic<size_t>);
+
 #ifdef BUILD_DEBUG
     id_ = FixedSizeAllocator::counter_++;
     memset(block_, CLEAN_FILL, total_block_size_);
@@ -72,10 +88,12 @@ FixedSizeAllocator* FixedSizeAllocator::Create(const size_t i_block_size, const
 
     // calculate the amount of memory required to create an FSA
     // per block, the FSA adds an overhead of 12 (32-bit) to 16 (64-bit) bytes in debug mode
-    size_t fsa_memory_size = sizeof(FixedSizeAllocator) + i_num_blocks * (i_block_size + size_type + guardband_size * 2) + engine::data::BitArray::GetRequiredMemorySize(i_num_blocks);
+    const size_t user_state_memory_size = ((i_num_blocks + USER_STATE_BIT_DEPTH - 1) / USER_STATE_BIT_DEPTH) * sizeof(std::atomic<size_t>);
+    size_t fsa_memory_size = sizeof(FixedSizeAllocator) + user_state_memory_size + i_num_blocks * (i_block_size + size_type + guardband_size * 2) + engine::data::BitArray::GetRequiredMemorySize(i_num_blocks);
 
     // allocate memory
-    void* memory = i_allocator->Alloc(fsa_memory_size);
+    // the user state follows the FSA & must be aligned for atomic access
+    void* memory = i_allocator->Alloc(fsa_memory_size, sizeof(size_t));
     ASSERT(memory);
 
     // move up the address of the usable block
@@ -237,7 +255,7 @@ void* FixedSizeAllocator::Alloc(const size_t i_size)
 
     // check if there are any blocks available
     size_t bit_index = -1;
-    bool block_available = block_state_->GetFirstClearBit(bit_index);
+    bool block_available = block_state_->FindClearBit(bit_index);
 
     // return nullptr if nothing was available
     if (!block_available)
@@ -252,6 +270,7 @@ void* FixedSizeAllocator::Alloc(const size_t i_size)
 
     // set the bit at this index
     block_state_->SetBit(bit_index);
+    SetBlockHeld(bit_index);
 
 #ifdef BUILD_DEBUG
     const size_t guardband_size = DEFAULT_GUARDBAND_SIZE;
@@ -342,8 +361,8 @@ bool FixedSizeAllocator::Free(void* i_pointer)
         return false;
     }
 
-    // check if this block is currently allocated
-    if (block_state_->IsBitClear(bit_index))
+    // check if this block is currently held by a user
+    if (!ClearBlockHeld(bit_index))
     {
 #ifdef BUILD_DEBUG
         LOG_ERROR("FixedSizeAllocator-%d could not free pointer=%p since it is not currently allocated!", id_, i_pointer);
@@ -412,12 +431,193 @@ bool FixedSizeAllocator::IsAllocated(const void* i_pointer) const
         return false;
     }
 
-    // check if this block is currently unallocated
-    if (block_state_->IsBitClear(bit_index))
+    // check if this block is currently held by a user
+    if (!IsBlockHeld(bit_index))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool FixedSizeAllocator::GetBitIndexForPointer(const void* i_pointer, size_t& o_bit_index) const
+{
+    // validate input
+    ASSERT(i_pointer);
+
+    // return if this allocator does not contain this pointer
+    if (!Contains(i_pointer))
+    {
+        return false;
+    }
+
+#ifdef BUILD_DEBUG
+    const size_t guardband_size = DEFAULT_GUARDBAND_SIZE;
+    const size_t size_type = sizeof(size_t);
+#else
+    const size_t guardband_size = 0;
+    const size_t size_type = 0;
+#endif
+
+    // get a pointer to a block
+    const uint8_t* block = static_cast<const uint8_t*>(i_pointer) - guardband_size - size_type;
+
+    // check if we recognize this pointer
+    if (block < block_ || (block - block_) % (fixed_block_size_ + size_type + guardband_size * 2))
     {
         return false;
     }
 
+    // calculate the index of the bit that represents this block
+    o_bit_index = (block - block_) / (fixed_block_size_ + size_type + guardband_size * 2);
+    return o_bit_index < num_blocks_;
+}
+
+size_t FixedSizeAllocator::AllocBatch(void** o_blocks, const size_t i_count)
+{
+    std::lock_guard<std::mutex> lock(allocator_mutex_);
+
+    // validate input
+    ASSERT(o_blocks);
+
+#ifdef BUILD_DEBUG
+    const size_t guardband_size = DEFAULT_GUARDBAND_SIZE;
+    const size_t size_type = sizeof(size_t);
+#else
+    const size_t guardband_size = 0;
+    const size_t size_type = 0;
+#endif
+
+    size_t num_moved = 0;
+    size_t bit_index = -1;
+    while (num_moved < i_count && block_state_->FindClearBit(bit_index))
+    {
+        // the block is allocated but no user holds it yet
+        block_state_->SetBit(bit_index);
+        o_blocks[num_moved++] = GetPointerForBlock(bit_index) + size_type + guardband_size;
+
+#ifdef BUILD_DEBUG
+        // update diagnostic information
+        ++stats_.num_allocated;
+        ++stats_.num_outstanding;
+        stats_.max_num_outstanding = stats_.max_num_outstanding < stats_.num_outstanding ? stats_.num_outstanding : stats_.max_num_outstanding;
+        stats_.allocated_memory_size += (guardband_size * 2 + size_type + fixed_block_size_);
+        stats_.available_memory_size -= (guardband_size * 2 + size_type + fixed_block_size_);
+        stats_.max_allocated_memory_size = stats_.max_allocated_memory_size < stats_.allocated_memory_size ? stats_.allocated_memory_size : stats_.max_allocated_memory_size;
+#endif
+    }
+
+    return num_moved;
+}
+
+void FixedSizeAllocator::FreeBatch(void* const* i_blocks, const size_t i_count)
+{
+    std::lock_guard<std::mutex> lock(allocator_mutex_);
+
+    // validate input
+    ASSERT(i_blocks);
+
+#ifdef BUILD_DEBUG
+    const size_t guardband_size = DEFAULT_GUARDBAND_SIZE;
+    const size_t size_type = sizeof(size_t);
+#else
+    const size_t guardband_size = 0;
+    const size_t size_type = 0;
+#endif
+
+    for (size_t i = 0; i < i_count; ++i)
+    {
+        size_t bit_index = -1;
+        const bool found_block = GetBitIndexForPointer(i_blocks[i], bit_index);
+        ASSERT(found_block);
+
+        // only blocks that no user holds are expected here
+        ASSERT(block_state_->IsBitSet(bit_index) && !IsBlockHeld(bit_index));
+        block_state_->ClearBit(bit_index);
+
+#ifdef BUILD_DEBUG
+        // update diagnostic information
+        ++stats_.num_freed;
+        --stats_.num_outstanding;
+        stats_.allocated_memory_size -= (guardband_size * 2 + size_type + fixed_block_size_);
+        stats_.available_memory_size += (guardband_size * 2 + size_type + fixed_block_size_);
+#endif
+    }
+}
+
+void* FixedSizeAllocator::TakeCachedBlock(void* i_block, const size_t i_size)
+{
+    // validate input
+    ASSERT(i_block);
+    ASSERT(i_size <= fixed_block_size_);
+
+    size_t bit_index = -1;
+    const bool found_block = GetBitIndexForPointer(i_block, bit_index);
+    ASSERT(found_block);
+
+    // the calling thread's cache owns this block so only the user state needs to be atomic
+    const bool was_held = !SetBlockHeld(bit_index);
+    ASSERT(!was_held);
+
+#ifdef BUILD_DEBUG
+    const size_t guardband_size = DEFAULT_GUARDBAND_SIZE;
+    const size_t size_type = sizeof(size_t);
+    uint8_t* block = GetPointerForBlock(bit_index);
+
+    // save the size of this block
+    *(reinterpret_cast<size_t*>(block)) = i_size;
+
+    // clear the block
+    memset(block + size_type + guardband_size, CLEAN_FILL, fixed_block_size_);
+
+    // add guardbands
+    for (uint8_t i = 0; i < guardband_size; ++i)
+    {
+        *(block + size_type + i) = GUARDBAND_FILL;
+        *(block + size_type + guardband_size + i_size + i) = GUARDBAND_FILL;
+    }
+
+    COUNT_ALLOC(i_size);
+#endif
+
+    return i_block;
+}
+
+bool FixedSizeAllocator::CacheBlock(void* i_pointer)
+{
+    // validate input
+    ASSERT(i_pointer != nullptr);
+
+    size_t bit_index = -1;
+    if (!GetBitIndexForPointer(i_pointer, bit_index))
+    {
+#ifdef BUILD_DEBUG
+        LOG_ERROR("FixedSizeAllocator-%d could not find pointer=%p passed into CacheBlock...bad adress!", id_, i_pointer);
+#else
+        LOG_ERROR("Bad input passed to FixedSizeAllocator::CacheBlock!");
+#endif
+        return false;
+    }
+
+    // the block stays allocated & simply stops being held by a user
+    if (!ClearBlockHeld(bit_index))
+    {
+#ifdef BUILD_DEBUG
+        LOG_ERROR("FixedSizeAllocator-%d could not free pointer=%p since it is not currently allocated!", id_, i_pointer);
+#else
+        LOG_ERROR("Bad input passed to FixedSizeAllocator::CacheBlock!");
+#endif
+        return false;
+    }
+
+#ifdef BUILD_DEBUG
+    // check for overwrites
+    ASSERT(!CheckMemoryOverwrite(bit_index));
+
+    // clear the block
+    memset(GetPointerForBlock(bit_index), DEAD_FILL, fixed_block_size_ + sizeof(size_t) + DEFAULT_GUARDBAND_SIZE * 2);
+#endif
+
     return true;
 }
 
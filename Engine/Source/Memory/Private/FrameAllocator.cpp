@@ -0,0 +1,94 @@
+#include "Memory/FrameAllocator.h"
+
+// library includes
+#include <string.h>         // for memset
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+#include "Memory/BlockAllocator.h"
+#include "Util/Profiler.h"
+
+namespace engine {
+namespace memory {
+
+// initialize static members
+FrameAllocator* FrameAllocator::instance_ = nullptr;
+
+FrameAllocator::FrameAllocator(uint8_t* i_memory, const size_t i_size, BlockAllocator* i_allocator) : memory_(i_memory),
+    size_(i_size),
+    offset_(0),
+    high_water_mark_(0),
+    allocator_(i_allocator)
+{}
+
+FrameAllocator::~FrameAllocator()
+{
+    allocator_->Free(memory_);
+    memory_ = nullptr;
+}
+
+FrameAllocator* FrameAllocator::Create(const size_t i_size, BlockAllocator* i_allocator)
+{
+    // validate inputs
+    ASSERT(i_size > 0);
+    ASSERT(i_allocator);
+
+    if (FrameAllocator::instance_ == nullptr)
+    {
+        uint8_t* memory = static_cast<uint8_t*>(i_allocator->Alloc(i_size, sizeof(size_t)));
+        ASSERT(memory);
+
+        FrameAllocator::instance_ = new FrameAllocator(memory, i_size, i_allocator);
+    }
+    return FrameAllocator::instance_;
+}
+
+void FrameAllocator::Destroy()
+{
+    if (FrameAllocator::instance_)
+    {
+        LOG("FrameAllocator high water mark:%zu bytes of %zu", FrameAllocator::instance_->high_water_mark_, FrameAllocator::instance_->size_);
+        delete FrameAllocator::instance_;
+        FrameAllocator::instance_ = nullptr;
+    }
+}
+
+void* FrameAllocator::Alloc(const size_t i_size, const size_t i_alignment)
+{
+    // validate inputs
+    ASSERT(i_size > 0);
+    ASSERT((i_alignment & (i_alignment - 1)) == 0);
+
+    const uintptr_t base = reinterpret_cast<uintptr_t>(memory_);
+
+    size_t offset = offset_.load(std::memory_order_relaxed);
+    size_t aligned_offset = 0;
+    do
+    {
+        aligned_offset = ((base + offset + i_alignment - 1) & ~uintptr_t(i_alignment - 1)) - base;
+        if (aligned_offset + i_size > size_)
+        {
+            return nullptr;
+        }
+    } while (!offset_.compare_exchange_weak(offset, aligned_offset + i_size, std::memory_order_relaxed));
+
+    return memory_ + aligned_offset;
+}
+
+void FrameAllocator::Reset()
+{
+    const size_t used_size = GetUsedSize();
+    high_water_mark_ = used_size > high_water_mark_ ? used_size : high_water_mark_;
+    PROFILE_VALUE("FrameAllocatorUsedBytes", used_size);
+
+#ifdef BUILD_DEBUG
+    // make stale frame data easy to spot
+    memset(memory_, DEAD_FILL, used_size);
+#endif
+
+    offset_.store(0, std::memory_order_relaxed);
+}
+
+} // namespace memory
+} // namespace engine
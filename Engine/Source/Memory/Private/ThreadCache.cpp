@@ -0,0 +1,108 @@
+#include "Memory/ThreadCache.h"
+
+// library includes
+#include <string.h>         // for memmove
+
+// engine includes
+#include "Assert/Assert.h"
+
+namespace engine {
+namespace memory {
+
+// initialize static members
+thread_local ThreadCache        ThreadCache::instance_;
+std::atomic<bool>               ThreadCache::is_enabled_(false);
+
+ThreadCache::ThreadCache()
+{
+    for (uint8_t i = 0; i < MAX_FIXED_SIZE_ALLOCATORS; ++i)
+    {
+        magazines_[i].allocator = nullptr;
+        magazines_[i].num_blocks = 0;
+    }
+}
+
+ThreadCache::~ThreadCache()
+{
+    // the allocators may already be gone if caching was disabled
+    if (is_enabled_.load(std::memory_order_relaxed))
+    {
+        Flush();
+    }
+}
+
+void ThreadCache::Enable()
+{
+    is_enabled_.store(true, std::memory_order_relaxed);
+}
+
+void ThreadCache::Disable()
+{
+    ThreadCache* thread_cache = Get();
+    if (thread_cache)
+    {
+        thread_cache->Flush();
+    }
+    is_enabled_.store(false, std::memory_order_relaxed);
+}
+
+void* ThreadCache::Alloc(const uint8_t i_index, FixedSizeAllocator* i_allocator, const size_t i_size)
+{
+    Magazine& magazine = GetMagazine(i_index, i_allocator);
+
+    // refill an empty magazine
+    if (magazine.num_blocks == 0)
+    {
+        magazine.num_blocks = i_allocator->AllocBatch(magazine.blocks, THREAD_CACHE_BATCH_SIZE);
+        if (magazine.num_blocks == 0)
+        {
+            return nullptr;
+        }
+    }
+
+    return i_allocator->TakeCachedBlock(magazine.blocks[--magazine.num_blocks], i_size);
+}
+
+bool ThreadCache::Free(const uint8_t i_index, FixedSizeAllocator* i_allocator, void* i_pointer)
+{
+    // validate input
+    ASSERT(i_pointer);
+
+    Magazine& magazine = GetMagazine(i_index, i_allocator);
+
+    if (!i_allocator->CacheBlock(i_pointer))
+    {
+        return false;
+    }
+
+    // flush the oldest blocks of a full magazine
+    if (magazine.num_blocks >= THREAD_CACHE_MAGAZINE_SIZE)
+    {
+        i_allocator->FreeBatch(magazine.blocks, THREAD_CACHE_BATCH_SIZE);
+        magazine.num_blocks -= THREAD_CACHE_BATCH_SIZE;
+        memmove(magazine.blocks, magazine.blocks + THREAD_CACHE_BATCH_SIZE, magazine.num_blocks * sizeof(void*));
+    }
+
+    magazine.blocks[magazine.num_blocks++] = i_pointer;
+    return true;
+}
+
+void ThreadCache::Flush()
+{
+    for (uint8_t i = 0; i < MAX_FIXED_SIZE_ALLOCATORS; ++i)
+    {
+        Flush(magazines_[i]);
+    }
+}
+
+void ThreadCache::Flush(Magazine& i_magazine)
+{
+    if (i_magazine.allocator && i_magazine.num_blocks > 0)
+    {
+        i_magazine.allocator->FreeBatch(i_magazine.blocks, i_magazine.num_blocks);
+    }
+    i_magazine.num_blocks = 0;
+}
+
+} // namespace memory
+} // namespace engine
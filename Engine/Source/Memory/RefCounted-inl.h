@@ -0,0 +1,39 @@
+#include "RefCounted.h"
+
+// library includes
+#include <new>
+#include <stdint.h>
+
+// engine includes
+#include "Assert/Assert.h"
+
+namespace engine {
+namespace memory {
+
+    inline void* RefCounted::operator new(size_t i_size)
+    {
+        uint8_t* block = static_cast<uint8_t*>(::operator new(REF_COUNTER_HEADER_SIZE + i_size));
+        new (block) RefCounter(0, 0, true);
+        return block + REF_COUNTER_HEADER_SIZE;
+    }
+
+    // only reached when a derived object is deleted directly instead of through a SharedPointer
+    inline void RefCounted::operator delete(void* i_pointer)
+    {
+        if (i_pointer)
+        {
+            ::operator delete(static_cast<uint8_t*>(i_pointer) - REF_COUNTER_HEADER_SIZE);
+        }
+    }
+
+    inline RefCounter* RefCounted::GetRefCounter() const
+    {
+        // the counter sits in front of the most derived object, which is where new placed it
+        const uint8_t* object = static_cast<const uint8_t*>(dynamic_cast<const void*>(this));
+        RefCounter* ref_counter = reinterpret_cast<RefCounter*>(const_cast<uint8_t*>(object) - REF_COUNTER_HEADER_SIZE);
+        ASSERT(ref_counter->has_inline_object);
+        return ref_counter;
+    }
+
+} // namespace memory
+} // namespace engine
@@ -0,0 +1,40 @@
+#ifndef REF_COUNTED_H_
+#define REF_COUNTED_H_
+
+// engine includes
+#include "Memory/RefCounter.h"
+
+namespace engine {
+namespace memory {
+
+/*
+    RefCounted
+    - An opt-in base class that gives an object an intrusive reference counter
+    - Every new of a derived class places a RefCounter in front of the object, in the same allocation
+    - A SharedPointer created from a raw pointer to a derived object uses that counter instead of allocating one,
+      so any number of SharedPointers can be created from the same raw pointer (including this)
+    - Once the last SharedPointer lets go, the object is destroyed but its memory is kept until the last WeakPointer lets go
+    - Derived objects must be created with new, never on the stack, as a member or inside an array
+*/
+class RefCounted
+{
+public:
+    virtual ~RefCounted() {}
+
+    static inline void* operator new(size_t i_size);
+    static inline void operator delete(void* i_pointer);
+
+    // returns the counter placed in front of this object
+    inline RefCounter* GetRefCounter() const;
+
+protected:
+    RefCounted() {}
+
+}; // class RefCounted
+
+} // namespace memory
+} // namespace engine
+
+#include "RefCounted-inl.h"
+
+#endif // REF_COUNTED_H_
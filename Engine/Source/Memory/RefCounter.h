@@ -1,19 +1,86 @@
 #ifndef REF_COUNTER_H_
 #define REF_COUNTER_H_
 
+// library includes
+#include <atomic>
+#include <cstddef>
+
 namespace engine {
 namespace memory {
 
+/*
+    RefCounter
+    - The lock-free control block shared by SharedPointer & WeakPointer
+    - Increments are relaxed, decrements release & the thread that drops a count to zero acquires before destroying anything
+    - All strong references together hold one weak reference, so the counter is freed exactly once,
+      by whoever drops the weak count to zero
+*/
 struct RefCounter
 {
 public:
-    explicit RefCounter(long i_strong_count = 0, long i_weak_count = 0) : strong_count(i_strong_count),
-        weak_count(i_weak_count)
+    explicit RefCounter(long i_strong_count = 0, long i_weak_count = 0, bool i_has_inline_object = false) : strong_count(i_strong_count),
+        weak_count(i_weak_count),
+        has_inline_object(i_has_inline_object)
     {}
-    long strong_count;
-    long weak_count;
+
+    inline void AddStrong()
+    {
+        // the first strong reference also takes the weak reference held on behalf of all strong references
+        if (strong_count.fetch_add(1, std::memory_order_relaxed) == 0)
+        {
+            AddWeak();
+        }
+    }
+
+    // adds a strong reference unless the object has already been destroyed
+    inline bool TryAddStrong()
+    {
+        long count = strong_count.load(std::memory_order_relaxed);
+        while (count > 0)
+        {
+            if (strong_count.compare_exchange_weak(count, count + 1, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // returns true if that was the last strong reference & the object must be destroyed
+    inline bool ReleaseStrong()
+    {
+        if (strong_count.fetch_sub(1, std::memory_order_release) == 1)
+        {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return true;
+        }
+        return false;
+    }
+
+    inline void AddWeak()
+    {
+        weak_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // returns true if that was the last reference of any kind & the counter must be freed
+    inline bool ReleaseWeak()
+    {
+        if (weak_count.fetch_sub(1, std::memory_order_release) == 1)
+        {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return true;
+        }
+        return false;
+    }
+
+    std::atomic<long> strong_count;
+    std::atomic<long> weak_count;
+    bool has_inline_object;             // the object lives in the same allocation, REF_COUNTER_HEADER_SIZE bytes after the counter
 }; // struct RefCounter
 
+// space reserved for a counter that shares its allocation with the object, keeps the object suitably aligned
+#define REF_COUNTER_HEADER_SIZE ((sizeof(engine::memory::RefCounter) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1))
+
 } // namespace memory
 } // namespace engine
 
@@ -2,10 +2,13 @@
 
 // library includes
 #include <algorithm>
+#include <new>
+#include <stdint.h>
+#include <utility>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Common\HelperMacros.h"
+#include "Assert/Assert.h"
+#include "Common/HelperMacros.h"
 
 namespace engine {
 namespace memory {
@@ -77,42 +80,71 @@ inline bool SharedPointer<T>::operator!=(const SharedPointer& i_other) const
 template<class T>
 inline long SharedPointer<T>::GetStrongCount() const
 {
-    return ref_counter_ ? ref_counter_->strong_count : 0;
+    return ref_counter_ ? ref_counter_->strong_count.load(std::memory_order_relaxed) : 0;
 }
 
 template<class T>
 inline long SharedPointer<T>::GetWeakCount() const
 {
-    return ref_counter_ ? ref_counter_->weak_count : 0;
+    // leave out the weak reference held on behalf of the strong references
+    return ref_counter_ ? ref_counter_->weak_count.load(std::memory_order_relaxed) - (GetStrongCount() > 0 ? 1 : 0) : 0;
 }
 #endif
 
+template<class T, class... Args>
+inline SharedPointer<T> MakeShared(Args&&... i_args)
+{
+    // the counter goes first so RefCounted objects made here can still find theirs
+    uint8_t* block = static_cast<uint8_t*>(::operator new(REF_COUNTER_HEADER_SIZE + sizeof(T)));
+    RefCounter* ref_counter = new (block) RefCounter(1, 1, true);
+    T* object = ::new (block + REF_COUNTER_HEADER_SIZE) T(std::forward<Args>(i_args)...);
+    return SharedPointer<T>(object, ref_counter);
+}
+
+template<class T>
+inline RefCounter* SharedPointer<T>::AcquireRefCounter(RefCounted* i_object)
+{
+    RefCounter* ref_counter = i_object->GetRefCounter();
+    ref_counter->AddStrong();
+    return ref_counter;
+}
+
+template<class T>
+inline RefCounter* SharedPointer<T>::AcquireRefCounter(void* i_object)
+{
+    return new RefCounter(1, 1);
+}
+
 template<class T>
 inline void SharedPointer<T>::Acquire()
 {
     if (ref_counter_)
     {
-        ++(ref_counter_->strong_count);
+        ref_counter_->AddStrong();
     }
 }
 
 template<class T>
 inline void SharedPointer<T>::Release()
 {
-    if (ref_counter_)
+    if (ref_counter_ && ref_counter_->ReleaseStrong())
     {
-        if (ref_counter_->strong_count <= 1)
+        // an inline object's memory belongs to the counter & is freed along with it
+        if (ref_counter_->has_inline_object)
+        {
+            object_->~T();
+            object_ = nullptr;
+        }
+        else
         {
             SAFE_DELETE(object_);
-            --ref_counter_->strong_count;
+        }
 
-            if (ref_counter_->weak_count <= 0)
-            {
-                SAFE_DELETE(ref_counter_);
-            }
-            return;
+        // drop the weak reference held on behalf of the strong references
+        if (ref_counter_->ReleaseWeak())
+        {
+            SAFE_DELETE(ref_counter_);
         }
-        --ref_counter_->strong_count;
     }
 }
 
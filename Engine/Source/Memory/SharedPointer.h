@@ -2,7 +2,8 @@
 #define SHARED_POINTER_H_
 
 // engine includes
-#include "Memory\RefCounter.h"
+#include "Memory/RefCounted.h"
+#include "Memory/RefCounter.h"
 
 namespace engine {
 namespace memory {
@@ -11,6 +12,13 @@ namespace memory {
 template<class T>
 class WeakPointer;
 
+template<class T>
+class SharedPointer;
+
+// creates an object & its reference counter in a single allocation
+template<class T, class... Args>
+inline SharedPointer<T> MakeShared(Args&&... i_args);
+
 template<class T>
 class SharedPointer
 {
@@ -28,7 +36,7 @@ public:
     {
         if (object_)
         {
-            ref_counter_ = new RefCounter(1);
+            ref_counter_ = AcquireRefCounter(object_);
         }
     };
 
@@ -50,10 +58,15 @@ public:
         i_copy.ref_counter_ = nullptr;
     }
 
-    explicit SharedPointer(const WeakPointer<T>& i_weak_pointer) : object_(i_weak_pointer.HasExpired() ? nullptr : i_weak_pointer.object_),
-        ref_counter_(i_weak_pointer.HasExpired() ? nullptr : i_weak_pointer.ref_counter_)
+    explicit SharedPointer(const WeakPointer<T>& i_weak_pointer) : object_(i_weak_pointer.object_),
+        ref_counter_(i_weak_pointer.ref_counter_)
     {
-        Acquire();
+        // the object may expire on another thread at any time, so checking & acquiring must be a single step
+        if (ref_counter_ == nullptr || !ref_counter_->TryAddStrong())
+        {
+            object_ = nullptr;
+            ref_counter_ = nullptr;
+        }
     }
     
     inline SharedPointer& operator=(const SharedPointer& i_copy);
@@ -73,6 +86,15 @@ public:
 #endif // BUILD_DEBUG
 
 private:
+    // takes over the reference already held by i_ref_counter
+    SharedPointer(T* i_object, RefCounter* i_ref_counter) : object_(i_object),
+        ref_counter_(i_ref_counter)
+    {}
+
+    // objects deriving from RefCounted bring their own counter, everything else gets a new one
+    static inline RefCounter* AcquireRefCounter(RefCounted* i_object);
+    static inline RefCounter* AcquireRefCounter(void* i_object);
+
     inline void Acquire();
     inline void Release();
 
@@ -80,8 +102,11 @@ private:
     T*                              object_;
     RefCounter*                     ref_counter_;
 
-    template<class T>
+    template<class U>
     friend class WeakPointer;
+
+    template<class U, class... Args>
+    friend SharedPointer<U> MakeShared(Args&&... i_args);
 }; // class StrongPointer
 
 } // namespace memory
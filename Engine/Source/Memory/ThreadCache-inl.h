@@ -0,0 +1,30 @@
+#include "ThreadCache.h"
+
+// engine includes
+#include "Assert/Assert.h"
+
+namespace engine {
+namespace memory {
+
+    inline ThreadCache* ThreadCache::Get()
+    {
+        return is_enabled_.load(std::memory_order_relaxed) ? &instance_ : nullptr;
+    }
+
+    inline ThreadCache::Magazine& ThreadCache::GetMagazine(const uint8_t i_index, FixedSizeAllocator* i_allocator)
+    {
+        ASSERT(i_index < MAX_FIXED_SIZE_ALLOCATORS);
+        ASSERT(i_allocator);
+
+        // the registered allocators are sorted by block size, so an index can map to a different allocator after registration changes
+        Magazine& magazine = magazines_[i_index];
+        if (magazine.allocator != i_allocator)
+        {
+            Flush(magazine);
+            magazine.allocator = i_allocator;
+        }
+        return magazine;
+    }
+
+} // namespace memory
+} // namespace engine
@@ -0,0 +1,74 @@
+#ifndef ENGINE_THREAD_CACHE_H_
+#define ENGINE_THREAD_CACHE_H_
+
+// library includes
+#include <atomic>
+#include <stdint.h>
+
+// engine includes
+#include "FixedSizeAllocator.h"
+
+namespace engine {
+namespace memory {
+
+#define THREAD_CACHE_MAGAZINE_SIZE 32
+#define THREAD_CACHE_BATCH_SIZE 16
+
+/*
+    ThreadCache
+    - A per-thread cache of free blocks that sits in front of the registered fixed size allocators
+    - It keeps one magazine (a small stack of free blocks) per registered fixed size allocator
+    - An empty magazine is refilled & a full magazine is flushed in batches of THREAD_CACHE_BATCH_SIZE,
+      so only one in every few allocations takes a fixed size allocator's lock
+    - Every thread gets its own instance which flushes its magazines when the thread exits
+    - Caching is enabled by CreateAllocators once all fixed size allocators are registered and disabled by DestroyAllocators
+*/
+class ThreadCache
+{
+private:
+    // disable copy constructor & assignment operator
+    ThreadCache(const ThreadCache& i_copy) = delete;
+    ThreadCache& operator=(const ThreadCache& i_copy) = delete;
+
+    struct Magazine
+    {
+        FixedSizeAllocator*                         allocator;                                              // the allocator these blocks belong to
+        size_t                                      num_blocks;                                             // number of blocks in the magazine
+        void*                                       blocks[THREAD_CACHE_MAGAZINE_SIZE];                     // free blocks, the most recently freed one last
+    };
+
+    inline Magazine& GetMagazine(const uint8_t i_index, FixedSizeAllocator* i_allocator);
+    void Flush(Magazine& i_magazine);
+
+public:
+    ThreadCache();
+    ~ThreadCache();
+
+    // returns the calling thread's cache or nullptr if caching is disabled
+    static inline ThreadCache* Get();
+    static void Enable();
+    // flushes the calling thread's cache before disabling caching
+    static void Disable();
+
+    // allocate a block from the fixed size allocator registered at i_index
+    void* Alloc(const uint8_t i_index, FixedSizeAllocator* i_allocator, const size_t i_size);
+    // deallocate a block that belongs to the fixed size allocator registered at i_index
+    bool Free(const uint8_t i_index, FixedSizeAllocator* i_allocator, void* i_pointer);
+
+    // return every cached block to its allocator
+    void Flush();
+
+private:
+    Magazine                                        magazines_[MAX_FIXED_SIZE_ALLOCATORS];                  // one magazine for each registered fixed size allocator
+
+    static thread_local ThreadCache                 instance_;                                              // the calling thread's cache
+    static std::atomic<bool>                        is_enabled_;                                            // whether new & delete should go through thread caches
+
+}; // class ThreadCache
+
+} // namespace memory
+} // namespace engine
+
+#include "ThreadCache-inl.h"
+
+#endif // ENGINE_THREAD_CACHE_H_
@@ -1,7 +1,7 @@
 #include "UniquePointer.h"
 
 // engine includes
-#include "Assert\Assert.h"
+#include "Assert/Assert.h"
 
 namespace engine {
 namespace memory {
@@ -2,8 +2,8 @@
 #define UNIQUE_POINTER_H_
 
 // engine includes
-#include "Common\HelperMacros.h"
-#include "Logger\Logger.h"
+#include "Common/HelperMacros.h"
+#include "Logger/Logger.h"
 
 namespace engine {
 namespace memory {
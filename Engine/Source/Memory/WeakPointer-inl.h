@@ -4,7 +4,7 @@
 #include <algorithm>
 
 // engine includes
-#include "Common\HelperMacros.h"
+#include "Common/HelperMacros.h"
 
 namespace engine {
 namespace memory {
@@ -79,26 +79,27 @@ inline bool WeakPointer<T>::operator!=(const WeakPointer& i_other) const
 template<class T>
 inline long WeakPointer<T>::GetStrongCount() const
 {
-    return ref_counter_ ? ref_counter_->strong_count : 0;
+    return ref_counter_ ? ref_counter_->strong_count.load(std::memory_order_relaxed) : 0;
 }
 
 template<class T>
 inline long WeakPointer<T>::GetWeakCount() const
 {
-    return ref_counter_ ? ref_counter_->weak_count : 0;
+    // leave out the weak reference held on behalf of the strong references
+    return ref_counter_ ? ref_counter_->weak_count.load(std::memory_order_relaxed) - (GetStrongCount() > 0 ? 1 : 0) : 0;
 }
 #endif
 
 template<class T>
 inline bool WeakPointer<T>::HasExpired() const
 {
-    return (ref_counter_ == nullptr || ref_counter_->strong_count <= 0);
+    return (ref_counter_ == nullptr || ref_counter_->strong_count.load(std::memory_order_relaxed) <= 0);
 }
 
 template<class T>
 inline SharedPointer<T> WeakPointer<T>::Lock() const
 {
-    return HasExpired() ? SharedPointer<T>(nullptr) : SharedPointer<T>(*this);
+    return SharedPointer<T>(*this);
 }
 
 template<class T>
@@ -106,20 +107,16 @@ inline void WeakPointer<T>::Acquire()
 {
     if (ref_counter_)
     {
-        ++(ref_counter_->weak_count);
+        ref_counter_->AddWeak();
     }
 }
 
 template<class T>
 inline void WeakPointer<T>::Release()
 {
-    if (ref_counter_)
+    if (ref_counter_ && ref_counter_->ReleaseWeak())
     {
-        if (--(ref_counter_->weak_count) <= 0 && ref_counter_->strong_count <= 0)
-        {
-            SAFE_DELETE(ref_counter_);
-        }
-        return;
+        SAFE_DELETE(ref_counter_);
     }
 }
 
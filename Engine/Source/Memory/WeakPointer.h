@@ -2,7 +2,7 @@
 #define WEAK_POINTER_H_
 
 // engine includes
-#include "Memory\SharedPointer.h"
+#include "Memory/SharedPointer.h"
 
 namespace engine {
 namespace memory {
@@ -66,7 +66,7 @@ private:
     T*                              object_;
     RefCounter*                     ref_counter_;
 
-    template<class T>
+    template<class U>
     friend class SharedPointer;
 
 }; // class WeakPointer
@@ -0,0 +1,92 @@
+#include "Broadphase.h"
+
+// library includes
+#include <math.h>
+
+// engine includes
+#include "Assert/Assert.h"
+
+namespace engine {
+namespace physics {
+
+inline BroadphaseType Broadphase::GetType() const
+{
+    return type_;
+}
+
+inline void Broadphase::SetType(BroadphaseType i_type)
+{
+    type_ = i_type;
+    for (std::vector<uint32_t>& sorted_proxies : sorted_proxies_)
+    {
+        sorted_proxies.clear();
+    }
+}
+
+inline float Broadphase::GetCellSize() const
+{
+    return cell_size_;
+}
+
+inline void Broadphase::SetCellSize(float i_cell_size)
+{
+    ASSERT(i_cell_size > 0.0f);
+    cell_size_ = i_cell_size;
+}
+
+inline size_t Broadphase::GetNumPairsTested() const
+{
+    return num_pairs_tested_;
+}
+
+inline const CollisionLayerMatrix& Broadphase::GetLayerMatrix() const
+{
+    return layer_matrix_;
+}
+
+inline size_t Broadphase::GetNumMovedProxies() const
+{
+    return num_moved_proxies_;
+}
+
+inline const DynamicTree& Broadphase::GetTree() const
+{
+    return tree_;
+}
+
+inline int32_t Broadphase::GetCellCoordinate(float i_value) const
+{
+    return static_cast<int32_t>(floorf(i_value / cell_size_));
+}
+
+inline uint64_t Broadphase::GetCellKey(int32_t i_x, int32_t i_y)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(i_x)) << 32) | static_cast<uint32_t>(i_y);
+}
+
+inline bool Broadphase::TestPair(const BroadphaseProxy& i_proxy_a, const BroadphaseProxy& i_proxy_b)
+{
+    ++num_pairs_tested_;
+    return (i_proxy_a.is_dynamic || i_proxy_b.is_dynamic) &&
+        ShouldCollide(i_proxy_a.collision_filter, i_proxy_b.collision_filter) &&
+        i_proxy_a.min_x <= i_proxy_b.max_x && i_proxy_b.min_x <= i_proxy_a.max_x &&
+        i_proxy_a.min_y <= i_proxy_b.max_y && i_proxy_b.min_y <= i_proxy_a.max_y;
+}
+
+inline void Broadphase::AddPair(uint32_t i_index_a, uint32_t i_index_b, engine::memory::FrameVector<BroadphasePair>& o_pairs)
+{
+    o_pairs.push_back(i_index_a < i_index_b ? BroadphasePair{ i_index_a, i_index_b } : BroadphasePair{ i_index_b, i_index_a });
+}
+
+inline bool Broadphase::TreePair::operator<(const TreePair& i_other) const
+{
+    return key_a < i_other.key_a || (key_a == i_other.key_a && key_b < i_other.key_b);
+}
+
+inline bool Broadphase::TreePair::operator==(const TreePair& i_other) const
+{
+    return key_a == i_other.key_a && key_b == i_other.key_b;
+}
+
+} // namespace physics
+} // namespace engine
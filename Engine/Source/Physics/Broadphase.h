@@ -0,0 +1,162 @@
+#ifndef BROADPHASE_H_
+#define BROADPHASE_H_
+
+// library includes
+#include <stdint.h>
+#include <vector>
+
+// engine includes
+#include "Memory/FrameAllocator.h"
+#include "Physics/CollisionFilter.h"
+#include "Physics/DynamicTree.h"
+
+// default edge length of a uniform grid cell, a little larger than most actors
+#define DEFAULT_BROADPHASE_CELL_SIZE            64.0f
+// proxies that cover more cells than this are tested against every other proxy instead
+#define BROADPHASE_GRID_MAX_CELLS_PER_PROXY     64
+// a key that has been added to the dynamic tree but hasn't been placed in it by FindPairs yet
+#define BROADPHASE_UNPLACED_TREE_PROXY          -2
+
+namespace engine {
+namespace physics {
+
+enum class BroadphaseType : uint8_t
+{
+    AllPairs = 0,                       // tests every pair of proxies
+    UniformGrid,                        // buckets proxies into the cells of a hashed uniform grid
+    SweepAndPrune,                      // sweeps proxies along X, keeping last frame's order so sorting is nearly free
+    DynamicTree                         // keeps fattened boxes in a dynamic tree between frames, only proxies that leave theirs look for new pairs
+};
+
+// a world space box that bounds an object over the whole time step
+struct BroadphaseProxy
+{
+    float                                       min_x;
+    float                                       min_y;
+    float                                       max_x;
+    float                                       max_y;
+    uint32_t                                    id;                                 // identifies the object to the caller
+    CollisionFilter                             collision_filter;
+    bool                                        is_dynamic;
+    uint32_t                                    key;                                // identifies the object from frame to frame, see AddProxy
+};
+
+// a pair of proxies that may collide, as indices into the proxies passed to FindPairs with first < second
+struct BroadphasePair
+{
+    uint32_t                                    first;
+    uint32_t                                    second;
+};
+
+/*
+    Broadphase
+    - Finds the pairs of proxies whose boxes overlap, so the narrowphase only runs on those
+    - A pair is only reported if at least one of the proxies is dynamic & their collision filters accept each other
+    - Proxies are bucketed by collision layer, pairs of layers that can't collide (see CollisionLayerMatrix) are never iterated
+    - Every pair is reported exactly once, whichever type is used
+    - The dynamic tree type remembers proxies between frames, so the keys of proxies must be added before they're passed to
+      FindPairs & removed once they won't be passed again
+*/
+class Broadphase
+{
+    // a proxy bucketed into one cell of the uniform grid
+    struct GridEntry
+    {
+        uint64_t                                cell;
+        uint32_t                                proxy;
+        uint8_t                                 layer;
+    };
+
+    // the proxies on each collision layer, proxies without a layer are left out
+    struct LayerBuckets
+    {
+        engine::memory::FrameVector<uint32_t>   proxies;                            // indices of the proxies, grouped by layer
+        engine::memory::FrameVector<uint8_t>    layers;                             // the layer of every proxy
+        uint32_t                                begins[MAX_COLLISION_LAYERS + 1];   // where each layer's proxies begin
+    };
+
+    // an added key's proxy in the dynamic tree
+    struct TreeProxy
+    {
+        int32_t                                 node;                               // DYNAMIC_TREE_NULL_NODE if the key isn't added
+        uint32_t                                index;                              // the key's proxy during the current call to FindPairs
+        bool                                    is_moved;                           // placed or moved during the current call to FindPairs
+    };
+
+    // a pair of keys whose fat boxes overlap with key_a < key_b
+    struct TreePair
+    {
+        uint32_t                                key_a;
+        uint32_t                                key_b;
+
+        inline bool operator<(const TreePair& i_other) const;
+        inline bool operator==(const TreePair& i_other) const;
+    };
+
+public:
+    Broadphase(BroadphaseType i_type = BroadphaseType::UniformGrid, float i_cell_size = DEFAULT_BROADPHASE_CELL_SIZE);
+    ~Broadphase();
+
+    void FindPairs(const BroadphaseProxy* i_proxies, size_t i_num_proxies, engine::memory::FrameVector<BroadphasePair>& o_pairs);
+
+    // start & stop tracking a proxy key in the dynamic tree, it's placed in the tree the next time FindPairs sees it
+    void AddProxy(uint32_t i_key);
+    void RemoveProxy(uint32_t i_key);
+
+    inline BroadphaseType GetType() const;
+    inline void SetType(BroadphaseType i_type);
+    inline float GetCellSize() const;
+    inline void SetCellSize(float i_cell_size);
+
+    // the number of pairs whose boxes were compared during the last call to FindPairs
+    inline size_t GetNumPairsTested() const;
+    // the layers that could collide during the last call to FindPairs
+    inline const CollisionLayerMatrix& GetLayerMatrix() const;
+    // the number of proxies placed or moved in the dynamic tree during the last call to FindPairs
+    inline size_t GetNumMovedProxies() const;
+    inline const DynamicTree& GetTree() const;
+
+private:
+    // disable copy constructor & copy assignment operator
+    Broadphase(const Broadphase& i_copy) = delete;
+    Broadphase& operator=(const Broadphase& i_copy) = delete;
+
+    // build the layer matrix & bucket the proxies by layer
+    void BucketProxies(const BroadphaseProxy* i_proxies, size_t i_num_proxies, LayerBuckets& o_buckets);
+
+    void FindPairsAllPairs(const BroadphaseProxy* i_proxies, const LayerBuckets& i_buckets, engine::memory::FrameVector<BroadphasePair>& o_pairs);
+    void FindPairsUniformGrid(const BroadphaseProxy* i_proxies, const LayerBuckets& i_buckets, engine::memory::FrameVector<BroadphasePair>& o_pairs);
+    void FindPairsSweepAndPrune(const BroadphaseProxy* i_proxies, size_t i_num_proxies, const LayerBuckets& i_buckets, engine::memory::FrameVector<BroadphasePair>& o_pairs);
+    void FindPairsDynamicTree(const BroadphaseProxy* i_proxies, size_t i_num_proxies, const LayerBuckets& i_buckets, engine::memory::FrameVector<BroadphasePair>& o_pairs);
+
+    // sweep the proxies of one layer against each other, or the proxies of two layers against each other
+    void SweepLayer(const BroadphaseProxy* i_proxies, const std::vector<uint32_t>& i_sorted_proxies, engine::memory::FrameVector<BroadphasePair>& o_pairs);
+    void SweepLayers(const BroadphaseProxy* i_proxies, const std::vector<uint32_t>& i_sorted_proxies_a, const std::vector<uint32_t>& i_sorted_proxies_b, engine::memory::FrameVector<BroadphasePair>& o_pairs);
+
+    inline int32_t GetCellCoordinate(float i_value) const;
+    static inline uint64_t GetCellKey(int32_t i_x, int32_t i_y);
+
+    inline bool TestPair(const BroadphaseProxy& i_proxy_a, const BroadphaseProxy& i_proxy_b);
+    static inline void AddPair(uint32_t i_index_a, uint32_t i_index_b, engine::memory::FrameVector<BroadphasePair>& o_pairs);
+
+private:
+    BroadphaseType                              type_;
+    float                                       cell_size_;
+    std::vector<uint32_t>                       sorted_proxies_[MAX_COLLISION_LAYERS];  // each layer's proxies sorted by min_x, kept between frames for sweep & prune
+    CollisionLayerMatrix                        layer_matrix_;
+    size_t                                      num_pairs_tested_;
+    DynamicTree                                 tree_;
+    std::vector<TreeProxy>                      tree_proxies_;                      // indexed by key
+    std::vector<TreePair>                       tree_pairs_;                        // every pair of keys whose fat boxes overlap, sorted
+    std::vector<TreePair>                       merged_tree_pairs_;                 // kept around so merging in new pairs doesn't allocate every frame
+    std::vector<uint32_t>                       removed_keys_;                      // keys removed since the last call to FindPairs
+    size_t                                      num_moved_proxies_;
+
+}; // class Broadphase
+
+} // namespace physics
+} // namespace engine
+
+#include "Broadphase-inl.h"
+
+#endif // BROADPHASE_H_
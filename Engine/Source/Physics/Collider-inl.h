@@ -4,8 +4,8 @@
 #include <algorithm>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Logger\Logger.h"
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
 
 namespace engine {
 namespace physics {
@@ -20,5 +20,75 @@ inline void Collider::SetCollisionListener(InterfaceCollisionListener* i_collisi
     collision_listener_ = i_collision_listener;
 }
 
+inline bool Collider::GetIsContinuousCollisionEnabled() const
+{
+    return is_continuous_collision_enabled_;
+}
+
+inline void Collider::SetIsContinuousCollisionEnabled(bool i_is_enabled)
+{
+    is_continuous_collision_enabled_ = i_is_enabled;
+}
+
+inline uint8_t Collider::GetMaxImpactIterations() const
+{
+    return max_impact_iterations_;
+}
+
+inline void Collider::SetMaxImpactIterations(uint8_t i_max_impact_iterations)
+{
+    max_impact_iterations_ = i_max_impact_iterations;
+}
+
+inline Broadphase& Collider::GetBroadphase()
+{
+    return broadphase_;
+}
+
+inline size_t Collider::GetNumCandidatePairs() const
+{
+    return num_candidate_pairs_;
+}
+
+inline size_t Collider::GetNumReusedContacts() const
+{
+    return num_reused_contacts_;
+}
+
+inline const StaticBVH& Collider::GetStaticBVH() const
+{
+    return static_bvh_;
+}
+
+inline size_t Collider::GetNumSleepingObjects() const
+{
+    return sleeping_objects_.size();
+}
+
+inline const ContactCache& Collider::GetContactCache() const
+{
+    return contact_cache_;
+}
+
+inline bool Collider::Raycast(const engine::math::Vec3D& i_origin, const engine::math::Vec3D& i_direction, float i_max_distance, SceneQueryHit& o_hit, uint16_t i_mask) const
+{
+    return scene_query_.Raycast({ i_origin, i_direction, i_max_distance, i_mask }, o_hit);
+}
+
+inline void Collider::OverlapAABB(const engine::math::AABB& i_aabb, std::vector<engine::memory::WeakPointer<PhysicsObject>>& o_objects, uint16_t i_mask) const
+{
+    scene_query_.OverlapAABB(i_aabb, i_mask, o_objects);
+}
+
+inline bool Collider::QueryNearest(const engine::math::Vec3D& i_point, float i_max_distance, SceneQueryHit& o_hit, uint16_t i_mask) const
+{
+    return scene_query_.QueryNearest({ i_point, i_max_distance, i_mask }, o_hit);
+}
+
+inline const SceneQuery& Collider::GetSceneQuery() const
+{
+    return scene_query_;
+}
+
 } // namespace physics
 } // namespace engine
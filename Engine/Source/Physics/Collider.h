@@ -2,44 +2,115 @@
 #define COLLIDER_H_
 
 // library includes
-#include <mutex>
+#include <functional>
+#include <stdint.h>
 #include <vector>
 
 // engine includes
-#include "Math\Vec3D.h"
-#include "Memory\WeakPointer.h"
+#include "Data/CommandQueue.h"
+#include "Math/Vec3D.h"
+#include "Memory/FrameAllocator.h"
+#include "Memory/WeakPointer.h"
+#include "Physics/Broadphase.h"
+#include "Physics/ContactCache.h"
+#include "Physics/DynamicTree.h"
+#include "Physics/SceneQuery.h"
+#include "Physics/SeparatingAxisBatch.h"
+#include "Physics/StaticBVH.h"
+
+// number of objects each job caches the transforms of
+#define COLLIDER_TRANSFORM_GRAIN_SIZE           64
+// number of candidate pairs each job tests, must be a multiple of SEPARATING_AXIS_BATCH_WIDTH
+#define COLLIDER_NARROWPHASE_GRAIN_SIZE         256
+// number of impacts continuous collision detection moves objects to every step, the rest are responded to where they were found
+#define COLLIDER_DEFAULT_MAX_IMPACT_ITERATIONS  4
+// number of scene queries each job runs
+#define COLLIDER_QUERY_GRAIN_SIZE               32
+// number of objects each job finds the baked & sleeping objects of
+#define COLLIDER_BAKED_QUERY_GRAIN_SIZE         256
 
 // forward declarations
 namespace engine {
+namespace gameobject {
+    class GameObject;
+}
 namespace math {
     struct AABB;
     class Mat44;
     class Transform;
+namespace optimized {
+    class Mat44;
+}
 }
 namespace physics {
     class PhysicsObject;
+    struct PhysicsObjectCommand;
+    class PhysicsWorld;
 }
 }
 
 namespace engine {
 namespace physics {
 
-struct CollisionPair
-{
-    float                                                       time;
-    engine::math::Vec3D                                         normal;
-    engine::memory::WeakPointer<PhysicsObject>                  object_a;
-    engine::memory::WeakPointer<PhysicsObject>                  object_b;
-};
-
 class InterfaceCollisionListener
 {
 public:
-    virtual void OnCollision(const CollisionPair& i_collision_pair) = 0;
+    // every frame two objects collide
+    virtual void OnCollision(const CollisionPair& i_collision_pair) {}
+    // the first frame two objects touch & every frame after that they keep touching
+    virtual void OnCollisionEnter(const CollisionPair& i_collision_pair) {}
+    virtual void OnCollisionStay(const CollisionPair& i_collision_pair) {}
+    // the first frame two objects stop touching, with their last collision, either object may no longer exist
+    virtual void OnCollisionExit(const CollisionPair& i_collision_pair) {}
 };
 
+/*
+    Collider
+    - Detects collisions between the dynamic objects that are awake & everything else, then lets them respond
+    - A broadphase first finds the objects whose bounds overlap over the time step, objects on layers that don't collide
+      (see CollisionFilter) are never paired
+    - Dynamic objects that fall asleep leave the broadphase & aren't cached every frame, they're kept in a tree of where they
+      fell asleep instead, awake objects find the ones they reach in it & only those are cached for the narrowphase
+    - A sleeping object goes back to the broadphase as soon as it is woken up, one that is moved must be woken up to be found
+      where it is now
+    - Objects keep a proxy in the broadphase from when they're added until they're removed, keyed on their physics handle,
+      so the dynamic tree broadphase only does work for the objects that moved
+    - Every collision is reported to the physics world as a contact, so touching bodies are put to sleep & woken up together
+    - The exact (separating axis) test only runs on those candidates, several pairs at a time (see SeparatingAxisBatch)
+    - Every object's transforms are calculated once per frame & cached, instead of once for every pair it is part of
+    - Caching & the exact test are split across the engine's workers, the collisions they find are merged in order of
+      the objects' indices so the response is the same no matter how the work was split
+    - Objects can be added & removed from any thread, the changes are queued without a lock & applied when the collider next runs
+    - With continuous collision detection, collisions are responded to in order of their time of impact: the objects are moved to
+      where they touch & the collisions found with their old velocities are tested again from there, so fast objects hit
+      the first thing in their way instead of passing through it
+    - Touching objects are remembered from frame to frame (see ContactCache), so listeners can be told when objects start,
+      keep & stop touching, & a touching pair whose relative state hasn't changed reuses its collision instead of being tested again
+    - Only the collisions that are responded to are remembered, as they were responded to, so a collision that continuous
+      collision detection drops after testing it again never starts or keeps a contact
+    - The broadphase's proxies are kept until the collider runs again to answer ray, box & nearest object queries (see SceneQuery),
+      queries can be run in batches that are split across the engine's workers
+    - Static objects can be baked into a StaticBVH once a level has loaded: they leave the broadphase & aren't cached every frame,
+      dynamic objects find the ones they reach in the tree & only those are cached for the narrowphase
+*/
 class Collider
 {
+#ifdef ENABLE_FAST_MATH
+    typedef engine::math::optimized::Mat44 TransformMatrix;
+#else
+    typedef engine::math::Mat44 TransformMatrix;
+#endif
+
+    // the state of every active object for the current frame, stored as parallel arrays indexed by broadphase proxy id
+    struct TransformCache
+    {
+        engine::memory::FrameVector<engine::memory::SharedPointer<PhysicsObject>>   physics_objects;
+        engine::memory::FrameVector<TransformMatrix>                                objects_to_world;
+        engine::memory::FrameVector<TransformMatrix>                                worlds_to_object;
+        engine::memory::FrameVector<engine::math::AABB>                             aabbs;
+        engine::memory::FrameVector<engine::math::Vec3D>                            velocities;
+    };
+
 private:
     Collider();
     ~Collider();
@@ -54,18 +125,55 @@ public:
     static void Destroy();
     static inline Collider* Get();
 
+    // apply the queued adds & removes, then detect & respond to collisions
     void Run(float i_dt);
+    // apply the queued adds & removes, must be called from the thread that runs the collider
+    void ApplyCommands();
     void DetectCollisions(float i_dt);
     void RespondToCollisions(float i_dt);
 
-    bool CheckSeparationForAxis(const float i_relative_vel_WtoA, const float i_a_aabb_center, const float i_a_aabb_extents, const float i_B_center_in_A, const float i_B_extents_in_a, const float i_dt, float &o_t_close, float &o_t_open);
+    // the scalar separating axis test along a single axis, SeparatingAxisBatch runs the same test on several pairs at once
+    static bool CheckSeparationForAxis(const float i_relative_vel_WtoA, const float i_a_aabb_center, const float i_a_aabb_extents, const float i_B_center_in_A, const float i_B_extents_in_a, const float i_dt, float &o_t_close, float &o_t_open);
 
     // add and remove physics objects
     void AddPhysicsObject(const engine::memory::WeakPointer<engine::physics::PhysicsObject>& i_physics_object);
     void RemovePhysicsObject(const engine::memory::WeakPointer<engine::physics::PhysicsObject>& i_physics_object);
 
+    // build the static tree from every static object added so far, replacing the last one, must be called from the thread that
+    // runs the collider & again if a baked object moves or stops being static
+    void BakeStaticObjects();
+    inline const StaticBVH& GetStaticBVH() const;
+    // the number of dynamic objects that are kept out of the broadphase because they're asleep
+    inline size_t GetNumSleepingObjects() const;
+
     inline void SetCollisionListener(InterfaceCollisionListener* i_collision_listener);
 
+    // respond to collisions in order of their time of impact, instead of the order they were found in
+    inline bool GetIsContinuousCollisionEnabled() const;
+    inline void SetIsContinuousCollisionEnabled(bool i_is_enabled);
+    // the number of impacts objects are moved to every step
+    inline uint8_t GetMaxImpactIterations() const;
+    inline void SetMaxImpactIterations(uint8_t i_max_impact_iterations);
+
+    inline Broadphase& GetBroadphase();
+    // the number of pairs the broadphase handed to the narrowphase last frame
+    inline size_t GetNumCandidatePairs() const;
+    // the number of touching pairs that reused last frame's collision instead of being tested
+    inline size_t GetNumReusedContacts() const;
+    // the objects that touched last frame
+    inline const ContactCache& GetContactCache() const;
+
+    // the closest object along a ray, the direction doesn't need to be normalized
+    inline bool Raycast(const engine::math::Vec3D& i_origin, const engine::math::Vec3D& i_direction, float i_max_distance, SceneQueryHit& o_hit, uint16_t i_mask = SCENE_QUERY_ALL_LAYERS) const;
+    // every object that overlaps a world space box
+    inline void OverlapAABB(const engine::math::AABB& i_aabb, std::vector<engine::memory::WeakPointer<PhysicsObject>>& o_objects, uint16_t i_mask = SCENE_QUERY_ALL_LAYERS) const;
+    // the object closest to a point
+    inline bool QueryNearest(const engine::math::Vec3D& i_point, float i_max_distance, SceneQueryHit& o_hit, uint16_t i_mask = SCENE_QUERY_ALL_LAYERS) const;
+    // run many queries at once on the engine's workers, every query gets a hit & the hits of queries that found nothing have no object
+    void Raycast(const RaycastQuery* i_queries, size_t i_num_queries, SceneQueryHit* o_hits) const;
+    void QueryNearest(const NearestQuery* i_queries, size_t i_num_queries, SceneQueryHit* o_hits) const;
+    inline const SceneQuery& GetSceneQuery() const;
+
 #ifdef BUILD_DEBUG
     void PrintDebugInformation(const engine::math::Mat44& i_mat_WtoA,
         const engine::math::Mat44& i_mat_WtoB,
@@ -78,14 +186,72 @@ public:
         float i_dt) const;
 #endif
 
+private:
+    // dynamic objects come first, followed by static & kinematic objects
+    // split a loop across the engine's workers, or run it on the calling thread if there is no job system
+    static void RunInParallel(size_t i_count, size_t i_grain_size, const std::function<void(size_t, size_t)>& i_function);
+
+    engine::memory::SharedPointer<PhysicsObject> GetPhysicsObject(size_t i_index) const;
+    void ApplyCommand(const PhysicsObjectCommand& i_command);
+    // move the dynamic objects that fell asleep out of the broadphase & the ones that woke up back into it
+    void UpdateSleepingObjects(float i_dt);
+    void AddSleepingObject(const engine::memory::SharedPointer<PhysicsObject>& i_physics_object, const BroadphaseProxy& i_proxy);
+    void RemoveSleepingObject(size_t i_slot);
+    // pair the dynamic proxies with the baked objects they overlap, caching each of those objects after the proxies
+    void AddBakedPairs(engine::memory::FrameVector<BroadphaseProxy>& io_proxies, engine::memory::FrameVector<BroadphasePair>& io_pairs, float i_dt);
+    // pair the dynamic proxies with the sleeping objects they overlap, caching each of those objects after the proxies
+    void AddSleepingPairs(engine::memory::FrameVector<BroadphaseProxy>& io_proxies, engine::memory::FrameVector<BroadphasePair>& io_pairs, float i_dt);
+    // cache the objects a tree found for the dynamic proxies & pair them, the second index of every pair is an index into the objects
+    void AddFoundPairs(engine::memory::FrameVector<BroadphaseProxy>& io_proxies, engine::memory::FrameVector<BroadphasePair>& io_pairs, const engine::memory::FrameVector<engine::memory::FrameVector<BroadphasePair>>& i_found_pairs, const engine::memory::WeakPointer<PhysicsObject>* i_objects, float i_dt);
+    // fill in the cached transforms & the broadphase proxy of a single object
+    void CacheObject(TransformCache& io_cache, uint32_t i_index, BroadphaseProxy& o_proxy, float i_dt) const;
+    // the world space box an object covers over the step, for the broadphase
+    static void GetProxy(const PhysicsObject& i_physics_object, const engine::gameobject::GameObject& i_game_object, const engine::math::Vec3D& i_velocity, uint32_t i_id, float i_dt, BroadphaseProxy& o_proxy);
+    // fill in the separating axis test of a candidate pair
+    void PrepareCollision(const TransformCache& i_cache, uint32_t i_index_a, uint32_t i_index_b, SeparatingAxisBatch& o_batch, size_t i_pair) const;
+    // record a pair the separating axis test found colliding
+    void AddCollision(const TransformCache& i_cache, uint32_t i_index_a, uint32_t i_index_b, const SeparatingAxisBatch& i_batch, size_t i_pair);
+    // record a touching pair that collides exactly the way it did last frame
+    void AddReusedCollision(uint32_t i_index_a, uint32_t i_index_b, const Contact& i_contact);
+    // what the separating axis test of two cached objects depends on
+    ContactState GetContactState(uint32_t i_index_a, uint32_t i_index_b, float i_dt) const;
+    // the normal to the surface that collided first
+    engine::math::Vec3D GetCollisionNormal(const TransformCache& i_cache, uint32_t i_index_a, uint32_t i_index_b, const SeparatingAxisBatch& i_batch, size_t i_pair) const;
+
+    // respond to a collision & remember its objects touched, so listeners are told whether they started or kept touching
+    void RespondToCollision(size_t i_collision, PhysicsWorld* i_world);
+    // move objects to their impacts in order & respond to them, see SetIsContinuousCollisionEnabled
+    void RespondToImpacts(float i_dt, PhysicsWorld& i_world);
+    // test a collision again from the time either object was last moved to, false if the objects no longer collide this step
+    bool RetestCollision(size_t i_collision, float i_dt, const PhysicsWorld& i_world);
+    // cache an object's transforms where it will be at a time within the step
+    void CacheObjectAt(uint32_t i_index, float i_time, const PhysicsWorld& i_world);
+
 private:
     std::vector<engine::memory::WeakPointer<PhysicsObject>>                         dynamic_objects_;
     std::vector<engine::memory::WeakPointer<PhysicsObject>>                         static_kynematic_objects_;
-    std::vector<CollisionPair>                                                      collided_objects_;
+    std::vector<engine::memory::WeakPointer<PhysicsObject>>                         baked_objects_;             // indexed by the ids of the static tree's proxies, removed objects leave a gap
+    StaticBVH                                                                       static_bvh_;
+    std::vector<engine::memory::WeakPointer<PhysicsObject>>                         sleeping_objects_;
+    std::vector<BroadphaseProxy>                                                    sleeping_proxies_;          // where each sleeping object fell asleep, ids are their slots
+    std::vector<int32_t>                                                            sleeping_tree_proxies_;     // each sleeping object's proxy in the sleeping tree
+    DynamicTree                                                                     sleeping_tree_;             // user data are the objects' slots
+    engine::memory::FrameVector<CollisionPair>                                      collided_objects_;
+    engine::memory::FrameVector<BroadphasePair>                                     collided_indices_;          // the objects' indices into the cache, for every collision
+    engine::memory::FrameVector<ContactState>                                       collided_states_;           // what every collision was found from
+    TransformCache                                                                  cache_;                     // kept from detection to response
+    ContactCache                                                                    contact_cache_;
+    engine::memory::FrameVector<CollisionPair>                                      exited_collisions_;         // pairs that stopped touching this frame
+    SceneQuery                                                                      scene_query_;
 
     size_t                                                                          num_dynamic_objects_;
     size_t                                                                          num_static_kynematic_objects_;
-    std::mutex                                                                      collider_mutex_;
+    Broadphase                                                                      broadphase_;
+    size_t                                                                          num_candidate_pairs_;
+    size_t                                                                          num_reused_contacts_;
+    engine::data::CommandQueue<PhysicsObjectCommand>                                commands_;
+    bool                                                                            is_continuous_collision_enabled_;
+    uint8_t                                                                         max_impact_iterations_;
 
     InterfaceCollisionListener*                                                     collision_listener_;
 
@@ -0,0 +1,94 @@
+#include "CollisionFilter.h"
+
+// library includes
+#include <string.h>
+
+// engine includes
+#include "Assert/Assert.h"
+
+namespace engine {
+namespace physics {
+
+inline bool ShouldCollide(const CollisionFilter& i_filter_a, const CollisionFilter& i_filter_b)
+{
+    return (i_filter_a.category & i_filter_b.mask) != 0 && (i_filter_b.category & i_filter_a.mask) != 0;
+}
+
+inline bool IsValidCollisionCategory(uint16_t i_category)
+{
+    return (i_category & (i_category - 1)) == 0;
+}
+
+inline uint8_t GetCollisionLayer(uint16_t i_category)
+{
+    ASSERT(IsValidCollisionCategory(i_category));
+
+    if (i_category == 0)
+    {
+        return INVALID_COLLISION_LAYER;
+    }
+
+    uint8_t layer = 0;
+    while ((i_category & 1) == 0)
+    {
+        i_category >>= 1;
+        ++layer;
+    }
+    return layer;
+}
+
+inline uint16_t GetCollisionCategory(uint8_t i_layer)
+{
+    ASSERT(i_layer < MAX_COLLISION_LAYERS);
+    return static_cast<uint16_t>(1 << i_layer);
+}
+
+inline CollisionLayerMatrix::CollisionLayerMatrix()
+{
+    Reset();
+}
+
+inline void CollisionLayerMatrix::Reset()
+{
+    memset(layer_masks_, 0, sizeof(layer_masks_));
+    memset(colliding_layers_, 0, sizeof(colliding_layers_));
+}
+
+inline void CollisionLayerMatrix::AddFilter(const CollisionFilter& i_filter)
+{
+    const uint8_t layer = GetCollisionLayer(i_filter.category);
+    if (layer != INVALID_COLLISION_LAYER)
+    {
+        layer_masks_[layer] |= i_filter.mask;
+    }
+}
+
+inline void CollisionLayerMatrix::Build()
+{
+    for (uint8_t layer_a = 0; layer_a < MAX_COLLISION_LAYERS; ++layer_a)
+    {
+        colliding_layers_[layer_a] = 0;
+        for (uint8_t layer_b = 0; layer_b < MAX_COLLISION_LAYERS; ++layer_b)
+        {
+            if ((layer_masks_[layer_a] & GetCollisionCategory(layer_b)) && (layer_masks_[layer_b] & GetCollisionCategory(layer_a)))
+            {
+                colliding_layers_[layer_a] |= GetCollisionCategory(layer_b);
+            }
+        }
+    }
+}
+
+inline bool CollisionLayerMatrix::GetLayersCollide(uint8_t i_layer_a, uint8_t i_layer_b) const
+{
+    ASSERT(i_layer_a < MAX_COLLISION_LAYERS && i_layer_b < MAX_COLLISION_LAYERS);
+    return (colliding_layers_[i_layer_a] & GetCollisionCategory(i_layer_b)) != 0;
+}
+
+inline uint16_t CollisionLayerMatrix::GetCollidingLayers(uint8_t i_layer) const
+{
+    ASSERT(i_layer < MAX_COLLISION_LAYERS);
+    return colliding_layers_[i_layer];
+}
+
+} // namespace physics
+} // namespace engine
@@ -0,0 +1,60 @@
+#ifndef COLLISION_FILTER_H_
+#define COLLISION_FILTER_H_
+
+// library includes
+#include <stdint.h>
+
+// number of collision layers, one per bit of a collision category
+#define MAX_COLLISION_LAYERS                    16
+// the layer of objects that aren't on any layer
+#define INVALID_COLLISION_LAYER                 0xff
+
+namespace engine {
+namespace physics {
+
+// the layer an object is on & the layers it collides with
+struct CollisionFilter
+{
+    uint16_t                                    category;                           // a single bit, objects without a category never collide
+    uint16_t                                    mask;                               // a bit for every layer the object collides with
+};
+
+// two objects collide only if each one's mask has the other's category
+inline bool ShouldCollide(const CollisionFilter& i_filter_a, const CollisionFilter& i_filter_b);
+
+inline bool IsValidCollisionCategory(uint16_t i_category);
+inline uint8_t GetCollisionLayer(uint16_t i_category);
+inline uint16_t GetCollisionCategory(uint8_t i_layer);
+
+/*
+    CollisionLayerMatrix
+    - Says which pairs of layers can have colliding objects, so pairs of layers that never interact can be skipped entirely
+    - Built from the filters of the objects on each layer, a pair of layers collides if any of their objects might
+*/
+class CollisionLayerMatrix
+{
+public:
+    inline CollisionLayerMatrix();
+
+    // start over with no layers colliding
+    inline void Reset();
+    // add an object's filter, the matrix must then be built before it is used
+    inline void AddFilter(const CollisionFilter& i_filter);
+    inline void Build();
+
+    inline bool GetLayersCollide(uint8_t i_layer_a, uint8_t i_layer_b) const;
+    // a bit for every layer the layer collides with
+    inline uint16_t GetCollidingLayers(uint8_t i_layer) const;
+
+private:
+    uint16_t                                    layer_masks_[MAX_COLLISION_LAYERS];   // the masks of all objects on a layer combined
+    uint16_t                                    colliding_layers_[MAX_COLLISION_LAYERS];
+
+}; // class CollisionLayerMatrix
+
+} // namespace physics
+} // namespace engine
+
+#include "CollisionFilter-inl.h"
+
+#endif // COLLISION_FILTER_H_
@@ -0,0 +1,79 @@
+#include "ContactCache.h"
+
+namespace engine {
+namespace physics {
+
+inline bool operator==(const ContactState& i_lhs, const ContactState& i_rhs)
+{
+    // exactly the same, Vec3D's == allows for an epsilon
+    return !(i_lhs.relative_position != i_rhs.relative_position) &&
+        !(i_lhs.relative_velocity != i_rhs.relative_velocity) &&
+        i_lhs.rotation_a == i_rhs.rotation_a &&
+        i_lhs.rotation_b == i_rhs.rotation_b &&
+        i_lhs.dt == i_rhs.dt;
+}
+
+inline void ContactCache::BeginFrame()
+{
+    ++frame_;
+}
+
+inline void ContactCache::Clear()
+{
+    for (Slot& slot : slots_)
+    {
+        if (slot.key != EMPTY_KEY)
+        {
+            GetContact(slot.contact).collision = CollisionPair();
+            free_contacts_.push_back(slot.contact);
+            slot.key = EMPTY_KEY;
+        }
+    }
+    num_contacts_ = 0;
+}
+
+inline const Contact* ContactCache::Find(PhysicsHandle i_handle_a, PhysicsHandle i_handle_b) const
+{
+    const size_t slot = FindSlot(GetKey(i_handle_a, i_handle_b));
+    return slots_[slot].key == EMPTY_KEY ? nullptr : &GetContact(slots_[slot].contact);
+}
+
+inline size_t ContactCache::GetNumContacts() const
+{
+    return num_contacts_;
+}
+
+inline uint64_t ContactCache::GetKey(PhysicsHandle i_handle_a, PhysicsHandle i_handle_b)
+{
+    return i_handle_a < i_handle_b ? (uint64_t(i_handle_a) << 32) | i_handle_b : (uint64_t(i_handle_b) << 32) | i_handle_a;
+}
+
+inline Contact& ContactCache::GetContact(uint32_t i_index)
+{
+    return blocks_[i_index / CONTACT_CACHE_BLOCK_SIZE]->contacts[i_index % CONTACT_CACHE_BLOCK_SIZE];
+}
+
+inline const Contact& ContactCache::GetContact(uint32_t i_index) const
+{
+    return blocks_[i_index / CONTACT_CACHE_BLOCK_SIZE]->contacts[i_index % CONTACT_CACHE_BLOCK_SIZE];
+}
+
+inline size_t ContactCache::GetHomeSlot(uint64_t i_key) const
+{
+    // fibonacci hashing, so keys that only differ in their low handle don't all land next to each other
+    return size_t((i_key * 0x9E3779B97F4A7C15ull) >> 32) & (slots_.size() - 1);
+}
+
+inline size_t ContactCache::FindSlot(uint64_t i_key) const
+{
+    // the slot holding the key, or the empty slot it would go in
+    size_t slot = GetHomeSlot(i_key);
+    while (slots_[slot].key != i_key && slots_[slot].key != EMPTY_KEY)
+    {
+        slot = (slot + 1) & (slots_.size() - 1);
+    }
+    return slot;
+}
+
+} // namespace physics
+} // namespace engine
@@ -0,0 +1,131 @@
+#ifndef CONTACT_CACHE_H_
+#define CONTACT_CACHE_H_
+
+// library includes
+#include <stdint.h>
+#include <vector>
+
+// engine includes
+#include "Math/Vec3D.h"
+#include "Memory/FrameAllocator.h"
+#include "Memory/WeakPointer.h"
+#include "Physics/PhysicsWorld.h"
+
+// contacts are allocated in blocks of this size
+#define CONTACT_CACHE_BLOCK_SIZE                                64
+// slots the table starts out with, it doubles whenever it is more than three quarters full
+#define CONTACT_CACHE_INITIAL_NUM_SLOTS                         64
+
+// forward declaration
+namespace engine {
+namespace physics {
+    class PhysicsObject;
+}
+}
+
+namespace engine {
+namespace physics {
+
+struct CollisionPair
+{
+    float                                                       time;
+    engine::math::Vec3D                                         normal;
+    engine::memory::WeakPointer<PhysicsObject>                  object_a;
+    engine::memory::WeakPointer<PhysicsObject>                  object_b;
+};
+
+// everything the separating axis test of two objects depends on, with the object that has the lower handle first
+struct ContactState
+{
+    engine::math::Vec3D                                         relative_position;  // the second object's position relative to the first
+    engine::math::Vec3D                                         relative_velocity;  // the first object's velocity relative to the second
+    float                                                       rotation_a;
+    float                                                       rotation_b;
+    float                                                       dt;
+};
+
+inline bool operator==(const ContactState& i_lhs, const ContactState& i_rhs);
+
+// two objects that touched, kept for as long as they keep touching
+struct Contact
+{
+    CollisionPair                                               collision;          // the last collision between the objects
+    ContactState                                                state;              // the objects' state when that collision was found
+    uint32_t                                                    last_frame;
+    uint32_t                                                    num_frames;         // frames in a row the objects have touched
+};
+
+/*
+    ContactCache
+    - Remembers which objects touched, in a hash table keyed on both objects' physics handles
+    - Contacts are stored in fixed blocks of CONTACT_CACHE_BLOCK_SIZE & reused once removed, while the table only holds
+      keys & indices, open addressed with linear probing in a single array, so thousands of contacts neither scatter
+      small allocations all over the heap nor need one large one
+    - Contacts persist from frame to frame, so the collider can tell objects that start, keep & stop touching apart
+    - A contact keeps the last collision & what it was found from, so a pair that is in exactly the same relative state
+      again can reuse it instead of being tested again, or a response can start from last frame's result
+*/
+class ContactCache
+{
+public:
+    ContactCache();
+    ~ContactCache();
+
+    // start a new frame, contacts that aren't added again before EndFrame are removed
+    inline void BeginFrame();
+    // remember that two objects touched this frame
+    const Contact& AddContact(PhysicsHandle i_handle_a, PhysicsHandle i_handle_b, const CollisionPair& i_collision, const ContactState& i_state);
+    // remove the contacts that weren't added this frame & hand out their last collisions
+    void EndFrame(engine::memory::FrameVector<CollisionPair>& o_exited_collisions);
+    inline void Clear();
+
+    // the contact between two objects, or nullptr if they haven't touched since the last EndFrame
+    inline const Contact* Find(PhysicsHandle i_handle_a, PhysicsHandle i_handle_b) const;
+    inline size_t GetNumContacts() const;
+
+    // the same key no matter which object comes first
+    static inline uint64_t GetKey(PhysicsHandle i_handle_a, PhysicsHandle i_handle_b);
+
+    static const uint64_t                                       EMPTY_KEY;
+
+private:
+    struct Slot
+    {
+        uint64_t                                                key;
+        uint32_t                                                contact;            // index of the contact
+    };
+
+    struct ContactBlock
+    {
+        Contact                                                 contacts[CONTACT_CACHE_BLOCK_SIZE];
+    };
+
+    inline Contact& GetContact(uint32_t i_index);
+    inline const Contact& GetContact(uint32_t i_index) const;
+    void AddBlock();
+    inline size_t GetHomeSlot(uint64_t i_key) const;
+    inline size_t FindSlot(uint64_t i_key) const;
+    void Grow();
+    // close the gap left by an erased slot, so probes don't stop early
+    void EraseSlot(size_t i_slot);
+
+private:
+    // disable copy constructor & copy assignment operator
+    ContactCache(const ContactCache& i_copy) = delete;
+    ContactCache& operator=(const ContactCache& i_copy) = delete;
+
+private:
+    std::vector<Slot>                                           slots_;             // a power of two in size
+    std::vector<ContactBlock*>                                  blocks_;
+    std::vector<uint32_t>                                       free_contacts_;     // indices of removed contacts, to be reused
+    size_t                                                      num_contacts_;
+    uint32_t                                                    frame_;
+
+}; // class ContactCache
+
+} // namespace physics
+} // namespace engine
+
+#include "ContactCache-inl.h"
+
+#endif // CONTACT_CACHE_H_
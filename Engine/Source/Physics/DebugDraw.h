@@ -4,8 +4,8 @@
 #define DEBUG_DRAW_H_
 
 // engine includes
-#include "Memory\SharedPointer.h"
-#include "Renderer\RenderableObject.h"
+#include "Memory/SharedPointer.h"
+#include "Renderer/RenderableObject.h"
 
 // forward declarations
 namespace engine {
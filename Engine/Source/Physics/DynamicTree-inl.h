@@ -0,0 +1,109 @@
+#include "DynamicTree.h"
+
+// engine includes
+#include "Assert/Assert.h"
+
+namespace engine {
+namespace physics {
+
+template<class TCallback>
+inline void DynamicTree::Query(const DynamicTreeBox& i_box, TCallback i_callback) const
+{
+    if (root_ == DYNAMIC_TREE_NULL_NODE)
+    {
+        return;
+    }
+
+    int32_t stack[DYNAMIC_TREE_QUERY_STACK_SIZE];
+    int32_t stack_size = 0;
+    stack[stack_size++] = root_;
+
+    while (stack_size > 0)
+    {
+        const Node& node = nodes_[stack[--stack_size]];
+        if (!Overlaps(node.box, i_box))
+        {
+            continue;
+        }
+
+        if (node.height == 0)
+        {
+            if (!i_callback(static_cast<int32_t>(&node - nodes_.data())))
+            {
+                return;
+            }
+        }
+        else
+        {
+            ASSERT(stack_size + 2 <= DYNAMIC_TREE_QUERY_STACK_SIZE);
+            stack[stack_size++] = node.child_1;
+            stack[stack_size++] = node.child_2;
+        }
+    }
+}
+
+inline const DynamicTreeBox& DynamicTree::GetFatBox(int32_t i_proxy) const
+{
+    ASSERT(i_proxy >= 0 && size_t(i_proxy) < nodes_.size());
+    return nodes_[i_proxy].box;
+}
+
+inline uint32_t DynamicTree::GetUserData(int32_t i_proxy) const
+{
+    ASSERT(i_proxy >= 0 && size_t(i_proxy) < nodes_.size());
+    return nodes_[i_proxy].user_data;
+}
+
+inline void DynamicTree::SetUserData(int32_t i_proxy, uint32_t i_user_data)
+{
+    ASSERT(i_proxy >= 0 && size_t(i_proxy) < nodes_.size() && nodes_[i_proxy].height == 0);
+    nodes_[i_proxy].user_data = i_user_data;
+}
+
+inline size_t DynamicTree::GetNumProxies() const
+{
+    return num_proxies_;
+}
+
+inline int32_t DynamicTree::GetHeight() const
+{
+    return root_ == DYNAMIC_TREE_NULL_NODE ? 0 : nodes_[root_].height + 1;
+}
+
+inline float DynamicTree::GetMargin() const
+{
+    return margin_;
+}
+
+inline bool DynamicTree::Overlaps(const DynamicTreeBox& i_box_a, const DynamicTreeBox& i_box_b)
+{
+    return i_box_a.min_x <= i_box_b.max_x && i_box_b.min_x <= i_box_a.max_x &&
+        i_box_a.min_y <= i_box_b.max_y && i_box_b.min_y <= i_box_a.max_y;
+}
+
+inline bool DynamicTree::Contains(const DynamicTreeBox& i_outer, const DynamicTreeBox& i_inner)
+{
+    return i_outer.min_x <= i_inner.min_x && i_outer.min_y <= i_inner.min_y &&
+        i_inner.max_x <= i_outer.max_x && i_inner.max_y <= i_outer.max_y;
+}
+
+inline DynamicTreeBox DynamicTree::Combine(const DynamicTreeBox& i_box_a, const DynamicTreeBox& i_box_b)
+{
+    return { i_box_a.min_x < i_box_b.min_x ? i_box_a.min_x : i_box_b.min_x,
+        i_box_a.min_y < i_box_b.min_y ? i_box_a.min_y : i_box_b.min_y,
+        i_box_a.max_x > i_box_b.max_x ? i_box_a.max_x : i_box_b.max_x,
+        i_box_a.max_y > i_box_b.max_y ? i_box_a.max_y : i_box_b.max_y };
+}
+
+inline float DynamicTree::GetPerimeter(const DynamicTreeBox& i_box)
+{
+    return 2.0f * ((i_box.max_x - i_box.min_x) + (i_box.max_y - i_box.min_y));
+}
+
+inline bool DynamicTree::IsLeaf(int32_t i_node) const
+{
+    return nodes_[i_node].child_1 == DYNAMIC_TREE_NULL_NODE;
+}
+
+} // namespace physics
+} // namespace engine
@@ -0,0 +1,110 @@
+#ifndef DYNAMIC_TREE_H_
+#define DYNAMIC_TREE_H_
+
+// library includes
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// the index of a node that doesn't exist
+#define DYNAMIC_TREE_NULL_NODE                  -1
+// how much farther than its box a proxy's fat box reaches, so small moves don't change the tree
+#define DEFAULT_DYNAMIC_TREE_MARGIN             8.0f
+// deepest a query can go, far more than a balanced tree of any size needs
+#define DYNAMIC_TREE_QUERY_STACK_SIZE           256
+
+namespace engine {
+namespace physics {
+
+struct DynamicTreeBox
+{
+    float                                       min_x;
+    float                                       min_y;
+    float                                       max_x;
+    float                                       max_y;
+};
+
+/*
+    DynamicTree
+    - A bounding volume tree of boxes that can be added, moved & removed at any time, based on Box2D's b2DynamicTree
+    - Every proxy's box is fattened by a margin, a proxy is only taken out & inserted again once its box leaves its fat box
+    - Leaves are inserted next to the sibling that grows the tree's perimeter the least & the tree is kept balanced with
+      rotations, so queries stay logarithmic no matter the order proxies were added in
+    - Nodes are stored in a single array & reused once freed, proxies are identified by the index of their node
+*/
+class DynamicTree
+{
+    struct Node
+    {
+        DynamicTreeBox                          box;                                // fattened for leaves, bounds both children otherwise
+        int32_t                                 parent;                             // or the next free node
+        int32_t                                 child_1;
+        int32_t                                 child_2;
+        int32_t                                 height;                             // 0 for leaves, -1 for free nodes
+        uint32_t                                user_data;
+    };
+
+public:
+    DynamicTree(float i_margin = DEFAULT_DYNAMIC_TREE_MARGIN);
+    ~DynamicTree();
+
+    // add a proxy, the user data identifies it to the caller
+    int32_t CreateProxy(const DynamicTreeBox& i_box, uint32_t i_user_data);
+    void DestroyProxy(int32_t i_proxy);
+    // move a proxy to its new box, true if it left its fat box & was inserted again
+    bool MoveProxy(int32_t i_proxy, const DynamicTreeBox& i_box);
+    void Clear();
+
+    // call back with every proxy whose fat box overlaps the box, until the callback returns false
+    template<class TCallback>
+    inline void Query(const DynamicTreeBox& i_box, TCallback i_callback) const;
+
+    inline const DynamicTreeBox& GetFatBox(int32_t i_proxy) const;
+    inline uint32_t GetUserData(int32_t i_proxy) const;
+    inline void SetUserData(int32_t i_proxy, uint32_t i_user_data);
+    inline size_t GetNumProxies() const;
+    // the number of nodes on the longest path from the root to a leaf
+    inline int32_t GetHeight() const;
+    inline float GetMargin() const;
+
+    // check every link, height & box in the tree
+    bool Validate() const;
+
+    static inline bool Overlaps(const DynamicTreeBox& i_box_a, const DynamicTreeBox& i_box_b);
+    static inline bool Contains(const DynamicTreeBox& i_outer, const DynamicTreeBox& i_inner);
+    static inline DynamicTreeBox Combine(const DynamicTreeBox& i_box_a, const DynamicTreeBox& i_box_b);
+    static inline float GetPerimeter(const DynamicTreeBox& i_box);
+
+private:
+    // disable copy constructor & copy assignment operator
+    DynamicTree(const DynamicTree& i_copy) = delete;
+    DynamicTree& operator=(const DynamicTree& i_copy) = delete;
+
+    int32_t AllocateNode();
+    void FreeNode(int32_t i_node);
+    inline bool IsLeaf(int32_t i_node) const;
+
+    void InsertLeaf(int32_t i_leaf);
+    void RemoveLeaf(int32_t i_leaf);
+    // rotate the taller child up if the node's children differ in height by more than one, returns the node now in its place
+    int32_t Balance(int32_t i_node);
+    // refit the boxes & heights of a node & its ancestors, balancing them on the way up
+    void RefitAncestors(int32_t i_node);
+
+    bool ValidateNode(int32_t i_node, int32_t i_parent, size_t& io_num_leaves) const;
+
+private:
+    std::vector<Node>                           nodes_;
+    int32_t                                     root_;
+    int32_t                                     free_list_;
+    size_t                                      num_proxies_;
+    float                                       margin_;
+
+}; // class DynamicTree
+
+} // namespace physics
+} // namespace engine
+
+#include "DynamicTree-inl.h"
+
+#endif // DYNAMIC_TREE_H_
@@ -1,11 +1,8 @@
 #include "Physics.h"
 
-// library includes
-#include <algorithm>
-
 // engine includes
-#include "Assert\Assert.h"
-#include "Logger\Logger.h"
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
 
 namespace engine {
 namespace physics {
@@ -15,5 +12,15 @@ inline Physics* Physics::Get()
     return Physics::instance_;
 }
 
+inline PhysicsWorld& Physics::GetWorld()
+{
+    return world_;
+}
+
+inline size_t Physics::GetNumPhysicsObjects() const
+{
+    return num_physics_objects_;
+}
+
 } // namespace physics
 } // namespace engine
\ No newline at end of file
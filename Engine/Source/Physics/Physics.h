@@ -2,12 +2,13 @@
 #define PHYSICS_H_
 
 // library includes
-#include <mutex>
 #include <vector>
 
 // engine includes
-#include "Memory\SharedPointer.h"
-#include "Physics\PhysicsObject.h"
+#include "Data/CommandQueue.h"
+#include "Memory/SharedPointer.h"
+#include "Physics/PhysicsObject.h"
+#include "Physics/PhysicsWorld.h"
 
 namespace engine {
 namespace physics {
@@ -15,6 +16,8 @@ namespace physics {
 /*
     Physics
     - A class that updates physics objects
+    - Owns the physics world that stores the physics objects' bodies
+    - Physics objects can be added & removed from any thread, the changes are queued without a lock & applied when physics next runs
 */
 
 class Physics
@@ -33,23 +36,34 @@ public:
     static void Destroy();
     static inline Physics* Get();
 
+    // apply the queued adds & removes, then simulate
     void Run(float i_dt);
+    // apply the queued adds & removes, must be called from the thread that runs physics
+    void ApplyCommands();
 
     // create, add & remove physics objects
     engine::memory::SharedPointer<PhysicsObject> CreatePhysicsObject(const engine::memory::WeakPointer<engine::gameobject::GameObject>& i_game_object, 
                                                                     float i_mass = PhysicsObject::DEFAULT_MASS, 
                                                                     float i_drag = PhysicsObject::DEFAULT_COEFF_DRAG, 
                                                                     PhysicsObjectType i_type = PhysicsObjectType::kPhysicsObjectStatic,
-                                                                    uint16_t i_collision_filter = 0x0000,
+                                                                    const CollisionFilter& i_collision_filter = PhysicsObject::DEFAULT_COLLISION_FILTER,
                                                                     bool i_is_collidable = false);
 
+    // collidable objects are added to & removed from the collider too
     void AddPhysicsObject(const engine::memory::SharedPointer<PhysicsObject>& i_physics_object);
     void RemovePhysicsObject(const engine::memory::SharedPointer<PhysicsObject>& i_physics_object);
 
+    inline PhysicsWorld& GetWorld();
+    inline size_t GetNumPhysicsObjects() const;
+
+private:
+    void ApplyCommand(const PhysicsObjectCommand& i_command);
+
 private:
+    PhysicsWorld                                                                    world_;
     size_t                                                                          num_physics_objects_;
     std::vector<engine::memory::SharedPointer<PhysicsObject>>                       physics_objects_;
-    std::mutex                                                                      physics_mutex_;
+    engine::data::CommandQueue<PhysicsObjectCommand>                                commands_;
 };
 
 } // namespace physics
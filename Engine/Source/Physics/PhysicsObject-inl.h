@@ -1,7 +1,7 @@
 #include "PhysicsObject.h"
 
 // engine includes
-#include "GameObject\GameObject.h"
+#include "GameObject/GameObject.h"
 
 namespace engine {
 namespace physics {
@@ -10,7 +10,7 @@ inline engine::memory::SharedPointer<PhysicsObject> PhysicsObject::Create(const
     float i_mass,
     float i_drag,
     PhysicsObjectType i_type,
-    uint16_t i_collision_filter,
+    const CollisionFilter& i_collision_filter,
     bool i_is_collidable)
 {
     return engine::memory::SharedPointer<PhysicsObject>(new PhysicsObject(i_game_object, i_mass, i_drag, i_type, i_collision_filter, i_is_collidable));
@@ -21,15 +21,9 @@ inline PhysicsObject& PhysicsObject::operator=(const PhysicsObject& i_copy)
     // check for self assignment
     if (this != &i_copy)
     {
-        curr_velocity_ = i_copy.curr_velocity_;
+        world_->CopyBody(i_copy.handle_, handle_);
         collision_data_ = i_copy.collision_data_;
         game_object_ = i_copy.game_object_;
-        mass_ = i_copy.mass_;
-        inverse_mass_ = i_copy.inverse_mass_;
-        coeff_drag_ = i_copy.coeff_drag_;
-        type_ = i_copy.type_;
-        is_awake_ = i_copy.is_awake_;
-        is_active_ = i_copy.is_active_;
 #ifdef ENABLE_DEBUG_DRAW
         debug_draw_data_ = nullptr;
 #endif
@@ -38,23 +32,40 @@ inline PhysicsObject& PhysicsObject::operator=(const PhysicsObject& i_copy)
     return *this;
 }
 
-inline const engine::math::Vec3D& PhysicsObject::GetVelocity() const
+inline void PhysicsObject::ApplyImpulse(const engine::math::Vec3D& i_impulse)
 {
-    return curr_velocity_;
+    world_->ApplyImpulse(handle_, i_impulse);
+}
+
+inline void PhysicsObject::RespondToCollision(const engine::math::Vec3D& collision_normal)
+{
+    world_->RespondToCollision(handle_, collision_normal, collision_data_.default_collision_response_enabled_);
+}
+
+inline engine::math::Vec3D PhysicsObject::GetVelocity() const
+{
+    return world_->GetVelocity(handle_);
 }
 
 inline void PhysicsObject::SetVelocity(const engine::math::Vec3D& i_velocity)
 {
-    curr_velocity_ = i_velocity;
+    world_->SetVelocity(handle_, i_velocity);
+
+    // a body that was given a velocity must be simulated
+    if (!i_velocity.IsZero())
+    {
+        world_->SetIsAwake(handle_, true);
+    }
 }
 
-inline uint16_t PhysicsObject::GetCollisionFilter() const
+inline const CollisionFilter& PhysicsObject::GetCollisionFilter() const
 {
     return collision_data_.collision_filter_;
 }
 
-inline void PhysicsObject::SetCollisionFilter(uint16_t i_collision_filter)
+inline void PhysicsObject::SetCollisionFilter(const CollisionFilter& i_collision_filter)
 {
+    ASSERT(IsValidCollisionCategory(i_collision_filter.category));
     collision_data_.collision_filter_ = i_collision_filter;
 }
 
@@ -87,61 +98,63 @@ inline void PhysicsObject::SetGameObject(const engine::memory::WeakPointer<engin
 {
     ASSERT(i_game_object);
     game_object_ = i_game_object;
+    world_->SetGameObject(handle_, i_game_object.Lock().operator->());
 }
 
 inline float PhysicsObject::GetMass() const
 {
-    return mass_;
+    return world_->GetMass(handle_);
 }
 
 inline void PhysicsObject::SetMass(float i_mass)
 {
-    // physics objects must have positive mass
-    ASSERT(!engine::math::IsNaN(i_mass) && !engine::math::FuzzyEquals(i_mass, 0.0f));
-    mass_ = i_mass;
-    inverse_mass_ = 1.0f / mass_;
+    world_->SetMass(handle_, i_mass);
 }
 
 inline float PhysicsObject::GetDrag() const
 {
-    return coeff_drag_;
+    return world_->GetDrag(handle_);
 }
 
 inline void PhysicsObject::SetDrag(float i_drag)
 {
     ASSERT(!engine::math::IsNaN(i_drag) && i_drag < MAX_COEFF_DRAG);
-    coeff_drag_ = i_drag;
+    world_->SetDrag(handle_, i_drag);
 }
 
 inline PhysicsObjectType PhysicsObject::GetType() const
 {
-    return type_;
+    return world_->GetType(handle_);
 }
 
 inline void PhysicsObject::SetType(PhysicsObjectType i_type)
 {
-    type_ = i_type;
+    world_->SetType(handle_, i_type);
 }
 
 inline bool PhysicsObject::GetIsAwake() const
 {
-    return is_awake_;
+    return world_->GetIsAwake(handle_);
 }
 
 inline void PhysicsObject::SetIsAwake(bool i_is_awake)
 {
-    is_awake_ = i_is_awake;
+    world_->SetIsAwake(handle_, i_is_awake);
 }
 
 inline bool PhysicsObject::GetIsActive() const
 {
-    return is_active_;
+    return world_->GetIsActive(handle_);
 }
 
 inline void PhysicsObject::SetIsActive(bool i_is_active)
 {
-    is_active_ = i_is_active;
-    curr_velocity_ = engine::math::Vec3D::ZERO;
+    world_->SetIsActive(handle_, i_is_active);
+}
+
+inline PhysicsHandle PhysicsObject::GetHandle() const
+{
+    return handle_;
 }
 
 } // namespace physics
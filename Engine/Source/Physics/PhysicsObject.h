@@ -5,52 +5,41 @@
 #include <stdint.h>
 
 // engine includes
-#include "Math\Vec3D.h"
-#include "Memory\SharedPointer.h"
-#include "Memory\WeakPointer.h"
+#include "Math/Vec3D.h"
+#include "Memory/RefCounted.h"
+#include "Memory/SharedPointer.h"
+#include "Memory/WeakPointer.h"
+#include "Physics/CollisionFilter.h"
+#include "Physics/PhysicsWorld.h"
 
 #ifdef ENABLE_DEBUG_DRAW
-#include "Physics\DebugDraw.h"
+#include "Physics/DebugDraw.h"
 #endif
 
-// forward declaration
-namespace engine {
-namespace gameobject {
-    class GameObject;
-}
-}
-
 namespace engine {
 namespace physics {
 
-enum class PhysicsObjectType : uint8_t
-{
-    kPhysicsObjectStatic =              0,
-    kPhysicsObjectKinematic =           1,
-    kPhysicsObjectDynamic =             2
-};
-
 struct CollisionData
 {
-    uint16_t                                                                collision_filter_;
+    CollisionFilter                                                         collision_filter_;
     bool                                                                    is_collidable_;
-    bool                                                                    done_collision_response_;
     bool                                                                    default_collision_response_enabled_;
 };
 
 /*
     PhysicsObject
     - A class that can be used to associate physics with a game object
+    - A handle to a body in the physics world, which stores & integrates the state of every body
 */
 
-class PhysicsObject
+class PhysicsObject : public engine::memory::RefCounted
 {
 public:
     inline static engine::memory::SharedPointer<PhysicsObject> Create(const engine::memory::WeakPointer<engine::gameobject::GameObject>& i_game_object,
         float i_mass = DEFAULT_MASS,
         float i_drag = DEFAULT_COEFF_DRAG,
         PhysicsObjectType i_type = PhysicsObjectType::kPhysicsObjectStatic,
-        uint16_t i_collision_filter = 0x0000,
+        const CollisionFilter& i_collision_filter = DEFAULT_COLLISION_FILTER,
         bool i_is_collidable = false);
     ~PhysicsObject();
 
@@ -60,9 +49,8 @@ public:
     inline PhysicsObject& operator=(const PhysicsObject& i_copy);
 
     // functions
-    void Update(float i_dt);
-    void ApplyImpulse(const engine::math::Vec3D& i_impulse);
-    void RespondToCollision(const engine::math::Vec3D& collision_normal);
+    inline void ApplyImpulse(const engine::math::Vec3D& i_impulse);
+    inline void RespondToCollision(const engine::math::Vec3D& collision_normal);
 
     // debug draw functions
 #ifdef ENABLE_DEBUG_DRAW
@@ -71,11 +59,11 @@ public:
 #endif
 
     // accessors and mutators
-    inline const engine::math::Vec3D& GetVelocity() const;
+    inline engine::math::Vec3D GetVelocity() const;
     inline void SetVelocity(const engine::math::Vec3D& i_velocity);
 
-    inline uint16_t GetCollisionFilter() const;
-    inline void SetCollisionFilter(uint16_t i_collision_filter);
+    inline const CollisionFilter& GetCollisionFilter() const;
+    inline void SetCollisionFilter(const CollisionFilter& i_collision_filter);
 
     inline bool GetIsCollidable() const;
     inline void SetIsCollidable(bool i_is_collidable);
@@ -101,12 +89,14 @@ public:
     inline bool GetIsActive() const;
     inline void SetIsActive(bool i_is_active);
 
+    inline PhysicsHandle GetHandle() const;
+
 private:
     explicit PhysicsObject(const engine::memory::WeakPointer<engine::gameobject::GameObject>& i_game_object, 
         float i_mass = DEFAULT_MASS, 
         float i_drag = DEFAULT_COEFF_DRAG, 
         PhysicsObjectType i_type = PhysicsObjectType::kPhysicsObjectStatic,
-        uint16_t i_collision_filter = 0x0000,
+        const CollisionFilter& i_collision_filter = DEFAULT_COLLISION_FILTER,
         bool i_is_collidable = false);
 
 public:
@@ -116,26 +106,37 @@ public:
     static const float                                                      MAX_COEFF_DRAG;
     static const float                                                      MIN_VELOCITY_LENGTH_SQUARED;
     static const float                                                      MAX_VELOCITY_LENGTH_SQUARED;
+    static const CollisionFilter                                            DEFAULT_COLLISION_FILTER;
 
 private:
-    engine::math::Vec3D                                                     curr_velocity_;
+    // the index of an object that isn't stored by the physics system or the collider
+    static const size_t                                                     INVALID_INDEX;
+
+    PhysicsWorld*                                                           world_;
+    PhysicsHandle                                                           handle_;
     CollisionData                                                           collision_data_;
     engine::memory::WeakPointer<engine::gameobject::GameObject>             game_object_;
 
-    float                                                                   mass_;
-    float                                                                   inverse_mass_;
-    float                                                                   coeff_drag_;
-
-    PhysicsObjectType                                                       type_;
-    bool                                                                    is_awake_;
-    bool                                                                    is_active_;
+    // where the physics system & the collider store this object, so they can remove it without searching
+    size_t                                                                  physics_index_;
+    size_t                                                                  collider_index_;
 
 #ifdef ENABLE_DEBUG_DRAW
     DebugDrawData*                                                          debug_draw_data_;
 #endif
 
+    friend class Physics;
+    friend class Collider;
+
 }; // class PhysicsObject
 
+// adds an object to or removes it from the physics system or the collider, queued until the next time they run
+struct PhysicsObjectCommand
+{
+    engine::memory::SharedPointer<PhysicsObject>                            physics_object;
+    bool                                                                    is_add;
+};
+
 } // namespace physics
 } // namespace engine
 
@@ -0,0 +1,161 @@
+#include "PhysicsWorld.h"
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Math/MathUtil.h"
+
+namespace engine {
+namespace physics {
+
+inline engine::math::Vec3D PhysicsWorld::GetVelocity(PhysicsHandle i_handle) const
+{
+    const BodyBlock& block = GetBlock(i_handle);
+    const size_t lane = GetLane(i_handle);
+    return engine::math::Vec3D(block.velocity_x[lane], block.velocity_y[lane], block.velocity_z[lane]);
+}
+
+inline void PhysicsWorld::SetVelocity(PhysicsHandle i_handle, const engine::math::Vec3D& i_velocity)
+{
+    BodyBlock& block = GetBlock(i_handle);
+    const size_t lane = GetLane(i_handle);
+    block.velocity_x[lane] = i_velocity.x();
+    block.velocity_y[lane] = i_velocity.y();
+    block.velocity_z[lane] = i_velocity.z();
+}
+
+inline float PhysicsWorld::GetMass(PhysicsHandle i_handle) const
+{
+    return GetBlock(i_handle).mass[GetLane(i_handle)];
+}
+
+inline void PhysicsWorld::SetMass(PhysicsHandle i_handle, float i_mass)
+{
+    // physics objects must have positive mass
+    ASSERT(!engine::math::IsNaN(i_mass) && !engine::math::FuzzyEquals(i_mass, 0.0f));
+    BodyBlock& block = GetBlock(i_handle);
+    const size_t lane = GetLane(i_handle);
+    block.mass[lane] = i_mass;
+    block.inverse_mass[lane] = 1.0f / i_mass;
+}
+
+inline float PhysicsWorld::GetInverseMass(PhysicsHandle i_handle) const
+{
+    return GetBlock(i_handle).inverse_mass[GetLane(i_handle)];
+}
+
+inline float PhysicsWorld::GetDrag(PhysicsHandle i_handle) const
+{
+    return GetBlock(i_handle).drag[GetLane(i_handle)];
+}
+
+inline void PhysicsWorld::SetDrag(PhysicsHandle i_handle, float i_drag)
+{
+    GetBlock(i_handle).drag[GetLane(i_handle)] = i_drag;
+}
+
+inline PhysicsObjectType PhysicsWorld::GetType(PhysicsHandle i_handle) const
+{
+    return GetBlock(i_handle).type[GetLane(i_handle)];
+}
+
+inline void PhysicsWorld::SetType(PhysicsHandle i_handle, PhysicsObjectType i_type)
+{
+    GetBlock(i_handle).type[GetLane(i_handle)] = i_type;
+}
+
+inline bool PhysicsWorld::GetIsAwake(PhysicsHandle i_handle) const
+{
+    return GetBlock(i_handle).is_awake[GetLane(i_handle)] != 0;
+}
+
+inline void PhysicsWorld::SetIsAwake(PhysicsHandle i_handle, bool i_is_awake)
+{
+    BodyBlock& block = GetBlock(i_handle);
+    const size_t lane = GetLane(i_handle);
+    block.is_awake[lane] = i_is_awake ? 1 : 0;
+
+    // a body that was woken up has to rest all over again before it can fall asleep
+    if (i_is_awake)
+    {
+        block.sleep_time[lane] = 0.0f;
+    }
+}
+
+inline bool PhysicsWorld::GetIsActive(PhysicsHandle i_handle) const
+{
+    return GetBlock(i_handle).is_active[GetLane(i_handle)] != 0;
+}
+
+inline void PhysicsWorld::SetIsActive(PhysicsHandle i_handle, bool i_is_active)
+{
+    GetBlock(i_handle).is_active[GetLane(i_handle)] = i_is_active ? 1 : 0;
+    SetVelocity(i_handle, engine::math::Vec3D::ZERO);
+}
+
+inline bool PhysicsWorld::GetIsSimulated(PhysicsHandle i_handle) const
+{
+    return GetBlock(i_handle).is_simulated[GetLane(i_handle)] != 0;
+}
+
+inline void PhysicsWorld::SetIsSimulated(PhysicsHandle i_handle, bool i_is_simulated)
+{
+    BodyBlock& block = GetBlock(i_handle);
+    const size_t lane = GetLane(i_handle);
+    block.is_simulated[lane] = i_is_simulated ? 1 : 0;
+
+    // a body that was removed mustn't touch its game object again, which may be released soon after
+    if (!i_is_simulated)
+    {
+        block.was_integrated[lane] = 0;
+    }
+}
+
+inline void PhysicsWorld::SetGameObject(PhysicsHandle i_handle, engine::gameobject::GameObject* i_game_object)
+{
+    ASSERT(i_game_object);
+    GetBlock(i_handle).game_object[GetLane(i_handle)] = i_game_object;
+}
+
+inline bool PhysicsWorld::GetWasIntegrated(PhysicsHandle i_handle) const
+{
+    return GetBlock(i_handle).was_integrated[GetLane(i_handle)] != 0;
+}
+
+inline float PhysicsWorld::GetImpactTime(PhysicsHandle i_handle) const
+{
+    return GetBlock(i_handle).impact_time[GetLane(i_handle)];
+}
+
+inline size_t PhysicsWorld::GetNumBodies() const
+{
+    return num_bodies_;
+}
+
+inline bool PhysicsWorld::CanJoinIsland(PhysicsHandle i_handle) const
+{
+    const BodyBlock& block = GetBlock(i_handle);
+    const size_t lane = GetLane(i_handle);
+    return block.is_simulated[lane] && block.is_active[lane] && block.type[lane] != PhysicsObjectType::kPhysicsObjectStatic;
+}
+
+inline PhysicsWorld::BodyBlock& PhysicsWorld::GetBlock(PhysicsHandle i_handle)
+{
+    ASSERT(i_handle != INVALID_HANDLE && i_handle / PHYSICS_WORLD_BLOCK_SIZE < PHYSICS_WORLD_MAX_BLOCKS);
+    ASSERT(blocks_[i_handle / PHYSICS_WORLD_BLOCK_SIZE]);
+    return *blocks_[i_handle / PHYSICS_WORLD_BLOCK_SIZE];
+}
+
+inline const PhysicsWorld::BodyBlock& PhysicsWorld::GetBlock(PhysicsHandle i_handle) const
+{
+    ASSERT(i_handle != INVALID_HANDLE && i_handle / PHYSICS_WORLD_BLOCK_SIZE < PHYSICS_WORLD_MAX_BLOCKS);
+    ASSERT(blocks_[i_handle / PHYSICS_WORLD_BLOCK_SIZE]);
+    return *blocks_[i_handle / PHYSICS_WORLD_BLOCK_SIZE];
+}
+
+inline size_t PhysicsWorld::GetLane(PhysicsHandle i_handle)
+{
+    return i_handle % PHYSICS_WORLD_BLOCK_SIZE;
+}
+
+} // namespace physics
+} // namespace engine
@@ -0,0 +1,174 @@
+#ifndef PHYSICS_WORLD_H_
+#define PHYSICS_WORLD_H_
+
+// library includes
+#include <mutex>
+#include <stdint.h>
+#include <vector>
+
+// engine includes
+#include "Math/Vec3D.h"
+
+// number of bodies stored in a block, must be a multiple of the SIMD width
+#define PHYSICS_WORLD_BLOCK_SIZE                64
+// maximum number of blocks, blocks are never moved so that bodies can be created while others are being read
+#define PHYSICS_WORLD_MAX_BLOCKS                256
+// how long, in milliseconds, every body of an island must have been resting before the island falls asleep
+#define PHYSICS_WORLD_TIME_TO_SLEEP             500.0f
+
+// forward declaration
+namespace engine {
+namespace gameobject {
+    class GameObject;
+}
+}
+
+namespace engine {
+namespace physics {
+
+enum class PhysicsObjectType : uint8_t
+{
+    kPhysicsObjectStatic =              0,
+    kPhysicsObjectKinematic =           1,
+    kPhysicsObjectDynamic =             2
+};
+
+// identifies a body for as long as it exists, handles of destroyed bodies are reused
+typedef uint32_t PhysicsHandle;
+
+/*
+    PhysicsWorld
+    - Stores the state of every physics body in arrays, one array per quantity
+    - Bodies are stored in fixed blocks of PHYSICS_WORLD_BLOCK_SIZE, so a handle always refers to the same memory
+    - Integrates every simulated body in a single loop, 4 bodies per SSE2 instruction, with the blocks split across the engine's workers
+    - Game objects own the positions, they are read before & written after the integration
+    - Drag brings bodies to a stop once they're below PhysicsObject::MIN_VELOCITY_LENGTH_SQUARED, a body that has been
+      stopped for PHYSICS_WORLD_TIME_TO_SLEEP is resting
+    - Continuous collision detection can advance bodies to their impacts before the run, the run then integrates the rest of the step
+    - Bodies that touch each other form islands & a body that touches nothing is an island of its own, an island only falls
+      asleep once every one of its bodies is resting & until then all of them are kept awake if any of them is, so a sleeping
+      body wakes up when something that moves touches it
+*/
+
+class PhysicsWorld
+{
+private:
+    struct BodyBlock
+    {
+        float                                                               velocity_x[PHYSICS_WORLD_BLOCK_SIZE];
+        float                                                               velocity_y[PHYSICS_WORLD_BLOCK_SIZE];
+        float                                                               velocity_z[PHYSICS_WORLD_BLOCK_SIZE];
+        float                                                               position_x[PHYSICS_WORLD_BLOCK_SIZE];
+        float                                                               position_y[PHYSICS_WORLD_BLOCK_SIZE];
+        float                                                               position_z[PHYSICS_WORLD_BLOCK_SIZE];
+        float                                                               mass[PHYSICS_WORLD_BLOCK_SIZE];
+        float                                                               inverse_mass[PHYSICS_WORLD_BLOCK_SIZE];
+        float                                                               drag[PHYSICS_WORLD_BLOCK_SIZE];
+        engine::gameobject::GameObject*                                     game_object[PHYSICS_WORLD_BLOCK_SIZE];
+        PhysicsObjectType                                                   type[PHYSICS_WORLD_BLOCK_SIZE];
+        uint8_t                                                             is_awake[PHYSICS_WORLD_BLOCK_SIZE];
+        uint8_t                                                             is_active[PHYSICS_WORLD_BLOCK_SIZE];
+        uint8_t                                                             is_simulated[PHYSICS_WORLD_BLOCK_SIZE];
+        uint8_t                                                             done_collision_response[PHYSICS_WORLD_BLOCK_SIZE];
+        uint8_t                                                             was_integrated[PHYSICS_WORLD_BLOCK_SIZE];
+        float                                                               impact_time[PHYSICS_WORLD_BLOCK_SIZE];         // how far into the step the body was moved to an impact
+        float                                                               sleep_time[PHYSICS_WORLD_BLOCK_SIZE];          // how long the body has been stopped for
+    };
+
+    // two bodies that touched during the last collision detection
+    struct BodyContact
+    {
+        PhysicsHandle                                                       body_a;
+        PhysicsHandle                                                       body_b;
+    };
+
+public:
+    PhysicsWorld();
+    ~PhysicsWorld();
+
+    // bodies can be created & destroyed from any thread
+    PhysicsHandle CreateBody(engine::gameobject::GameObject* i_game_object, float i_mass, float i_drag, PhysicsObjectType i_type);
+    void DestroyBody(PhysicsHandle i_handle);
+    void CopyBody(PhysicsHandle i_source, PhysicsHandle i_destination);
+
+    // integrate every simulated body that is active, awake & not static, then put resting islands to sleep & wake up the rest
+    void Run(float i_dt);
+
+    // remember that two bodies touched, the next run joins them into an island
+    // contacts with static, inactive or unsimulated bodies are ignored
+    void AddContact(PhysicsHandle i_body_a, PhysicsHandle i_body_b);
+
+    void ApplyImpulse(PhysicsHandle i_handle, const engine::math::Vec3D& i_impulse);
+    void RespondToCollision(PhysicsHandle i_handle, const engine::math::Vec3D& i_collision_normal, bool i_reflect);
+    // move a body along its velocity to a time within the coming step, the next run only integrates what is left of the step
+    // the body can respond to another collision from there, bodies that won't be integrated aren't moved
+    void AdvanceBody(PhysicsHandle i_handle, float i_time);
+
+    // accessors and mutators
+    inline engine::math::Vec3D GetVelocity(PhysicsHandle i_handle) const;
+    inline void SetVelocity(PhysicsHandle i_handle, const engine::math::Vec3D& i_velocity);
+
+    inline float GetMass(PhysicsHandle i_handle) const;
+    inline void SetMass(PhysicsHandle i_handle, float i_mass);
+    inline float GetInverseMass(PhysicsHandle i_handle) const;
+
+    inline float GetDrag(PhysicsHandle i_handle) const;
+    inline void SetDrag(PhysicsHandle i_handle, float i_drag);
+
+    inline PhysicsObjectType GetType(PhysicsHandle i_handle) const;
+    inline void SetType(PhysicsHandle i_handle, PhysicsObjectType i_type);
+
+    inline bool GetIsAwake(PhysicsHandle i_handle) const;
+    inline void SetIsAwake(PhysicsHandle i_handle, bool i_is_awake);
+
+    inline bool GetIsActive(PhysicsHandle i_handle) const;
+    inline void SetIsActive(PhysicsHandle i_handle, bool i_is_active);
+
+    // only bodies added to the physics system are simulated
+    inline bool GetIsSimulated(PhysicsHandle i_handle) const;
+    inline void SetIsSimulated(PhysicsHandle i_handle, bool i_is_simulated);
+
+    inline void SetGameObject(PhysicsHandle i_handle, engine::gameobject::GameObject* i_game_object);
+
+    // whether the body was integrated by the last run
+    inline bool GetWasIntegrated(PhysicsHandle i_handle) const;
+    // how far into the coming step the body has been advanced
+    inline float GetImpactTime(PhysicsHandle i_handle) const;
+
+    inline size_t GetNumBodies() const;
+
+private:
+    // disable copy constructor & copy assignment operator
+    PhysicsWorld(const PhysicsWorld& i_copy) = delete;
+    PhysicsWorld& operator=(const PhysicsWorld& i_copy) = delete;
+
+    void IntegrateBlock(BodyBlock& io_block, float i_dt);
+    // put the islands whose bodies are all resting to sleep & wake every body of the other islands that have an awake body
+    void UpdateIslands();
+
+    inline bool CanJoinIsland(PhysicsHandle i_handle) const;
+
+    inline BodyBlock& GetBlock(PhysicsHandle i_handle);
+    inline const BodyBlock& GetBlock(PhysicsHandle i_handle) const;
+    static inline size_t GetLane(PhysicsHandle i_handle);
+
+public:
+    static const PhysicsHandle                                              INVALID_HANDLE;
+
+private:
+    BodyBlock*                                                              blocks_[PHYSICS_WORLD_MAX_BLOCKS];
+    size_t                                                                  num_blocks_;
+    size_t                                                                  num_handles_;               // handles given out so far, including destroyed ones
+    size_t                                                                  num_bodies_;
+    std::vector<PhysicsHandle>                                              free_handles_;
+    std::vector<BodyContact>                                                contacts_;
+    std::mutex                                                              world_mutex_;
+
+}; // class PhysicsWorld
+
+} // namespace physics
+} // namespace engine
+
+#include "PhysicsWorld-inl.h"
+
+#endif // PHYSICS_WORLD_H_
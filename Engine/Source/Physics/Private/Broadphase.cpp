@@ -0,0 +1,481 @@
+#include "Physics/Broadphase.h"
+
+// library includes
+#include <algorithm>
+#include <iterator>
+#include <string.h>
+
+namespace engine {
+namespace physics {
+
+Broadphase::Broadphase(BroadphaseType i_type, float i_cell_size) : type_(i_type),
+    cell_size_(i_cell_size),
+    num_pairs_tested_(0),
+    num_moved_proxies_(0)
+{
+    ASSERT(cell_size_ > 0.0f);
+}
+
+Broadphase::~Broadphase()
+{}
+
+void Broadphase::FindPairs(const BroadphaseProxy* i_proxies, size_t i_num_proxies, engine::memory::FrameVector<BroadphasePair>& o_pairs)
+{
+    // validate inputs
+    ASSERT(i_proxies || i_num_proxies == 0);
+
+    num_pairs_tested_ = 0;
+
+    LayerBuckets buckets;
+    BucketProxies(i_proxies, i_num_proxies, buckets);
+
+    switch (type_)
+    {
+    case BroadphaseType::AllPairs:
+        FindPairsAllPairs(i_proxies, buckets, o_pairs);
+        break;
+    case BroadphaseType::UniformGrid:
+        FindPairsUniformGrid(i_proxies, buckets, o_pairs);
+        break;
+    case BroadphaseType::SweepAndPrune:
+        FindPairsSweepAndPrune(i_proxies, i_num_proxies, buckets, o_pairs);
+        break;
+    case BroadphaseType::DynamicTree:
+        FindPairsDynamicTree(i_proxies, i_num_proxies, buckets, o_pairs);
+        break;
+    default:
+        ASSERT(false);
+        break;
+    }
+}
+
+void Broadphase::AddProxy(uint32_t i_key)
+{
+    if (i_key >= tree_proxies_.size())
+    {
+        tree_proxies_.resize(i_key + 1, TreeProxy{ DYNAMIC_TREE_NULL_NODE, UINT32_MAX, false });
+    }
+
+    TreeProxy& tree_proxy = tree_proxies_[i_key];
+    ASSERT(tree_proxy.node == DYNAMIC_TREE_NULL_NODE);
+    tree_proxy.node = BROADPHASE_UNPLACED_TREE_PROXY;
+}
+
+void Broadphase::RemoveProxy(uint32_t i_key)
+{
+    ASSERT(i_key < tree_proxies_.size());
+    TreeProxy& tree_proxy = tree_proxies_[i_key];
+    ASSERT(tree_proxy.node != DYNAMIC_TREE_NULL_NODE);
+
+    if (tree_proxy.node != BROADPHASE_UNPLACED_TREE_PROXY)
+    {
+        tree_.DestroyProxy(tree_proxy.node);
+        // the key's pairs are forgotten the next time FindPairs runs
+        removed_keys_.push_back(i_key);
+    }
+    tree_proxy.node = DYNAMIC_TREE_NULL_NODE;
+}
+
+void Broadphase::BucketProxies(const BroadphaseProxy* i_proxies, size_t i_num_proxies, LayerBuckets& o_buckets)
+{
+    layer_matrix_.Reset();
+    o_buckets.layers.resize(i_num_proxies);
+
+    // count the proxies on each layer
+    uint32_t counts[MAX_COLLISION_LAYERS] = { 0 };
+    for (uint32_t i = 0; i < i_num_proxies; ++i)
+    {
+        const uint8_t layer = GetCollisionLayer(i_proxies[i].collision_filter.category);
+        o_buckets.layers[i] = layer;
+        if (layer != INVALID_COLLISION_LAYER)
+        {
+            layer_matrix_.AddFilter(i_proxies[i].collision_filter);
+            ++counts[layer];
+        }
+    }
+    layer_matrix_.Build();
+
+    o_buckets.begins[0] = 0;
+    for (uint8_t layer = 0; layer < MAX_COLLISION_LAYERS; ++layer)
+    {
+        o_buckets.begins[layer + 1] = o_buckets.begins[layer] + counts[layer];
+    }
+
+    // place each proxy in its layer's bucket, in order of index
+    uint32_t ends[MAX_COLLISION_LAYERS];
+    memcpy(ends, o_buckets.begins, sizeof(ends));
+    o_buckets.proxies.resize(o_buckets.begins[MAX_COLLISION_LAYERS]);
+    for (uint32_t i = 0; i < i_num_proxies; ++i)
+    {
+        const uint8_t layer = o_buckets.layers[i];
+        if (layer != INVALID_COLLISION_LAYER)
+        {
+            o_buckets.proxies[ends[layer]++] = i;
+        }
+    }
+}
+
+void Broadphase::FindPairsAllPairs(const BroadphaseProxy* i_proxies, const LayerBuckets& i_buckets, engine::memory::FrameVector<BroadphasePair>& o_pairs)
+{
+    for (uint8_t layer_a = 0; layer_a < MAX_COLLISION_LAYERS; ++layer_a)
+    {
+        for (uint8_t layer_b = layer_a; layer_b < MAX_COLLISION_LAYERS; ++layer_b)
+        {
+            if (!layer_matrix_.GetLayersCollide(layer_a, layer_b))
+            {
+                continue;
+            }
+
+            for (uint32_t i = i_buckets.begins[layer_a]; i < i_buckets.begins[layer_a + 1]; ++i)
+            {
+                const uint32_t proxy_a = i_buckets.proxies[i];
+                for (uint32_t j = (layer_a == layer_b ? i + 1 : i_buckets.begins[layer_b]); j < i_buckets.begins[layer_b + 1]; ++j)
+                {
+                    const uint32_t proxy_b = i_buckets.proxies[j];
+                    if (TestPair(i_proxies[proxy_a], i_proxies[proxy_b]))
+                    {
+                        AddPair(proxy_a, proxy_b, o_pairs);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void Broadphase::FindPairsUniformGrid(const BroadphaseProxy* i_proxies, const LayerBuckets& i_buckets, engine::memory::FrameVector<BroadphasePair>& o_pairs)
+{
+    const size_t num_layered_proxies = i_buckets.proxies.size();
+    engine::memory::FrameVector<GridEntry> entries;
+    entries.reserve(num_layered_proxies * 2);
+    engine::memory::FrameVector<uint32_t> large_proxies;
+
+    // bucket every proxy into the cells it covers
+    for (size_t i = 0; i < num_layered_proxies; ++i)
+    {
+        const uint32_t proxy_index = i_buckets.proxies[i];
+        const BroadphaseProxy& proxy = i_proxies[proxy_index];
+        const int32_t min_x = GetCellCoordinate(proxy.min_x);
+        const int32_t min_y = GetCellCoordinate(proxy.min_y);
+        const int32_t max_x = GetCellCoordinate(proxy.max_x);
+        const int32_t max_y = GetCellCoordinate(proxy.max_y);
+
+        if (int64_t(max_x - min_x + 1) * int64_t(max_y - min_y + 1) > BROADPHASE_GRID_MAX_CELLS_PER_PROXY)
+        {
+            large_proxies.push_back(proxy_index);
+            continue;
+        }
+
+        for (int32_t x = min_x; x <= max_x; ++x)
+        {
+            for (int32_t y = min_y; y <= max_y; ++y)
+            {
+                entries.push_back({ GetCellKey(x, y), proxy_index, i_buckets.layers[proxy_index] });
+            }
+        }
+    }
+
+    // bring the proxies that share a cell together, grouped by layer
+    std::sort(entries.begin(), entries.end(), [](const GridEntry& i_lhs, const GridEntry& i_rhs) {
+        return i_lhs.cell < i_rhs.cell || (i_lhs.cell == i_rhs.cell && (i_lhs.layer < i_rhs.layer || (i_lhs.layer == i_rhs.layer && i_lhs.proxy < i_rhs.proxy)));
+    });
+
+    const size_t num_entries = entries.size();
+    for (size_t begin = 0, end = 0; begin < num_entries; begin = end)
+    {
+        const uint64_t cell = entries[begin].cell;
+        for (end = begin + 1; end < num_entries && entries[end].cell == cell; ++end);
+
+        // only the layers of the cell that can collide are tested against each other
+        for (size_t begin_a = begin, end_a = begin; begin_a < end; begin_a = end_a)
+        {
+            const uint8_t layer_a = entries[begin_a].layer;
+            for (end_a = begin_a + 1; end_a < end && entries[end_a].layer == layer_a; ++end_a);
+
+            for (size_t begin_b = begin_a, end_b = begin_a; begin_b < end; begin_b = end_b)
+            {
+                const uint8_t layer_b = entries[begin_b].layer;
+                for (end_b = begin_b + 1; end_b < end && entries[end_b].layer == layer_b; ++end_b);
+
+                if (!layer_matrix_.GetLayersCollide(layer_a, layer_b))
+                {
+                    continue;
+                }
+
+                for (size_t i = begin_a; i < end_a; ++i)
+                {
+                    const BroadphaseProxy& proxy_a = i_proxies[entries[i].proxy];
+                    for (size_t j = (begin_a == begin_b ? i + 1 : begin_b); j < end_b; ++j)
+                    {
+                        const BroadphaseProxy& proxy_b = i_proxies[entries[j].proxy];
+                        if (!TestPair(proxy_a, proxy_b))
+                        {
+                            continue;
+                        }
+
+                        // a pair can share several cells, only the cell holding the corner of their overlap reports it
+                        const float overlap_x = proxy_a.min_x > proxy_b.min_x ? proxy_a.min_x : proxy_b.min_x;
+                        const float overlap_y = proxy_a.min_y > proxy_b.min_y ? proxy_a.min_y : proxy_b.min_y;
+                        if (GetCellKey(GetCellCoordinate(overlap_x), GetCellCoordinate(overlap_y)) == cell)
+                        {
+                            AddPair(entries[i].proxy, entries[j].proxy, o_pairs);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // proxies too large for the grid are tested against every proxy on the layers they collide with, once per pair
+    std::sort(large_proxies.begin(), large_proxies.end());
+    const size_t num_large_proxies = large_proxies.size();
+    for (size_t i = 0; i < num_large_proxies; ++i)
+    {
+        const uint32_t large_proxy = large_proxies[i];
+        const uint16_t colliding_layers = layer_matrix_.GetCollidingLayers(i_buckets.layers[large_proxy]);
+
+        for (uint8_t layer = 0; layer < MAX_COLLISION_LAYERS; ++layer)
+        {
+            if ((colliding_layers & GetCollisionCategory(layer)) == 0)
+            {
+                continue;
+            }
+
+            for (uint32_t j = i_buckets.begins[layer]; j < i_buckets.begins[layer + 1]; ++j)
+            {
+                // skip large proxies that come earlier, they have already tested this one
+                const uint32_t proxy = i_buckets.proxies[j];
+                if (proxy == large_proxy || std::binary_search(large_proxies.begin(), large_proxies.begin() + i, proxy))
+                {
+                    continue;
+                }
+                if (TestPair(i_proxies[large_proxy], i_proxies[proxy]))
+                {
+                    AddPair(large_proxy, proxy, o_pairs);
+                }
+            }
+        }
+    }
+}
+
+void Broadphase::FindPairsSweepAndPrune(const BroadphaseProxy* i_proxies, size_t i_num_proxies, const LayerBuckets& i_buckets, engine::memory::FrameVector<BroadphasePair>& o_pairs)
+{
+    const auto is_before = [i_proxies](uint32_t i_lhs, uint32_t i_rhs) {
+        return i_proxies[i_lhs].min_x < i_proxies[i_rhs].min_x;
+    };
+
+    for (uint8_t layer = 0; layer < MAX_COLLISION_LAYERS; ++layer)
+    {
+        std::vector<uint32_t>& sorted_proxies = sorted_proxies_[layer];
+        const size_t num_layer_proxies = i_buckets.begins[layer + 1] - i_buckets.begins[layer];
+
+        // the layer's proxies are the same as last frame's if there are as many & they are all still on the layer
+        bool is_same_layer = sorted_proxies.size() == num_layer_proxies;
+        for (size_t i = 0; is_same_layer && i < num_layer_proxies; ++i)
+        {
+            is_same_layer = sorted_proxies[i] < i_num_proxies && i_buckets.layers[sorted_proxies[i]] == layer;
+        }
+
+        if (!is_same_layer)
+        {
+            // the proxies have changed, start over with a full sort
+            sorted_proxies.assign(i_buckets.proxies.begin() + i_buckets.begins[layer], i_buckets.proxies.begin() + i_buckets.begins[layer + 1]);
+            std::sort(sorted_proxies.begin(), sorted_proxies.end(), is_before);
+        }
+        else
+        {
+            // objects move a little every frame, so last frame's order only needs a few swaps
+            for (size_t i = 1; i < num_layer_proxies; ++i)
+            {
+                const uint32_t proxy = sorted_proxies[i];
+                size_t j = i;
+                for (; j > 0 && is_before(proxy, sorted_proxies[j - 1]); --j)
+                {
+                    sorted_proxies[j] = sorted_proxies[j - 1];
+                }
+                sorted_proxies[j] = proxy;
+            }
+        }
+    }
+
+    for (uint8_t layer_a = 0; layer_a < MAX_COLLISION_LAYERS; ++layer_a)
+    {
+        for (uint8_t layer_b = layer_a; layer_b < MAX_COLLISION_LAYERS; ++layer_b)
+        {
+            if (!layer_matrix_.GetLayersCollide(layer_a, layer_b))
+            {
+                continue;
+            }
+
+            if (layer_a == layer_b)
+            {
+                SweepLayer(i_proxies, sorted_proxies_[layer_a], o_pairs);
+            }
+            else
+            {
+                SweepLayers(i_proxies, sorted_proxies_[layer_a], sorted_proxies_[layer_b], o_pairs);
+            }
+        }
+    }
+}
+
+void Broadphase::FindPairsDynamicTree(const BroadphaseProxy* i_proxies, size_t i_num_proxies, const LayerBuckets& i_buckets, engine::memory::FrameVector<BroadphasePair>& o_pairs)
+{
+    // forget the pairs of removed keys first, the keys may already belong to new proxies
+    if (!removed_keys_.empty())
+    {
+        std::sort(removed_keys_.begin(), removed_keys_.end());
+        const auto is_removed = [this](const TreePair& i_pair) {
+            return std::binary_search(removed_keys_.begin(), removed_keys_.end(), i_pair.key_a) ||
+                std::binary_search(removed_keys_.begin(), removed_keys_.end(), i_pair.key_b);
+        };
+        tree_pairs_.erase(std::remove_if(tree_pairs_.begin(), tree_pairs_.end(), is_removed), tree_pairs_.end());
+        removed_keys_.clear();
+    }
+
+    // place new proxies & move the ones that left their fat boxes, the rest don't touch the tree
+    engine::memory::FrameVector<uint32_t> moved_keys;
+    for (uint32_t i = 0; i < i_num_proxies; ++i)
+    {
+        const BroadphaseProxy& proxy = i_proxies[i];
+        ASSERT(proxy.key < tree_proxies_.size() && tree_proxies_[proxy.key].node != DYNAMIC_TREE_NULL_NODE);
+
+        TreeProxy& tree_proxy = tree_proxies_[proxy.key];
+        ASSERT(tree_proxy.index == UINT32_MAX);
+        tree_proxy.index = i;
+
+        const DynamicTreeBox box = { proxy.min_x, proxy.min_y, proxy.max_x, proxy.max_y };
+        if (tree_proxy.node == BROADPHASE_UNPLACED_TREE_PROXY)
+        {
+            tree_proxy.node = tree_.CreateProxy(box, proxy.key);
+            tree_proxy.is_moved = true;
+            moved_keys.push_back(proxy.key);
+        }
+        else if (tree_.MoveProxy(tree_proxy.node, box))
+        {
+            tree_proxy.is_moved = true;
+            moved_keys.push_back(proxy.key);
+        }
+    }
+    num_moved_proxies_ = moved_keys.size();
+
+    // only moved proxies can have started overlapping another fat box, a pair of moved proxies is only added by the lower key
+    engine::memory::FrameVector<TreePair> new_pairs;
+    for (const uint32_t key : moved_keys)
+    {
+        tree_.Query(tree_.GetFatBox(tree_proxies_[key].node), [this, key, &new_pairs](int32_t i_node) {
+            const uint32_t other_key = tree_.GetUserData(i_node);
+            if (other_key != key && (other_key > key || !tree_proxies_[other_key].is_moved))
+            {
+                new_pairs.push_back(key < other_key ? TreePair{ key, other_key } : TreePair{ other_key, key });
+            }
+            return true;
+        });
+    }
+
+    if (!new_pairs.empty())
+    {
+        // pairs that were already overlapping are found again, so merge without duplicates
+        std::sort(new_pairs.begin(), new_pairs.end());
+        merged_tree_pairs_.clear();
+        merged_tree_pairs_.reserve(tree_pairs_.size() + new_pairs.size());
+        std::set_union(tree_pairs_.begin(), tree_pairs_.end(), new_pairs.begin(), new_pairs.end(), std::back_inserter(merged_tree_pairs_));
+        tree_pairs_.swap(merged_tree_pairs_);
+    }
+
+    // drop the pairs whose fat boxes have come apart & report the ones whose proxies overlap this frame
+    size_t num_kept_pairs = 0;
+    for (const TreePair& pair : tree_pairs_)
+    {
+        const TreeProxy& tree_proxy_a = tree_proxies_[pair.key_a];
+        const TreeProxy& tree_proxy_b = tree_proxies_[pair.key_b];
+        ASSERT(tree_proxy_a.node >= 0 && tree_proxy_b.node >= 0);
+
+        if (!DynamicTree::Overlaps(tree_.GetFatBox(tree_proxy_a.node), tree_.GetFatBox(tree_proxy_b.node)))
+        {
+            continue;
+        }
+        tree_pairs_[num_kept_pairs++] = pair;
+
+        // proxies that weren't passed in this time keep their place & pairs for when they are
+        if (tree_proxy_a.index == UINT32_MAX || tree_proxy_b.index == UINT32_MAX)
+        {
+            continue;
+        }
+
+        const uint8_t layer_a = i_buckets.layers[tree_proxy_a.index];
+        const uint8_t layer_b = i_buckets.layers[tree_proxy_b.index];
+        if (layer_a != INVALID_COLLISION_LAYER && layer_b != INVALID_COLLISION_LAYER && layer_matrix_.GetLayersCollide(layer_a, layer_b) &&
+            TestPair(i_proxies[tree_proxy_a.index], i_proxies[tree_proxy_b.index]))
+        {
+            AddPair(tree_proxy_a.index, tree_proxy_b.index, o_pairs);
+        }
+    }
+    tree_pairs_.resize(num_kept_pairs);
+
+    for (uint32_t i = 0; i < i_num_proxies; ++i)
+    {
+        TreeProxy& tree_proxy = tree_proxies_[i_proxies[i].key];
+        tree_proxy.index = UINT32_MAX;
+        tree_proxy.is_moved = false;
+    }
+}
+
+void Broadphase::SweepLayer(const BroadphaseProxy* i_proxies, const std::vector<uint32_t>& i_sorted_proxies, engine::memory::FrameVector<BroadphasePair>& o_pairs)
+{
+    // every proxy only needs to be tested against those that start before it ends
+    const size_t num_proxies = i_sorted_proxies.size();
+    for (size_t i = 0; i < num_proxies; ++i)
+    {
+        const uint32_t proxy_a = i_sorted_proxies[i];
+        const float max_x = i_proxies[proxy_a].max_x;
+        for (size_t j = i + 1; j < num_proxies && i_proxies[i_sorted_proxies[j]].min_x <= max_x; ++j)
+        {
+            const uint32_t proxy_b = i_sorted_proxies[j];
+            if (TestPair(i_proxies[proxy_a], i_proxies[proxy_b]))
+            {
+                AddPair(proxy_a, proxy_b, o_pairs);
+            }
+        }
+    }
+}
+
+void Broadphase::SweepLayers(const BroadphaseProxy* i_proxies, const std::vector<uint32_t>& i_sorted_proxies_a, const std::vector<uint32_t>& i_sorted_proxies_b, engine::memory::FrameVector<BroadphasePair>& o_pairs)
+{
+    // walk both layers in order of min_x, whichever proxy starts first is tested against the other layer's proxies that start before it ends
+    const size_t num_proxies_a = i_sorted_proxies_a.size();
+    const size_t num_proxies_b = i_sorted_proxies_b.size();
+    size_t a = 0, b = 0;
+    while (a < num_proxies_a && b < num_proxies_b)
+    {
+        const uint32_t proxy_a = i_sorted_proxies_a[a];
+        const uint32_t proxy_b = i_sorted_proxies_b[b];
+
+        if (i_proxies[proxy_a].min_x <= i_proxies[proxy_b].min_x)
+        {
+            const float max_x = i_proxies[proxy_a].max_x;
+            for (size_t j = b; j < num_proxies_b && i_proxies[i_sorted_proxies_b[j]].min_x <= max_x; ++j)
+            {
+                if (TestPair(i_proxies[proxy_a], i_proxies[i_sorted_proxies_b[j]]))
+                {
+                    AddPair(proxy_a, i_sorted_proxies_b[j], o_pairs);
+                }
+            }
+            ++a;
+        }
+        else
+        {
+            const float max_x = i_proxies[proxy_b].max_x;
+            for (size_t j = a; j < num_proxies_a && i_proxies[i_sorted_proxies_a[j]].min_x <= max_x; ++j)
+            {
+                if (TestPair(i_proxies[i_sorted_proxies_a[j]], i_proxies[proxy_b]))
+                {
+                    AddPair(i_sorted_proxies_a[j], proxy_b, o_pairs);
+                }
+            }
+            ++b;
+        }
+    }
+}
+
+} // namespace physics
+} // namespace engine
@@ -1,14 +1,24 @@
-#include "Physics\Collider.h"
+#include "Physics/Collider.h"
+
+// library includes
+#include <algorithm>
+#include <float.h>
+#include <math.h>
 
 // engine includes
-#include "Common\HelperMacros.h"
-#include "GameObject\GameObject.h"
-#include "Math\Mat44.h"
-#include "Math\Mat44-SSE.h"
-#include "Math\Vec3D-SSE.h"
-#include "Math\Vec4D-SSE.h"
-#include "Physics\PhysicsObject.h"
-#include "Util\Profiler.h"
+#include "Common/HelperMacros.h"
+#include "Data/PooledString.h"
+#include "GameObject/GameObject.h"
+#include "Jobs/JobSystem.h"
+#include "Math/AABB.h"
+#include "Math/Mat44.h"
+#include "Math/Mat44-SSE.h"
+#include "Math/Transform.h"
+#include "Math/Vec3D-SSE.h"
+#include "Math/Vec4D-SSE.h"
+#include "Physics/Physics.h"
+#include "Physics/PhysicsObject.h"
+#include "Util/Profiler.h"
 
 namespace engine {
 namespace physics {
@@ -16,8 +26,13 @@ namespace physics {
 // static member initialization
 Collider* Collider::instance_ = nullptr;
 
-Collider::Collider() : num_dynamic_objects_(0),
+Collider::Collider() : sleeping_tree_(0.0f),
+    num_dynamic_objects_(0),
     num_static_kynematic_objects_(0),
+    num_candidate_pairs_(0),
+    num_reused_contacts_(0),
+    is_continuous_collision_enabled_(false),
+    max_impact_iterations_(COLLIDER_DEFAULT_MAX_IMPACT_ITERATIONS),
     collision_listener_(nullptr)
 {}
 
@@ -27,6 +42,12 @@ Collider::~Collider()
     num_dynamic_objects_ = 0;
     static_kynematic_objects_.clear();
     num_static_kynematic_objects_ = 0;
+    baked_objects_.clear();
+    static_bvh_.Clear();
+    sleeping_objects_.clear();
+    sleeping_proxies_.clear();
+    sleeping_tree_proxies_.clear();
+    sleeping_tree_.Clear();
 }
 
 Collider* Collider::Create()
@@ -47,6 +68,8 @@ void Collider::Run(float i_dt)
 {
     PROFILE_UNSCOPED("ColliderRun");
 
+    ApplyCommands();
+
     PROFILE_SCOPE_BEGIN("CollisionDetection")
     DetectCollisions(i_dt);
     PROFILE_SCOPE_END
@@ -55,178 +78,662 @@ void Collider::Run(float i_dt)
 
 void Collider::DetectCollisions(float i_dt)
 {
-#ifdef ENABLE_FAST_MATH
-    using namespace engine::math::optimized;
-#else
-    using namespace engine::math;
-#endif
+    // sleeping objects are only cached if an awake object reaches them
+    UpdateSleepingObjects(i_dt);
+
+    // gather the active objects
+    const size_t num_objects = num_dynamic_objects_ + num_static_kynematic_objects_;
+    // baked & sleeping objects are cached after the rest if something reaches them, so there's room for all of them
+    const size_t max_objects = num_objects + baked_objects_.size() + sleeping_objects_.size();
+    cache_.physics_objects.clear();
+    cache_.physics_objects.reserve(max_objects);
+    for (size_t i = 0; i < num_objects; ++i)
+    {
+        engine::memory::SharedPointer<PhysicsObject> physics_object = GetPhysicsObject(i);
+        if (physics_object->GetIsActive())
+        {
+            cache_.physics_objects.push_back(physics_object);
+        }
+    }
+
+    // calculate every object's transforms & bounds once for this frame
+    const size_t num_active_objects = cache_.physics_objects.size();
+    cache_.objects_to_world.reserve(max_objects);
+    cache_.worlds_to_object.reserve(max_objects);
+    cache_.aabbs.reserve(max_objects);
+    cache_.velocities.reserve(max_objects);
+    cache_.objects_to_world.resize(num_active_objects);
+    cache_.worlds_to_object.resize(num_active_objects);
+    cache_.aabbs.resize(num_active_objects);
+    cache_.velocities.resize(num_active_objects);
+    engine::memory::FrameVector<BroadphaseProxy> proxies;
+    proxies.reserve(max_objects);
+    proxies.resize(num_active_objects);
+
+    // every object only writes its own slots, so they can be split across the engine's workers
+    auto cache_objects = [this, &proxies, i_dt](size_t i_begin, size_t i_end) {
+        for (size_t i = i_begin; i < i_end; ++i)
+        {
+            CacheObject(cache_, static_cast<uint32_t>(i), proxies[i], i_dt);
+        }
+    };
+
+    RunInParallel(num_active_objects, COLLIDER_TRANSFORM_GRAIN_SIZE, cache_objects);
 
-    // acquire a lock
-    std::lock_guard<std::mutex> lock(collider_mutex_);
+    // only objects whose bounds overlap can collide
+    // dynamic objects come first, so the first object of a pair is always dynamic
+    engine::memory::FrameVector<BroadphasePair> pairs;
+    broadphase_.FindPairs(proxies.data(), proxies.size(), pairs);
+
+    // the same proxies answer scene queries until the collider runs again
+    PROFILE_SCOPE_BEGIN("SceneQueryBuild")
+    scene_query_.Build(proxies.data(), num_active_objects, cache_.physics_objects.data(), broadphase_.GetCellSize(), &static_bvh_, baked_objects_.data(),
+        sleeping_proxies_.data(), sleeping_objects_.data(), sleeping_objects_.size());
+    PROFILE_SCOPE_END
+
+    // the static & sleeping trees only need to be walked by objects that move
+    PROFILE_SCOPE_BEGIN("StaticBVHQuery")
+    AddBakedPairs(proxies, pairs, i_dt);
+    PROFILE_SCOPE_END
+    PROFILE_SCOPE_BEGIN("SleepingTreeQuery")
+    AddSleepingPairs(proxies, pairs, i_dt);
+    PROFILE_SCOPE_END
 
-    for (size_t i = 0; i < num_dynamic_objects_; ++i)
+    num_candidate_pairs_ = pairs.size();
+    PROFILE_VALUE("ColliderCandidatePairs", num_candidate_pairs_);
+
+    // touching pairs in exactly the same relative state as last frame collide the same way again, the rest are tested
+    contact_cache_.BeginFrame();
+    engine::memory::FrameVector<BroadphasePair> tested_pairs;
+    engine::memory::FrameVector<BroadphasePair> reused_pairs;
+    tested_pairs.reserve(pairs.size());
+    for (const BroadphasePair& pair : pairs)
     {
-        // get physics object A
-        const engine::memory::SharedPointer<PhysicsObject> physics_object_a = dynamic_objects_[i].Lock();
-        if (!physics_object_a->GetIsActive())
+        const uint32_t index_a = proxies[pair.first].id;
+        const uint32_t index_b = proxies[pair.second].id;
+        const Contact* contact = contact_cache_.Find(cache_.physics_objects[index_a]->GetHandle(), cache_.physics_objects[index_b]->GetHandle());
+
+        // handles are reused, but not while the objects that had them still exist
+        const bool is_reused = contact && contact->collision.object_a && contact->collision.object_b && contact->state == GetContactState(index_a, index_b, i_dt);
+        (is_reused ? reused_pairs : tested_pairs).push_back({ index_a, index_b });
+    }
+    num_reused_contacts_ = reused_pairs.size();
+    PROFILE_VALUE("ColliderReusedContacts", num_reused_contacts_);
+
+    // every job gathers what the separating axis test needs for its share of the candidates, tests them several at a time
+    // & remembers the ones that collided in a list of its own
+    const size_t num_tested_pairs = tested_pairs.size();
+    SeparatingAxisBatch batch;
+    batch.Reset(num_tested_pairs);
+
+    const size_t num_chunks = (num_tested_pairs + COLLIDER_NARROWPHASE_GRAIN_SIZE - 1) / COLLIDER_NARROWPHASE_GRAIN_SIZE;
+    engine::memory::FrameVector<engine::memory::FrameVector<uint32_t>> chunk_collisions(num_chunks);
+
+    RunInParallel(num_tested_pairs, COLLIDER_NARROWPHASE_GRAIN_SIZE, [this, &tested_pairs, &batch, &chunk_collisions, i_dt](size_t i_begin, size_t i_end) {
+        for (size_t i = i_begin; i < i_end; ++i)
+        {
+            PrepareCollision(cache_, tested_pairs[i].first, tested_pairs[i].second, batch, i);
+        }
+
+        batch.Run(i_dt, i_begin, i_end - i_begin);
+
+        engine::memory::FrameVector<uint32_t>& collisions = chunk_collisions[i_begin / COLLIDER_NARROWPHASE_GRAIN_SIZE];
+        for (size_t i = i_begin; i < i_end; ++i)
+        {
+            if (batch.IsColliding(i))
+            {
+                collisions.push_back(static_cast<uint32_t>(i));
+            }
+        }
+    });
+
+    // merge the lists, reused pairs are numbered after the tested ones
+    engine::memory::FrameVector<uint32_t> collisions;
+    for (const engine::memory::FrameVector<uint32_t>& chunk : chunk_collisions)
+    {
+        collisions.insert(collisions.end(), chunk.begin(), chunk.end());
+    }
+    for (size_t i = 0; i < reused_pairs.size(); ++i)
+    {
+        collisions.push_back(static_cast<uint32_t>(num_tested_pairs + i));
+    }
+
+    // order them by the objects' indices, so the response doesn't depend on the broadphase or on how the work was split
+    auto get_pair = [&tested_pairs, &reused_pairs, num_tested_pairs](uint32_t i_collision) -> const BroadphasePair& {
+        return i_collision < num_tested_pairs ? tested_pairs[i_collision] : reused_pairs[i_collision - num_tested_pairs];
+    };
+    std::sort(collisions.begin(), collisions.end(), [&get_pair](uint32_t i_lhs, uint32_t i_rhs) {
+        const BroadphasePair& lhs = get_pair(i_lhs);
+        const BroadphasePair& rhs = get_pair(i_rhs);
+        return lhs.first < rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+    });
+
+    const size_t first_collision = collided_objects_.size();
+    for (uint32_t collision : collisions)
+    {
+        const BroadphasePair& pair = get_pair(collision);
+        if (collision < num_tested_pairs)
+        {
+            AddCollision(cache_, pair.first, pair.second, batch, collision);
+        }
+        else
+        {
+            AddReusedCollision(pair.first, pair.second, *contact_cache_.Find(cache_.physics_objects[pair.first]->GetHandle(), cache_.physics_objects[pair.second]->GetHandle()));
+        }
+    }
+
+    // what each collision was found from, it is remembered along with the collision once that has been responded to
+    for (size_t i = first_collision; i < collided_objects_.size(); ++i)
+    {
+        const BroadphasePair& pair = collided_indices_[i];
+        collided_states_.push_back(GetContactState(pair.first, pair.second, i_dt));
+    }
+}
+
+void Collider::UpdateSleepingObjects(float i_dt)
+{
+    // the collider doesn't need the physics system, but without it nothing falls asleep
+    Physics* physics = Physics::Get();
+    if (!physics)
+    {
+        return;
+    }
+    const PhysicsWorld& world = physics->GetWorld();
+
+    // sleeping objects that were woken up or stopped being dynamic go back to the lists, walking backwards keeps the slots
+    // that are left to visit where they are
+    for (size_t i = sleeping_objects_.size(); i > 0; --i)
+    {
+        const size_t slot = i - 1;
+        const PhysicsHandle handle = sleeping_proxies_[slot].key;
+        const bool is_dynamic = world.GetType(handle) == PhysicsObjectType::kPhysicsObjectDynamic;
+        if (is_dynamic && !world.GetIsAwake(handle))
+        {
+            continue;
+        }
+
+        engine::memory::SharedPointer<PhysicsObject> physics_object = sleeping_objects_[slot].Lock();
+        RemoveSleepingObject(slot);
+
+        std::vector<engine::memory::WeakPointer<PhysicsObject>>& objects = is_dynamic ? dynamic_objects_ : static_kynematic_objects_;
+        size_t& num_objects = is_dynamic ? num_dynamic_objects_ : num_static_kynematic_objects_;
+        physics_object->collider_index_ = num_objects;
+        objects.push_back(physics_object);
+        ++num_objects;
+        broadphase_.AddProxy(handle);
+    }
+
+    // dynamic objects that fell asleep leave the broadphase, where they are now is where they'll be found
+    for (size_t i = num_dynamic_objects_; i > 0; --i)
+    {
+        const size_t index = i - 1;
+        engine::memory::SharedPointer<PhysicsObject> physics_object = dynamic_objects_[index].Lock();
+        if (physics_object->GetIsAwake() || physics_object->GetType() != PhysicsObjectType::kPhysicsObjectDynamic)
         {
             continue;
         }
 
-        // get physics object A's collision filter
-        uint16_t collision_filter_a = physics_object_a->GetCollisionFilter();
+        // move the last object into its place
+        broadphase_.RemoveProxy(physics_object->GetHandle());
+        const size_t last_index = num_dynamic_objects_ - 1;
+        if (index != last_index)
+        {
+            dynamic_objects_[index] = dynamic_objects_[last_index];
+            dynamic_objects_[index].Lock()->collider_index_ = index;
+        }
+        dynamic_objects_.pop_back();
+        --num_dynamic_objects_;
 
-        // get game object A
-        const engine::memory::SharedPointer<engine::gameobject::GameObject> game_object_a = physics_object_a->GetGameObject().Lock();
-        // get A's AABB
-        const engine::math::AABB a_aabb = game_object_a->GetAABB();
+        BroadphaseProxy proxy;
+        GetProxy(*physics_object, *physics_object->GetGameObject().Lock(), engine::math::Vec3D::ZERO, static_cast<uint32_t>(sleeping_objects_.size()), i_dt, proxy);
+        proxy.is_dynamic = false;
+        AddSleepingObject(physics_object, proxy);
+    }
+    PROFILE_VALUE("ColliderSleepingObjects", sleeping_objects_.size());
+}
+
+void Collider::AddSleepingObject(const engine::memory::SharedPointer<PhysicsObject>& i_physics_object, const BroadphaseProxy& i_proxy)
+{
+    const size_t slot = sleeping_objects_.size();
+    ASSERT(i_proxy.id == slot);
+
+    i_physics_object->collider_index_ = slot;
+    sleeping_objects_.push_back(i_physics_object);
+    sleeping_proxies_.push_back(i_proxy);
+    sleeping_tree_proxies_.push_back(sleeping_tree_.CreateProxy({ i_proxy.min_x, i_proxy.min_y, i_proxy.max_x, i_proxy.max_y }, static_cast<uint32_t>(slot)));
+}
+
+void Collider::RemoveSleepingObject(size_t i_slot)
+{
+    ASSERT(i_slot < sleeping_objects_.size());
+
+    // move the last object into its slot
+    sleeping_tree_.DestroyProxy(sleeping_tree_proxies_[i_slot]);
+    const size_t last_slot = sleeping_objects_.size() - 1;
+    if (i_slot != last_slot)
+    {
+        sleeping_objects_[i_slot] = sleeping_objects_[last_slot];
+        sleeping_proxies_[i_slot] = sleeping_proxies_[last_slot];
+        sleeping_proxies_[i_slot].id = static_cast<uint32_t>(i_slot);
+        sleeping_tree_proxies_[i_slot] = sleeping_tree_proxies_[last_slot];
+        sleeping_tree_.SetUserData(sleeping_tree_proxies_[i_slot], static_cast<uint32_t>(i_slot));
+        sleeping_objects_[i_slot].Lock()->collider_index_ = i_slot;
+    }
+    sleeping_objects_.pop_back();
+    sleeping_proxies_.pop_back();
+    sleeping_tree_proxies_.pop_back();
+}
 
-        // calculate transform to convert from object A to world coordinates
-        Mat44 mat_AtoW;
-        engine::math::GetObjectToWorldTransform(game_object_a->GetTransform(), mat_AtoW);
+void Collider::AddBakedPairs(engine::memory::FrameVector<BroadphaseProxy>& io_proxies, engine::memory::FrameVector<BroadphasePair>& io_pairs, float i_dt)
+{
+    if (static_bvh_.GetNumProxies() == 0)
+    {
+        return;
+    }
 
-        // calculate transform to convert world to object A coordinates
-        Mat44 mat_WtoA(mat_AtoW.GetInverse());
+    // find the baked objects each awake dynamic proxy overlaps, baked objects never test against each other
+    // the tree is only read, so every job walks it for its share of the proxies & keeps what it finds in a list of its own
+    const size_t num_proxies = io_proxies.size();
+    const size_t num_chunks = (num_proxies + COLLIDER_BAKED_QUERY_GRAIN_SIZE - 1) / COLLIDER_BAKED_QUERY_GRAIN_SIZE;
+    engine::memory::FrameVector<engine::memory::FrameVector<BroadphasePair>> chunk_pairs(num_chunks);
 
-        for (size_t j = i + 1, k = 0; j < num_dynamic_objects_ || k < num_static_kynematic_objects_; k += j < num_dynamic_objects_ ? 0 : 1, j += j < num_dynamic_objects_ ? 1 : 0)
+    RunInParallel(num_proxies, COLLIDER_BAKED_QUERY_GRAIN_SIZE, [this, &io_proxies, &chunk_pairs](size_t i_begin, size_t i_end) {
+        engine::memory::FrameVector<BroadphasePair>& pairs = chunk_pairs[i_begin / COLLIDER_BAKED_QUERY_GRAIN_SIZE];
+        for (size_t i = i_begin; i < i_end; ++i)
         {
-            // get physics object B
-            engine::memory::SharedPointer<PhysicsObject> physics_object_b = j < num_dynamic_objects_ ? dynamic_objects_[j].Lock() : static_kynematic_objects_[k].Lock();
-            if (!physics_object_b->GetIsActive())
+            const BroadphaseProxy& proxy = io_proxies[i];
+            if (!proxy.is_dynamic)
             {
                 continue;
             }
 
-            // get physics object B's collision filter
-            uint16_t collision_filter_b = physics_object_b->GetCollisionFilter();
+            static_bvh_.Query(proxy.min_x, proxy.min_y, proxy.max_x, proxy.max_y, [&proxy, &pairs, i](const BroadphaseProxy& i_baked_proxy) {
+                if (ShouldCollide(proxy.collision_filter, i_baked_proxy.collision_filter))
+                {
+                    pairs.push_back({ static_cast<uint32_t>(i), i_baked_proxy.id });
+                }
+            });
+        }
+    });
+
+    AddFoundPairs(io_proxies, io_pairs, chunk_pairs, baked_objects_.data(), i_dt);
+}
+
+void Collider::AddSleepingPairs(engine::memory::FrameVector<BroadphaseProxy>& io_proxies, engine::memory::FrameVector<BroadphasePair>& io_pairs, float i_dt)
+{
+    if (sleeping_tree_.GetNumProxies() == 0)
+    {
+        return;
+    }
+
+    // find the sleeping objects each awake dynamic proxy overlaps, sleeping objects never test against each other
+    // only the proxies that were there before any objects were found are walked, so found objects never look for more
+    const size_t num_proxies = io_proxies.size();
+    const size_t num_chunks = (num_proxies + COLLIDER_BAKED_QUERY_GRAIN_SIZE - 1) / COLLIDER_BAKED_QUERY_GRAIN_SIZE;
+    engine::memory::FrameVector<engine::memory::FrameVector<BroadphasePair>> chunk_pairs(num_chunks);
 
-            if (collision_filter_a != collision_filter_b)
+    RunInParallel(num_proxies, COLLIDER_BAKED_QUERY_GRAIN_SIZE, [this, &io_proxies, &chunk_pairs](size_t i_begin, size_t i_end) {
+        engine::memory::FrameVector<BroadphasePair>& pairs = chunk_pairs[i_begin / COLLIDER_BAKED_QUERY_GRAIN_SIZE];
+        for (size_t i = i_begin; i < i_end; ++i)
+        {
+            const BroadphaseProxy& proxy = io_proxies[i];
+            if (!proxy.is_dynamic)
             {
                 continue;
             }
 
-            // get game object B
-            const engine::memory::SharedPointer<engine::gameobject::GameObject> game_object_b = physics_object_b->GetGameObject().Lock();
-            // get B's AABB
-            const engine::math::AABB b_aabb = game_object_b->GetAABB();
+            sleeping_tree_.Query({ proxy.min_x, proxy.min_y, proxy.max_x, proxy.max_y }, [this, &proxy, &pairs, i](int32_t i_tree_proxy) {
+                const uint32_t slot = sleeping_tree_.GetUserData(i_tree_proxy);
+                if (ShouldCollide(proxy.collision_filter, sleeping_proxies_[slot].collision_filter))
+                {
+                    pairs.push_back({ static_cast<uint32_t>(i), slot });
+                }
+                return true;
+            });
+        }
+    });
 
-            // calculate transform to convert object B to world coordinates
-            Mat44 mat_BtoW;
-            engine::math::GetObjectToWorldTransform(game_object_b->GetTransform(), mat_BtoW);
+    AddFoundPairs(io_proxies, io_pairs, chunk_pairs, sleeping_objects_.data(), i_dt);
+}
 
-            // calculate transform to convert world to object B coordinates
-            Mat44 mat_WtoB(mat_BtoW.GetInverse());
+void Collider::AddFoundPairs(engine::memory::FrameVector<BroadphaseProxy>& io_proxies, engine::memory::FrameVector<BroadphasePair>& io_pairs, const engine::memory::FrameVector<engine::memory::FrameVector<BroadphasePair>>& i_found_pairs, const engine::memory::WeakPointer<PhysicsObject>* i_objects, float i_dt)
+{
+    engine::memory::FrameVector<BroadphasePair> found_pairs;
+    for (const engine::memory::FrameVector<BroadphasePair>& pairs : i_found_pairs)
+    {
+        found_pairs.insert(found_pairs.end(), pairs.begin(), pairs.end());
+    }
 
-            // calculate transform to convert from A to B coordinates
-            Mat44 mat_AtoB = mat_WtoB * mat_AtoW;
-            // calculate transform to convert from B to A coordinates
-            Mat44 mat_BtoA(mat_AtoB.GetInverse());
+    if (found_pairs.empty())
+    {
+        return;
+    }
 
-            bool is_X_separated_in_B = false;
-            bool is_Y_separated_in_B = false;
+    // cache every object that was found once, in the order of their slots
+    engine::memory::FrameVector<uint32_t> slots;
+    slots.reserve(found_pairs.size());
+    for (const BroadphasePair& pair : found_pairs)
+    {
+        slots.push_back(pair.second);
+    }
+    std::sort(slots.begin(), slots.end());
+    slots.erase(std::unique(slots.begin(), slots.end()), slots.end());
 
-            float t_close_X_in_B = 0.0f;
-            float t_open_X_in_B = 0.0f;
-            float t_close_Y_in_B = 0.0f;
-            float t_open_Y_in_B = 0.0f;
+    // the proxy each slot was cached into, or UINT32_MAX if its object is gone or inactive
+    engine::memory::FrameVector<uint32_t> slot_proxies(slots.size(), UINT32_MAX);
+    for (size_t i = 0; i < slots.size(); ++i)
+    {
+        engine::memory::SharedPointer<PhysicsObject> physics_object = i_objects[slots[i]].Lock();
+        if (!physics_object || !physics_object->GetIsActive())
+        {
+            continue;
+        }
 
-            // check for A in B's coordinate system
-            {
-                // calculate velocity of A relative to B
-                const Vec3D relative_vel_AtoB = physics_object_a->GetVelocity() - physics_object_b->GetVelocity();
+        const uint32_t index = static_cast<uint32_t>(cache_.physics_objects.size());
+        cache_.physics_objects.push_back(physics_object);
+        cache_.objects_to_world.resize(index + 1);
+        cache_.worlds_to_object.resize(index + 1);
+        cache_.aabbs.resize(index + 1);
+        cache_.velocities.resize(index + 1);
+        io_proxies.resize(index + 1);
+        CacheObject(cache_, index, io_proxies[index], i_dt);
+        slot_proxies[i] = index;
+    }
 
-                // transform relative velocity (as a vector) to object B's coordinate system
-                const Vec4D relative_vel_WtoB = mat_WtoB * Vec4D(relative_vel_AtoB, 0.0f);
+    // found objects come after every other object, so the dynamic proxy is still first
+    for (const BroadphasePair& pair : found_pairs)
+    {
+        const size_t slot = std::lower_bound(slots.begin(), slots.end(), pair.second) - slots.begin();
+        if (slot_proxies[slot] != UINT32_MAX)
+        {
+            io_pairs.push_back({ pair.first, slot_proxies[slot] });
+        }
+    }
+}
 
-                // transform A's AABB to B's coordinate system
-                const Vec4D A_center_in_B = mat_AtoB * Vec4D(a_aabb.center, 1.0f);
-                const Vec4D A_X_extent_in_B = mat_AtoB * Vec4D(a_aabb.extents.x(), 0.0f, 0.0f, 0.0f);
-                const Vec4D A_Y_extent_in_B = mat_AtoB * Vec4D(0.0f, a_aabb.extents.y(), 0.0f, 0.0f);
-                const Vec4D A_extents_in_B(fabs(A_X_extent_in_B.x()) + fabs(A_Y_extent_in_B.x()), fabs(A_X_extent_in_B.y()) + fabs(A_Y_extent_in_B.y()), 0.0f, 0.0f);
+void Collider::BakeStaticObjects()
+{
+    PROFILE_UNSCOPED("ColliderBakeStaticObjects");
 
-                // for X-axis
-                is_X_separated_in_B = CheckSeparationForAxis(relative_vel_WtoB.x(), b_aabb.center.x(), b_aabb.extents.x(), A_center_in_B.x(), A_extents_in_B.x(), i_dt, t_close_X_in_B, t_open_X_in_B);
+    // the lists must be up to date before objects are moved between them
+    ApplyCommands();
 
-                // for Y-axis
-                is_Y_separated_in_B = CheckSeparationForAxis(relative_vel_WtoB.y(), b_aabb.center.y(), b_aabb.extents.y(), A_center_in_B.y(), A_extents_in_B.y(), i_dt, t_close_Y_in_B, t_open_Y_in_B);
+    // objects baked last time go back to the list, so they're baked again along with the rest
+    for (const engine::memory::WeakPointer<PhysicsObject>& baked_object : baked_objects_)
+    {
+        engine::memory::SharedPointer<PhysicsObject> physics_object = baked_object.Lock();
+        if (physics_object)
+        {
+            physics_object->collider_index_ = num_static_kynematic_objects_;
+            static_kynematic_objects_.push_back(baked_object);
+            ++num_static_kynematic_objects_;
+            broadphase_.AddProxy(physics_object->GetHandle());
+        }
+    }
+    baked_objects_.clear();
+    static_bvh_.Clear();
 
-            } // check for A in B's coordinate system    
+    // take the static objects out of the list, keeping the order of the rest
+    TransformCache cache;
+    size_t num_remaining = 0;
+    for (size_t i = 0; i < num_static_kynematic_objects_; ++i)
+    {
+        engine::memory::SharedPointer<PhysicsObject> physics_object = static_kynematic_objects_[i].Lock();
+        if (physics_object->GetType() != PhysicsObjectType::kPhysicsObjectStatic)
+        {
+            physics_object->collider_index_ = num_remaining;
+            static_kynematic_objects_[num_remaining++] = static_kynematic_objects_[i];
+            continue;
+        }
 
-            bool is_X_separated_in_A = false;
-            bool is_Y_separated_in_A = false;
+        physics_object->collider_index_ = baked_objects_.size();
+        baked_objects_.push_back(static_kynematic_objects_[i]);
+        broadphase_.RemoveProxy(physics_object->GetHandle());
+        cache.physics_objects.push_back(physics_object);
+    }
+    static_kynematic_objects_.resize(num_remaining);
+    num_static_kynematic_objects_ = num_remaining;
+
+    // static objects don't move, so their bounds are the ones they have now, ids are their slots in the baked list
+    const size_t num_baked_objects = cache.physics_objects.size();
+    cache.objects_to_world.resize(num_baked_objects);
+    cache.worlds_to_object.resize(num_baked_objects);
+    cache.aabbs.resize(num_baked_objects);
+    cache.velocities.resize(num_baked_objects);
+    engine::memory::FrameVector<BroadphaseProxy> proxies(num_baked_objects);
+    for (size_t i = 0; i < num_baked_objects; ++i)
+    {
+        CacheObject(cache, static_cast<uint32_t>(i), proxies[i], 0.0f);
+    }
+
+    static_bvh_.Build(proxies.data(), num_baked_objects);
+    PROFILE_VALUE("ColliderBakedObjects", num_baked_objects);
 
-            float t_close_X_in_A = 0.0f;
-            float t_open_X_in_A = 0.0f;
-            float t_close_Y_in_A = 0.0f;
-            float t_open_Y_in_A = 0.0f;
+    // the scene query may still point at the old tree
+    scene_query_.Clear();
+}
+
+void Collider::Raycast(const RaycastQuery* i_queries, size_t i_num_queries, SceneQueryHit* o_hits) const
+{
+    // validate inputs
+    ASSERT((i_queries && o_hits) || i_num_queries == 0);
 
-            // check for B in A's coordinate system
+    RunInParallel(i_num_queries, COLLIDER_QUERY_GRAIN_SIZE, [this, i_queries, o_hits](size_t i_begin, size_t i_end) {
+        for (size_t i = i_begin; i < i_end; ++i)
+        {
+            if (!scene_query_.Raycast(i_queries[i], o_hits[i]))
             {
-                // calculate velocity of B relative to A
-                const Vec3D relative_vel_BtoA = physics_object_b->GetVelocity() - physics_object_a->GetVelocity();
+                o_hits[i] = SceneQueryHit();
+            }
+        }
+    });
+}
 
-                // transform relative velocity (as a vector) to A's coordinate system
-                const Vec4D relative_vel_WtoA = mat_WtoA * Vec4D(relative_vel_BtoA, 0.0f);
+void Collider::QueryNearest(const NearestQuery* i_queries, size_t i_num_queries, SceneQueryHit* o_hits) const
+{
+    // validate inputs
+    ASSERT((i_queries && o_hits) || i_num_queries == 0);
 
-                // transform B's AABB to A's coordinate system
-                const Vec4D B_center_in_A = mat_BtoA * Vec4D(b_aabb.center, 1.0f);
-                const Vec4D B_X_extent_in_A = mat_BtoA * Vec4D(b_aabb.extents.x(), 0.0f, 0.0f, 0.0f);
-                const Vec4D B_Y_extent_in_A = mat_BtoA * Vec4D(0.0f, b_aabb.extents.y(), 0.0f, 0.0f);
-                const Vec4D B_extents_in_A(fabs(B_X_extent_in_A.x()) + fabs(B_Y_extent_in_A.x()), fabs(B_X_extent_in_A.y()) + fabs(B_Y_extent_in_A.y()), 0.0f, 0.0f);
+    RunInParallel(i_num_queries, COLLIDER_QUERY_GRAIN_SIZE, [this, i_queries, o_hits](size_t i_begin, size_t i_end) {
+        for (size_t i = i_begin; i < i_end; ++i)
+        {
+            if (!scene_query_.QueryNearest(i_queries[i], o_hits[i]))
+            {
+                o_hits[i] = SceneQueryHit();
+            }
+        }
+    });
+}
 
-                // for X-axis
-                is_X_separated_in_A = CheckSeparationForAxis(relative_vel_WtoA.x(), a_aabb.center.x(), a_aabb.extents.x(), B_center_in_A.x(), B_extents_in_A.x(), i_dt, t_close_X_in_A, t_open_X_in_A);
+void Collider::RunInParallel(size_t i_count, size_t i_grain_size, const std::function<void(size_t, size_t)>& i_function)
+{
+    engine::jobs::JobSystem* job_system = engine::jobs::JobSystem::Get();
+    if (job_system)
+    {
+        // not cached, the string pool is recreated every time the engine starts up
+        const engine::data::PooledString engine_team("EngineTeam");
+        job_system->ParallelFor(0, i_count, i_grain_size, i_function, engine_team);
+    }
+    else if (i_count > 0)
+    {
+        i_function(0, i_count);
+    }
+}
 
-                // for Y-axis
-                is_Y_separated_in_A = CheckSeparationForAxis(relative_vel_WtoA.y(), a_aabb.center.y(), a_aabb.extents.y(), B_center_in_A.y(), B_extents_in_A.y(), i_dt, t_close_Y_in_A, t_open_Y_in_A);
+engine::memory::SharedPointer<PhysicsObject> Collider::GetPhysicsObject(size_t i_index) const
+{
+    ASSERT(i_index < num_dynamic_objects_ + num_static_kynematic_objects_);
+    return i_index < num_dynamic_objects_ ? dynamic_objects_[i_index].Lock() : static_kynematic_objects_[i_index - num_dynamic_objects_].Lock();
+}
 
-            } // check for B in A's coordinate system
+void Collider::CacheObject(TransformCache& io_cache, uint32_t i_index, BroadphaseProxy& o_proxy, float i_dt) const
+{
+    const engine::memory::SharedPointer<PhysicsObject>& physics_object = io_cache.physics_objects[i_index];
+    const engine::memory::SharedPointer<engine::gameobject::GameObject> game_object = physics_object->GetGameObject().Lock();
+    const engine::math::Vec3D velocity = physics_object->GetVelocity();
 
-            // was there an obvious separation?
-            if (!(is_X_separated_in_B || is_Y_separated_in_B || is_X_separated_in_A || is_Y_separated_in_A))
-            {
-                // find the latest t_close and the earliest t_open
-                float t_close_latest = engine::math::GetMaxOfFour(t_close_X_in_B, t_close_Y_in_B, t_close_X_in_A, t_close_Y_in_A);
-                float t_open_earliest = engine::math::GetMinOfFour(t_open_X_in_B, t_open_Y_in_B, t_open_X_in_A, t_open_Y_in_A);
+    // calculate transforms to convert between object & world coordinates
+    engine::math::GetObjectToWorldTransform(game_object->GetTransform(), io_cache.objects_to_world[i_index]);
+    io_cache.worlds_to_object[i_index] = io_cache.objects_to_world[i_index].GetInverse();
+    io_cache.aabbs[i_index] = game_object->GetAABB();
+    io_cache.velocities[i_index] = velocity;
 
-                // if the latest t_close was after the earliest t_open, there was continuity of separation
-                if (t_close_latest > t_open_earliest)
-                {
-                    //VERBOSE("Collision not found!");
-                }
-                else
-                {
-                    // calculate the normal to the surface that collided
-                    Vec3D normal = Vec3D::ZERO;
-                    if (engine::math::FuzzyEquals(t_close_latest, t_close_X_in_B))
-                    {
-                        const Vec4D B_X_in_W = mat_BtoW * Vec4D(1.0f, 0.0f, 0.0f, 0.0f);
-                        normal.set(B_X_in_W.x(), B_X_in_W.y(), B_X_in_W.z());
-                    }
-                    else if (engine::math::FuzzyEquals(t_close_latest, t_close_Y_in_B))
-                    {
-                        const Vec4D B_Y_in_W = mat_BtoW * Vec4D(0.0f, 1.0f, 0.0f, 0.0f);
-                        normal.set(B_Y_in_W.x(), B_Y_in_W.y(), B_Y_in_W.z());
-                    }
-                    else if (engine::math::FuzzyEquals(t_close_latest, t_close_X_in_A))
-                    {
-                        const Vec4D A_X_in_W = mat_AtoW * Vec4D(1.0f, 0.0f, 0.0f, 0.0f);
-                        normal.set(A_X_in_W.x(), A_X_in_W.y(), A_X_in_W.z());
-                    }
-                    else if (engine::math::FuzzyEquals(t_close_latest, t_close_Y_in_A))
-                    {
-                        const Vec4D A_Y_in_W = mat_AtoW * Vec4D(0.0f, 1.0f, 0.0f, 0.0f);
-                        normal.set(A_Y_in_W.x(), A_Y_in_W.y(), A_Y_in_W.z());
-                    }
-
-                    collided_objects_.push_back({t_close_latest, normal, physics_object_a, physics_object_b});
-                }
-            }
+    GetProxy(*physics_object, *game_object, velocity, i_index, i_dt, o_proxy);
+}
+
+void Collider::GetProxy(const PhysicsObject& i_physics_object, const engine::gameobject::GameObject& i_game_object, const engine::math::Vec3D& i_velocity, uint32_t i_id, float i_dt, BroadphaseProxy& o_proxy)
+{
+    const engine::math::AABB& aabb = i_game_object.GetAABB();
+    const engine::math::Vec3D& position = i_game_object.GetPosition();
+
+    // objects only rotate about Z
+    const float rotation = i_game_object.GetRotation().z();
+    const float cos_rotation = cosf(rotation);
+    const float sin_rotation = sinf(rotation);
+
+    // transform the box to world space
+    const float center_x = position.x() + aabb.center.x() * cos_rotation - aabb.center.y() * sin_rotation;
+    const float center_y = position.y() + aabb.center.x() * sin_rotation + aabb.center.y() * cos_rotation;
+    const float extents_x = fabs(cos_rotation) * aabb.extents.x() + fabs(sin_rotation) * aabb.extents.y();
+    const float extents_y = fabs(sin_rotation) * aabb.extents.x() + fabs(cos_rotation) * aabb.extents.y();
+
+    // stretch it over the distance covered during this step
+    const float move_x = i_velocity.x() * i_dt;
+    const float move_y = i_velocity.y() * i_dt;
+
+    o_proxy.min_x = center_x - extents_x + (move_x < 0.0f ? move_x : 0.0f);
+    o_proxy.min_y = center_y - extents_y + (move_y < 0.0f ? move_y : 0.0f);
+    o_proxy.max_x = center_x + extents_x + (move_x > 0.0f ? move_x : 0.0f);
+    o_proxy.max_y = center_y + extents_y + (move_y > 0.0f ? move_y : 0.0f);
+    o_proxy.id = i_id;
+    o_proxy.key = i_physics_object.GetHandle();
+    o_proxy.collision_filter = i_physics_object.GetCollisionFilter();
+    // sleeping bodies don't move, so they only need to be tested against bodies that are awake
+    o_proxy.is_dynamic = i_physics_object.GetType() == PhysicsObjectType::kPhysicsObjectDynamic && i_physics_object.GetIsAwake();
+}
+
+void Collider::PrepareCollision(const TransformCache& i_cache, uint32_t i_index_a, uint32_t i_index_b, SeparatingAxisBatch& o_batch, size_t i_pair) const
+{
+#ifdef ENABLE_FAST_MATH
+    using namespace engine::math::optimized;
+#else
+    using namespace engine::math;
+#endif
+
+    // the transforms were calculated once for the whole frame
+    const engine::math::AABB& a_aabb = i_cache.aabbs[i_index_a];
+    const Mat44& mat_AtoW = i_cache.objects_to_world[i_index_a];
+    const Mat44& mat_WtoA = i_cache.worlds_to_object[i_index_a];
+
+    const engine::math::AABB& b_aabb = i_cache.aabbs[i_index_b];
+    const Mat44& mat_BtoW = i_cache.objects_to_world[i_index_b];
+    const Mat44& mat_WtoB = i_cache.worlds_to_object[i_index_b];
+
+    // calculate transform to convert from A to B coordinates
+    Mat44 mat_AtoB = mat_WtoB * mat_AtoW;
+    // calculate transform to convert from B to A coordinates
+    Mat44 mat_BtoA = mat_WtoA * mat_BtoW;
+
+    // A in B's coordinate system
+    {
+        // calculate velocity of A relative to B
+        const Vec3D relative_vel_AtoB = i_cache.velocities[i_index_a] - i_cache.velocities[i_index_b];
+
+        // transform relative velocity (as a vector) to object B's coordinate system
+        const Vec4D relative_vel_WtoB = mat_WtoB * Vec4D(relative_vel_AtoB, 0.0f);
+
+        // transform A's AABB to B's coordinate system
+        const Vec4D A_center_in_B = mat_AtoB * Vec4D(a_aabb.center, 1.0f);
+        const Vec4D A_X_extent_in_B = mat_AtoB * Vec4D(a_aabb.extents.x(), 0.0f, 0.0f, 0.0f);
+        const Vec4D A_Y_extent_in_B = mat_AtoB * Vec4D(0.0f, a_aabb.extents.y(), 0.0f, 0.0f);
+        const Vec4D A_extents_in_B(fabs(A_X_extent_in_B.x()) + fabs(A_Y_extent_in_B.x()), fabs(A_X_extent_in_B.y()) + fabs(A_Y_extent_in_B.y()), 0.0f, 0.0f);
 
-        } // end of inner for loop
+        o_batch.SetAxis(i_pair, SeparatingAxis::XInB, relative_vel_WtoB.x(), b_aabb.center.x(), b_aabb.extents.x(), A_center_in_B.x(), A_extents_in_B.x());
+        o_batch.SetAxis(i_pair, SeparatingAxis::YInB, relative_vel_WtoB.y(), b_aabb.center.y(), b_aabb.extents.y(), A_center_in_B.y(), A_extents_in_B.y());
 
-    } // end of outer for loop
+    } // A in B's coordinate system
 
+    // B in A's coordinate system
+    {
+        // calculate velocity of B relative to A
+        const Vec3D relative_vel_BtoA = i_cache.velocities[i_index_b] - i_cache.velocities[i_index_a];
+
+        // transform relative velocity (as a vector) to A's coordinate system
+        const Vec4D relative_vel_WtoA = mat_WtoA * Vec4D(relative_vel_BtoA, 0.0f);
+
+        // transform B's AABB to A's coordinate system
+        const Vec4D B_center_in_A = mat_BtoA * Vec4D(b_aabb.center, 1.0f);
+        const Vec4D B_X_extent_in_A = mat_BtoA * Vec4D(b_aabb.extents.x(), 0.0f, 0.0f, 0.0f);
+        const Vec4D B_Y_extent_in_A = mat_BtoA * Vec4D(0.0f, b_aabb.extents.y(), 0.0f, 0.0f);
+        const Vec4D B_extents_in_A(fabs(B_X_extent_in_A.x()) + fabs(B_Y_extent_in_A.x()), fabs(B_X_extent_in_A.y()) + fabs(B_Y_extent_in_A.y()), 0.0f, 0.0f);
+
+        o_batch.SetAxis(i_pair, SeparatingAxis::XInA, relative_vel_WtoA.x(), a_aabb.center.x(), a_aabb.extents.x(), B_center_in_A.x(), B_extents_in_A.x());
+        o_batch.SetAxis(i_pair, SeparatingAxis::YInA, relative_vel_WtoA.y(), a_aabb.center.y(), a_aabb.extents.y(), B_center_in_A.y(), B_extents_in_A.y());
+
+    } // B in A's coordinate system
+}
+
+void Collider::AddCollision(const TransformCache& i_cache, uint32_t i_index_a, uint32_t i_index_b, const SeparatingAxisBatch& i_batch, size_t i_pair)
+{
+    collided_objects_.push_back({i_batch.GetCloseTime(i_pair), GetCollisionNormal(i_cache, i_index_a, i_index_b, i_batch, i_pair), i_cache.physics_objects[i_index_a], i_cache.physics_objects[i_index_b]});
+    collided_indices_.push_back({i_index_a, i_index_b});
+}
+
+void Collider::AddReusedCollision(uint32_t i_index_a, uint32_t i_index_b, const Contact& i_contact)
+{
+    collided_objects_.push_back({i_contact.collision.time, i_contact.collision.normal, cache_.physics_objects[i_index_a], cache_.physics_objects[i_index_b]});
+    collided_indices_.push_back({i_index_a, i_index_b});
+}
+
+ContactState Collider::GetContactState(uint32_t i_index_a, uint32_t i_index_b, float i_dt) const
+{
+    // the object with the lower handle comes first, so the state doesn't depend on the order the pair was found in
+    if (cache_.physics_objects[i_index_b]->GetHandle() < cache_.physics_objects[i_index_a]->GetHandle())
+    {
+        std::swap(i_index_a, i_index_b);
+    }
+
+    const engine::memory::SharedPointer<engine::gameobject::GameObject> game_object_a = cache_.physics_objects[i_index_a]->GetGameObject().Lock();
+    const engine::memory::SharedPointer<engine::gameobject::GameObject> game_object_b = cache_.physics_objects[i_index_b]->GetGameObject().Lock();
+    return { game_object_b->GetPosition() - game_object_a->GetPosition(), cache_.velocities[i_index_a] - cache_.velocities[i_index_b], game_object_a->GetRotation().z(), game_object_b->GetRotation().z(), i_dt };
+}
+
+engine::math::Vec3D Collider::GetCollisionNormal(const TransformCache& i_cache, uint32_t i_index_a, uint32_t i_index_b, const SeparatingAxisBatch& i_batch, size_t i_pair) const
+{
+#ifdef ENABLE_FAST_MATH
+    using namespace engine::math::optimized;
+#else
+    using namespace engine::math;
+#endif
+
+    const Mat44& mat_AtoW = i_cache.objects_to_world[i_index_a];
+    const Mat44& mat_BtoW = i_cache.objects_to_world[i_index_b];
+
+    // calculate the normal to the surface that collided
+    const float t_close_latest = i_batch.GetCloseTime(i_pair);
+    engine::math::Vec3D normal = engine::math::Vec3D::ZERO;
+    if (engine::math::FuzzyEquals(t_close_latest, i_batch.GetCloseTime(i_pair, SeparatingAxis::XInB)))
+    {
+        const Vec4D B_X_in_W = mat_BtoW * Vec4D(1.0f, 0.0f, 0.0f, 0.0f);
+        normal.set(B_X_in_W.x(), B_X_in_W.y(), B_X_in_W.z());
+    }
+    else if (engine::math::FuzzyEquals(t_close_latest, i_batch.GetCloseTime(i_pair, SeparatingAxis::YInB)))
+    {
+        const Vec4D B_Y_in_W = mat_BtoW * Vec4D(0.0f, 1.0f, 0.0f, 0.0f);
+        normal.set(B_Y_in_W.x(), B_Y_in_W.y(), B_Y_in_W.z());
+    }
+    else if (engine::math::FuzzyEquals(t_close_latest, i_batch.GetCloseTime(i_pair, SeparatingAxis::XInA)))
+    {
+        const Vec4D A_X_in_W = mat_AtoW * Vec4D(1.0f, 0.0f, 0.0f, 0.0f);
+        normal.set(A_X_in_W.x(), A_X_in_W.y(), A_X_in_W.z());
+    }
+    else if (engine::math::FuzzyEquals(t_close_latest, i_batch.GetCloseTime(i_pair, SeparatingAxis::YInA)))
+    {
+        const Vec4D A_Y_in_W = mat_AtoW * Vec4D(0.0f, 1.0f, 0.0f, 0.0f);
+        normal.set(A_Y_in_W.x(), A_Y_in_W.y(), A_Y_in_W.z());
+    }
+
+    return normal;
 }
 
 bool Collider::CheckSeparationForAxis(const float i_relative_vel_WtoA, const float i_a_aabb_center, const float i_a_aabb_extents, const float i_B_center_in_A, const float i_B_extents_in_a, const float i_dt, float &o_t_close, float &o_t_open)
@@ -234,6 +741,10 @@ bool Collider::CheckSeparationForAxis(const float i_relative_vel_WtoA, const flo
     // treat zero velocities differently
     if (engine::math::FuzzyEquals(i_relative_vel_WtoA, 0.0f))
     {
+        // an axis without velocity never opens, so it doesn't limit when the others do
+        o_t_close = 0.0f;
+        o_t_open = FLT_MAX;
+
         // separation check without velocities
         return (fabs(i_a_aabb_center - i_B_center_in_A) > i_a_aabb_extents + i_B_extents_in_a);
     }
@@ -260,21 +771,177 @@ bool Collider::CheckSeparationForAxis(const float i_relative_vel_WtoA, const flo
 
 void Collider::RespondToCollisions(float i_dt)
 {
-    const size_t num_collided_objects = collided_objects_.size();
+    PhysicsWorld* world = Physics::Get() ? &Physics::Get()->GetWorld() : nullptr;
 
-    for (size_t i = 0; i < num_collided_objects; ++i)
+    // objects can only be moved to their impacts by the physics world
+    if (is_continuous_collision_enabled_ && world)
+    {
+        RespondToImpacts(i_dt, *world);
+    }
+    else
     {
-        CollisionPair& collision_pair = collided_objects_[i];
-        collision_pair.object_a.Lock()->RespondToCollision(collision_pair.normal);
-        collision_pair.object_b.Lock()->RespondToCollision(collision_pair.normal);
+        for (size_t i = 0; i < collided_objects_.size(); ++i)
+        {
+            RespondToCollision(i, world);
+        }
+    }
 
-        if (collision_listener_)
+    // anything that touched last frame but wasn't responded to this frame has stopped touching
+    contact_cache_.EndFrame(exited_collisions_);
+    if (collision_listener_)
+    {
+        for (const CollisionPair& collision_pair : exited_collisions_)
         {
-            collision_listener_->OnCollision(collision_pair);
+            collision_listener_->OnCollisionExit(collision_pair);
         }
     }
 
-    collided_objects_.clear();
+    // release the frame memory before the frame allocator is reset
+    engine::memory::FrameVector<CollisionPair>().swap(collided_objects_);
+    engine::memory::FrameVector<CollisionPair>().swap(exited_collisions_);
+    engine::memory::FrameVector<BroadphasePair>().swap(collided_indices_);
+    engine::memory::FrameVector<ContactState>().swap(collided_states_);
+    engine::memory::FrameVector<engine::memory::SharedPointer<PhysicsObject>>().swap(cache_.physics_objects);
+    engine::memory::FrameVector<TransformMatrix>().swap(cache_.objects_to_world);
+    engine::memory::FrameVector<TransformMatrix>().swap(cache_.worlds_to_object);
+    engine::memory::FrameVector<engine::math::AABB>().swap(cache_.aabbs);
+    engine::memory::FrameVector<engine::math::Vec3D>().swap(cache_.velocities);
+}
+
+void Collider::RespondToCollision(size_t i_collision, PhysicsWorld* i_world)
+{
+    const CollisionPair& collision_pair = collided_objects_[i_collision];
+    const engine::memory::SharedPointer<PhysicsObject> object_a = collision_pair.object_a.Lock();
+    const engine::memory::SharedPointer<PhysicsObject> object_b = collision_pair.object_b.Lock();
+    object_a->RespondToCollision(collision_pair.normal);
+    object_b->RespondToCollision(collision_pair.normal);
+
+    // bodies that touch share an island, so they fall asleep & wake up together
+    if (i_world)
+    {
+        i_world->AddContact(object_a->GetHandle(), object_b->GetHandle());
+    }
+
+    // remember the collision as it was responded to, continuous collision detection may have tested it again since it was found
+    const Contact& contact = contact_cache_.AddContact(object_a->GetHandle(), object_b->GetHandle(), collision_pair, collided_states_[i_collision]);
+
+    if (collision_listener_)
+    {
+        collision_listener_->OnCollision(collision_pair);
+
+        // the objects have only been touching for a frame if they just started
+        if (contact.num_frames > 1)
+        {
+            collision_listener_->OnCollisionStay(collision_pair);
+        }
+        else
+        {
+            collision_listener_->OnCollisionEnter(collision_pair);
+        }
+    }
+}
+
+void Collider::RespondToImpacts(float i_dt, PhysicsWorld& i_world)
+{
+    // the collisions that haven't been responded to yet, earliest impact first
+    // collisions at the same time keep the order they were found in
+    auto is_earlier = [this](uint32_t i_lhs, uint32_t i_rhs) {
+        return collided_objects_[i_lhs].time < collided_objects_[i_rhs].time;
+    };
+
+    const size_t num_collisions = collided_objects_.size();
+    engine::memory::FrameVector<uint32_t> pending(num_collisions);
+    for (size_t i = 0; i < num_collisions; ++i)
+    {
+        pending[i] = static_cast<uint32_t>(num_collisions - 1 - i);
+    }
+    std::stable_sort(pending.begin(), pending.end(), [&is_earlier](uint32_t i_lhs, uint32_t i_rhs) { return is_earlier(i_rhs, i_lhs); });
+
+    // the list is kept latest first, so the next impact is always taken off the back
+    uint8_t num_impacts = 0;
+    while (!pending.empty())
+    {
+        const uint32_t collision = pending.back();
+        pending.pop_back();
+
+        const CollisionPair& collision_pair = collided_objects_[collision];
+        const bool is_moved = num_impacts < max_impact_iterations_;
+        if (is_moved)
+        {
+            // move both objects to where they touch, the physics world integrates what is left of the step
+            i_world.AdvanceBody(collision_pair.object_a.Lock()->GetHandle(), collision_pair.time);
+            i_world.AdvanceBody(collision_pair.object_b.Lock()->GetHandle(), collision_pair.time);
+        }
+
+        RespondToCollision(collision, &i_world);
+
+        if (!is_moved)
+        {
+            continue;
+        }
+        ++num_impacts;
+
+        // the other collisions of either object were found with its old velocity, test them again from the impact
+        const BroadphasePair& indices = collided_indices_[collision];
+        size_t num_pending = 0;
+        for (const uint32_t other : pending)
+        {
+            const BroadphasePair& other_indices = collided_indices_[other];
+            const bool is_affected = other_indices.first == indices.first || other_indices.first == indices.second ||
+                other_indices.second == indices.first || other_indices.second == indices.second;
+            if (!is_affected || RetestCollision(other, i_dt, i_world))
+            {
+                pending[num_pending++] = other;
+            }
+        }
+        pending.resize(num_pending);
+        std::stable_sort(pending.begin(), pending.end(), [&is_earlier](uint32_t i_lhs, uint32_t i_rhs) { return is_earlier(i_rhs, i_lhs); });
+    }
+}
+
+bool Collider::RetestCollision(size_t i_collision, float i_dt, const PhysicsWorld& i_world)
+{
+    CollisionPair& collision_pair = collided_objects_[i_collision];
+    const uint32_t index_a = collided_indices_[i_collision].first;
+    const uint32_t index_b = collided_indices_[i_collision].second;
+
+    // both objects move in a straight line from the last time either of them was moved
+    const float start_time = std::max(i_world.GetImpactTime(cache_.physics_objects[index_a]->GetHandle()), i_world.GetImpactTime(cache_.physics_objects[index_b]->GetHandle()));
+    CacheObjectAt(index_a, start_time, i_world);
+    CacheObjectAt(index_b, start_time, i_world);
+
+    // the same separating axis test, over what is left of the step
+    SeparatingAxisBatch batch;
+    batch.Reset(1);
+    PrepareCollision(cache_, index_a, index_b, batch, 0);
+    batch.Run(i_dt - start_time);
+    if (!batch.IsColliding(0))
+    {
+        return false;
+    }
+
+    // objects that already overlap collide right away
+    collision_pair.time = start_time + std::max(batch.GetCloseTime(0), 0.0f);
+    collision_pair.normal = GetCollisionNormal(cache_, index_a, index_b, batch, 0);
+
+    // what it was tested from this time, which only matches a later frame's state if the test started at the beginning of the step
+    collided_states_[i_collision] = GetContactState(index_a, index_b, i_dt - start_time);
+    return true;
+}
+
+void Collider::CacheObjectAt(uint32_t i_index, float i_time, const PhysicsWorld& i_world)
+{
+    const engine::memory::SharedPointer<PhysicsObject>& physics_object = cache_.physics_objects[i_index];
+    const engine::memory::SharedPointer<engine::gameobject::GameObject> game_object = physics_object->GetGameObject().Lock();
+    const engine::math::Vec3D velocity = physics_object->GetVelocity();
+
+    // the game object is where the physics world last moved it to
+    engine::math::Transform transform = game_object->GetTransform();
+    transform.SetPosition(transform.GetPosition() + velocity * (i_time - i_world.GetImpactTime(physics_object->GetHandle())));
+
+    engine::math::GetObjectToWorldTransform(transform, cache_.objects_to_world[i_index]);
+    cache_.worlds_to_object[i_index] = cache_.objects_to_world[i_index].GetInverse();
+    cache_.velocities[i_index] = velocity;
 }
 
 #ifdef BUILD_DEBUG
@@ -327,74 +994,101 @@ void Collider::AddPhysicsObject(const engine::memory::WeakPointer<PhysicsObject>
     // validate input
     ASSERT(i_physics_object);
 
-    // acquire a lock
-    std::lock_guard<std::mutex> lock(collider_mutex_);
+    commands_.Push({ i_physics_object.Lock(), true });
+}
+
+void Collider::RemovePhysicsObject(const engine::memory::WeakPointer<PhysicsObject>& i_physics_object)
+{
+    // validate input
+    ASSERT(i_physics_object);
+
+    commands_.Push({ i_physics_object.Lock(), false });
+}
+
+void Collider::ApplyCommands()
+{
+    commands_.Apply([this](const PhysicsObjectCommand& i_command) {
+        ApplyCommand(i_command);
+    });
+}
 
-    if (i_physics_object.Lock()->GetType() == PhysicsObjectType::kPhysicsObjectDynamic)
+void Collider::ApplyCommand(const PhysicsObjectCommand& i_command)
+{
+    const engine::memory::SharedPointer<PhysicsObject>& physics_object = i_command.physics_object;
+
+    if (i_command.is_add)
     {
         // check if this object already exists
-        if (std::find(dynamic_objects_.begin(), dynamic_objects_.end(), i_physics_object) != dynamic_objects_.end())
+        if (physics_object->collider_index_ != PhysicsObject::INVALID_INDEX)
         {
             LOG_ERROR("Collider is already tracking this physics object!");
             return;
         }
-    
+
         // add it to the list
-        dynamic_objects_.push_back(i_physics_object);
-        ++num_dynamic_objects_;
+        if (physics_object->GetType() == PhysicsObjectType::kPhysicsObjectDynamic)
+        {
+            physics_object->collider_index_ = num_dynamic_objects_;
+            dynamic_objects_.push_back(physics_object);
+            ++num_dynamic_objects_;
+        }
+        else
+        {
+            physics_object->collider_index_ = num_static_kynematic_objects_;
+            static_kynematic_objects_.push_back(physics_object);
+            ++num_static_kynematic_objects_;
+        }
+
+        // the handle stays the same for as long as the object lives, so it keys the object's proxy between frames
+        broadphase_.AddProxy(physics_object->GetHandle());
     }
     else
     {
-        // check if this object already exists
-        if (std::find(static_kynematic_objects_.begin(), static_kynematic_objects_.end(), i_physics_object) != static_kynematic_objects_.end())
+        // check if this object exists
+        const size_t index = physics_object->collider_index_;
+        if (index == PhysicsObject::INVALID_INDEX)
         {
-            LOG_ERROR("Collider is already tracking this physics object!");
+            LOG_ERROR("Collider could not find this physics object!");
             return;
         }
 
-        // add it to the list
-        static_kynematic_objects_.push_back(i_physics_object);
-        ++num_static_kynematic_objects_;
-    }
-}
-
-void Collider::RemovePhysicsObject(const engine::memory::WeakPointer<PhysicsObject>& i_physics_object)
-{
-    // validate input
-    ASSERT(i_physics_object);
-    // can't remove an object if there are none
-    ASSERT(num_dynamic_objects_ > 0 || num_static_kynematic_objects_ > 0);
-
-    // acquire a lock
-    std::lock_guard<std::mutex> lock(collider_mutex_);
-
-    if (i_physics_object.Lock()->GetType() == PhysicsObjectType::kPhysicsObjectDynamic)
-    {
-        // check if this object exists
-        auto it = std::find(dynamic_objects_.begin(), dynamic_objects_.end(), i_physics_object);
-        if (it == dynamic_objects_.end())
+        // its type may have changed since it was added, so look for it where the index points in every list
+        const bool is_dynamic = index < num_dynamic_objects_ && dynamic_objects_[index].Lock() == physics_object;
+        const bool is_static = !is_dynamic && index < num_static_kynematic_objects_ && static_kynematic_objects_[index].Lock() == physics_object;
+        const bool is_sleeping = !is_dynamic && !is_static && index < sleeping_objects_.size() && sleeping_objects_[index].Lock() == physics_object;
+        if (is_sleeping)
         {
-            LOG_ERROR("Physics could not find this physics object!");
+            // it left the broadphase when it fell asleep
+            RemoveSleepingObject(index);
+            physics_object->collider_index_ = PhysicsObject::INVALID_INDEX;
             return;
         }
 
-        // remove it from the list
-        dynamic_objects_.erase(it);
-        --num_dynamic_objects_;
-    }
-    else
-    {
-        // check if this object exists
-        auto it = std::find(static_kynematic_objects_.begin(), static_kynematic_objects_.end(), i_physics_object);
-        if (it == static_kynematic_objects_.end())
+        const bool is_baked = !is_dynamic && !is_static;
+        if (is_baked)
         {
-            LOG_ERROR("Physics could not find this physics object!");
+            // leave a gap, so the static tree's ids stay valid until the objects are baked again
+            ASSERT(index < baked_objects_.size() && baked_objects_[index].Lock() == physics_object);
+            baked_objects_[index] = engine::memory::WeakPointer<PhysicsObject>();
+            physics_object->collider_index_ = PhysicsObject::INVALID_INDEX;
             return;
         }
 
-        // remove it from the list
-        static_kynematic_objects_.erase(it);
-        --num_static_kynematic_objects_;
+        std::vector<engine::memory::WeakPointer<PhysicsObject>>& objects = is_dynamic ? dynamic_objects_ : static_kynematic_objects_;
+        size_t& num_objects = is_dynamic ? num_dynamic_objects_ : num_static_kynematic_objects_;
+        ASSERT(index < num_objects);
+
+        // move the last object into its place
+        physics_object->collider_index_ = PhysicsObject::INVALID_INDEX;
+        broadphase_.RemoveProxy(physics_object->GetHandle());
+        const size_t last_index = num_objects - 1;
+        if (index != last_index)
+        {
+            objects[index] = objects[last_index];
+            objects[index].Lock()->collider_index_ = index;
+        }
+        objects.pop_back();
+        --num_objects;
     }
 }
 
@@ -0,0 +1,135 @@
+#include "Physics/ContactCache.h"
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Common/HelperMacros.h"
+
+namespace engine {
+namespace physics {
+
+// static member initialization
+// no two objects have the same handle, so this is never the key of a contact
+const uint64_t ContactCache::EMPTY_KEY = UINT64_MAX;
+
+ContactCache::ContactCache() : num_contacts_(0),
+    frame_(0)
+{
+    slots_.resize(CONTACT_CACHE_INITIAL_NUM_SLOTS, { EMPTY_KEY, 0 });
+}
+
+ContactCache::~ContactCache()
+{
+    Clear();
+    for (ContactBlock*& block : blocks_)
+    {
+        SAFE_DELETE(block);
+    }
+    blocks_.clear();
+}
+
+const Contact& ContactCache::AddContact(PhysicsHandle i_handle_a, PhysicsHandle i_handle_b, const CollisionPair& i_collision, const ContactState& i_state)
+{
+    if ((num_contacts_ + 1) * 4 > slots_.size() * 3)
+    {
+        Grow();
+    }
+
+    const uint64_t key = GetKey(i_handle_a, i_handle_b);
+    Slot& slot = slots_[FindSlot(key)];
+
+    if (slot.key == EMPTY_KEY)
+    {
+        // start a new block when every contact is in use
+        if (free_contacts_.empty())
+        {
+            AddBlock();
+        }
+
+        slot.key = key;
+        slot.contact = free_contacts_.back();
+        free_contacts_.pop_back();
+        GetContact(slot.contact).num_frames = 0;
+        ++num_contacts_;
+    }
+
+    // a contact that wasn't touched last frame is a new one, even if it hasn't been removed yet
+    Contact& contact = GetContact(slot.contact);
+    contact.num_frames = contact.num_frames > 0 && contact.last_frame + 1 == frame_ ? contact.num_frames + 1 : 1;
+    contact.last_frame = frame_;
+    contact.collision = i_collision;
+    contact.state = i_state;
+    return contact;
+}
+
+void ContactCache::EndFrame(engine::memory::FrameVector<CollisionPair>& o_exited_collisions)
+{
+    for (size_t i = 0; i < slots_.size();)
+    {
+        if (slots_[i].key != EMPTY_KEY && GetContact(slots_[i].contact).last_frame != frame_)
+        {
+            Contact& contact = GetContact(slots_[i].contact);
+            o_exited_collisions.push_back(contact.collision);
+            contact.collision = CollisionPair();
+            free_contacts_.push_back(slots_[i].contact);
+
+            // a contact further along may have been moved into this slot, so look at it again
+            EraseSlot(i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+void ContactCache::AddBlock()
+{
+    blocks_.push_back(new ContactBlock());
+    ASSERT(blocks_.back());
+
+    // hand out the lowest indices first
+    free_contacts_.reserve(blocks_.size() * CONTACT_CACHE_BLOCK_SIZE);
+    for (uint32_t i = CONTACT_CACHE_BLOCK_SIZE; i > 0; --i)
+    {
+        free_contacts_.push_back(uint32_t((blocks_.size() - 1) * CONTACT_CACHE_BLOCK_SIZE + i - 1));
+    }
+}
+
+void ContactCache::Grow()
+{
+    std::vector<Slot> old_slots(slots_.size() * 2, { EMPTY_KEY, 0 });
+    old_slots.swap(slots_);
+
+    for (const Slot& old_slot : old_slots)
+    {
+        if (old_slot.key != EMPTY_KEY)
+        {
+            slots_[FindSlot(old_slot.key)] = old_slot;
+        }
+    }
+}
+
+void ContactCache::EraseSlot(size_t i_slot)
+{
+    const size_t mask = slots_.size() - 1;
+    size_t hole = i_slot;
+    size_t slot = (hole + 1) & mask;
+
+    // move back every key that was probed past the hole, until the run of full slots ends
+    while (slots_[slot].key != EMPTY_KEY)
+    {
+        const size_t home = GetHomeSlot(slots_[slot].key);
+        if (((slot - home) & mask) >= ((slot - hole) & mask))
+        {
+            slots_[hole] = slots_[slot];
+            hole = slot;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    slots_[hole].key = EMPTY_KEY;
+    --num_contacts_;
+}
+
+} // namespace physics
+} // namespace engine
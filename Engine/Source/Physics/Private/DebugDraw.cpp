@@ -1,17 +1,17 @@
 #ifdef ENABLE_DEBUG_DRAW
 
-#include "Physics\DebugDraw.h"
+#include "Physics/DebugDraw.h"
 
 // engine includes
-#include "Math\AABB.h"
-#include "Math\Mat44.h"
-#include "Renderer\Renderer.h"
+#include "Math/AABB.h"
+#include "Math/Mat44.h"
+#include "Renderer/Renderer.h"
 
 namespace engine {
 namespace physics {
 
 // static member initialization
-const char* DebugDrawData::POINT_SPRITE_FILE_NAME = "Data\\4x4_red.dds";
+const char* DebugDrawData::POINT_SPRITE_FILE_NAME = "Data/4x4_red.dds";
 
 DebugDrawData::DebugDrawData(uint8_t i_r, uint8_t i_g, uint8_t i_b, uint8_t i_a)
 {
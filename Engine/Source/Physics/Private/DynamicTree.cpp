@@ -0,0 +1,340 @@
+#include "Physics/DynamicTree.h"
+
+// library includes
+#include <algorithm>
+
+// engine includes
+#include "Assert/Assert.h"
+
+namespace engine {
+namespace physics {
+
+DynamicTree::DynamicTree(float i_margin) : root_(DYNAMIC_TREE_NULL_NODE),
+    free_list_(DYNAMIC_TREE_NULL_NODE),
+    num_proxies_(0),
+    margin_(i_margin)
+{
+    ASSERT(i_margin >= 0.0f);
+}
+
+DynamicTree::~DynamicTree()
+{
+    Clear();
+}
+
+int32_t DynamicTree::CreateProxy(const DynamicTreeBox& i_box, uint32_t i_user_data)
+{
+    // validate input
+    ASSERT(i_box.min_x <= i_box.max_x && i_box.min_y <= i_box.max_y);
+
+    const int32_t proxy = AllocateNode();
+    Node& node = nodes_[proxy];
+    node.box = { i_box.min_x - margin_, i_box.min_y - margin_, i_box.max_x + margin_, i_box.max_y + margin_ };
+    node.height = 0;
+    node.user_data = i_user_data;
+
+    InsertLeaf(proxy);
+    ++num_proxies_;
+
+    return proxy;
+}
+
+void DynamicTree::DestroyProxy(int32_t i_proxy)
+{
+    // validate input
+    ASSERT(i_proxy >= 0 && size_t(i_proxy) < nodes_.size());
+    ASSERT(IsLeaf(i_proxy));
+
+    RemoveLeaf(i_proxy);
+    FreeNode(i_proxy);
+    --num_proxies_;
+}
+
+bool DynamicTree::MoveProxy(int32_t i_proxy, const DynamicTreeBox& i_box)
+{
+    // validate inputs
+    ASSERT(i_proxy >= 0 && size_t(i_proxy) < nodes_.size());
+    ASSERT(IsLeaf(i_proxy));
+    ASSERT(i_box.min_x <= i_box.max_x && i_box.min_y <= i_box.max_y);
+
+    // the fat box still covers the proxy, nothing in the tree needs to change
+    if (Contains(nodes_[i_proxy].box, i_box))
+    {
+        return false;
+    }
+
+    RemoveLeaf(i_proxy);
+    nodes_[i_proxy].box = { i_box.min_x - margin_, i_box.min_y - margin_, i_box.max_x + margin_, i_box.max_y + margin_ };
+    InsertLeaf(i_proxy);
+
+    return true;
+}
+
+void DynamicTree::Clear()
+{
+    nodes_.clear();
+    root_ = DYNAMIC_TREE_NULL_NODE;
+    free_list_ = DYNAMIC_TREE_NULL_NODE;
+    num_proxies_ = 0;
+}
+
+bool DynamicTree::Validate() const
+{
+    size_t num_leaves = 0;
+    if (root_ != DYNAMIC_TREE_NULL_NODE && !ValidateNode(root_, DYNAMIC_TREE_NULL_NODE, num_leaves))
+    {
+        return false;
+    }
+
+    // every node is either in the tree or in the free list
+    size_t num_free_nodes = 0;
+    for (int32_t node = free_list_; node != DYNAMIC_TREE_NULL_NODE; node = nodes_[node].parent)
+    {
+        if (nodes_[node].height != -1)
+        {
+            return false;
+        }
+        ++num_free_nodes;
+    }
+
+    const size_t num_used_nodes = num_leaves == 0 ? 0 : num_leaves * 2 - 1;
+    return num_leaves == num_proxies_ && num_used_nodes + num_free_nodes == nodes_.size();
+}
+
+int32_t DynamicTree::AllocateNode()
+{
+    int32_t node = free_list_;
+    if (node == DYNAMIC_TREE_NULL_NODE)
+    {
+        node = static_cast<int32_t>(nodes_.size());
+        nodes_.push_back(Node());
+    }
+    else
+    {
+        free_list_ = nodes_[node].parent;
+    }
+
+    Node& new_node = nodes_[node];
+    new_node.parent = DYNAMIC_TREE_NULL_NODE;
+    new_node.child_1 = DYNAMIC_TREE_NULL_NODE;
+    new_node.child_2 = DYNAMIC_TREE_NULL_NODE;
+    new_node.height = 0;
+    new_node.user_data = 0;
+
+    return node;
+}
+
+void DynamicTree::FreeNode(int32_t i_node)
+{
+    nodes_[i_node].parent = free_list_;
+    nodes_[i_node].height = -1;
+    free_list_ = i_node;
+}
+
+void DynamicTree::InsertLeaf(int32_t i_leaf)
+{
+    if (root_ == DYNAMIC_TREE_NULL_NODE)
+    {
+        root_ = i_leaf;
+        nodes_[root_].parent = DYNAMIC_TREE_NULL_NODE;
+        return;
+    }
+
+    // walk down to the sibling that grows the tree's perimeter the least
+    const DynamicTreeBox leaf_box = nodes_[i_leaf].box;
+    int32_t index = root_;
+    while (!IsLeaf(index))
+    {
+        const Node& node = nodes_[index];
+        const float perimeter = GetPerimeter(node.box);
+        const float combined_perimeter = GetPerimeter(Combine(node.box, leaf_box));
+
+        // cost of pairing the leaf with this node & the cost every level below pays for this node growing
+        const float cost = 2.0f * combined_perimeter;
+        const float inherited_cost = 2.0f * (combined_perimeter - perimeter);
+
+        float child_costs[2] = { 0.0f, 0.0f };
+        const int32_t children[2] = { node.child_1, node.child_2 };
+        for (uint8_t i = 0; i < 2; ++i)
+        {
+            const Node& child = nodes_[children[i]];
+            const float child_perimeter = GetPerimeter(Combine(child.box, leaf_box));
+            child_costs[i] = (child.height == 0 ? child_perimeter : child_perimeter - GetPerimeter(child.box)) + inherited_cost;
+        }
+
+        if (cost < child_costs[0] && cost < child_costs[1])
+        {
+            break;
+        }
+
+        index = child_costs[0] < child_costs[1] ? children[0] : children[1];
+    }
+
+    // give the leaf & its sibling a new parent
+    const int32_t sibling = index;
+    const int32_t old_parent = nodes_[sibling].parent;
+    const int32_t new_parent = AllocateNode();
+
+    nodes_[new_parent].parent = old_parent;
+    nodes_[new_parent].box = Combine(leaf_box, nodes_[sibling].box);
+    nodes_[new_parent].height = nodes_[sibling].height + 1;
+    nodes_[new_parent].child_1 = sibling;
+    nodes_[new_parent].child_2 = i_leaf;
+    nodes_[sibling].parent = new_parent;
+    nodes_[i_leaf].parent = new_parent;
+
+    if (old_parent == DYNAMIC_TREE_NULL_NODE)
+    {
+        root_ = new_parent;
+    }
+    else if (nodes_[old_parent].child_1 == sibling)
+    {
+        nodes_[old_parent].child_1 = new_parent;
+    }
+    else
+    {
+        nodes_[old_parent].child_2 = new_parent;
+    }
+
+    RefitAncestors(new_parent);
+}
+
+void DynamicTree::RemoveLeaf(int32_t i_leaf)
+{
+    if (i_leaf == root_)
+    {
+        root_ = DYNAMIC_TREE_NULL_NODE;
+        return;
+    }
+
+    // the leaf's sibling takes its parent's place
+    const int32_t parent = nodes_[i_leaf].parent;
+    const int32_t grand_parent = nodes_[parent].parent;
+    const int32_t sibling = nodes_[parent].child_1 == i_leaf ? nodes_[parent].child_2 : nodes_[parent].child_1;
+
+    nodes_[sibling].parent = grand_parent;
+    FreeNode(parent);
+
+    if (grand_parent == DYNAMIC_TREE_NULL_NODE)
+    {
+        root_ = sibling;
+        return;
+    }
+
+    if (nodes_[grand_parent].child_1 == parent)
+    {
+        nodes_[grand_parent].child_1 = sibling;
+    }
+    else
+    {
+        nodes_[grand_parent].child_2 = sibling;
+    }
+
+    RefitAncestors(grand_parent);
+}
+
+int32_t DynamicTree::Balance(int32_t i_node)
+{
+    Node& a = nodes_[i_node];
+    if (a.height < 2)
+    {
+        return i_node;
+    }
+
+    const int32_t index_b = a.child_1;
+    const int32_t index_c = a.child_2;
+    const int32_t balance = nodes_[index_c].height - nodes_[index_b].height;
+    if (balance >= -1 && balance <= 1)
+    {
+        return i_node;
+    }
+
+    // rotate the taller child up into a's place, a keeps the other child & the shorter of the grandchildren
+    const bool rotate_c = balance > 1;
+    const int32_t index_up = rotate_c ? index_c : index_b;
+    const int32_t index_kept = rotate_c ? index_b : index_c;
+    Node& up = nodes_[index_up];
+    const int32_t index_f = up.child_1;
+    const int32_t index_g = up.child_2;
+
+    up.child_1 = i_node;
+    up.parent = a.parent;
+    a.parent = index_up;
+
+    if (up.parent == DYNAMIC_TREE_NULL_NODE)
+    {
+        root_ = index_up;
+    }
+    else if (nodes_[up.parent].child_1 == i_node)
+    {
+        nodes_[up.parent].child_1 = index_up;
+    }
+    else
+    {
+        nodes_[up.parent].child_2 = index_up;
+    }
+
+    const bool keep_f = nodes_[index_f].height > nodes_[index_g].height;
+    const int32_t index_stays = keep_f ? index_f : index_g;
+    const int32_t index_moves = keep_f ? index_g : index_f;
+
+    up.child_2 = index_stays;
+    if (rotate_c)
+    {
+        a.child_2 = index_moves;
+    }
+    else
+    {
+        a.child_1 = index_moves;
+    }
+    nodes_[index_moves].parent = i_node;
+
+    a.box = Combine(nodes_[index_kept].box, nodes_[index_moves].box);
+    a.height = 1 + std::max(nodes_[index_kept].height, nodes_[index_moves].height);
+    up.box = Combine(a.box, nodes_[index_stays].box);
+    up.height = 1 + std::max(a.height, nodes_[index_stays].height);
+
+    return index_up;
+}
+
+void DynamicTree::RefitAncestors(int32_t i_node)
+{
+    int32_t index = i_node;
+    while (index != DYNAMIC_TREE_NULL_NODE)
+    {
+        index = Balance(index);
+
+        Node& node = nodes_[index];
+        const Node& child_1 = nodes_[node.child_1];
+        const Node& child_2 = nodes_[node.child_2];
+        node.height = 1 + std::max(child_1.height, child_2.height);
+        node.box = Combine(child_1.box, child_2.box);
+
+        index = node.parent;
+    }
+}
+
+bool DynamicTree::ValidateNode(int32_t i_node, int32_t i_parent, size_t& io_num_leaves) const
+{
+    const Node& node = nodes_[i_node];
+    if (node.parent != i_parent)
+    {
+        return false;
+    }
+
+    if (node.child_1 == DYNAMIC_TREE_NULL_NODE)
+    {
+        ++io_num_leaves;
+        return node.child_2 == DYNAMIC_TREE_NULL_NODE && node.height == 0;
+    }
+
+    const Node& child_1 = nodes_[node.child_1];
+    const Node& child_2 = nodes_[node.child_2];
+    return node.height == 1 + std::max(child_1.height, child_2.height) &&
+        Contains(node.box, child_1.box) && Contains(node.box, child_2.box) &&
+        ValidateNode(node.child_1, i_node, io_num_leaves) &&
+        ValidateNode(node.child_2, i_node, io_num_leaves);
+}
+
+} // namespace physics
+} // namespace engine
@@ -1,8 +1,8 @@
-#include "Physics\Physics.h"
+#include "Physics/Physics.h"
 
 // engine includes
-#include "Common\HelperMacros.h"
-#include "Physics\Collider.h"
+#include "Common/HelperMacros.h"
+#include "Physics/Collider.h"
 
 namespace engine {
 namespace physics {
@@ -35,23 +35,26 @@ void Physics::Destroy()
 
 void Physics::Run(float i_dt)
 {
-    // acquire a lock
-    std::lock_guard<std::mutex> lock(physics_mutex_);
+    ApplyCommands();
 
+    world_.Run(i_dt);
+
+#ifdef ENABLE_DEBUG_DRAW
     for (size_t i = 0; i < num_physics_objects_; ++i)
     {
-        if (physics_objects_[i]->GetType() != PhysicsObjectType::kPhysicsObjectStatic)
+        if (world_.GetWasIntegrated(physics_objects_[i]->GetHandle()))
         {
-            physics_objects_[i]->Update(i_dt);
+            physics_objects_[i]->DrawDebugData(i_dt);
         }
     }
+#endif
 }
 
 engine::memory::SharedPointer<PhysicsObject> Physics::CreatePhysicsObject(const engine::memory::WeakPointer<engine::gameobject::GameObject>& i_game_object, 
     float i_mass, 
     float i_drag, 
     PhysicsObjectType i_type, 
-    uint16_t i_collision_filter,
+    const CollisionFilter& i_collision_filter,
     bool i_is_collidable)
 {
     // validate input
@@ -76,27 +79,13 @@ void Physics::AddPhysicsObject(const engine::memory::SharedPointer<PhysicsObject
         Collider::Get()->AddPhysicsObject(i_physics_object);
     }
 
-    // acquire a lock
-    std::lock_guard<std::mutex> lock(physics_mutex_);
-
-    // check if this object already exists
-    if (std::find(physics_objects_.begin(), physics_objects_.end(), i_physics_object) != physics_objects_.end())
-    {
-        LOG_ERROR("Physics is already tracking this physics object!");
-        return;
-    }
-
-    // add it to the list
-    physics_objects_.push_back(i_physics_object);
-    ++num_physics_objects_;
+    commands_.Push({ i_physics_object, true });
 }
 
 void Physics::RemovePhysicsObject(const engine::memory::SharedPointer<PhysicsObject>& i_physics_object)
 {
     // validate input
     ASSERT(i_physics_object);
-    // can't remove an object if there are none
-    ASSERT(num_physics_objects_ > 0);
 
     // remove from the collider if it is collidable
     if (i_physics_object->GetIsCollidable())
@@ -104,20 +93,58 @@ void Physics::RemovePhysicsObject(const engine::memory::SharedPointer<PhysicsObj
         Collider::Get()->RemovePhysicsObject(i_physics_object);
     }
 
-    // acquire a lock
-    std::lock_guard<std::mutex> lock(physics_mutex_);
+    commands_.Push({ i_physics_object, false });
+}
+
+void Physics::ApplyCommands()
+{
+    commands_.Apply([this](const PhysicsObjectCommand& i_command) {
+        ApplyCommand(i_command);
+    });
+}
+
+void Physics::ApplyCommand(const PhysicsObjectCommand& i_command)
+{
+    const engine::memory::SharedPointer<PhysicsObject>& physics_object = i_command.physics_object;
 
-    // check if this object exists
-    auto it = std::find(physics_objects_.begin(), physics_objects_.end(), i_physics_object);
-    if (it == physics_objects_.end())
+    if (i_command.is_add)
     {
-        LOG_ERROR("Physics could not find this physics object!");
-        return;
+        // check if this object already exists
+        if (physics_object->physics_index_ != PhysicsObject::INVALID_INDEX)
+        {
+            LOG_ERROR("Physics is already tracking this physics object!");
+            return;
+        }
+
+        // add it to the list & start simulating its body
+        physics_object->physics_index_ = num_physics_objects_;
+        physics_objects_.push_back(physics_object);
+        world_.SetIsSimulated(physics_object->GetHandle(), true);
+        ++num_physics_objects_;
     }
+    else
+    {
+        // check if this object exists
+        const size_t index = physics_object->physics_index_;
+        if (index == PhysicsObject::INVALID_INDEX)
+        {
+            LOG_ERROR("Physics could not find this physics object!");
+            return;
+        }
+
+        // stop simulating its body & move the last object into its place
+        world_.SetIsSimulated(physics_object->GetHandle(), false);
+        physics_object->physics_index_ = PhysicsObject::INVALID_INDEX;
 
-    // erase it from the list
-    physics_objects_.erase(it);
-    --num_physics_objects_;
+        const size_t last_index = num_physics_objects_ - 1;
+        if (index != last_index)
+        {
+            physics_objects_[index] = physics_objects_[last_index];
+            physics_objects_[index]->physics_index_ = index;
+        }
+        physics_objects_.pop_back();
+        --num_physics_objects_;
+    }
 }
 
 } // namespace physics
@@ -0,0 +1,424 @@
+#include "Physics/PhysicsWorld.h"
+
+// library includes
+#include <algorithm>
+#include <emmintrin.h>
+#include <string.h>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Common/HelperMacros.h"
+#include "GameObject/GameObject.h"
+#include "Jobs/JobSystem.h"
+#include "Memory/FrameAllocator.h"
+#include "Physics/PhysicsObject.h"
+
+namespace engine {
+namespace physics {
+
+// static member initialization
+const PhysicsHandle PhysicsWorld::INVALID_HANDLE = UINT32_MAX;
+
+PhysicsWorld::PhysicsWorld() : num_blocks_(0),
+    num_handles_(0),
+    num_bodies_(0)
+{
+    for (size_t i = 0; i < PHYSICS_WORLD_MAX_BLOCKS; ++i)
+    {
+        blocks_[i] = nullptr;
+    }
+}
+
+PhysicsWorld::~PhysicsWorld()
+{
+    for (size_t i = 0; i < num_blocks_; ++i)
+    {
+        SAFE_DELETE(blocks_[i]);
+    }
+    num_blocks_ = 0;
+}
+
+PhysicsHandle PhysicsWorld::CreateBody(engine::gameobject::GameObject* i_game_object, float i_mass, float i_drag, PhysicsObjectType i_type)
+{
+    // validate inputs
+    ASSERT(i_game_object);
+    // physics objects must have positive mass
+    ASSERT(!engine::math::IsNaN(i_mass) && i_mass > 0.0f);
+    ASSERT(!engine::math::IsNaN(i_drag));
+
+    // acquire a lock
+    std::lock_guard<std::mutex> lock(world_mutex_);
+
+    // reuse the handle of a destroyed body if possible
+    PhysicsHandle handle = INVALID_HANDLE;
+    if (free_handles_.empty())
+    {
+        ASSERT(num_handles_ < PHYSICS_WORLD_BLOCK_SIZE * PHYSICS_WORLD_MAX_BLOCKS);
+        handle = static_cast<PhysicsHandle>(num_handles_++);
+
+        // start a new block when the previous one is full
+        if (GetLane(handle) == 0)
+        {
+            blocks_[num_blocks_] = new BodyBlock();
+            ASSERT(blocks_[num_blocks_]);
+            ++num_blocks_;
+        }
+    }
+    else
+    {
+        handle = free_handles_.back();
+        free_handles_.pop_back();
+    }
+
+    BodyBlock& block = GetBlock(handle);
+    const size_t lane = GetLane(handle);
+    block.velocity_x[lane] = 0.0f;
+    block.velocity_y[lane] = 0.0f;
+    block.velocity_z[lane] = 0.0f;
+    block.mass[lane] = i_mass;
+    block.inverse_mass[lane] = 1.0f / i_mass;
+    block.drag[lane] = i_drag;
+    block.game_object[lane] = i_game_object;
+    block.type[lane] = i_type;
+    block.is_awake[lane] = 0;
+    block.is_active[lane] = 1;
+    block.is_simulated[lane] = 0;
+    block.done_collision_response[lane] = 0;
+    block.was_integrated[lane] = 0;
+    block.impact_time[lane] = 0.0f;
+    block.sleep_time[lane] = 0.0f;
+
+    ++num_bodies_;
+    return handle;
+}
+
+void PhysicsWorld::DestroyBody(PhysicsHandle i_handle)
+{
+    // acquire a lock
+    std::lock_guard<std::mutex> lock(world_mutex_);
+
+    ASSERT(num_bodies_ > 0);
+
+    // the lane stays in its block until a new body takes it, it just isn't simulated anymore
+    BodyBlock& block = GetBlock(i_handle);
+    const size_t lane = GetLane(i_handle);
+    block.is_simulated[lane] = 0;
+    block.was_integrated[lane] = 0;
+    block.game_object[lane] = nullptr;
+
+    free_handles_.push_back(i_handle);
+    --num_bodies_;
+}
+
+void PhysicsWorld::CopyBody(PhysicsHandle i_source, PhysicsHandle i_destination)
+{
+    const BodyBlock& source = GetBlock(i_source);
+    const size_t source_lane = GetLane(i_source);
+    BodyBlock& destination = GetBlock(i_destination);
+    const size_t destination_lane = GetLane(i_destination);
+
+    // whether the body is simulated depends on the physics system, not on the body it was copied from
+    destination.velocity_x[destination_lane] = source.velocity_x[source_lane];
+    destination.velocity_y[destination_lane] = source.velocity_y[source_lane];
+    destination.velocity_z[destination_lane] = source.velocity_z[source_lane];
+    destination.mass[destination_lane] = source.mass[source_lane];
+    destination.inverse_mass[destination_lane] = source.inverse_mass[source_lane];
+    destination.drag[destination_lane] = source.drag[source_lane];
+    destination.game_object[destination_lane] = source.game_object[source_lane];
+    destination.type[destination_lane] = source.type[source_lane];
+    destination.is_awake[destination_lane] = source.is_awake[source_lane];
+    destination.is_active[destination_lane] = source.is_active[source_lane];
+    destination.done_collision_response[destination_lane] = source.done_collision_response[source_lane];
+    destination.sleep_time[destination_lane] = source.sleep_time[source_lane];
+}
+
+void PhysicsWorld::Run(float i_dt)
+{
+    // acquire a lock
+    std::lock_guard<std::mutex> lock(world_mutex_);
+
+    // every block only integrates its own bodies, so the blocks are split across the engine's workers
+    engine::jobs::JobSystem* job_system = engine::jobs::JobSystem::Get();
+    if (job_system)
+    {
+        // not cached, the string pool is recreated every time the engine starts up
+        const engine::data::PooledString engine_team("EngineTeam");
+        job_system->ParallelFor(0, num_blocks_, 1, [this, i_dt](size_t i_begin, size_t i_end) {
+            for (size_t i = i_begin; i < i_end; ++i)
+            {
+                IntegrateBlock(*blocks_[i], i_dt);
+            }
+        }, engine_team);
+    }
+    else
+    {
+        for (size_t i = 0; i < num_blocks_; ++i)
+        {
+            IntegrateBlock(*blocks_[i], i_dt);
+        }
+    }
+
+    UpdateIslands();
+}
+
+void PhysicsWorld::AddContact(PhysicsHandle i_body_a, PhysicsHandle i_body_b)
+{
+    // acquire a lock
+    std::lock_guard<std::mutex> lock(world_mutex_);
+
+    if (CanJoinIsland(i_body_a) && CanJoinIsland(i_body_b))
+    {
+        contacts_.push_back({ i_body_a, i_body_b });
+    }
+}
+
+void PhysicsWorld::UpdateIslands()
+{
+    // gather the bodies that touched something, bodies may have been destroyed since they touched
+    engine::memory::FrameVector<PhysicsHandle> bodies;
+    bodies.reserve(contacts_.size() * 2);
+    for (const BodyContact& contact : contacts_)
+    {
+        if (CanJoinIsland(contact.body_a) && CanJoinIsland(contact.body_b))
+        {
+            bodies.push_back(contact.body_a);
+            bodies.push_back(contact.body_b);
+        }
+    }
+    std::sort(bodies.begin(), bodies.end());
+    bodies.erase(std::unique(bodies.begin(), bodies.end()), bodies.end());
+
+    // every body starts as an island of its own, every contact merges two islands
+    const size_t num_bodies = bodies.size();
+    engine::memory::FrameVector<uint32_t> islands(num_bodies);
+    for (size_t i = 0; i < num_bodies; ++i)
+    {
+        islands[i] = static_cast<uint32_t>(i);
+    }
+
+    auto find_island = [&islands](uint32_t i_body) {
+        while (islands[i_body] != i_body)
+        {
+            // point every other body at its grandparent to keep the islands flat
+            islands[i_body] = islands[islands[i_body]];
+            i_body = islands[i_body];
+        }
+        return i_body;
+    };
+
+    for (const BodyContact& contact : contacts_)
+    {
+        if (CanJoinIsland(contact.body_a) && CanJoinIsland(contact.body_b))
+        {
+            const uint32_t island_a = find_island(static_cast<uint32_t>(std::lower_bound(bodies.begin(), bodies.end(), contact.body_a) - bodies.begin()));
+            const uint32_t island_b = find_island(static_cast<uint32_t>(std::lower_bound(bodies.begin(), bodies.end(), contact.body_b) - bodies.begin()));
+            islands[island_a] = island_b;
+        }
+    }
+    contacts_.clear();
+
+    // an island falls asleep once all of its bodies are resting, otherwise it stays awake as long as any of its bodies is awake
+    engine::memory::FrameVector<uint8_t> is_island_awake(num_bodies, 0);
+    engine::memory::FrameVector<uint8_t> is_island_resting(num_bodies, 1);
+    for (size_t i = 0; i < num_bodies; ++i)
+    {
+        const uint32_t island = find_island(static_cast<uint32_t>(i));
+        if (GetIsAwake(bodies[i]))
+        {
+            is_island_awake[island] = 1;
+        }
+        if (GetBlock(bodies[i]).sleep_time[GetLane(bodies[i])] < PHYSICS_WORLD_TIME_TO_SLEEP)
+        {
+            is_island_resting[island] = 0;
+        }
+    }
+
+    for (size_t i = 0; i < num_bodies; ++i)
+    {
+        const uint32_t island = find_island(static_cast<uint32_t>(i));
+        if (is_island_resting[island])
+        {
+            GetBlock(bodies[i]).is_awake[GetLane(bodies[i])] = 0;
+        }
+        else if (is_island_awake[island] && !GetIsAwake(bodies[i]))
+        {
+            SetIsAwake(bodies[i], true);
+        }
+    }
+
+    // every other body that was integrated is an island of its own
+    for (size_t i = 0; i < num_blocks_; ++i)
+    {
+        BodyBlock& block = *blocks_[i];
+        for (size_t lane = 0; lane < PHYSICS_WORLD_BLOCK_SIZE; ++lane)
+        {
+            const PhysicsHandle handle = static_cast<PhysicsHandle>(i * PHYSICS_WORLD_BLOCK_SIZE + lane);
+            if (block.was_integrated[lane] && block.is_awake[lane] && block.sleep_time[lane] >= PHYSICS_WORLD_TIME_TO_SLEEP &&
+                !std::binary_search(bodies.begin(), bodies.end(), handle))
+            {
+                block.is_awake[lane] = 0;
+            }
+        }
+    }
+}
+
+void PhysicsWorld::IntegrateBlock(BodyBlock& io_block, float i_dt)
+{
+    // gather the positions of the bodies that will be integrated
+    for (size_t lane = 0; lane < PHYSICS_WORLD_BLOCK_SIZE; ++lane)
+    {
+        const bool is_integrated = io_block.is_simulated[lane] && io_block.is_active[lane] && io_block.is_awake[lane] && io_block.type[lane] != PhysicsObjectType::kPhysicsObjectStatic;
+
+        // a body that stops being integrated must not be rendered between its last two positions forever
+        if (io_block.was_integrated[lane] && !is_integrated)
+        {
+            io_block.game_object[lane]->SetPreviousPosition(io_block.game_object[lane]->GetPosition());
+        }
+
+        io_block.was_integrated[lane] = is_integrated ? 1 : 0;
+        if (is_integrated)
+        {
+            const engine::math::Vec3D& position = io_block.game_object[lane]->GetPosition();
+            io_block.position_x[lane] = position.x();
+            io_block.position_y[lane] = position.y();
+            io_block.position_z[lane] = position.z();
+        }
+    }
+
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 step_dt = _mm_set1_ps(i_dt);
+    const __m128 min_velocity_length_squared = _mm_set1_ps(PhysicsObject::MIN_VELOCITY_LENGTH_SQUARED);
+    const __m128i zero = _mm_setzero_si128();
+
+    // only SSE2 is used, so the loop runs on any x86/x64 CPU
+    for (size_t i = 0; i < PHYSICS_WORLD_BLOCK_SIZE; i += 4)
+    {
+        // bodies that aren't integrated keep their state, the 4 flags are widened to 32 bits each
+        int32_t integrated_flags = 0;
+        memcpy(&integrated_flags, &io_block.was_integrated[i], sizeof(integrated_flags));
+        const __m128i widened_flags = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(integrated_flags), zero), zero);
+        const __m128 is_integrated = _mm_castsi128_ps(_mm_cmpgt_epi32(widened_flags, zero));
+
+        // bodies advanced to an impact have already covered part of the step
+        const __m128 dt = _mm_sub_ps(step_dt, _mm_loadu_ps(&io_block.impact_time[i]));
+
+        // apply drag to velocity when no force is acting
+        const __m128 prev_velocity_x = _mm_loadu_ps(&io_block.velocity_x[i]);
+        const __m128 prev_velocity_y = _mm_loadu_ps(&io_block.velocity_y[i]);
+        const __m128 prev_velocity_z = _mm_loadu_ps(&io_block.velocity_z[i]);
+        const __m128 negative_drag = _mm_xor_ps(_mm_loadu_ps(&io_block.drag[i]), sign_mask);
+        __m128 velocity_x = _mm_add_ps(prev_velocity_x, _mm_mul_ps(prev_velocity_x, negative_drag));
+        __m128 velocity_y = _mm_add_ps(prev_velocity_y, _mm_mul_ps(prev_velocity_y, negative_drag));
+        __m128 velocity_z = _mm_add_ps(prev_velocity_z, _mm_mul_ps(prev_velocity_z, negative_drag));
+
+        // bring stationary bodies to a stop, they can fall asleep once they've been stopped for long enough
+        const __m128 length_squared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(velocity_x, velocity_x), _mm_mul_ps(velocity_y, velocity_y)), _mm_mul_ps(velocity_z, velocity_z));
+        const __m128 is_moving = _mm_cmpgt_ps(length_squared, min_velocity_length_squared);
+        const __m128 prev_sleep_time = _mm_loadu_ps(&io_block.sleep_time[i]);
+        const __m128 sleep_time = _mm_andnot_ps(is_moving, _mm_add_ps(prev_sleep_time, step_dt));
+        velocity_x = _mm_and_ps(velocity_x, is_moving);
+        velocity_y = _mm_and_ps(velocity_y, is_moving);
+        velocity_z = _mm_and_ps(velocity_z, is_moving);
+
+        // use midpoint numerical integration to calculate new positions
+        const __m128 position_x = _mm_add_ps(_mm_loadu_ps(&io_block.position_x[i]), _mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_and_ps(prev_velocity_x, is_moving), velocity_x), half), dt));
+        const __m128 position_y = _mm_add_ps(_mm_loadu_ps(&io_block.position_y[i]), _mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_and_ps(prev_velocity_y, is_moving), velocity_y), half), dt));
+        const __m128 position_z = _mm_add_ps(_mm_loadu_ps(&io_block.position_z[i]), _mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_and_ps(prev_velocity_z, is_moving), velocity_z), half), dt));
+
+        _mm_storeu_ps(&io_block.velocity_x[i], _mm_or_ps(_mm_and_ps(is_integrated, velocity_x), _mm_andnot_ps(is_integrated, prev_velocity_x)));
+        _mm_storeu_ps(&io_block.velocity_y[i], _mm_or_ps(_mm_and_ps(is_integrated, velocity_y), _mm_andnot_ps(is_integrated, prev_velocity_y)));
+        _mm_storeu_ps(&io_block.velocity_z[i], _mm_or_ps(_mm_and_ps(is_integrated, velocity_z), _mm_andnot_ps(is_integrated, prev_velocity_z)));
+        _mm_storeu_ps(&io_block.position_x[i], position_x);
+        _mm_storeu_ps(&io_block.position_y[i], position_y);
+        _mm_storeu_ps(&io_block.position_z[i], position_z);
+        _mm_storeu_ps(&io_block.sleep_time[i], _mm_or_ps(_mm_and_ps(is_integrated, sleep_time), _mm_andnot_ps(is_integrated, prev_sleep_time)));
+    }
+
+    // update the game objects
+    for (size_t lane = 0; lane < PHYSICS_WORLD_BLOCK_SIZE; ++lane)
+    {
+        if (io_block.was_integrated[lane])
+        {
+            // remember where the body was, so that rendering can interpolate between the last two steps
+            // a body advanced to an impact already remembers where it started the step
+            engine::gameobject::GameObject* game_object = io_block.game_object[lane];
+            const engine::math::Vec3D previous_position = io_block.impact_time[lane] > 0.0f ? game_object->GetPreviousPosition() : game_object->GetPosition();
+            game_object->SetPosition(engine::math::Vec3D(io_block.position_x[lane], io_block.position_y[lane], io_block.position_z[lane]));
+            game_object->SetPreviousPosition(previous_position);
+            io_block.done_collision_response[lane] = 0;
+        }
+        io_block.impact_time[lane] = 0.0f;
+    }
+}
+
+void PhysicsWorld::ApplyImpulse(PhysicsHandle i_handle, const engine::math::Vec3D& i_impulse)
+{
+    BodyBlock& block = GetBlock(i_handle);
+    const size_t lane = GetLane(i_handle);
+
+    if (block.is_active[lane] == 0 || block.type[lane] == PhysicsObjectType::kPhysicsObjectStatic)
+    {
+        return;
+    }
+
+    // validate input
+    if (i_impulse.IsZero())
+    {
+        return;
+    }
+
+    // start processing
+    block.is_awake[lane] = 1;
+    block.sleep_time[lane] = 0.0f;
+
+    // calculate new velocity
+    const engine::math::Vec3D curr_velocity = GetVelocity(i_handle);
+    const engine::math::Vec3D new_velocity = curr_velocity + (i_impulse * block.inverse_mass[lane]);
+    // limit max velocity
+    SetVelocity(i_handle, new_velocity.LengthSquared() > PhysicsObject::MAX_VELOCITY_LENGTH_SQUARED ? curr_velocity : new_velocity);
+}
+
+void PhysicsWorld::RespondToCollision(PhysicsHandle i_handle, const engine::math::Vec3D& i_collision_normal, bool i_reflect)
+{
+    BodyBlock& block = GetBlock(i_handle);
+    const size_t lane = GetLane(i_handle);
+
+    if (block.done_collision_response[lane])
+    {
+        return;
+    }
+
+    block.done_collision_response[lane] = 1;
+
+    // do simple reflection
+    if (i_reflect)
+    {
+        const engine::math::Vec3D curr_velocity = GetVelocity(i_handle);
+        SetVelocity(i_handle, curr_velocity - (i_collision_normal * engine::math::DotProduct(curr_velocity, i_collision_normal) * 2));
+    }
+}
+
+void PhysicsWorld::AdvanceBody(PhysicsHandle i_handle, float i_time)
+{
+    BodyBlock& block = GetBlock(i_handle);
+    const size_t lane = GetLane(i_handle);
+
+    const bool is_integrated = block.is_simulated[lane] && block.is_active[lane] && block.is_awake[lane] && block.type[lane] != PhysicsObjectType::kPhysicsObjectStatic;
+    if (!is_integrated || i_time <= block.impact_time[lane])
+    {
+        return;
+    }
+
+    // the renderer interpolates from where the body was at the start of the step
+    engine::gameobject::GameObject* game_object = block.game_object[lane];
+    const engine::math::Vec3D start_position = block.impact_time[lane] > 0.0f ? game_object->GetPreviousPosition() : game_object->GetPosition();
+    game_object->SetPosition(game_object->GetPosition() + GetVelocity(i_handle) * (i_time - block.impact_time[lane]));
+    game_object->SetPreviousPosition(start_position);
+
+    block.impact_time[lane] = i_time;
+    block.done_collision_response[lane] = 0;
+}
+
+} // namespace physics
+} // namespace engine
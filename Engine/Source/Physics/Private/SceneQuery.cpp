@@ -0,0 +1,502 @@
+#include "Physics/SceneQuery.h"
+
+// library includes
+#include <float.h>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "GameObject/GameObject.h"
+#include "Math/AABB.h"
+#include "Physics/PhysicsObject.h"
+
+namespace engine {
+namespace physics {
+
+SceneQuery::SceneQuery() : cell_size_(DEFAULT_BROADPHASE_CELL_SIZE),
+    static_bvh_(nullptr),
+    static_objects_(nullptr)
+{
+    Clear();
+}
+
+SceneQuery::~SceneQuery()
+{
+    Clear();
+}
+
+void SceneQuery::Build(const BroadphaseProxy* i_proxies, size_t i_num_proxies, const engine::memory::SharedPointer<PhysicsObject>* i_physics_objects, float i_cell_size,
+    const StaticBVH* i_static_bvh, const engine::memory::WeakPointer<PhysicsObject>* i_static_objects,
+    const BroadphaseProxy* i_sleeping_proxies, const engine::memory::WeakPointer<PhysicsObject>* i_sleeping_objects, size_t i_num_sleeping_proxies)
+{
+    // validate inputs
+    ASSERT(i_proxies || i_num_proxies == 0);
+    ASSERT(i_physics_objects || i_num_proxies == 0);
+    ASSERT(i_cell_size > 0.0f);
+    ASSERT(!i_static_bvh || i_static_objects || i_static_bvh->GetNumProxies() == 0);
+    ASSERT((i_sleeping_proxies && i_sleeping_objects) || i_num_sleeping_proxies == 0);
+
+    Clear();
+    cell_size_ = i_cell_size;
+    static_bvh_ = i_static_bvh;
+    static_objects_ = i_static_objects;
+    objects_.reserve(i_num_proxies + i_num_sleeping_proxies);
+
+    for (size_t i = 0; i < i_num_proxies; ++i)
+    {
+        AddObject(i_proxies[i], i_physics_objects[i_proxies[i].id]);
+    }
+    for (size_t i = 0; i < i_num_sleeping_proxies; ++i)
+    {
+        AddObject(i_sleeping_proxies[i], i_sleeping_objects[i_sleeping_proxies[i].id]);
+    }
+
+    std::sort(entries_.begin(), entries_.end(), [](const GridEntry& i_lhs, const GridEntry& i_rhs) {
+        return i_lhs.cell < i_rhs.cell || (i_lhs.cell == i_rhs.cell && i_lhs.object < i_rhs.object);
+    });
+}
+
+void SceneQuery::AddObject(const BroadphaseProxy& i_proxy, const engine::memory::WeakPointer<PhysicsObject>& i_physics_object)
+{
+    const uint32_t index = static_cast<uint32_t>(objects_.size());
+    objects_.push_back(QueryObject());
+    QueryObject& object = objects_.back();
+    object.min_x = i_proxy.min_x;
+    object.min_y = i_proxy.min_y;
+    object.max_x = i_proxy.max_x;
+    object.max_y = i_proxy.max_y;
+    object.category = i_proxy.collision_filter.category;
+    object.physics_object = i_physics_object;
+
+    // objects without a category can't be found
+    if (object.category == 0)
+    {
+        return;
+    }
+
+    // bucket the object into every cell it covers
+    const int32_t min_x = GetCellCoordinate(i_proxy.min_x);
+    const int32_t min_y = GetCellCoordinate(i_proxy.min_y);
+    const int32_t max_x = GetCellCoordinate(i_proxy.max_x);
+    const int32_t max_y = GetCellCoordinate(i_proxy.max_y);
+
+    if (int64_t(max_x - min_x + 1) * int64_t(max_y - min_y + 1) > BROADPHASE_GRID_MAX_CELLS_PER_PROXY)
+    {
+        large_objects_.push_back(index);
+        return;
+    }
+
+    for (int32_t x = min_x; x <= max_x; ++x)
+    {
+        for (int32_t y = min_y; y <= max_y; ++y)
+        {
+            entries_.push_back({ GetCellKey(x, y), index });
+        }
+    }
+
+    min_cell_x_ = min_x < min_cell_x_ ? min_x : min_cell_x_;
+    min_cell_y_ = min_y < min_cell_y_ ? min_y : min_cell_y_;
+    max_cell_x_ = max_x > max_cell_x_ ? max_x : max_cell_x_;
+    max_cell_y_ = max_y > max_cell_y_ ? max_y : max_cell_y_;
+}
+
+void SceneQuery::Clear()
+{
+    objects_.clear();
+    entries_.clear();
+    large_objects_.clear();
+    min_cell_x_ = INT32_MAX;
+    min_cell_y_ = INT32_MAX;
+    max_cell_x_ = INT32_MIN;
+    max_cell_y_ = INT32_MIN;
+    static_bvh_ = nullptr;
+    static_objects_ = nullptr;
+}
+
+bool SceneQuery::Raycast(const RaycastQuery& i_query, SceneQueryHit& o_hit) const
+{
+    // validate inputs
+    const float length = sqrtf(i_query.direction.x() * i_query.direction.x() + i_query.direction.y() * i_query.direction.y());
+    ASSERT(length > 0.0f);
+    ASSERT(i_query.max_distance >= 0.0f);
+
+    const float origin_x = i_query.origin.x();
+    const float origin_y = i_query.origin.y();
+    const float direction_x = i_query.direction.x() / length;
+    const float direction_y = i_query.direction.y() / length;
+
+    bool has_hit = false;
+    float distance = i_query.max_distance;
+
+    for (const uint32_t object : large_objects_)
+    {
+        if (IsInMask(objects_[object], i_query.mask))
+        {
+            RaycastObject(objects_[object], origin_x, origin_y, direction_x, direction_y, distance, o_hit, has_hit);
+        }
+    }
+
+    if (static_bvh_)
+    {
+        static_bvh_->Raycast(origin_x, origin_y, direction_x, direction_y, distance, [&](const BroadphaseProxy& i_proxy) {
+            const QueryObject object = GetStaticObject(i_proxy);
+            if (IsInMask(object, i_query.mask))
+            {
+                RaycastObject(object, origin_x, origin_y, direction_x, direction_y, distance, o_hit, has_hit);
+            }
+            return distance;
+        });
+    }
+
+    if (entries_.empty())
+    {
+        return has_hit;
+    }
+
+    // clip the ray to the cells the grid covers
+    float t_begin = 0.0f;
+    float t_end = distance;
+    const float grid_min[2] = { float(min_cell_x_) * cell_size_, float(min_cell_y_) * cell_size_ };
+    const float grid_max[2] = { float(max_cell_x_ + 1) * cell_size_, float(max_cell_y_ + 1) * cell_size_ };
+    const float origin[2] = { origin_x, origin_y };
+    const float direction[2] = { direction_x, direction_y };
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        if (direction[axis] == 0.0f)
+        {
+            if (origin[axis] < grid_min[axis] || origin[axis] > grid_max[axis])
+            {
+                return has_hit;
+            }
+            continue;
+        }
+
+        const float t_0 = (grid_min[axis] - origin[axis]) / direction[axis];
+        const float t_1 = (grid_max[axis] - origin[axis]) / direction[axis];
+        t_begin = std::max(t_begin, std::min(t_0, t_1));
+        t_end = std::min(t_end, std::max(t_0, t_1));
+    }
+    if (t_begin > t_end)
+    {
+        return has_hit;
+    }
+
+    // walk the cells the ray passes through in order, until the next cell is further than the closest hit
+    int32_t x = std::min(std::max(GetCellCoordinate(origin_x + direction_x * t_begin), min_cell_x_), max_cell_x_);
+    int32_t y = std::min(std::max(GetCellCoordinate(origin_y + direction_y * t_begin), min_cell_y_), max_cell_y_);
+    const int32_t step_x = direction_x > 0.0f ? 1 : -1;
+    const int32_t step_y = direction_y > 0.0f ? 1 : -1;
+    const float t_delta_x = direction_x != 0.0f ? cell_size_ / fabsf(direction_x) : FLT_MAX;
+    const float t_delta_y = direction_y != 0.0f ? cell_size_ / fabsf(direction_y) : FLT_MAX;
+    float t_next_x = direction_x != 0.0f ? (float(x + (step_x > 0 ? 1 : 0)) * cell_size_ - origin_x) / direction_x : FLT_MAX;
+    float t_next_y = direction_y != 0.0f ? (float(y + (step_y > 0 ? 1 : 0)) * cell_size_ - origin_y) / direction_y : FLT_MAX;
+
+    float t_cell = t_begin;
+    while (t_cell <= distance && t_cell <= t_end &&
+        x >= min_cell_x_ && x <= max_cell_x_ && y >= min_cell_y_ && y <= max_cell_y_)
+    {
+        const GridEntry* begin = nullptr;
+        const GridEntry* end = nullptr;
+        GetCellEntries(x, y, begin, end);
+        for (const GridEntry* entry = begin; entry != end; ++entry)
+        {
+            if (IsInMask(objects_[entry->object], i_query.mask))
+            {
+                RaycastObject(objects_[entry->object], origin_x, origin_y, direction_x, direction_y, distance, o_hit, has_hit);
+            }
+        }
+
+        if (t_next_x < t_next_y)
+        {
+            t_cell = t_next_x;
+            t_next_x += t_delta_x;
+            x += step_x;
+        }
+        else
+        {
+            t_cell = t_next_y;
+            t_next_y += t_delta_y;
+            y += step_y;
+        }
+    }
+
+    return has_hit;
+}
+
+void SceneQuery::OverlapAABB(const engine::math::AABB& i_aabb, uint16_t i_mask, std::vector<engine::memory::WeakPointer<PhysicsObject>>& o_objects) const
+{
+    const float min_x = i_aabb.center.x() - i_aabb.extents.x();
+    const float min_y = i_aabb.center.y() - i_aabb.extents.y();
+    const float max_x = i_aabb.center.x() + i_aabb.extents.x();
+    const float max_y = i_aabb.center.y() + i_aabb.extents.y();
+
+    // objects are tested with the bounds they have now
+    const auto add_if_overlapping = [min_x, min_y, max_x, max_y, &o_objects](const QueryObject& i_object) {
+        float object_min_x, object_min_y, object_max_x, object_max_y;
+        if (GetBounds(i_object, object_min_x, object_min_y, object_max_x, object_max_y) &&
+            object_min_x <= max_x && min_x <= object_max_x && object_min_y <= max_y && min_y <= object_max_y)
+        {
+            o_objects.push_back(i_object.physics_object);
+        }
+    };
+
+    for (const uint32_t object : large_objects_)
+    {
+        if (IsInMask(objects_[object], i_mask))
+        {
+            add_if_overlapping(objects_[object]);
+        }
+    }
+
+    if (static_bvh_)
+    {
+        static_bvh_->Query(min_x, min_y, max_x, max_y, [&](const BroadphaseProxy& i_proxy) {
+            const QueryObject object = GetStaticObject(i_proxy);
+            if (IsInMask(object, i_mask))
+            {
+                add_if_overlapping(object);
+            }
+        });
+    }
+
+    const int32_t begin_x = std::max(GetCellCoordinate(min_x), min_cell_x_);
+    const int32_t begin_y = std::max(GetCellCoordinate(min_y), min_cell_y_);
+    const int32_t end_x = std::min(GetCellCoordinate(max_x), max_cell_x_);
+    const int32_t end_y = std::min(GetCellCoordinate(max_y), max_cell_y_);
+    if (begin_x > end_x || begin_y > end_y)
+    {
+        return;
+    }
+
+    for (int32_t x = begin_x; x <= end_x; ++x)
+    {
+        for (int32_t y = begin_y; y <= end_y; ++y)
+        {
+            const GridEntry* begin = nullptr;
+            const GridEntry* end = nullptr;
+            GetCellEntries(x, y, begin, end);
+            for (const GridEntry* entry = begin; entry != end; ++entry)
+            {
+                const QueryObject& object = objects_[entry->object];
+                if (!IsInMask(object, i_mask) ||
+                    object.min_x > max_x || min_x > object.max_x || object.min_y > max_y || min_y > object.max_y)
+                {
+                    continue;
+                }
+
+                // an object can be in several cells, only the cell holding the corner of its overlap with the box reports it
+                const float corner_x = object.min_x > min_x ? object.min_x : min_x;
+                const float corner_y = object.min_y > min_y ? object.min_y : min_y;
+                if (GetCellCoordinate(corner_x) == x && GetCellCoordinate(corner_y) == y)
+                {
+                    add_if_overlapping(object);
+                }
+            }
+        }
+    }
+}
+
+bool SceneQuery::QueryNearest(const NearestQuery& i_query, SceneQueryHit& o_hit) const
+{
+    // validate inputs
+    ASSERT(i_query.max_distance >= 0.0f);
+
+    const float point_x = i_query.point.x();
+    const float point_y = i_query.point.y();
+
+    bool has_hit = false;
+    float distance = i_query.max_distance;
+
+    for (const uint32_t object : large_objects_)
+    {
+        if (IsInMask(objects_[object], i_query.mask))
+        {
+            TestNearestObject(objects_[object], point_x, point_y, distance, o_hit, has_hit);
+        }
+    }
+
+    if (static_bvh_)
+    {
+        static_bvh_->QueryNearest(point_x, point_y, distance, [&](const BroadphaseProxy& i_proxy) {
+            const QueryObject object = GetStaticObject(i_proxy);
+            if (IsInMask(object, i_query.mask))
+            {
+                TestNearestObject(object, point_x, point_y, distance, o_hit, has_hit);
+            }
+            return distance;
+        });
+    }
+
+    if (entries_.empty())
+    {
+        return has_hit;
+    }
+
+    // search rings of cells around the point's cell, until a whole ring is further than the closest object found
+    const int32_t center_x = GetCellCoordinate(point_x);
+    const int32_t center_y = GetCellCoordinate(point_y);
+    const int32_t max_ring = std::max(std::max(center_x - min_cell_x_, max_cell_x_ - center_x), std::max(center_y - min_cell_y_, max_cell_y_ - center_y));
+
+    const auto test_cell = [&](int32_t i_x, int32_t i_y) {
+        if (i_x < min_cell_x_ || i_x > max_cell_x_ || i_y < min_cell_y_ || i_y > max_cell_y_)
+        {
+            return;
+        }
+
+        const GridEntry* begin = nullptr;
+        const GridEntry* end = nullptr;
+        GetCellEntries(i_x, i_y, begin, end);
+        for (const GridEntry* entry = begin; entry != end; ++entry)
+        {
+            if (IsInMask(objects_[entry->object], i_query.mask))
+            {
+                TestNearestObject(objects_[entry->object], point_x, point_y, distance, o_hit, has_hit);
+            }
+        }
+    };
+
+    for (int32_t ring = 0; ring <= max_ring; ++ring)
+    {
+        if (ring > 0)
+        {
+            // the cells inside the ring contain the point, so the ring is at least as far as their closest edge
+            const float ring_distance = std::min(std::min(point_x - float(center_x - ring + 1) * cell_size_, float(center_x + ring) * cell_size_ - point_x),
+                std::min(point_y - float(center_y - ring + 1) * cell_size_, float(center_y + ring) * cell_size_ - point_y));
+            if (ring_distance > distance)
+            {
+                break;
+            }
+        }
+
+        for (int32_t x = center_x - ring; x <= center_x + ring; ++x)
+        {
+            test_cell(x, center_y - ring);
+            if (ring > 0)
+            {
+                test_cell(x, center_y + ring);
+            }
+        }
+        for (int32_t y = center_y - ring + 1; y <= center_y + ring - 1; ++y)
+        {
+            test_cell(center_x - ring, y);
+            test_cell(center_x + ring, y);
+        }
+    }
+
+    return has_hit;
+}
+
+bool SceneQuery::GetBounds(const QueryObject& i_object, float& o_min_x, float& o_min_y, float& o_max_x, float& o_max_y)
+{
+    const engine::memory::SharedPointer<PhysicsObject> physics_object = i_object.physics_object.Lock();
+    if (!physics_object)
+    {
+        return false;
+    }
+    const engine::memory::SharedPointer<engine::gameobject::GameObject> game_object = physics_object->GetGameObject().Lock();
+    if (!game_object)
+    {
+        return false;
+    }
+
+    const engine::math::AABB& aabb = game_object->GetAABB();
+    const engine::math::Vec3D& position = game_object->GetPosition();
+
+    // objects only rotate about Z
+    const float rotation = game_object->GetRotation().z();
+    const float cos_rotation = cosf(rotation);
+    const float sin_rotation = sinf(rotation);
+
+    // transform the box to world space
+    const float center_x = position.x() + aabb.center.x() * cos_rotation - aabb.center.y() * sin_rotation;
+    const float center_y = position.y() + aabb.center.x() * sin_rotation + aabb.center.y() * cos_rotation;
+    const float extents_x = fabs(cos_rotation) * aabb.extents.x() + fabs(sin_rotation) * aabb.extents.y();
+    const float extents_y = fabs(sin_rotation) * aabb.extents.x() + fabs(cos_rotation) * aabb.extents.y();
+
+    o_min_x = center_x - extents_x;
+    o_min_y = center_y - extents_y;
+    o_max_x = center_x + extents_x;
+    o_max_y = center_y + extents_y;
+    return true;
+}
+
+void SceneQuery::RaycastObject(const QueryObject& i_object, float i_origin_x, float i_origin_y, float i_direction_x, float i_direction_y, float& io_distance, SceneQueryHit& o_hit, bool& o_has_hit) const
+{
+    float bounds_min[2], bounds_max[2];
+    if (!GetBounds(i_object, bounds_min[0], bounds_min[1], bounds_max[0], bounds_max[1]))
+    {
+        return;
+    }
+
+    // rays that start inside an object don't hit it, so a ray cast from an object doesn't hit the object itself
+    const float origin[2] = { i_origin_x, i_origin_y };
+    const float direction[2] = { i_direction_x, i_direction_y };
+    if (origin[0] >= bounds_min[0] && origin[0] <= bounds_max[0] && origin[1] >= bounds_min[1] && origin[1] <= bounds_max[1])
+    {
+        return;
+    }
+
+    // the ray is inside the box between the time it is inside both slabs & the time it leaves either of them
+    float t_enter = 0.0f;
+    float t_exit = io_distance;
+    int enter_axis = -1;
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        if (direction[axis] == 0.0f)
+        {
+            if (origin[axis] < bounds_min[axis] || origin[axis] > bounds_max[axis])
+            {
+                return;
+            }
+            continue;
+        }
+
+        const float t_0 = (bounds_min[axis] - origin[axis]) / direction[axis];
+        const float t_1 = (bounds_max[axis] - origin[axis]) / direction[axis];
+        const float t_near = std::min(t_0, t_1);
+        if (t_near > t_enter)
+        {
+            t_enter = t_near;
+            enter_axis = axis;
+        }
+        t_exit = std::min(t_exit, std::max(t_0, t_1));
+    }
+
+    if (enter_axis < 0 || t_enter > t_exit || (o_has_hit && t_enter >= io_distance))
+    {
+        return;
+    }
+
+    io_distance = t_enter;
+    o_has_hit = true;
+    o_hit.object = i_object.physics_object;
+    o_hit.point = engine::math::Vec3D(i_origin_x + i_direction_x * t_enter, i_origin_y + i_direction_y * t_enter, 0.0f);
+    o_hit.normal = enter_axis == 0 ? engine::math::Vec3D(i_direction_x > 0.0f ? -1.0f : 1.0f, 0.0f, 0.0f) : engine::math::Vec3D(0.0f, i_direction_y > 0.0f ? -1.0f : 1.0f, 0.0f);
+    o_hit.distance = t_enter;
+}
+
+void SceneQuery::TestNearestObject(const QueryObject& i_object, float i_x, float i_y, float& io_distance, SceneQueryHit& o_hit, bool& o_has_hit) const
+{
+    float min_x, min_y, max_x, max_y;
+    if (!GetBounds(i_object, min_x, min_y, max_x, max_y))
+    {
+        return;
+    }
+
+    const float closest_x = std::min(std::max(i_x, min_x), max_x);
+    const float closest_y = std::min(std::max(i_y, min_y), max_y);
+    const float distance = sqrtf((closest_x - i_x) * (closest_x - i_x) + (closest_y - i_y) * (closest_y - i_y));
+    if (distance > io_distance || (o_has_hit && distance >= io_distance))
+    {
+        return;
+    }
+
+    io_distance = distance;
+    o_has_hit = true;
+    o_hit.object = i_object.physics_object;
+    o_hit.point = engine::math::Vec3D(closest_x, closest_y, 0.0f);
+    o_hit.normal = engine::math::Vec3D::ZERO;
+    o_hit.distance = distance;
+}
+
+} // namespace physics
+} // namespace engine
@@ -0,0 +1,154 @@
+#include "Physics/SeparatingAxisBatch.h"
+
+// library includes
+#include <float.h>
+#include <immintrin.h>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Math/MathUtil.h"
+
+namespace engine {
+namespace physics {
+
+SeparatingAxisBatch::SeparatingAxisBatch() : num_pairs_(0),
+    stride_(0)
+{}
+
+SeparatingAxisBatch::~SeparatingAxisBatch()
+{}
+
+void SeparatingAxisBatch::Reset(size_t i_num_pairs)
+{
+    num_pairs_ = i_num_pairs;
+    stride_ = (i_num_pairs + SEPARATING_AXIS_BATCH_WIDTH - 1) / SEPARATING_AXIS_BATCH_WIDTH * SEPARATING_AXIS_BATCH_WIDTH;
+
+    data_.assign((kNumFields * static_cast<size_t>(SeparatingAxis::Count) + 1) * stride_, 0.0f);
+    is_colliding_.assign(stride_, 0);
+
+    // the pairs padding the last batch are stationary boxes that are far apart, so they never collide
+    for (uint8_t axis = 0; axis < static_cast<uint8_t>(SeparatingAxis::Count); ++axis)
+    {
+        float* other_centers = GetField(kOtherCenter, static_cast<SeparatingAxis>(axis));
+        for (size_t i = num_pairs_; i < stride_; ++i)
+        {
+            other_centers[i] = 1.0f;
+        }
+    }
+}
+
+void SeparatingAxisBatch::Run(float i_dt, size_t i_first_pair, size_t i_num_pairs)
+{
+    // validate inputs
+    ASSERT(i_first_pair % SEPARATING_AXIS_BATCH_WIDTH == 0);
+    ASSERT(i_first_pair + i_num_pairs <= num_pairs_);
+
+    // the last range also covers the padding
+    const size_t end_pair = (i_first_pair + i_num_pairs + SEPARATING_AXIS_BATCH_WIDTH - 1) / SEPARATING_AXIS_BATCH_WIDTH * SEPARATING_AXIS_BATCH_WIDTH;
+    float* const latest_close_times = data_.data() + kNumFields * static_cast<size_t>(SeparatingAxis::Count) * stride_;
+
+#ifdef __AVX2__
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 dt = _mm256_set1_ps(i_dt);
+    const __m256 epsilon = _mm256_set1_ps(MAX_EPSILON);
+    const __m256 never = _mm256_set1_ps(FLT_MAX);
+    const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+#else
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 dt = _mm_set1_ps(i_dt);
+    const __m128 epsilon = _mm_set1_ps(MAX_EPSILON);
+    const __m128 never = _mm_set1_ps(FLT_MAX);
+    const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+#endif
+
+    for (size_t i = i_first_pair; i < end_pair; i += SEPARATING_AXIS_BATCH_WIDTH)
+    {
+#ifdef __AVX2__
+        __m256 is_separated = zero;
+        __m256 close_times[static_cast<size_t>(SeparatingAxis::Count)];
+        __m256 open_times[static_cast<size_t>(SeparatingAxis::Count)];
+
+        for (uint8_t axis = 0; axis < static_cast<uint8_t>(SeparatingAxis::Count); ++axis)
+        {
+            const SeparatingAxis separating_axis = static_cast<SeparatingAxis>(axis);
+            const __m256 velocity = _mm256_loadu_ps(GetField(kRelativeVelocity, separating_axis) + i);
+            const __m256 center = _mm256_loadu_ps(GetField(kCenter, separating_axis) + i);
+            const __m256 extents = _mm256_loadu_ps(GetField(kExtents, separating_axis) + i);
+            const __m256 other_center = _mm256_loadu_ps(GetField(kOtherCenter, separating_axis) + i);
+            const __m256 other_extents = _mm256_loadu_ps(GetField(kOtherExtents, separating_axis) + i);
+
+            // separation check without velocities
+            const __m256 is_stationary = _mm256_cmp_ps(_mm256_and_ps(_mm256_sub_ps(zero, velocity), abs_mask), epsilon, _CMP_LT_OQ);
+            const __m256 is_apart = _mm256_cmp_ps(_mm256_and_ps(_mm256_sub_ps(center, other_center), abs_mask), _mm256_add_ps(extents, other_extents), _CMP_GT_OQ);
+
+            // separation close and open times, ordered so that close comes first
+            const __m256 t_close = _mm256_div_ps(_mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(center, extents), other_center), other_extents), velocity);
+            const __m256 t_open = _mm256_div_ps(_mm256_add_ps(_mm256_sub_ps(_mm256_add_ps(center, extents), other_center), other_extents), velocity);
+            const __m256 t_close_sorted = _mm256_min_ps(t_open, t_close);
+            const __m256 t_open_sorted = _mm256_max_ps(t_close, t_open);
+            const __m256 is_separated_in_time = _mm256_or_ps(_mm256_cmp_ps(t_open_sorted, zero, _CMP_LT_OQ), _mm256_cmp_ps(t_close_sorted, dt, _CMP_GT_OQ));
+
+            // stationary axes close right away & never open
+            is_separated = _mm256_or_ps(is_separated, _mm256_blendv_ps(is_separated_in_time, is_apart, is_stationary));
+            close_times[axis] = _mm256_andnot_ps(is_stationary, t_close_sorted);
+            open_times[axis] = _mm256_blendv_ps(t_open_sorted, never, is_stationary);
+            _mm256_storeu_ps(GetField(kCloseTime, separating_axis) + i, close_times[axis]);
+        }
+
+        // find the latest t_close and the earliest t_open
+        const __m256 t_close_latest = _mm256_max_ps(_mm256_max_ps(close_times[0], close_times[1]), _mm256_max_ps(close_times[2], close_times[3]));
+        const __m256 t_open_earliest = _mm256_min_ps(_mm256_min_ps(open_times[0], open_times[1]), _mm256_min_ps(open_times[2], open_times[3]));
+        _mm256_storeu_ps(latest_close_times + i, t_close_latest);
+
+        // if the latest t_close was after the earliest t_open, there was continuity of separation
+        const int is_missed = _mm256_movemask_ps(_mm256_or_ps(is_separated, _mm256_cmp_ps(t_close_latest, t_open_earliest, _CMP_GT_OQ)));
+#else
+        __m128 is_separated = zero;
+        __m128 close_times[static_cast<size_t>(SeparatingAxis::Count)];
+        __m128 open_times[static_cast<size_t>(SeparatingAxis::Count)];
+
+        for (uint8_t axis = 0; axis < static_cast<uint8_t>(SeparatingAxis::Count); ++axis)
+        {
+            const SeparatingAxis separating_axis = static_cast<SeparatingAxis>(axis);
+            const __m128 velocity = _mm_loadu_ps(GetField(kRelativeVelocity, separating_axis) + i);
+            const __m128 center = _mm_loadu_ps(GetField(kCenter, separating_axis) + i);
+            const __m128 extents = _mm_loadu_ps(GetField(kExtents, separating_axis) + i);
+            const __m128 other_center = _mm_loadu_ps(GetField(kOtherCenter, separating_axis) + i);
+            const __m128 other_extents = _mm_loadu_ps(GetField(kOtherExtents, separating_axis) + i);
+
+            // separation check without velocities
+            const __m128 is_stationary = _mm_cmplt_ps(_mm_and_ps(_mm_sub_ps(zero, velocity), abs_mask), epsilon);
+            const __m128 is_apart = _mm_cmpgt_ps(_mm_and_ps(_mm_sub_ps(center, other_center), abs_mask), _mm_add_ps(extents, other_extents));
+
+            // separation close and open times, ordered so that close comes first
+            const __m128 t_close = _mm_div_ps(_mm_sub_ps(_mm_sub_ps(_mm_sub_ps(center, extents), other_center), other_extents), velocity);
+            const __m128 t_open = _mm_div_ps(_mm_add_ps(_mm_sub_ps(_mm_add_ps(center, extents), other_center), other_extents), velocity);
+            const __m128 t_close_sorted = _mm_min_ps(t_open, t_close);
+            const __m128 t_open_sorted = _mm_max_ps(t_close, t_open);
+            const __m128 is_separated_in_time = _mm_or_ps(_mm_cmplt_ps(t_open_sorted, zero), _mm_cmpgt_ps(t_close_sorted, dt));
+
+            // stationary axes close right away & never open
+            is_separated = _mm_or_ps(is_separated, _mm_or_ps(_mm_and_ps(is_stationary, is_apart), _mm_andnot_ps(is_stationary, is_separated_in_time)));
+            close_times[axis] = _mm_andnot_ps(is_stationary, t_close_sorted);
+            open_times[axis] = _mm_or_ps(_mm_and_ps(is_stationary, never), _mm_andnot_ps(is_stationary, t_open_sorted));
+            _mm_storeu_ps(GetField(kCloseTime, separating_axis) + i, close_times[axis]);
+        }
+
+        // find the latest t_close and the earliest t_open
+        const __m128 t_close_latest = _mm_max_ps(_mm_max_ps(close_times[0], close_times[1]), _mm_max_ps(close_times[2], close_times[3]));
+        const __m128 t_open_earliest = _mm_min_ps(_mm_min_ps(open_times[0], open_times[1]), _mm_min_ps(open_times[2], open_times[3]));
+        _mm_storeu_ps(latest_close_times + i, t_close_latest);
+
+        // if the latest t_close was after the earliest t_open, there was continuity of separation
+        const int is_missed = _mm_movemask_ps(_mm_or_ps(is_separated, _mm_cmpgt_ps(t_close_latest, t_open_earliest)));
+#endif
+
+        for (uint8_t lane = 0; lane < SEPARATING_AXIS_BATCH_WIDTH; ++lane)
+        {
+            is_colliding_[i + lane] = (is_missed & (1 << lane)) == 0;
+        }
+    }
+}
+
+} // namespace physics
+} // namespace engine
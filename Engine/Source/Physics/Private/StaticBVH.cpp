@@ -0,0 +1,223 @@
+#include "Physics/StaticBVH.h"
+
+// library includes
+#include <algorithm>
+#include <string.h>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Memory/AllocatorOverrides.h"
+
+namespace engine {
+namespace physics {
+
+StaticBVH::StaticBVH() : nodes_(nullptr),
+    num_nodes_(0)
+{}
+
+StaticBVH::~StaticBVH()
+{
+    Clear();
+}
+
+void StaticBVH::Build(const BroadphaseProxy* i_proxies, size_t i_num_proxies)
+{
+    // validate inputs
+    ASSERT(i_proxies || i_num_proxies == 0);
+    ASSERT(i_num_proxies < STATIC_BVH_NULL_CHILD);
+
+    Clear();
+    if (i_num_proxies == 0)
+    {
+        return;
+    }
+
+    proxies_.assign(i_proxies, i_proxies + i_num_proxies);
+
+    // the root always exists, so even a single leaf is found through a node
+    engine::memory::FrameVector<Node> nodes;
+    nodes.reserve(i_num_proxies / STATIC_BVH_MAX_LEAF_PROXIES * 2 + 1);
+    nodes.push_back(Node());
+    nodes[0].children[1] = STATIC_BVH_NULL_CHILD;
+    nodes[0].counts[1] = 0;
+
+    if (i_num_proxies <= STATIC_BVH_MAX_LEAF_PROXIES)
+    {
+        BuildChild(nodes, 0, 0, 0, static_cast<uint32_t>(i_num_proxies), 1);
+    }
+    else
+    {
+        const uint32_t split = SplitProxies(0, static_cast<uint32_t>(i_num_proxies), 0);
+        BuildChild(nodes, 0, 0, 0, split, 1);
+        BuildChild(nodes, 0, 1, split, static_cast<uint32_t>(i_num_proxies), 1);
+    }
+
+    // the nodes only change during the build, so they're moved into an array aligned to a cache line once they're done
+    num_nodes_ = nodes.size();
+    nodes_ = static_cast<Node*>(::operator new(num_nodes_ * sizeof(Node), engine::memory::ALIGNMENT_64));
+    memcpy(nodes_, nodes.data(), num_nodes_ * sizeof(Node));
+}
+
+void StaticBVH::Clear()
+{
+    if (nodes_)
+    {
+        ::operator delete(nodes_, engine::memory::ALIGNMENT_64);
+        nodes_ = nullptr;
+    }
+    num_nodes_ = 0;
+    proxies_.clear();
+}
+
+void StaticBVH::BuildChild(engine::memory::FrameVector<Node>& io_nodes, uint32_t i_parent, uint8_t i_child, uint32_t i_begin, uint32_t i_end, uint32_t i_depth)
+{
+    ASSERT(i_begin < i_end);
+
+    // the child's bounds
+    float min_x = FLT_MAX, min_y = FLT_MAX, max_x = -FLT_MAX, max_y = -FLT_MAX;
+    for (uint32_t i = i_begin; i < i_end; ++i)
+    {
+        min_x = std::min(min_x, proxies_[i].min_x);
+        min_y = std::min(min_y, proxies_[i].min_y);
+        max_x = std::max(max_x, proxies_[i].max_x);
+        max_y = std::max(max_y, proxies_[i].max_y);
+    }
+
+    Node& parent = io_nodes[i_parent];
+    parent.min_x[i_child] = min_x;
+    parent.min_y[i_child] = min_y;
+    parent.max_x[i_child] = max_x;
+    parent.max_y[i_child] = max_y;
+
+    if (i_end - i_begin <= STATIC_BVH_MAX_LEAF_PROXIES)
+    {
+        parent.children[i_child] = i_begin;
+        parent.counts[i_child] = i_end - i_begin;
+        return;
+    }
+
+    const uint32_t node = static_cast<uint32_t>(io_nodes.size());
+    parent.children[i_child] = node;
+    parent.counts[i_child] = 0;
+    io_nodes.push_back(Node());
+
+    const uint32_t split = SplitProxies(i_begin, i_end, i_depth);
+    BuildChild(io_nodes, node, 0, i_begin, split, i_depth + 1);
+    BuildChild(io_nodes, node, 1, split, i_end, i_depth + 1);
+}
+
+uint32_t StaticBVH::SplitProxies(uint32_t i_begin, uint32_t i_end, uint32_t i_depth)
+{
+    const auto get_center = [](const BroadphaseProxy& i_proxy, int i_axis) {
+        return i_axis == 0 ? i_proxy.min_x + i_proxy.max_x : i_proxy.min_y + i_proxy.max_y;
+    };
+
+    // the range the proxies' centers cover, proxies are binned by center
+    float center_min[2] = { FLT_MAX, FLT_MAX };
+    float center_max[2] = { -FLT_MAX, -FLT_MAX };
+    for (uint32_t i = i_begin; i < i_end; ++i)
+    {
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            center_min[axis] = std::min(center_min[axis], get_center(proxies_[i], axis));
+            center_max[axis] = std::max(center_max[axis], get_center(proxies_[i], axis));
+        }
+    }
+
+    int best_axis = -1;
+    uint32_t best_bin = 0;
+    float best_cost = FLT_MAX;
+
+    if (i_depth < STATIC_BVH_MAX_DEPTH)
+    {
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            const float extent = center_max[axis] - center_min[axis];
+            if (extent <= 0.0f)
+            {
+                continue;
+            }
+
+            struct Bin
+            {
+                float min_x, min_y, max_x, max_y;
+                uint32_t count;
+            };
+            Bin bins[STATIC_BVH_NUM_BINS];
+            for (Bin& bin : bins)
+            {
+                bin = { FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX, 0 };
+            }
+
+            const float scale = float(STATIC_BVH_NUM_BINS) / extent;
+            for (uint32_t i = i_begin; i < i_end; ++i)
+            {
+                const BroadphaseProxy& proxy = proxies_[i];
+                const uint32_t index = std::min(uint32_t((get_center(proxy, axis) - center_min[axis]) * scale), uint32_t(STATIC_BVH_NUM_BINS - 1));
+                Bin& bin = bins[index];
+                bin.min_x = std::min(bin.min_x, proxy.min_x);
+                bin.min_y = std::min(bin.min_y, proxy.min_y);
+                bin.max_x = std::max(bin.max_x, proxy.max_x);
+                bin.max_y = std::max(bin.max_y, proxy.max_y);
+                ++bin.count;
+            }
+
+            // sweep from the right to find the cost of every right side, then from the left to price every split
+            float right_costs[STATIC_BVH_NUM_BINS];
+            Bin right = { FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX, 0 };
+            for (uint32_t i = STATIC_BVH_NUM_BINS - 1; i > 0; --i)
+            {
+                right.min_x = std::min(right.min_x, bins[i].min_x);
+                right.min_y = std::min(right.min_y, bins[i].min_y);
+                right.max_x = std::max(right.max_x, bins[i].max_x);
+                right.max_y = std::max(right.max_y, bins[i].max_y);
+                right.count += bins[i].count;
+                right_costs[i] = right.count == 0 ? 0.0f : float(right.count) * ((right.max_x - right.min_x) + (right.max_y - right.min_y));
+            }
+
+            Bin left = { FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX, 0 };
+            for (uint32_t i = 0; i < STATIC_BVH_NUM_BINS - 1; ++i)
+            {
+                left.min_x = std::min(left.min_x, bins[i].min_x);
+                left.min_y = std::min(left.min_y, bins[i].min_y);
+                left.max_x = std::max(left.max_x, bins[i].max_x);
+                left.max_y = std::max(left.max_y, bins[i].max_y);
+                left.count += bins[i].count;
+                if (left.count == 0 || left.count == i_end - i_begin)
+                {
+                    continue;
+                }
+
+                const float cost = float(left.count) * ((left.max_x - left.min_x) + (left.max_y - left.min_y)) + right_costs[i + 1];
+                if (cost < best_cost)
+                {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_bin = i + 1;
+                }
+            }
+        }
+    }
+
+    if (best_axis >= 0)
+    {
+        // everything in the bins before the split goes to the first child
+        const float min_center = center_min[best_axis];
+        const float scale = float(STATIC_BVH_NUM_BINS) / (center_max[best_axis] - min_center);
+        const BroadphaseProxy* split = std::partition(proxies_.data() + i_begin, proxies_.data() + i_end, [&](const BroadphaseProxy& i_proxy) {
+            return std::min(uint32_t((get_center(i_proxy, best_axis) - min_center) * scale), uint32_t(STATIC_BVH_NUM_BINS - 1)) < best_bin;
+        });
+        return static_cast<uint32_t>(split - proxies_.data());
+    }
+
+    // the centers are all in the same place or the tree is already deep, so split the longer axis at the median
+    const int axis = center_max[0] - center_min[0] >= center_max[1] - center_min[1] ? 0 : 1;
+    const uint32_t middle = i_begin + (i_end - i_begin) / 2;
+    std::nth_element(proxies_.begin() + i_begin, proxies_.begin() + middle, proxies_.begin() + i_end, [&get_center, axis](const BroadphaseProxy& i_lhs, const BroadphaseProxy& i_rhs) {
+        return get_center(i_lhs, axis) < get_center(i_rhs, axis);
+    });
+    return middle;
+}
+
+} // namespace physics
+} // namespace engine
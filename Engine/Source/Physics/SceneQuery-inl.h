@@ -0,0 +1,46 @@
+#include "SceneQuery.h"
+
+// library includes
+#include <algorithm>
+#include <math.h>
+
+namespace engine {
+namespace physics {
+
+inline size_t SceneQuery::GetNumObjects() const
+{
+    return objects_.size() + (static_bvh_ ? static_bvh_->GetNumProxies() : 0);
+}
+
+inline void SceneQuery::GetCellEntries(int32_t i_x, int32_t i_y, const GridEntry*& o_begin, const GridEntry*& o_end) const
+{
+    const uint64_t cell = GetCellKey(i_x, i_y);
+    const GridEntry* entries = entries_.data();
+    o_begin = std::lower_bound(entries, entries + entries_.size(), cell, [](const GridEntry& i_entry, uint64_t i_cell) {
+        return i_entry.cell < i_cell;
+    });
+    for (o_end = o_begin; o_end != entries + entries_.size() && o_end->cell == cell; ++o_end);
+}
+
+inline bool SceneQuery::IsInMask(const QueryObject& i_object, uint16_t i_mask)
+{
+    return (i_object.category & i_mask) != 0;
+}
+
+inline SceneQuery::QueryObject SceneQuery::GetStaticObject(const BroadphaseProxy& i_proxy) const
+{
+    return { i_proxy.min_x, i_proxy.min_y, i_proxy.max_x, i_proxy.max_y, i_proxy.collision_filter.category, static_objects_[i_proxy.id] };
+}
+
+inline int32_t SceneQuery::GetCellCoordinate(float i_value) const
+{
+    return static_cast<int32_t>(floorf(i_value / cell_size_));
+}
+
+inline uint64_t SceneQuery::GetCellKey(int32_t i_x, int32_t i_y)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(i_x)) << 32) | static_cast<uint32_t>(i_y);
+}
+
+} // namespace physics
+} // namespace engine
@@ -0,0 +1,147 @@
+#ifndef SCENE_QUERY_H_
+#define SCENE_QUERY_H_
+
+// library includes
+#include <stdint.h>
+#include <vector>
+
+// engine includes
+#include "Math/Vec3D.h"
+#include "Memory/SharedPointer.h"
+#include "Memory/WeakPointer.h"
+#include "Physics/Broadphase.h"
+#include "Physics/StaticBVH.h"
+
+// a query mask that finds objects on every layer
+#define SCENE_QUERY_ALL_LAYERS                  0xffff
+
+// forward declarations
+namespace engine {
+namespace math {
+    struct AABB;
+}
+namespace physics {
+    class PhysicsObject;
+}
+}
+
+namespace engine {
+namespace physics {
+
+// the object a query found
+struct SceneQueryHit
+{
+    engine::memory::WeakPointer<PhysicsObject>  object;
+    engine::math::Vec3D                         point;                              // where the ray entered the object, or the point on the object closest to the query
+    engine::math::Vec3D                         normal;                             // the side of the object the ray entered through, zero for other queries
+    float                                       distance;
+};
+
+struct RaycastQuery
+{
+    engine::math::Vec3D                         origin;
+    engine::math::Vec3D                         direction;                          // doesn't need to be normalized
+    float                                       max_distance;
+    uint16_t                                    mask;                               // the categories of the objects to find
+};
+
+struct NearestQuery
+{
+    engine::math::Vec3D                         point;
+    float                                       max_distance;
+    uint16_t                                    mask;                               // the categories of the objects to find
+};
+
+/*
+    SceneQuery
+    - Answers ray, box & nearest object queries in the XY plane, without iterating over every object
+    - Built from the broadphase's proxies every time the collider runs, each proxy is bucketed into the cells of a uniform grid
+      with the broadphase's cell size & the grid is sorted by cell, so a cell's objects are found with a binary search
+    - Proxies that cover too many cells are tested by every query instead, just like the broadphase does
+    - Candidates are tested against the world space bounds the objects have when the query runs, but objects are only found
+      if they are within the bounds they covered during the collider's last step
+    - Objects the collider has baked into a StaticBVH aren't in the grid, queries walk the tree for them instead
+    - Objects the collider keeps out of the broadphase while they sleep are bucketed with the bounds they fell asleep with
+    - Queries only read from the grid, so any number of them can run at once, but not while the collider runs
+*/
+class SceneQuery
+{
+    struct QueryObject
+    {
+        float                                           min_x;
+        float                                           min_y;
+        float                                           max_x;
+        float                                           max_y;
+        uint16_t                                        category;
+        engine::memory::WeakPointer<PhysicsObject>      physics_object;
+    };
+
+    // an object bucketed into one cell of the grid
+    struct GridEntry
+    {
+        uint64_t                                        cell;
+        uint32_t                                        object;
+    };
+
+public:
+    SceneQuery();
+    ~SceneQuery();
+
+    // bucket the proxies, proxy ids are indices into the physics objects
+    // the static tree's proxy ids are indices into the static objects, both must outlive the queries
+    // objects the collider keeps out of the broadphase while they sleep are bucketed too, their ids are indices into the sleeping objects
+    void Build(const BroadphaseProxy* i_proxies, size_t i_num_proxies, const engine::memory::SharedPointer<PhysicsObject>* i_physics_objects, float i_cell_size,
+        const StaticBVH* i_static_bvh = nullptr, const engine::memory::WeakPointer<PhysicsObject>* i_static_objects = nullptr,
+        const BroadphaseProxy* i_sleeping_proxies = nullptr, const engine::memory::WeakPointer<PhysicsObject>* i_sleeping_objects = nullptr, size_t i_num_sleeping_proxies = 0);
+    void Clear();
+
+    // the closest object the ray enters within the distance, objects the ray starts inside of are ignored
+    bool Raycast(const RaycastQuery& i_query, SceneQueryHit& o_hit) const;
+    // every object whose bounds overlap the box, each one once
+    void OverlapAABB(const engine::math::AABB& i_aabb, uint16_t i_mask, std::vector<engine::memory::WeakPointer<PhysicsObject>>& o_objects) const;
+    // the object closest to the point within the distance, objects containing the point are at a distance of zero
+    bool QueryNearest(const NearestQuery& i_query, SceneQueryHit& o_hit) const;
+
+    inline size_t GetNumObjects() const;
+
+private:
+    // disable copy constructor & copy assignment operator
+    SceneQuery(const SceneQuery& i_copy) = delete;
+    SceneQuery& operator=(const SceneQuery& i_copy) = delete;
+
+    // bucket an object into the cells it covers
+    void AddObject(const BroadphaseProxy& i_proxy, const engine::memory::WeakPointer<PhysicsObject>& i_physics_object);
+    // the objects' current bounds, false if the object no longer exists
+    static bool GetBounds(const QueryObject& i_object, float& o_min_x, float& o_min_y, float& o_max_x, float& o_max_y);
+    // the objects bucketed into a cell
+    inline void GetCellEntries(int32_t i_x, int32_t i_y, const GridEntry*& o_begin, const GridEntry*& o_end) const;
+    static inline bool IsInMask(const QueryObject& i_object, uint16_t i_mask);
+    // an object found in the static tree
+    inline QueryObject GetStaticObject(const BroadphaseProxy& i_proxy) const;
+
+    void RaycastObject(const QueryObject& i_object, float i_origin_x, float i_origin_y, float i_direction_x, float i_direction_y, float& io_distance, SceneQueryHit& o_hit, bool& o_has_hit) const;
+    void TestNearestObject(const QueryObject& i_object, float i_x, float i_y, float& io_distance, SceneQueryHit& o_hit, bool& o_has_hit) const;
+
+    inline int32_t GetCellCoordinate(float i_value) const;
+    static inline uint64_t GetCellKey(int32_t i_x, int32_t i_y);
+
+private:
+    std::vector<QueryObject>                    objects_;
+    std::vector<GridEntry>                      entries_;                           // sorted by cell
+    std::vector<uint32_t>                       large_objects_;                     // objects too large for the grid
+    float                                       cell_size_;
+    int32_t                                     min_cell_x_;                        // the cells the grid covers
+    int32_t                                     min_cell_y_;
+    int32_t                                     max_cell_x_;
+    int32_t                                     max_cell_y_;
+    const StaticBVH*                            static_bvh_;
+    const engine::memory::WeakPointer<PhysicsObject>* static_objects_;             // indexed by the ids of the static tree's proxies
+
+}; // class SceneQuery
+
+} // namespace physics
+} // namespace engine
+
+#include "SceneQuery-inl.h"
+
+#endif // SCENE_QUERY_H_
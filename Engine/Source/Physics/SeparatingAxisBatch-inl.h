@@ -0,0 +1,61 @@
+#include "SeparatingAxisBatch.h"
+
+// engine includes
+#include "Assert/Assert.h"
+
+namespace engine {
+namespace physics {
+
+inline void SeparatingAxisBatch::SetAxis(size_t i_pair, SeparatingAxis i_axis, float i_relative_velocity, float i_center, float i_extents, float i_other_center, float i_other_extents)
+{
+    ASSERT(i_pair < num_pairs_);
+    GetField(kRelativeVelocity, i_axis)[i_pair] = i_relative_velocity;
+    GetField(kCenter, i_axis)[i_pair] = i_center;
+    GetField(kExtents, i_axis)[i_pair] = i_extents;
+    GetField(kOtherCenter, i_axis)[i_pair] = i_other_center;
+    GetField(kOtherExtents, i_axis)[i_pair] = i_other_extents;
+}
+
+inline void SeparatingAxisBatch::Run(float i_dt)
+{
+    Run(i_dt, 0, num_pairs_);
+}
+
+inline size_t SeparatingAxisBatch::GetNumPairs() const
+{
+    return num_pairs_;
+}
+
+inline bool SeparatingAxisBatch::IsColliding(size_t i_pair) const
+{
+    ASSERT(i_pair < num_pairs_);
+    return is_colliding_[i_pair] != 0;
+}
+
+inline float SeparatingAxisBatch::GetCloseTime(size_t i_pair) const
+{
+    ASSERT(i_pair < num_pairs_);
+    // the latest close times are stored after the fields
+    return data_[kNumFields * static_cast<size_t>(SeparatingAxis::Count) * stride_ + i_pair];
+}
+
+inline float SeparatingAxisBatch::GetCloseTime(size_t i_pair, SeparatingAxis i_axis) const
+{
+    ASSERT(i_pair < num_pairs_);
+    return GetField(kCloseTime, i_axis)[i_pair];
+}
+
+inline float* SeparatingAxisBatch::GetField(Field i_field, SeparatingAxis i_axis)
+{
+    ASSERT(i_axis < SeparatingAxis::Count);
+    return data_.data() + (i_field * static_cast<size_t>(SeparatingAxis::Count) + static_cast<size_t>(i_axis)) * stride_;
+}
+
+inline const float* SeparatingAxisBatch::GetField(Field i_field, SeparatingAxis i_axis) const
+{
+    ASSERT(i_axis < SeparatingAxis::Count);
+    return data_.data() + (i_field * static_cast<size_t>(SeparatingAxis::Count) + static_cast<size_t>(i_axis)) * stride_;
+}
+
+} // namespace physics
+} // namespace engine
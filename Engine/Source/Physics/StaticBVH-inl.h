@@ -0,0 +1,242 @@
+#include "StaticBVH.h"
+
+// library includes
+#include <float.h>
+#include <math.h>
+
+// engine includes
+#include "Assert/Assert.h"
+
+namespace engine {
+namespace physics {
+
+template<class TCallback>
+inline void StaticBVH::Query(float i_min_x, float i_min_y, float i_max_x, float i_max_y, TCallback i_callback) const
+{
+    if (num_nodes_ == 0)
+    {
+        return;
+    }
+
+    uint32_t stack[STATIC_BVH_QUERY_STACK_SIZE];
+    uint32_t stack_size = 0;
+    stack[stack_size++] = 0;
+
+    while (stack_size > 0)
+    {
+        const Node& node = nodes_[stack[--stack_size]];
+        for (uint8_t child = 0; child < 2; ++child)
+        {
+            if (IsEmptyChild(node, child) ||
+                node.min_x[child] > i_max_x || i_min_x > node.max_x[child] || node.min_y[child] > i_max_y || i_min_y > node.max_y[child])
+            {
+                continue;
+            }
+
+            if (node.counts[child] == 0)
+            {
+                ASSERT(stack_size < STATIC_BVH_QUERY_STACK_SIZE);
+                stack[stack_size++] = node.children[child];
+                continue;
+            }
+
+            const uint32_t end = node.children[child] + node.counts[child];
+            for (uint32_t i = node.children[child]; i < end; ++i)
+            {
+                const BroadphaseProxy& proxy = proxies_[i];
+                if (proxy.min_x <= i_max_x && i_min_x <= proxy.max_x && proxy.min_y <= i_max_y && i_min_y <= proxy.max_y)
+                {
+                    i_callback(proxy);
+                }
+            }
+        }
+    }
+}
+
+template<class TCallback>
+inline void StaticBVH::Raycast(float i_origin_x, float i_origin_y, float i_direction_x, float i_direction_y, float i_max_distance, TCallback i_callback) const
+{
+    if (num_nodes_ == 0)
+    {
+        return;
+    }
+
+    const float inverse_x = i_direction_x != 0.0f ? 1.0f / i_direction_x : FLT_MAX;
+    const float inverse_y = i_direction_y != 0.0f ? 1.0f / i_direction_y : FLT_MAX;
+    float max_distance = i_max_distance;
+
+    // nodes are pushed with the distance the ray enters them at, so they can be skipped once something closer is hit
+    uint32_t stack[STATIC_BVH_QUERY_STACK_SIZE];
+    float stack_distances[STATIC_BVH_QUERY_STACK_SIZE];
+    uint32_t stack_size = 0;
+    stack[stack_size] = 0;
+    stack_distances[stack_size++] = 0.0f;
+
+    while (stack_size > 0)
+    {
+        --stack_size;
+        if (stack_distances[stack_size] > max_distance)
+        {
+            continue;
+        }
+
+        const Node& node = nodes_[stack[stack_size]];
+        float distances[2] = { FLT_MAX, FLT_MAX };
+        bool is_hit[2];
+        for (uint8_t child = 0; child < 2; ++child)
+        {
+            is_hit[child] = !IsEmptyChild(node, child) &&
+                RaycastChild(node, child, i_origin_x, i_origin_y, inverse_x, inverse_y, max_distance, distances[child]);
+        }
+
+        // visit the nearer child first, so it's pushed last
+        const uint8_t first = distances[1] < distances[0] ? 1 : 0;
+        for (uint8_t i = 0; i < 2; ++i)
+        {
+            const uint8_t child = i == 0 ? 1 - first : first;
+            if (!is_hit[child])
+            {
+                continue;
+            }
+
+            if (node.counts[child] == 0)
+            {
+                ASSERT(stack_size < STATIC_BVH_QUERY_STACK_SIZE);
+                stack[stack_size] = node.children[child];
+                stack_distances[stack_size++] = distances[child];
+                continue;
+            }
+
+            const uint32_t end = node.children[child] + node.counts[child];
+            for (uint32_t j = node.children[child]; j < end && distances[child] <= max_distance; ++j)
+            {
+                max_distance = i_callback(proxies_[j]);
+            }
+        }
+    }
+}
+
+template<class TCallback>
+inline void StaticBVH::QueryNearest(float i_x, float i_y, float i_max_distance, TCallback i_callback) const
+{
+    if (num_nodes_ == 0)
+    {
+        return;
+    }
+
+    float max_distance = i_max_distance;
+
+    uint32_t stack[STATIC_BVH_QUERY_STACK_SIZE];
+    float stack_distances[STATIC_BVH_QUERY_STACK_SIZE];
+    uint32_t stack_size = 0;
+    stack[stack_size] = 0;
+    stack_distances[stack_size++] = 0.0f;
+
+    while (stack_size > 0)
+    {
+        --stack_size;
+        if (stack_distances[stack_size] > max_distance)
+        {
+            continue;
+        }
+
+        const Node& node = nodes_[stack[stack_size]];
+        const float distances[2] = { IsEmptyChild(node, 0) ? FLT_MAX : GetChildDistance(node, 0, i_x, i_y),
+            IsEmptyChild(node, 1) ? FLT_MAX : GetChildDistance(node, 1, i_x, i_y) };
+
+        // visit the nearer child first, so it's pushed last
+        const uint8_t first = distances[1] < distances[0] ? 1 : 0;
+        for (uint8_t i = 0; i < 2; ++i)
+        {
+            const uint8_t child = i == 0 ? 1 - first : first;
+            if (distances[child] > max_distance)
+            {
+                continue;
+            }
+
+            if (node.counts[child] == 0)
+            {
+                ASSERT(stack_size < STATIC_BVH_QUERY_STACK_SIZE);
+                stack[stack_size] = node.children[child];
+                stack_distances[stack_size++] = distances[child];
+                continue;
+            }
+
+            const uint32_t end = node.children[child] + node.counts[child];
+            for (uint32_t j = node.children[child]; j < end && distances[child] <= max_distance; ++j)
+            {
+                max_distance = i_callback(proxies_[j]);
+            }
+        }
+    }
+}
+
+inline size_t StaticBVH::GetNumProxies() const
+{
+    return proxies_.size();
+}
+
+inline size_t StaticBVH::GetNumNodes() const
+{
+    return num_nodes_;
+}
+
+inline const BroadphaseProxy& StaticBVH::GetProxy(size_t i_index) const
+{
+    ASSERT(i_index < proxies_.size());
+    return proxies_[i_index];
+}
+
+inline bool StaticBVH::IsEmptyChild(const Node& i_node, uint8_t i_child)
+{
+    return i_node.children[i_child] == STATIC_BVH_NULL_CHILD;
+}
+
+inline bool StaticBVH::RaycastChild(const Node& i_node, uint8_t i_child, float i_origin_x, float i_origin_y, float i_inverse_x, float i_inverse_y, float i_max_distance, float& o_distance)
+{
+    // a ray parallel to an axis only passes through the slab if it starts inside it
+    float t_enter = 0.0f;
+    float t_exit = i_max_distance;
+    if (i_inverse_x == FLT_MAX)
+    {
+        if (i_origin_x < i_node.min_x[i_child] || i_origin_x > i_node.max_x[i_child])
+        {
+            return false;
+        }
+    }
+    else
+    {
+        const float t_0 = (i_node.min_x[i_child] - i_origin_x) * i_inverse_x;
+        const float t_1 = (i_node.max_x[i_child] - i_origin_x) * i_inverse_x;
+        t_enter = fmaxf(t_enter, fminf(t_0, t_1));
+        t_exit = fminf(t_exit, fmaxf(t_0, t_1));
+    }
+
+    if (i_inverse_y == FLT_MAX)
+    {
+        if (i_origin_y < i_node.min_y[i_child] || i_origin_y > i_node.max_y[i_child])
+        {
+            return false;
+        }
+    }
+    else
+    {
+        const float t_0 = (i_node.min_y[i_child] - i_origin_y) * i_inverse_y;
+        const float t_1 = (i_node.max_y[i_child] - i_origin_y) * i_inverse_y;
+        t_enter = fmaxf(t_enter, fminf(t_0, t_1));
+        t_exit = fminf(t_exit, fmaxf(t_0, t_1));
+    }
+
+    o_distance = t_enter;
+    return t_enter <= t_exit;
+}
+
+inline float StaticBVH::GetChildDistance(const Node& i_node, uint8_t i_child, float i_x, float i_y)
+{
+    const float dx = fmaxf(fmaxf(i_node.min_x[i_child] - i_x, i_x - i_node.max_x[i_child]), 0.0f);
+    const float dy = fmaxf(fmaxf(i_node.min_y[i_child] - i_y, i_y - i_node.max_y[i_child]), 0.0f);
+    return sqrtf(dx * dx + dy * dy);
+}
+
+} // namespace physics
+} // namespace engine
@@ -0,0 +1,97 @@
+#ifndef STATIC_BVH_H_
+#define STATIC_BVH_H_
+
+// library includes
+#include <stdint.h>
+#include <vector>
+
+// engine includes
+#include "Memory/FrameAllocator.h"
+#include "Physics/Broadphase.h"
+
+// the split planes tried along each axis when a node is split
+#define STATIC_BVH_NUM_BINS                     16
+// ranges of this many proxies or fewer are not split any further
+#define STATIC_BVH_MAX_LEAF_PROXIES             4
+// nodes deeper than this are split at the median, which can only go 32 levels deeper, so queries never run out of stack
+#define STATIC_BVH_MAX_DEPTH                    32
+#define STATIC_BVH_QUERY_STACK_SIZE             (STATIC_BVH_MAX_DEPTH + 32)
+// the child of a node that has fewer than two children
+#define STATIC_BVH_NULL_CHILD                   UINT32_MAX
+
+namespace engine {
+namespace physics {
+
+/*
+    StaticBVH
+    - A bounding volume hierarchy over proxies that don't move, built once & never changed, queried with boxes, rays & points
+    - Built top down, every range of proxies is split along the axis & at the plane (out of a few evenly spaced ones) that
+      minimizes the surface area heuristic, with perimeters standing in for surface areas in 2D
+    - Nodes are stored in a single array, each node fills one cache line & holds the bounds of both its children,
+      so a query decides which children to visit without loading them
+    - Leaves aren't nodes, a child is either another node or a range of the proxies, which are reordered so every leaf's
+      proxies are next to each other
+*/
+class StaticBVH
+{
+    struct alignas(64) Node
+    {
+        float                                   min_x[2];                           // the bounds of each child
+        float                                   min_y[2];
+        float                                   max_x[2];
+        float                                   max_y[2];
+        uint32_t                                children[2];                        // the child's node, or its first proxy if it's a leaf
+        uint32_t                                counts[2];                          // the number of proxies in a leaf, 0 if the child is a node
+    };
+
+public:
+    StaticBVH();
+    ~StaticBVH();
+
+    // replace the tree with one over these proxies, their ids are kept
+    void Build(const BroadphaseProxy* i_proxies, size_t i_num_proxies);
+    void Clear();
+
+    // call back with every proxy that overlaps the box
+    template<class TCallback>
+    inline void Query(float i_min_x, float i_min_y, float i_max_x, float i_max_y, TCallback i_callback) const;
+    // call back with every proxy whose bounds the ray enters within the distance, nearest nodes first
+    // the callback returns the distance the ray is still interested in, so returning a hit's distance prunes everything behind it
+    template<class TCallback>
+    inline void Raycast(float i_origin_x, float i_origin_y, float i_direction_x, float i_direction_y, float i_max_distance, TCallback i_callback) const;
+    // call back with every proxy within the distance of the point, nearest nodes first
+    // the callback returns the distance the query is still interested in, just like Raycast
+    template<class TCallback>
+    inline void QueryNearest(float i_x, float i_y, float i_max_distance, TCallback i_callback) const;
+
+    inline size_t GetNumProxies() const;
+    inline size_t GetNumNodes() const;
+    inline const BroadphaseProxy& GetProxy(size_t i_index) const;
+
+private:
+    // disable copy constructor & copy assignment operator
+    StaticBVH(const StaticBVH& i_copy) = delete;
+    StaticBVH& operator=(const StaticBVH& i_copy) = delete;
+
+    // build the child that holds a range of the proxies & fill in its bounds in the parent
+    void BuildChild(engine::memory::FrameVector<Node>& io_nodes, uint32_t i_parent, uint8_t i_child, uint32_t i_begin, uint32_t i_end, uint32_t i_depth);
+    // sort a range of the proxies around the cheapest split, returns where the second half begins
+    uint32_t SplitProxies(uint32_t i_begin, uint32_t i_end, uint32_t i_depth);
+
+    static inline bool IsEmptyChild(const Node& i_node, uint8_t i_child);
+    static inline bool RaycastChild(const Node& i_node, uint8_t i_child, float i_origin_x, float i_origin_y, float i_inverse_x, float i_inverse_y, float i_max_distance, float& o_distance);
+    static inline float GetChildDistance(const Node& i_node, uint8_t i_child, float i_x, float i_y);
+
+private:
+    Node*                                       nodes_;                             // aligned to a cache line
+    size_t                                      num_nodes_;
+    std::vector<BroadphaseProxy>                proxies_;                           // in the order of the leaves
+
+}; // class StaticBVH
+
+} // namespace physics
+} // namespace engine
+
+#include "StaticBVH-inl.h"
+
+#endif // STATIC_BVH_H_
@@ -0,0 +1,50 @@
+#ifndef GLIB_RENDER_BACKEND_H_
+#define GLIB_RENDER_BACKEND_H_
+
+// library includes
+#include <mutex>
+
+// engine includes
+#include "Renderer/InterfaceRenderBackend.h"
+
+namespace engine {
+namespace render {
+
+/*
+    GLibRenderBackend
+    - Draws into the window GLib opened, GLib must be initialized before it's created & is shut down when it's destroyed
+    - GLib's window also delivers the keyboard's input, so the backend forwards key presses to engine::input
+    - Frames are only drawn on the window's thread, GLib presents through DXGI & a present from any other thread can
+      deadlock against the window's message pump, so pipelined rendering falls back to drawing on the calling thread
+    - Only available on Windows
+*/
+class GLibRenderBackend : public InterfaceRenderBackend
+{
+public:
+    GLibRenderBackend();
+    ~GLibRenderBackend();
+
+    void Service(bool& o_quit_requested) override;
+
+    void BeginFrame() override;
+    void DrawSprite(const GLib::Sprites::Sprite& i_sprite, float i_x, float i_y, float i_angle) override;
+    void EndFrame() override;
+    bool CanDrawOnAnyThread() const override;
+
+    GLib::Sprites::Sprite* CreateSprite(void* i_texture_data, size_t i_texture_size, unsigned int i_width, unsigned int i_height) override;
+    void ReleaseSprite(GLib::Sprites::Sprite* i_sprite) override;
+
+private:
+    // disable copy constructor & copy assignment operator
+    GLibRenderBackend(const GLibRenderBackend& i_copy) = delete;
+    GLibRenderBackend& operator=(const GLibRenderBackend& i_copy) = delete;
+
+private:
+    std::mutex                                  create_sprite_mutex_;               // sprites are created by jobs on several threads
+
+}; // class GLibRenderBackend
+
+} // namespace render
+} // namespace engine
+
+#endif // GLIB_RENDER_BACKEND_H_
@@ -0,0 +1,50 @@
+#ifndef INTERFACE_RENDER_BACKEND_H_
+#define INTERFACE_RENDER_BACKEND_H_
+
+// library includes
+#include <stddef.h>
+
+// forward declarations
+namespace GLib {
+namespace Sprites {
+    struct Sprite;
+}
+}
+
+namespace engine {
+namespace render {
+
+/*
+    InterfaceRenderBackend
+    - Everything the renderer needs from the platform: somewhere to draw sprites & sprites made out of texture files
+    - Sprites are opaque to everything but the backend that created them
+    - A frame is drawn on whichever thread the renderer draws on, but never on two threads at once, sprites can be created
+      & released on any thread while a frame is drawn
+    - The renderer only draws on a thread of its own if the backend says it can draw on any thread, GPU backends that must
+      present from the window's thread keep drawing on it
+*/
+class InterfaceRenderBackend
+{
+public:
+    virtual ~InterfaceRenderBackend() {}
+
+    // handle the platform's messages, o_quit_requested is set once the user asks to quit
+    virtual void Service(bool& o_quit_requested) = 0;
+
+    virtual void BeginFrame() = 0;
+    virtual void DrawSprite(const GLib::Sprites::Sprite& i_sprite, float i_x, float i_y, float i_angle) = 0;
+    virtual void EndFrame() = 0;
+
+    // true if frames can be drawn on a thread other than the one that created the window
+    virtual bool CanDrawOnAnyThread() const = 0;
+
+    // a sprite i_width by i_height pixels large, or as large as the texture if either is 0, nullptr if the texture can't be read
+    virtual GLib::Sprites::Sprite* CreateSprite(void* i_texture_data, size_t i_texture_size, unsigned int i_width, unsigned int i_height) = 0;
+    virtual void ReleaseSprite(GLib::Sprites::Sprite* i_sprite) = 0;
+
+}; // class InterfaceRenderBackend
+
+} // namespace render
+} // namespace engine
+
+#endif // INTERFACE_RENDER_BACKEND_H_
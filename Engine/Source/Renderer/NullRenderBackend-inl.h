@@ -0,0 +1,27 @@
+#include "NullRenderBackend.h"
+
+namespace engine {
+namespace render {
+
+inline uint64_t NullRenderBackend::GetNumFrames() const
+{
+    return num_frames_.load();
+}
+
+inline uint64_t NullRenderBackend::GetNumDrawCalls() const
+{
+    return num_draw_calls_.load();
+}
+
+inline uint32_t NullRenderBackend::GetNumDrawCallsLastFrame() const
+{
+    return num_draw_calls_last_frame_.load();
+}
+
+inline uint32_t NullRenderBackend::GetNumSprites() const
+{
+    return num_sprites_.load();
+}
+
+} // namespace render
+} // namespace engine
@@ -0,0 +1,62 @@
+#ifndef NULL_RENDER_BACKEND_H_
+#define NULL_RENDER_BACKEND_H_
+
+// library includes
+#include <atomic>
+#include <stdint.h>
+
+// engine includes
+#include "Renderer/InterfaceRenderBackend.h"
+
+namespace engine {
+namespace render {
+
+/*
+    NullRenderBackend
+    - Headless, draws nothing & never touches a GPU or a window, so the engine can simulate on servers & in benchmarks
+    - Counts the frames & sprite draws the renderer asks for, they're drawn on the render thread so the counts are atomic
+    - Sprites are plain handles that remember their size, textures aren't decoded
+    - The platform never asks to quit, call engine::InitiateShutdown to stop engine::Run
+*/
+class NullRenderBackend : public InterfaceRenderBackend
+{
+public:
+    NullRenderBackend();
+    ~NullRenderBackend();
+
+    void Service(bool& o_quit_requested) override;
+
+    void BeginFrame() override;
+    void DrawSprite(const GLib::Sprites::Sprite& i_sprite, float i_x, float i_y, float i_angle) override;
+    void EndFrame() override;
+    bool CanDrawOnAnyThread() const override;
+
+    GLib::Sprites::Sprite* CreateSprite(void* i_texture_data, size_t i_texture_size, unsigned int i_width, unsigned int i_height) override;
+    void ReleaseSprite(GLib::Sprites::Sprite* i_sprite) override;
+
+    // accessors
+    inline uint64_t GetNumFrames() const;
+    inline uint64_t GetNumDrawCalls() const;
+    inline uint32_t GetNumDrawCallsLastFrame() const;
+    inline uint32_t GetNumSprites() const;
+
+private:
+    // disable copy constructor & copy assignment operator
+    NullRenderBackend(const NullRenderBackend& i_copy) = delete;
+    NullRenderBackend& operator=(const NullRenderBackend& i_copy) = delete;
+
+private:
+    std::atomic<uint64_t>                       num_frames_;                        // frames drawn since the backend was created
+    std::atomic<uint64_t>                       num_draw_calls_;                    // sprites drawn since the backend was created
+    std::atomic<uint32_t>                       num_draw_calls_last_frame_;
+    uint32_t                                    num_draw_calls_this_frame_;         // only touched between BeginFrame & EndFrame
+    std::atomic<uint32_t>                       num_sprites_;                       // sprites created & not yet released
+
+}; // class NullRenderBackend
+
+} // namespace render
+} // namespace engine
+
+#include "NullRenderBackend-inl.h"
+
+#endif // NULL_RENDER_BACKEND_H_
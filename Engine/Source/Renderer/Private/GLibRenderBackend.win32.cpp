@@ -0,0 +1,111 @@
+#include "Renderer/GLibRenderBackend.h"
+
+// external includes
+#include "GLib.h"
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Input/Input.h"
+
+namespace engine {
+namespace render {
+
+GLibRenderBackend::GLibRenderBackend()
+{
+    // register the key callback
+    GLib::SetKeyStateChangeCallback(engine::input::KeyCallback);
+}
+
+GLibRenderBackend::~GLibRenderBackend()
+{
+    // cleanup GLib
+    GLib::Shutdown();
+}
+
+void GLibRenderBackend::Service(bool& o_quit_requested)
+{
+    GLib::Service(o_quit_requested);
+}
+
+void GLibRenderBackend::BeginFrame()
+{
+    // Tell GLib that we want to start rendering
+    GLib::BeginRendering();
+    // Tell GLib that we want to render some sprites
+    GLib::Sprites::BeginRendering();
+}
+
+void GLibRenderBackend::DrawSprite(const GLib::Sprites::Sprite& i_sprite, float i_x, float i_y, float i_angle)
+{
+    GLib::Sprites::RenderSprite(i_sprite, { i_x, i_y }, i_angle);
+}
+
+void GLibRenderBackend::EndFrame()
+{
+    // Tell GLib we're done rendering sprites
+    GLib::Sprites::EndRendering();
+    // Tell GLib we're done rendering
+    GLib::EndRendering();
+}
+
+bool GLibRenderBackend::CanDrawOnAnyThread() const
+{
+    // DXGI's present waits on the window's messages, which are only pumped by Service on the window's thread
+    return false;
+}
+
+GLib::Sprites::Sprite* GLibRenderBackend::CreateSprite(void* i_texture_data, size_t i_texture_size, unsigned int i_width, unsigned int i_height)
+{
+    // Ask GLib to create a texture out of the data (assuming it was loaded successfully)
+    GLib::Texture * texture = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(create_sprite_mutex_);
+        texture = i_texture_data ? GLib::CreateTexture(i_texture_data, i_texture_size) : nullptr;
+    }
+
+    if (texture == nullptr)
+        return nullptr;
+
+    unsigned int width = 0;
+    unsigned int height = 0;
+    unsigned int depth = 0;
+
+    // Get the dimensions of the texture. We'll use this to determine how big it is on screen
+    bool result = GLib::GetDimensions(texture, width, height, depth);
+    ASSERT(result == true);
+    ASSERT((width > 0) && (height > 0));
+
+    // Define the sprite edges
+    GLib::Sprites::SpriteEdges      Edges = { -float(i_width > 0 ? i_width / 2.0f : width / 2.0f),
+        float(i_height > 0 ? i_height / 2.0f : height / 2.0f),
+        float(i_width > 0 ? i_width / 2.0f : width / 2.0f),
+        -float(i_height > 0 ? i_height / 2.0f : height / 2.0f) };
+    GLib::Sprites::SpriteUVs        UVs = { { 0.0f, 0.0f },{ 1.0f, 0.0f },{ 0.0f, 1.0f },{ 1.0f, 1.0f } };
+    GLib::RGBA                      Color = { 255, 255, 255, 255 };
+
+    std::lock_guard<std::mutex> lock(create_sprite_mutex_);
+
+    // Create the sprite
+    GLib::Sprites::Sprite * sprite = GLib::Sprites::CreateSprite(Edges, 0.1f, Color, UVs);
+    if (sprite == nullptr)
+    {
+        GLib::Release(texture);
+        return nullptr;
+    }
+
+    // Bind the texture to sprite
+    GLib::Sprites::SetTexture(*sprite, *texture);
+
+    return sprite;
+}
+
+void GLibRenderBackend::ReleaseSprite(GLib::Sprites::Sprite* i_sprite)
+{
+    // validate input
+    ASSERT(i_sprite);
+
+    GLib::Sprites::Release(i_sprite);
+}
+
+} // namespace render
+} // namespace engine
@@ -0,0 +1,87 @@
+#include "Renderer/NullRenderBackend.h"
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+
+namespace engine {
+namespace render {
+
+// what a sprite handed out by the backend really points to
+struct NullSprite
+{
+    unsigned int        width;
+    unsigned int        height;
+};
+
+NullRenderBackend::NullRenderBackend() : num_frames_(0),
+    num_draw_calls_(0),
+    num_draw_calls_last_frame_(0),
+    num_draw_calls_this_frame_(0),
+    num_sprites_(0)
+{}
+
+NullRenderBackend::~NullRenderBackend()
+{
+    if (num_sprites_ > 0)
+    {
+        LOG_ERROR("NullRenderBackend is being destroyed with %u sprites that were never released!", num_sprites_.load());
+    }
+}
+
+void NullRenderBackend::Service(bool& o_quit_requested)
+{
+    // there's no window to close
+}
+
+void NullRenderBackend::BeginFrame()
+{
+    num_draw_calls_this_frame_ = 0;
+}
+
+void NullRenderBackend::DrawSprite(const GLib::Sprites::Sprite& i_sprite, float i_x, float i_y, float i_angle)
+{
+    ++num_draw_calls_this_frame_;
+}
+
+void NullRenderBackend::EndFrame()
+{
+    num_draw_calls_ += num_draw_calls_this_frame_;
+    num_draw_calls_last_frame_ = num_draw_calls_this_frame_;
+    ++num_frames_;
+}
+
+bool NullRenderBackend::CanDrawOnAnyThread() const
+{
+    // there's no window or GPU to stay on the thread of
+    return true;
+}
+
+GLib::Sprites::Sprite* NullRenderBackend::CreateSprite(void* i_texture_data, size_t i_texture_size, unsigned int i_width, unsigned int i_height)
+{
+    // fail like a real backend would when the texture file couldn't be read
+    if (i_texture_data == nullptr || i_texture_size == 0)
+    {
+        return nullptr;
+    }
+
+    NullSprite* sprite = new NullSprite();
+    sprite->width = i_width;
+    sprite->height = i_height;
+    ++num_sprites_;
+
+    return reinterpret_cast<GLib::Sprites::Sprite*>(sprite);
+}
+
+void NullRenderBackend::ReleaseSprite(GLib::Sprites::Sprite* i_sprite)
+{
+    // validate input
+    ASSERT(i_sprite);
+    ASSERT(num_sprites_ > 0);
+
+    delete reinterpret_cast<NullSprite*>(i_sprite);
+    --num_sprites_;
+}
+
+} // namespace render
+} // namespace engine
@@ -0,0 +1,22 @@
+#include "Renderer/RenderSnapshot.h"
+
+namespace engine {
+namespace render {
+
+RenderSnapshot::RenderSnapshot()
+{}
+
+RenderSnapshot::~RenderSnapshot()
+{
+    Clear();
+}
+
+void RenderSnapshot::Clear()
+{
+    // keep the capacity, a snapshot is captured every frame
+    items_.clear();
+    renderables_.clear();
+}
+
+} // namespace render
+} // namespace engine
@@ -1,37 +1,38 @@
-#include "Renderer\RenderableObject.h"
-
-// external includes
-#include "BasicTypes.h"
-#include "GLib.h"
+#include "Renderer/RenderableObject.h"
 
 // engine includes
-#include "GameObject\GameObject.h"
-#include "Renderer\Renderer.h"
+#include "GameObject/GameObject.h"
+#include "Renderer/InterfaceRenderBackend.h"
+#include "Renderer/RenderSnapshot.h"
 
 namespace engine {
 namespace render {
 
-RenderableObject::RenderableObject(GLib::Sprites::Sprite* i_sprite) : sprite_(i_sprite),
+RenderableObject::RenderableObject(InterfaceRenderBackend* i_backend, GLib::Sprites::Sprite* i_sprite) : backend_(i_backend),
+    sprite_(i_sprite),
     game_object_(nullptr),
     is_visible_(true)
 {
     // validate inputs
+    ASSERT(backend_);
     ASSERT(sprite_);
 
-    position_ = { 0.0f, 0.0f, };
+    position_.set(0.0f, 0.0f);
     angle_ = 0.0f;
 }
 
-RenderableObject::RenderableObject(GLib::Sprites::Sprite* i_sprite, const engine::memory::WeakPointer<engine::gameobject::GameObject>& i_game_object) : sprite_(i_sprite),
+RenderableObject::RenderableObject(InterfaceRenderBackend* i_backend, GLib::Sprites::Sprite* i_sprite, const engine::memory::WeakPointer<engine::gameobject::GameObject>& i_game_object) : backend_(i_backend),
+    sprite_(i_sprite),
     game_object_(i_game_object),
     is_visible_(true)
 {
     // validate inputs
+    ASSERT(backend_);
     ASSERT(sprite_);
     ASSERT(game_object_);
 
     engine::memory::SharedPointer<engine::gameobject::GameObject> game_object(game_object_);
-    position_ = { game_object->GetPosition().x(), game_object->GetPosition().y() };
+    position_.set(game_object->GetPosition().x(), game_object->GetPosition().y());
     angle_ = game_object->GetRotation().z();
 }
 
@@ -39,27 +40,30 @@ RenderableObject::~RenderableObject()
 {
     if (sprite_)
     {
-        GLib::Sprites::Release(sprite_);
+        // the engine keeps the backend around until everything that may hold a renderable is gone
+        backend_->ReleaseSprite(sprite_);
         sprite_ = nullptr;
     }
 }
 
-void RenderableObject::Render(float i_dt)
+bool RenderableObject::Capture(float i_interpolation, RenderItem& o_item)
 {
     if (!is_visible_)
     {
-        return;
+        return false;
     }
 
     if (game_object_)
     {
         // get a shared pointer to operate on
         engine::memory::SharedPointer<engine::gameobject::GameObject> game_object(game_object_);
-        position_ = { game_object->GetPosition().x(), game_object->GetPosition().y() };
+        const engine::math::Vec3D position = game_object->GetInterpolatedPosition(i_interpolation);
+        position_.set(position.x(), position.y());
         angle_ = game_object->GetRotation().z();
     }
 
-    GLib::Sprites::RenderSprite(*sprite_, position_, angle_);
+    o_item = { sprite_, position_.x(), position_.y(), angle_ };
+    return true;
 }
 
 } // namespace render
@@ -1,13 +1,11 @@
-#include "Renderer\Renderer.h"
-
-// external includes
-#include "GLib.h"
+#include "Renderer/Renderer.h"
 
 // engine includes
-#include "Common\HelperMacros.h"
-#include "Data\PooledString.h"
-#include "Util\FileUtils.h"
-#include "Util\Profiler.h"
+#include "Common/HelperMacros.h"
+#include "Data/PooledString.h"
+#include "Renderer/InterfaceRenderBackend.h"
+#include "Util/FileUtils.h"
+#include "Util/Profiler.h"
 
 namespace engine {
 namespace render {
@@ -15,20 +13,32 @@ namespace render {
 // static member initialization
 Renderer* Renderer::instance_ = nullptr;
 
-Renderer::Renderer() : num_renderables_(0)
-{}
+Renderer::Renderer(InterfaceRenderBackend* i_backend) : backend_(i_backend),
+    num_renderables_(0),
+    capture_index_(0),
+    pending_snapshot_(nullptr),
+    is_drawing_(false),
+    is_stop_requested_(false)
+{
+    // validate input
+    ASSERT(backend_);
+}
 
 Renderer::~Renderer()
 {
+    StopRenderThread();
+
+    snapshots_[0].Clear();
+    snapshots_[1].Clear();
     renderables_.clear();
     num_renderables_ = 0;
 }
 
-Renderer* Renderer::Create()
+Renderer* Renderer::Create(InterfaceRenderBackend* i_backend)
 {
     if (!Renderer::instance_)
     {
-        Renderer::instance_ = new Renderer();
+        Renderer::instance_ = new Renderer(i_backend);
     }
     return Renderer::instance_;
 }
@@ -38,80 +48,149 @@ void Renderer::Destroy()
     SAFE_DELETE(Renderer::instance_);
 }
 
-void Renderer::Run(float i_dt)
+void Renderer::Run(float i_interpolation)
 {
     PROFILE_UNSCOPED("RendererRun");
 
-    // Tell GLib that we want to start rendering
-    GLib::BeginRendering();
-    // Tell GLib that we want to render some sprites
-    GLib::Sprites::BeginRendering();
+    // the render thread is done with this snapshot, it was handed over two frames ago & the last frame waited for it
+    RenderSnapshot& snapshot = snapshots_[capture_index_];
+    Capture(i_interpolation, snapshot);
 
-    std::lock_guard<std::mutex> lock(renderables_mutex_);
+    if (!IsRenderThreadRunning())
+    {
+        Draw(snapshot);
+        return;
+    }
 
-    for (size_t i = 0; i < num_renderables_; ++i)
     {
-        PROFILE_SCOPE_BEGIN("RenderableCall")
-        renderables_[i]->Render(i_dt);
+        PROFILE_SCOPE_BEGIN("RendererWaitForDraw")
+        std::unique_lock<std::mutex> lock(render_mutex_);
+        render_condition_.wait(lock, [this]() { return pending_snapshot_ == nullptr && !is_drawing_; });
+        pending_snapshot_ = &snapshot;
         PROFILE_SCOPE_END
     }
+    render_condition_.notify_all();
 
-    // Tell GLib we're done rendering sprites
-    GLib::Sprites::EndRendering();
-    // Tell GLib we're done rendering
-    GLib::EndRendering();
+    capture_index_ = 1 - capture_index_;
 }
 
-GLib::Sprites::Sprite* Renderer::CreateSprite(const engine::data::PooledString& i_texture_file_name, unsigned int i_width, unsigned int i_height)
+void Renderer::StartRenderThread()
 {
-    // validate input
-    ASSERT(i_texture_file_name.GetLength() > 0);
+    if (IsRenderThreadRunning())
+    {
+        return;
+    }
 
-    // Load the source file (texture data)
-    engine::util::FileUtils::FileData texture_file_data = engine::util::FileUtils::Get()->ReadFile(i_texture_file_name);
-    ASSERT(texture_file_data.file_contents);
+    // the backend may have to submit to the GPU from the window's thread
+    if (!backend_->CanDrawOnAnyThread())
+    {
+        LOG("Renderer's backend can't draw on a thread of its own, frames will be drawn on the calling thread");
+        return;
+    }
+
+    is_stop_requested_ = false;
+    render_thread_ = std::thread(&Renderer::RenderThreadMain, this);
+}
 
-    // Ask GLib to create a texture out of the data (assuming it was loaded successfully)
-    GLib::Texture * texture = nullptr;
+void Renderer::StopRenderThread()
+{
+    if (!IsRenderThreadRunning())
     {
-        std::lock_guard<std::mutex> lock(create_sprite_mutex_);
-        texture = texture_file_data.file_contents ? GLib::CreateTexture(texture_file_data.file_contents, texture_file_data.file_size) : nullptr;
+        return;
     }
 
-    if (texture == nullptr)
-        return nullptr;
+    {
+        std::lock_guard<std::mutex> lock(render_mutex_);
+        is_stop_requested_ = true;
+    }
+    render_condition_.notify_all();
+    render_thread_.join();
 
-    unsigned int width = 0;
-    unsigned int height = 0;
-    unsigned int depth = 0;
+    // Run only captures into one snapshot from now on, so let go of the renderables the thread drew last
+    snapshots_[1 - capture_index_].Clear();
+}
 
-    // Get the dimensions of the texture. We'll use this to determine how big it is on screen
-    bool result = GLib::GetDimensions(texture, width, height, depth);
-    ASSERT(result == true);
-    ASSERT((width > 0) && (height > 0));
+void Renderer::Capture(float i_interpolation, RenderSnapshot& o_snapshot)
+{
+    PROFILE_UNSCOPED("RendererCapture");
 
-    // Define the sprite edges
-    GLib::Sprites::SpriteEdges      Edges = { -float(i_width > 0 ? i_width / 2.0f : width / 2.0f), 
-        float(i_height > 0 ? i_height / 2.0f : height / 2.0f), 
-        float(i_width > 0 ? i_width / 2.0f : width / 2.0f), 
-        -float(i_height > 0 ? i_height / 2.0f : height / 2.0f) };
-    GLib::Sprites::SpriteUVs        UVs = { { 0.0f, 0.0f },{ 1.0f, 0.0f },{ 0.0f, 1.0f },{ 1.0f, 1.0f } };
-    GLib::RGBA                      Color = { 255, 255, 255, 255 };
+    // releases the renderables only this snapshot still held
+    o_snapshot.Clear();
 
-    std::lock_guard<std::mutex> lock(create_sprite_mutex_);
+    std::lock_guard<std::mutex> lock(renderables_mutex_);
 
-    // Create the sprite
-    GLib::Sprites::Sprite * sprite = GLib::Sprites::CreateSprite(Edges, 0.1f, Color, UVs);
-    if (sprite == nullptr)
+    for (size_t i = 0; i < num_renderables_; ++i)
     {
-        GLib::Release(texture);
-        return nullptr;
+        RenderItem item;
+        if (renderables_[i]->Capture(i_interpolation, item))
+        {
+            o_snapshot.AddItem(renderables_[i], item);
+        }
     }
+}
+
+void Renderer::Draw(const RenderSnapshot& i_snapshot)
+{
+    PROFILE_UNSCOPED("RendererDraw");
+
+    backend_->BeginFrame();
+
+    for (size_t i = 0; i < i_snapshot.GetNumItems(); ++i)
+    {
+        const RenderItem& item = i_snapshot.GetItem(i);
+        backend_->DrawSprite(*item.sprite, item.x, item.y, item.angle);
+    }
+
+    backend_->EndFrame();
+}
+
+void Renderer::RenderThreadMain()
+{
+    while (true)
+    {
+        const RenderSnapshot* snapshot = nullptr;
+        {
+            // a snapshot that was handed over is drawn even if the thread was asked to stop
+            std::unique_lock<std::mutex> lock(render_mutex_);
+            render_condition_.wait(lock, [this]() { return pending_snapshot_ != nullptr || is_stop_requested_; });
+            if (pending_snapshot_ == nullptr)
+            {
+                return;
+            }
+
+            snapshot = pending_snapshot_;
+            pending_snapshot_ = nullptr;
+            is_drawing_ = true;
+        }
+
+        Draw(*snapshot);
+
+        {
+            std::lock_guard<std::mutex> lock(render_mutex_);
+            is_drawing_ = false;
+        }
+        render_condition_.notify_all();
+    }
+}
 
-    // Bind the texture to sprite
-    GLib::Sprites::SetTexture(*sprite, *texture);
+GLib::Sprites::Sprite* Renderer::CreateSprite(const engine::data::PooledString& i_texture_file_name, unsigned int i_width, unsigned int i_height)
+{
+    // validate input
+    ASSERT(i_texture_file_name.GetLength() > 0);
+
+    // Load the source file (texture data)
+    engine::util::FileUtils::FileData texture_file_data = engine::util::FileUtils::Get()->ReadFile(i_texture_file_name);
+    ASSERT(texture_file_data.file_contents);
+
+    return backend_->CreateSprite(texture_file_data.file_contents, texture_file_data.file_size, i_width, i_height);
+}
+
+void Renderer::ReleaseSprite(GLib::Sprites::Sprite* i_sprite)
+{
+    // validate input
+    ASSERT(i_sprite);
 
-    return sprite;
+    backend_->ReleaseSprite(i_sprite);
 }
 
 } // namespace render
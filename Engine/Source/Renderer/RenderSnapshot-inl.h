@@ -0,0 +1,31 @@
+#include "RenderSnapshot.h"
+
+// engine includes
+#include "Assert/Assert.h"
+
+namespace engine {
+namespace render {
+
+inline void RenderSnapshot::AddItem(const engine::memory::SharedPointer<RenderableObject>& i_renderable, const RenderItem& i_item)
+{
+    // validate inputs
+    ASSERT(i_renderable);
+    ASSERT(i_item.sprite);
+
+    items_.push_back(i_item);
+    renderables_.push_back(i_renderable);
+}
+
+inline size_t RenderSnapshot::GetNumItems() const
+{
+    return items_.size();
+}
+
+inline const RenderItem& RenderSnapshot::GetItem(size_t i_index) const
+{
+    ASSERT(i_index < items_.size());
+    return items_[i_index];
+}
+
+} // namespace render
+} // namespace engine
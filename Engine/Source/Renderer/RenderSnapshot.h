@@ -0,0 +1,66 @@
+#ifndef RENDER_SNAPSHOT_H_
+#define RENDER_SNAPSHOT_H_
+
+// library includes
+#include <vector>
+
+// engine includes
+#include "Memory/SharedPointer.h"
+#include "Renderer/RenderableObject.h"
+
+// forward declarations
+namespace GLib {
+namespace Sprites {
+    struct Sprite;
+}
+}
+
+namespace engine {
+namespace render {
+
+// where & how a renderable is drawn in a frame
+struct RenderItem
+{
+    GLib::Sprites::Sprite*                      sprite;
+    float                                       x;
+    float                                       y;
+    float                                       angle;
+};
+
+/*
+    RenderSnapshot
+    - A copy of everything the renderer draws in a frame, taken once the frame has been simulated
+    - Drawing a snapshot never reads a game object or a renderable, so the next frame can be simulated while it's drawn
+    - Holds on to every renderable it captured, so their sprites aren't released while the snapshot is drawn,
+      they're let go the next time the snapshot is cleared
+*/
+class RenderSnapshot
+{
+public:
+    RenderSnapshot();
+    ~RenderSnapshot();
+
+    // must not be called while the snapshot is drawn
+    void Clear();
+    inline void AddItem(const engine::memory::SharedPointer<RenderableObject>& i_renderable, const RenderItem& i_item);
+
+    inline size_t GetNumItems() const;
+    inline const RenderItem& GetItem(size_t i_index) const;
+
+private:
+    // disable copy constructor & copy assignment operator
+    RenderSnapshot(const RenderSnapshot& i_copy) = delete;
+    RenderSnapshot& operator=(const RenderSnapshot& i_copy) = delete;
+
+private:
+    std::vector<RenderItem>                                             items_;
+    std::vector<engine::memory::SharedPointer<RenderableObject>>        renderables_;   // the renderables the items were captured from
+
+}; // class RenderSnapshot
+
+} // namespace render
+} // namespace engine
+
+#include "RenderSnapshot-inl.h"
+
+#endif // RENDER_SNAPSHOT_H_
@@ -1,24 +1,20 @@
 #include "RenderableObject.h"
 
-// external includes
-#include "BasicTypes.h"
-#include "GLib.h"
-
 // engine includes
-#include "Assert\Assert.h"
-#include "Math\MathUtil.h"
+#include "Assert/Assert.h"
+#include "Math/MathUtil.h"
 
 namespace engine {
 namespace render {
 
-inline engine::memory::SharedPointer<RenderableObject> RenderableObject::Create(GLib::Sprites::Sprite* i_sprite)
+inline engine::memory::SharedPointer<RenderableObject> RenderableObject::Create(InterfaceRenderBackend* i_backend, GLib::Sprites::Sprite* i_sprite)
 {
-    return engine::memory::SharedPointer<RenderableObject>(new RenderableObject(i_sprite));
+    return engine::memory::SharedPointer<RenderableObject>(new RenderableObject(i_backend, i_sprite));
 }
 
-inline engine::memory::SharedPointer<RenderableObject> RenderableObject::Create(GLib::Sprites::Sprite* i_sprite, const engine::memory::WeakPointer<engine::gameobject::GameObject>& i_game_object)
+inline engine::memory::SharedPointer<RenderableObject> RenderableObject::Create(InterfaceRenderBackend* i_backend, GLib::Sprites::Sprite* i_sprite, const engine::memory::WeakPointer<engine::gameobject::GameObject>& i_game_object)
 {
-    return engine::memory::SharedPointer<RenderableObject>(new RenderableObject(i_sprite, i_game_object));
+    return engine::memory::SharedPointer<RenderableObject>(new RenderableObject(i_backend, i_sprite, i_game_object));
 }
 
 inline GLib::Sprites::Sprite* RenderableObject::GetSprite() const
@@ -44,22 +40,11 @@ inline void RenderableObject::SetAngle(const float i_angle)
 }
 
 inline const engine::math::Vec2D RenderableObject::GetPositionAsVec2D() const
-{
-    return engine::math::Vec2D(position_.x, position_.y);
-}
-
-inline const GLib::Point2D& RenderableObject::GetPositionAsPoint2D() const
 {
     return position_;
 }
 
 inline void RenderableObject::SetPosition(const engine::math::Vec2D& i_position)
-{
-    position_.x = i_position.x();
-    position_.y = i_position.y();
-}
-
-inline void RenderableObject::SetPosition(const GLib::Point2D& i_position)
 {
     position_ = i_position;
 }
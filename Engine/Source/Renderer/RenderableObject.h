@@ -1,17 +1,14 @@
 #ifndef RENDERABLE_OBJECT_H_
 #define RENDERABLE_OBJECT_H_
 
-// external includes
-#include "BasicTypes.h"
-
 // engine includes
-#include "Math\Vec2D.h"
-#include "Memory\SharedPointer.h"
-#include "Memory\WeakPointer.h"
+#include "Math/Vec2D.h"
+#include "Memory/RefCounted.h"
+#include "Memory/SharedPointer.h"
+#include "Memory/WeakPointer.h"
 
 // forward declarations
 namespace GLib {
-    struct Point2D;
 namespace Sprites {
     struct Sprite;
 }
@@ -20,16 +17,21 @@ namespace engine {
 namespace gameobject {
     class GameObject;
 }
+namespace render {
+    class InterfaceRenderBackend;
+    struct RenderItem;
+}
 }
 
 namespace engine {
 namespace render {
 
-class RenderableObject
+class RenderableObject : public engine::memory::RefCounted
 {
 public:
-    inline static engine::memory::SharedPointer<RenderableObject> Create(GLib::Sprites::Sprite* i_sprite);
-    inline static engine::memory::SharedPointer<RenderableObject> Create(GLib::Sprites::Sprite* i_sprite, const engine::memory::WeakPointer<engine::gameobject::GameObject>& i_game_object);
+    // i_sprite was created by i_backend, which releases it when the renderable is destroyed
+    inline static engine::memory::SharedPointer<RenderableObject> Create(InterfaceRenderBackend* i_backend, GLib::Sprites::Sprite* i_sprite);
+    inline static engine::memory::SharedPointer<RenderableObject> Create(InterfaceRenderBackend* i_backend, GLib::Sprites::Sprite* i_sprite, const engine::memory::WeakPointer<engine::gameobject::GameObject>& i_game_object);
     ~RenderableObject();
 
     // disable copy constructor & copy assignment operator
@@ -37,7 +39,9 @@ public:
     RenderableObject& operator=(const RenderableObject& i_copy) = delete;
 
     // functions
-    void Render(float i_dt);
+    // follow the game object & fill in where the sprite is drawn this frame, false if it isn't drawn
+    // i_interpolation is how far the frame is between the game object's previous & current positions
+    bool Capture(float i_interpolation, RenderItem& o_item);
 
     // accessors and mutators
     inline GLib::Sprites::Sprite* GetSprite() const;
@@ -47,9 +51,7 @@ public:
     inline void SetAngle(const float i_angle);
 
     inline const engine::math::Vec2D GetPositionAsVec2D() const;
-    inline const GLib::Point2D& GetPositionAsPoint2D() const;
     inline void SetPosition(const engine::math::Vec2D& i_position);
-    inline void SetPosition(const GLib::Point2D& i_position);
 
     inline engine::memory::WeakPointer<engine::gameobject::GameObject> GetGameObject() const;
     inline void SetGameObject(const engine::memory::WeakPointer<engine::gameobject::GameObject>& i_game_object);
@@ -58,13 +60,14 @@ public:
     inline void SetIsVisible(bool i_is_visible);
 
 private:
-    RenderableObject(GLib::Sprites::Sprite* i_sprite);
-    RenderableObject(GLib::Sprites::Sprite* i_sprite, const engine::memory::WeakPointer<engine::gameobject::GameObject>& i_game_object);
+    RenderableObject(InterfaceRenderBackend* i_backend, GLib::Sprites::Sprite* i_sprite);
+    RenderableObject(InterfaceRenderBackend* i_backend, GLib::Sprites::Sprite* i_sprite, const engine::memory::WeakPointer<engine::gameobject::GameObject>& i_game_object);
 
 private:
+    InterfaceRenderBackend*                                                             backend_;           // outlives the renderer, so sprites can be released after it's gone
     GLib::Sprites::Sprite*                                                              sprite_;
     float                                                                               angle_;
-    GLib::Point2D                                                                       position_;
+    engine::math::Vec2D                                                                 position_;
     engine::memory::WeakPointer<engine::gameobject::GameObject>                         game_object_;
     bool                                                                                is_visible_;
 
@@ -3,13 +3,10 @@
 // libarary includes
 #include <algorithm>
 
-// external includes
-#include "GLib.h"
-
 // engine includes
-#include "Assert\Assert.h"
-#include "Data\PooledString.h"
-#include "Logger\Logger.h"
+#include "Assert/Assert.h"
+#include "Data/PooledString.h"
+#include "Logger/Logger.h"
 
 namespace engine {
 namespace render {
@@ -19,6 +16,16 @@ inline Renderer* Renderer::Get()
     return Renderer::instance_;
 }
 
+inline bool Renderer::IsRenderThreadRunning() const
+{
+    return render_thread_.joinable();
+}
+
+inline InterfaceRenderBackend* Renderer::GetBackend() const
+{
+    return backend_;
+}
+
 inline engine::memory::SharedPointer<RenderableObject> Renderer::CreateRenderableObject(const engine::data::PooledString& i_file_name)
 {
     // validate input
@@ -47,7 +54,7 @@ inline engine::memory::SharedPointer<RenderableObject> Renderer::CreateRenderabl
     ASSERT(i_sprite);
 
     // create a new renderable
-    engine::memory::SharedPointer<RenderableObject> renderable = RenderableObject::Create(i_sprite);
+    engine::memory::SharedPointer<RenderableObject> renderable = RenderableObject::Create(backend_, i_sprite);
 
     // add it to the list
     renderables_.push_back(renderable);
@@ -87,7 +94,7 @@ inline engine::memory::SharedPointer<RenderableObject> Renderer::CreateRenderabl
     ASSERT(i_game_object);
 
     // create a new renderable
-    engine::memory::SharedPointer<RenderableObject> renderable = RenderableObject::Create(i_sprite, i_game_object);
+    engine::memory::SharedPointer<RenderableObject> renderable = RenderableObject::Create(backend_, i_sprite, i_game_object);
 
     AddRenderableObject(renderable);
 
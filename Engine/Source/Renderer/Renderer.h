@@ -2,12 +2,16 @@
 #define RENDERER_H_
 
 // library includes
+#include <condition_variable>
 #include <mutex>
+#include <stdint.h>
+#include <thread>
 #include <vector>
 
 // engine includes
-#include "Memory\SharedPointer.h"
+#include "Memory/SharedPointer.h"
 #include "RenderableObject.h"
+#include "Renderer/RenderSnapshot.h"
 
 // forward declarations
 namespace GLib {
@@ -19,15 +23,31 @@ namespace engine {
 namespace data {
     class PooledString;
 }
+namespace render {
+    class InterfaceRenderBackend;
+}
 }
 
 namespace engine {
 namespace render {
 
+/*
+    Renderer
+    - Every frame starts by capturing a RenderSnapshot of the renderables on the thread that simulates, that's the only time
+      game objects & renderables are read
+    - The snapshot is then drawn either right away on the same thread, or on the render thread while the caller goes on to
+      simulate the next frame, so a frame takes as long as the slower of the two instead of both of them
+    - The render thread is only started if the backend can draw on any thread, GLib's backend always draws on the window's
+      thread
+    - There are two snapshots, one is captured while the other is drawn, a capture waits for the draw before it to finish
+      before handing its snapshot over
+    - Sprites are created & drawn by an InterfaceRenderBackend, GLib's window or a headless backend, the engine owns it & deletes
+      it only after every module that may hold renderables is gone
+*/
 class Renderer
 {
 private:
-    Renderer();
+    Renderer(InterfaceRenderBackend* i_backend);
     ~Renderer();
     static Renderer* instance_;
 
@@ -36,11 +56,22 @@ private:
     Renderer& operator=(const Renderer& i_copy) = delete;
 
 public:
-    static Renderer* Create();
+    static Renderer* Create(InterfaceRenderBackend* i_backend);
     static void Destroy();
     static inline Renderer* Get();
 
-    void Run(float i_dt);
+    // capture the frame, then draw it on the render thread if it is running or on the calling thread if it isn't
+    // i_interpolation is how far the frame is between the last two physics steps, 1 when physics runs every frame
+    void Run(float i_interpolation = 1.0f);
+
+    // draw on a thread of the renderer's own, Run must then always be called from the same thread
+    // does nothing if the backend can't draw on any thread, frames are then drawn by Run on the calling thread
+    void StartRenderThread();
+    // wait for the last snapshot to be drawn & stop the thread
+    void StopRenderThread();
+    inline bool IsRenderThreadRunning() const;
+
+    inline InterfaceRenderBackend* GetBackend() const;
 
     // create renderable objects
     inline engine::memory::SharedPointer<RenderableObject> CreateRenderableObject(const engine::data::PooledString& i_file_name);
@@ -55,12 +86,28 @@ public:
     inline void RemoveRenderableObject(const engine::memory::SharedPointer<RenderableObject>& i_renderable_object);
 
     GLib::Sprites::Sprite* CreateSprite(const engine::data::PooledString& i_texture_file_name, unsigned int i_width, unsigned int i_height);
+    void ReleaseSprite(GLib::Sprites::Sprite* i_sprite);
 
 private:
+    void Capture(float i_interpolation, RenderSnapshot& o_snapshot);
+    void Draw(const RenderSnapshot& i_snapshot);
+    void RenderThreadMain();
+
+private:
+    InterfaceRenderBackend*                                                         backend_;
     size_t                                                                          num_renderables_;
     std::vector<engine::memory::SharedPointer<RenderableObject>>                    renderables_;
     std::mutex                                                                      renderables_mutex_;
-    std::mutex                                                                      create_sprite_mutex_;
+
+    RenderSnapshot                                                                  snapshots_[2];
+    uint8_t                                                                         capture_index_;         // the snapshot the next frame is captured into
+
+    std::thread                                                                     render_thread_;
+    std::mutex                                                                      render_mutex_;          // guards everything below
+    std::condition_variable                                                         render_condition_;
+    const RenderSnapshot*                                                           pending_snapshot_;      // captured but not yet picked up by the render thread
+    bool                                                                            is_drawing_;
+    bool                                                                            is_stop_requested_;
 
 }; // class Renderer
 
@@ -0,0 +1,41 @@
+#include "FixedTimestep.h"
+
+// engine includes
+#include "Assert/Assert.h"
+
+namespace engine {
+namespace time {
+
+inline void FixedTimestep::Reset()
+{
+    accumulated_time_ms_ = 0.0f;
+}
+
+inline float FixedTimestep::GetStepTime() const
+{
+    return step_time_ms_;
+}
+
+inline float FixedTimestep::GetFrequency() const
+{
+    return frequency_;
+}
+
+inline uint8_t FixedTimestep::GetMaxSteps() const
+{
+    return max_steps_;
+}
+
+inline void FixedTimestep::SetMaxSteps(uint8_t i_max_steps)
+{
+    ASSERT(i_max_steps > 0);
+    max_steps_ = i_max_steps;
+}
+
+inline float FixedTimestep::GetInterpolation() const
+{
+    return accumulated_time_ms_ / step_time_ms_;
+}
+
+} // namespace time
+} // namespace engine
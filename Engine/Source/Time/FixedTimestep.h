@@ -0,0 +1,63 @@
+#ifndef FIXED_TIMESTEP_H_
+#define FIXED_TIMESTEP_H_
+
+// library includes
+#include <stdint.h>
+
+// number of fixed steps per second
+#define DEFAULT_FIXED_TIMESTEP_FREQUENCY        60.0f
+// maximum number of fixed steps taken in a single frame
+#define DEFAULT_FIXED_TIMESTEP_MAX_STEPS        4
+
+namespace engine {
+namespace time {
+
+/*
+    FixedTimestep
+    - Accumulates frame times and hands them out as a whole number of steps of a fixed length
+    - Never hands out more than the maximum number of steps in a frame, the time that couldn't be stepped is dropped
+      so that a slow frame doesn't make the next frames even slower
+    - The time left over after the last step is carried over to the next frame, the interpolation is that time as a fraction of a step
+*/
+
+class FixedTimestep
+{
+public:
+    FixedTimestep(float i_frequency = DEFAULT_FIXED_TIMESTEP_FREQUENCY, uint8_t i_max_steps = DEFAULT_FIXED_TIMESTEP_MAX_STEPS);
+    ~FixedTimestep();
+
+    // add a frame's time and return the number of steps to take this frame
+    uint8_t Advance(float i_frame_time_ms);
+    // forget any accumulated time
+    inline void Reset();
+
+    // accessors and mutators
+    inline float GetStepTime() const;
+
+    inline float GetFrequency() const;
+    void SetFrequency(float i_frequency);
+
+    inline uint8_t GetMaxSteps() const;
+    inline void SetMaxSteps(uint8_t i_max_steps);
+
+    // how far between the last step and the next one the current frame is, in the range [0, 1)
+    inline float GetInterpolation() const;
+
+private:
+    // disable copy constructor & copy assignment operator
+    FixedTimestep(const FixedTimestep& i_copy) = delete;
+    FixedTimestep& operator=(const FixedTimestep& i_copy) = delete;
+
+    float                                   frequency_;
+    float                                   step_time_ms_;
+    float                                   accumulated_time_ms_;
+    uint8_t                                 max_steps_;
+
+}; // class FixedTimestep
+
+} // namespace time
+} // namespace engine
+
+#include "FixedTimestep-inl.h"
+
+#endif // FIXED_TIMESTEP_H_
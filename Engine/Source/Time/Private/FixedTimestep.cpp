@@ -0,0 +1,51 @@
+#include "Time/FixedTimestep.h"
+
+// library includes
+#include <math.h>
+
+namespace engine {
+namespace time {
+
+FixedTimestep::FixedTimestep(float i_frequency, uint8_t i_max_steps) : frequency_(0.0f),
+    step_time_ms_(0.0f),
+    accumulated_time_ms_(0.0f),
+    max_steps_(0)
+{
+    SetFrequency(i_frequency);
+    SetMaxSteps(i_max_steps);
+}
+
+FixedTimestep::~FixedTimestep()
+{}
+
+uint8_t FixedTimestep::Advance(float i_frame_time_ms)
+{
+    ASSERT(i_frame_time_ms >= 0.0f);
+    accumulated_time_ms_ += i_frame_time_ms;
+
+    uint8_t num_steps = 0;
+    while (accumulated_time_ms_ >= step_time_ms_ && num_steps < max_steps_)
+    {
+        accumulated_time_ms_ -= step_time_ms_;
+        ++num_steps;
+    }
+
+    // too far behind to catch up, drop the whole steps but keep the fraction so the interpolation stays smooth
+    if (accumulated_time_ms_ >= step_time_ms_)
+    {
+        accumulated_time_ms_ = fmodf(accumulated_time_ms_, step_time_ms_);
+    }
+
+    return num_steps;
+}
+
+void FixedTimestep::SetFrequency(float i_frequency)
+{
+    ASSERT(i_frequency > 0.0f);
+    frequency_ = i_frequency;
+    step_time_ms_ = 1000.0f / i_frequency;
+    accumulated_time_ms_ = 0.0f;
+}
+
+} // namespace time
+} // namespace engine
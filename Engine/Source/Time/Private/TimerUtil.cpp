@@ -1,4 +1,4 @@
-#include "Time\TimerUtil.h"
+#include "Time/TimerUtil.h"
 
 namespace engine {
 namespace time {
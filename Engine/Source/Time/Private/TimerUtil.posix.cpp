@@ -0,0 +1,64 @@
+#include "Time/TimerUtil.h"
+
+// library includes
+#include <time.h>
+
+namespace engine {
+namespace time {
+
+double TimerUtil::CalculateTick()
+{
+    return GetCounter();
+}
+
+float TimerUtil::CalculateLastFrameTime_ms()
+{
+    // grab the monotonic clock
+    double current_tick = GetCounter();
+
+    if (last_frame_start_tick_)
+    {
+        // how many ticks have passed since the last time this function was called?
+        double elapsed_ticks = current_tick - last_frame_start_tick_;
+
+        // calculate time in milliseconds since the last time this function was called?
+        last_frame_time_ms_ = float(elapsed_ticks / GetFrequency());
+    }
+    else
+    {
+        last_frame_time_ms_ = 16.66667f;
+    }
+    // save the current frame's tick
+    last_frame_start_tick_ = current_tick;
+
+    return last_frame_time_ms_;
+}
+
+void TimerUtil::CustomSleep(uint32_t i_milli_seconds)
+{
+    timespec duration;
+    duration.tv_sec = time_t(i_milli_seconds / 1000);
+    duration.tv_nsec = long(i_milli_seconds % 1000) * 1000000L;
+    nanosleep(&duration, nullptr);
+}
+
+double TimerUtil::GetCounter()
+{
+    // a tick is a nanosecond
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return double(now.tv_sec) * 1000000000.0 + double(now.tv_nsec);
+}
+
+double TimerUtil::GetFrequency()
+{
+    if (pc_frequency_ <= 0)
+    {
+        // ticks per millisecond
+        pc_frequency_ = 1000000.0;
+    }
+    return pc_frequency_;
+}
+
+} // namespace time
+} // namespace engine
@@ -1,4 +1,4 @@
-#include "Time\TimerUtil.h"
+#include "Time/TimerUtil.h"
 
 // library includes
 #include <Windows.h>
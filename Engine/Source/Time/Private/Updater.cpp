@@ -1,10 +1,10 @@
-#include "Time\Updater.h"
+#include "Time/Updater.h"
 
 // engine includes
-#include "Common\HelperMacros.h"
-#include "Time\InterfaceTickable.h"
+#include "Common/HelperMacros.h"
+#include "Time/InterfaceTickable.h"
 
-#include "Logger\Logger.h"
+#include "Logger/Logger.h"
 
 namespace engine {
 namespace time {
@@ -4,9 +4,9 @@
 #include <algorithm>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Events\TimerEvent.h"
-#include "Logger\Logger.h"
+#include "Assert/Assert.h"
+#include "Events/TimerEvent.h"
+#include "Logger/Logger.h"
 
 namespace engine {
 namespace time {
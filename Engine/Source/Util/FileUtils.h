@@ -6,8 +6,8 @@
 #include <unordered_map>
 
 // engine includes
-#include "Data\HashedString.h"
-#include "Data\PooledString.h"
+#include "Data/HashedString.h"
+#include "Data/PooledString.h"
 
 namespace engine {
 namespace util {
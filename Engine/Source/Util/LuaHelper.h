@@ -2,11 +2,11 @@
 #define LUA_HELPER_H_
 
 // engine includes
-#include "Data\PooledString.h"
-#include "Math\AABB.h"
-#include "Math\Rect.h"
-#include "Math\Transform.h"
-#include "Math\Vec3D.h"
+#include "Data/PooledString.h"
+#include "Math/AABB.h"
+#include "Math/Rect.h"
+#include "Math/Transform.h"
+#include "Math/Vec3D.h"
 
 // forward declarations
 struct lua_State;
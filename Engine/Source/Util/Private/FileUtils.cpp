@@ -1,9 +1,13 @@
-#include "Util\FileUtils.h"
+#include "Util/FileUtils.h"
+
+// library includes
+#include <errno.h>
+#include <stdio.h>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Common\HelperMacros.h"
-#include "Logger\Logger.h"
+#include "Assert/Assert.h"
+#include "Common/HelperMacros.h"
+#include "Logger/Logger.h"
 
 namespace engine {
 namespace util {
@@ -51,10 +55,15 @@ const FileUtils::FileData FileUtils::ReadFile(const engine::data::PooledString&
     // read the file
     FILE * file = nullptr;
 
+#if defined(_MSC_VER)
     errno_t fopen_error = fopen_s(&file, i_file_name.GetString(), "rb");
+#else
+    file = fopen(i_file_name.GetString(), "rb");
+    int fopen_error = file ? 0 : errno;
+#endif
     if (fopen_error != 0)
     {
-        LOG_ERROR("Could not open %s...error code:%d", i_file_name, fopen_error);
+        LOG_ERROR("Could not open %s...error code:%d", i_file_name.GetString(), fopen_error);
         return FileData();
     }
 
@@ -95,7 +104,7 @@ const FileUtils::FileData FileUtils::ReadFile(const engine::data::PooledString&
         if (i_cache_file)
         {
             file_cache_.insert(std::pair<unsigned int, FileData>(hash, file_data));
-            LOG("FileUtils added '%s' to the cache", i_file_name);
+            LOG("FileUtils added '%s' to the cache", i_file_name.GetString());
         }
 
         return file_data;
@@ -1,6 +1,7 @@
-#include "Util\LuaHelper.h"
+#include "Util/LuaHelper.h"
 
 // library includes
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -8,8 +9,8 @@
 #include "lua.hpp"
 
 // engine includes 
-#include "Assert\Assert.h"
-#include "Logger\Logger.h"
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
 
 namespace engine {
 namespace util {
@@ -39,7 +40,7 @@ bool LuaHelper::CreateCString(lua_State* i_lua_state, const char* i_key_name, si
     if (const_string)
     {
         success = true;
-        sprintf_s(o_buffer, i_buffer_size, "%s", const_string);
+        snprintf(o_buffer, i_buffer_size, "%s", const_string);
     }
 #ifdef BUILD_DEBUG
     else
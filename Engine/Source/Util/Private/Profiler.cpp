@@ -1,11 +1,11 @@
 #if defined(ENABLE_PROFILING)
 
-#include "Util\Profiler.h"
+#include "Util/Profiler.h"
 
 // engine includes
-#include "Common\HelperMacros.h"
-#include "Logger\Logger.h"
-#include "Time\TimerUtil.h"
+#include "Common/HelperMacros.h"
+#include "Logger/Logger.h"
+#include "Time/TimerUtil.h"
 
 namespace engine {
 namespace util {
@@ -15,12 +15,14 @@ Profiler* Profiler::instance_ = nullptr;
 Profiler::Profiler()
 {
     accumulators_.reserve(20);
+    value_accumulators_.reserve(10);
 }
 
 Profiler::~Profiler()
 {
     DumpStatistics();
     accumulators_.clear();
+    value_accumulators_.clear();
 }
 
 Profiler* Profiler::Create()
@@ -42,6 +44,11 @@ void Profiler::RegisterAccumulator(const char* i_name, Accumulator* i_accumulato
     accumulators_.insert(std::make_pair(i_name, i_accumulator));
 }
 
+void Profiler::RegisterValueAccumulator(const char* i_name, Accumulator* i_accumulator)
+{
+    value_accumulators_.insert(std::make_pair(i_name, i_accumulator));
+}
+
 void Profiler::DumpStatistics()
 {
     LOG("---------- %s ----------", __FUNCTION__);
@@ -51,15 +58,26 @@ void Profiler::DumpStatistics()
         double timer_frequency = engine::time::TimerUtil::GetFrequency();
         LOG("%s - min:%1.8fms average:%1.8fms max:%1.8fms called:%d times", i.first, i.second->min_ / timer_frequency, i.second->Average() / timer_frequency, i.second->max_ / timer_frequency, i.second->count_);
     }
+    for (const auto& i : value_accumulators_)
+    {
+        LOG("%s - min:%.0f average:%.2f max:%.0f recorded:%d times", i.first, i.second->min_, i.second->Average(), i.second->max_, i.second->count_);
+    }
     LOG("---------- END ----------");
 }
 
-Accumulator::Accumulator(const char* i_name) : sum_(0.0),
+Accumulator::Accumulator(const char* i_name, bool i_is_timer) : sum_(0.0),
     count_(0),
     min_(std::numeric_limits<double>::max()),
     max_(std::numeric_limits<double>::min())
 {
-    Profiler::Get()->RegisterAccumulator(i_name, this);
+    if (i_is_timer)
+    {
+        Profiler::Get()->RegisterAccumulator(i_name, this);
+    }
+    else
+    {
+        Profiler::Get()->RegisterValueAccumulator(i_name, this);
+    }
 }
 
 ScopedTimer::ScopedTimer(Accumulator* i_accumulator) : start_(engine::time::TimerUtil::CalculateTick()),
@@ -18,11 +18,15 @@
     static engine::util::Accumulator CONCAT(__Accumulator, __LINE__)(name); engine::util::ScopedTimer CONCAT(__Timer, __LINE__)(&CONCAT(__Accumulator, __LINE__));
 #define PROFILE_SCOPE_END         }
 
+#define PROFILE_VALUE(name, value)                     \
+    { static engine::util::Accumulator CONCAT(__Accumulator, __LINE__)(name, false); CONCAT(__Accumulator, __LINE__) += double(value); }
+
 #else
 
 #define PROFILE_UNSCOPED(str)           //__noop
 #define PROFILE_SCOPE_BEGIN(str)        //__noop
 #define PROFILE_SCOPE_END               //__noop
+#define PROFILE_VALUE(str, value)       //__noop
 
 #endif
 
@@ -42,6 +46,7 @@ public:
     static inline Profiler* Get() { return Profiler::instance_; }
 
     void RegisterAccumulator(const char* i_name, Accumulator* i_accumulator);
+    void RegisterValueAccumulator(const char* i_name, Accumulator* i_accumulator);
     void DumpStatistics();
 
 private:
@@ -53,6 +58,7 @@ private:
     Profiler& operator=(const Profiler&) = delete;
 
     std::unordered_map<const char*, Accumulator*>       accumulators_;
+    std::unordered_map<const char*, Accumulator*>       value_accumulators_;
 
 }; // class Profiler
 
@@ -64,7 +70,8 @@ public:
     double                  min_;
     double                  max_;
 
-    Accumulator(const char* i_name);
+    // timing accumulators report in milliseconds, value accumulators report raw values
+    Accumulator(const char* i_name, bool i_is_timer = true);
 
     inline void operator+=(double i_time)
     {
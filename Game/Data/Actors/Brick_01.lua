@@ -20,6 +20,6 @@ Actor =
 
     render_settings = 
     {
-        sprite_name = "Data\\Sprites\\Brick_01.dds"
+        sprite_name = "Data/Sprites/Brick_01.dds"
     }
 }
@@ -20,7 +20,7 @@ Actor =
 
     render_settings = 
     {
-        sprite_name = "Data\\Sprites\\Bullet_01.dds"
+        sprite_name = "Data/Sprites/Bullet_01.dds"
     }
 }
 
@@ -20,6 +20,6 @@ Actor =
 
 	render_settings = 
 	{
-		sprite_name = "Data\\Sprites\\Enemy_01.dds"
+		sprite_name = "Data/Sprites/Enemy_01.dds"
 	}
 }
\ No newline at end of file
@@ -20,6 +20,6 @@ Actor =
 
 	render_settings = 
 	{
-		sprite_name = "Data\\Sprites\\Enemy_02.dds"
+		sprite_name = "Data/Sprites/Enemy_02.dds"
 	}
 }
\ No newline at end of file
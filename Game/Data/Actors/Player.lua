@@ -22,6 +22,6 @@ Actor =
 
 	render_settings = 
 	{
-		sprite_name = "Data\\Sprites\\Ship.dds"
+		sprite_name = "Data/Sprites/Ship.dds"
 	}
 }
\ No newline at end of file
@@ -1,38 +1,38 @@
 GameConfig = 
 {
-    player_lua = "Data\\Actors\\Player.lua",
-    bullet_lua = "Data\\Actors\\Bullet",
-    level_lua = "Data\\Levels\\Level_",
+    player_lua = "Data/Actors/Player.lua",
+    bullet_lua = "Data/Actors/Bullet",
+    level_lua = "Data/Levels/Level_",
     num_levels = 5,
 
     asset_list = 
     {
-        { file_name = "Data\\Sprites\\Brick_01.dds" },
-        { file_name = "Data\\Sprites\\Brick_02.dds" },
-        { file_name = "Data\\Sprites\\Bullet.dds" },
-        { file_name = "Data\\Sprites\\Bullet_01.dds" },
-        { file_name = "Data\\Sprites\\Bullet_02.dds" },
-        { file_name = "Data\\Sprites\\Bullet_03.dds" },
-        { file_name = "Data\\Sprites\\Enemy_01.dds" },
-        { file_name = "Data\\Sprites\\Enemy_02.dds" },
-        { file_name = "Data\\Sprites\\Enemy_03.dds" },
-        { file_name = "Data\\Sprites\\Ship.dds" },
+        { file_name = "Data/Sprites/Brick_01.dds" },
+        { file_name = "Data/Sprites/Brick_02.dds" },
+        { file_name = "Data/Sprites/Bullet.dds" },
+        { file_name = "Data/Sprites/Bullet_01.dds" },
+        { file_name = "Data/Sprites/Bullet_02.dds" },
+        { file_name = "Data/Sprites/Bullet_03.dds" },
+        { file_name = "Data/Sprites/Enemy_01.dds" },
+        { file_name = "Data/Sprites/Enemy_02.dds" },
+        { file_name = "Data/Sprites/Enemy_03.dds" },
+        { file_name = "Data/Sprites/Ship.dds" },
 
-        { file_name = "Data\\Actors\\Brick_01.lua" },
-        { file_name = "Data\\Actors\\Brick_02.lua" },
-        { file_name = "Data\\Actors\\Bullet.lua" },
-        { file_name = "Data\\Actors\\Bullet_01.lua" },
-        { file_name = "Data\\Actors\\Bullet_02.lua" },
-        { file_name = "Data\\Actors\\Bullet_03.lua" },
-        { file_name = "Data\\Actors\\Enemy_01.lua" },
-        { file_name = "Data\\Actors\\Enemy_02.lua" },
-        { file_name = "Data\\Actors\\Enemy_03.lua" },
-        { file_name = "Data\\Actors\\Player.lua" },
+        { file_name = "Data/Actors/Brick_01.lua" },
+        { file_name = "Data/Actors/Brick_02.lua" },
+        { file_name = "Data/Actors/Bullet.lua" },
+        { file_name = "Data/Actors/Bullet_01.lua" },
+        { file_name = "Data/Actors/Bullet_02.lua" },
+        { file_name = "Data/Actors/Bullet_03.lua" },
+        { file_name = "Data/Actors/Enemy_01.lua" },
+        { file_name = "Data/Actors/Enemy_02.lua" },
+        { file_name = "Data/Actors/Enemy_03.lua" },
+        { file_name = "Data/Actors/Player.lua" },
 
-        { file_name = "Data\\Levels\\Level_01.lua" },
-        { file_name = "Data\\Levels\\Level_02.lua" },
-        { file_name = "Data\\Levels\\Level_03.lua" },
-        { file_name = "Data\\Levels\\Level_04.lua" },
-        { file_name = "Data\\Levels\\Level_05.lua" }
+        { file_name = "Data/Levels/Level_01.lua" },
+        { file_name = "Data/Levels/Level_02.lua" },
+        { file_name = "Data/Levels/Level_03.lua" },
+        { file_name = "Data/Levels/Level_04.lua" },
+        { file_name = "Data/Levels/Level_05.lua" }
     }
 }
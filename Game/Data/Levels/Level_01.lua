@@ -7,30 +7,30 @@ Level =
 
     actors = 
     {
-        { file = "Data\\Actors\\Enemy_01.lua", position = { -360, 250, 0 } },
-        { file = "Data\\Actors\\Enemy_01.lua", position = { -180, 250, 0 } },
-        { file = "Data\\Actors\\Enemy_02.lua", position = { 0, 250, 0 } },
-        { file = "Data\\Actors\\Enemy_01.lua", position = { 180, 250, 0 } },
-        { file = "Data\\Actors\\Enemy_01.lua", position = { 360, 250, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { -360, 250, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { -180, 250, 0 } },
+        { file = "Data/Actors/Enemy_02.lua", position = { 0, 250, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { 180, 250, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { 360, 250, 0 } },
 
-        { file = "Data\\Actors\\Enemy_01.lua", position = { -270, 100, 0 } },
-        { file = "Data\\Actors\\Enemy_01.lua", position = { -90, 100, 0 } },
-        { file = "Data\\Actors\\Enemy_01.lua", position = { 90, 100, 0 } },
-        { file = "Data\\Actors\\Enemy_01.lua", position = { 270, 100, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { -270, 100, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { -90, 100, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { 90, 100, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { 270, 100, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { -340, -50, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { -276, -50, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { -340, -50, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { -276, -50, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { -190, -150, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { -126, -150, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { -190, -150, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { -126, -150, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { -40, -50, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { 24, -50, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { -40, -50, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { 24, -50, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { 110, -150, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { 174, -150, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { 110, -150, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { 174, -150, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { 260, -50, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { 324, -50, 0 } }
+        { file = "Data/Actors/Brick_02.lua", position = { 260, -50, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { 324, -50, 0 } }
     }
 }
@@ -7,37 +7,37 @@ Level =
 
     actors = 
     {
-        { file = "Data\\Actors\\Enemy_01.lua", position = { -360, 250, 0 } },
-        { file = "Data\\Actors\\Enemy_02.lua", position = { -180, 250, 0 } },
-        { file = "Data\\Actors\\Enemy_03.lua", position = { 0, 250, 0 } },
-        { file = "Data\\Actors\\Enemy_02.lua", position = { 180, 250, 0 } },
-        { file = "Data\\Actors\\Enemy_01.lua", position = { 360, 250, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { -360, 250, 0 } },
+        { file = "Data/Actors/Enemy_02.lua", position = { -180, 250, 0 } },
+        { file = "Data/Actors/Enemy_03.lua", position = { 0, 250, 0 } },
+        { file = "Data/Actors/Enemy_02.lua", position = { 180, 250, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { 360, 250, 0 } },
 
-        { file = "Data\\Actors\\Enemy_03.lua", position = { -270, 125, 0 } },
-        { file = "Data\\Actors\\Enemy_02.lua", position = { -90, 125, 0 } },
-        { file = "Data\\Actors\\Enemy_02.lua", position = { 90, 125, 0 } },
-        { file = "Data\\Actors\\Enemy_03.lua", position = { 270, 125, 0 } },
+        { file = "Data/Actors/Enemy_03.lua", position = { -270, 125, 0 } },
+        { file = "Data/Actors/Enemy_02.lua", position = { -90, 125, 0 } },
+        { file = "Data/Actors/Enemy_02.lua", position = { 90, 125, 0 } },
+        { file = "Data/Actors/Enemy_03.lua", position = { 270, 125, 0 } },
 
-        { file = "Data\\Actors\\Enemy_01.lua", position = { -360, -100, 0 } },
-        { file = "Data\\Actors\\Enemy_01.lua", position = { -180, -100, 0 } },
-        { file = "Data\\Actors\\Enemy_01.lua", position = { 0, -100, 0 } },
-        { file = "Data\\Actors\\Enemy_01.lua", position = { 180, -100, 0 } },
-        { file = "Data\\Actors\\Enemy_01.lua", position = { 360, -100, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { -360, -100, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { -180, -100, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { 0, -100, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { 180, -100, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { 360, -100, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { -490, 25, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { -426, 25, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { -490, 25, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { -426, 25, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { -260, 25, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { -196, 25, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { -260, 25, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { -196, 25, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { -30, 25, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { 34, 25, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { -30, 25, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { 34, 25, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { 200, 25, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { 254, 25, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { 200, 25, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { 254, 25, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { 430, 25, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { 494, 25, 0 } }
+        { file = "Data/Actors/Brick_02.lua", position = { 430, 25, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { 494, 25, 0 } }
     }
 }
 
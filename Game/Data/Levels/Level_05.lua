@@ -7,51 +7,51 @@ Level =
 
     actors = 
     {
-        { file = "Data\\Actors\\Enemy_02.lua", position = { -360, 250, 0 } },
-        { file = "Data\\Actors\\Enemy_03.lua", position = { -180, 250, 0 } },
-        { file = "Data\\Actors\\Enemy_01.lua", position = { 0, 250, 0 } },
-        { file = "Data\\Actors\\Enemy_03.lua", position = { 180, 250, 0 } },
-        { file = "Data\\Actors\\Enemy_02.lua", position = { 360, 250, 0 } },
+        { file = "Data/Actors/Enemy_02.lua", position = { -360, 250, 0 } },
+        { file = "Data/Actors/Enemy_03.lua", position = { -180, 250, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { 0, 250, 0 } },
+        { file = "Data/Actors/Enemy_03.lua", position = { 180, 250, 0 } },
+        { file = "Data/Actors/Enemy_02.lua", position = { 360, 250, 0 } },
 
-        { file = "Data\\Actors\\Enemy_03.lua", position = { -450, 125, 0 } },
-        { file = "Data\\Actors\\Enemy_01.lua", position = { -270, 125, 0 } },
-        { file = "Data\\Actors\\Enemy_02.lua", position = { -90, 125, 0 } },
-        { file = "Data\\Actors\\Enemy_02.lua", position = { 90, 125, 0 } },
-        { file = "Data\\Actors\\Enemy_01.lua", position = { 270, 125, 0 } },
-        { file = "Data\\Actors\\Enemy_03.lua", position = { 450, 125, 0 } },
+        { file = "Data/Actors/Enemy_03.lua", position = { -450, 125, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { -270, 125, 0 } },
+        { file = "Data/Actors/Enemy_02.lua", position = { -90, 125, 0 } },
+        { file = "Data/Actors/Enemy_02.lua", position = { 90, 125, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { 270, 125, 0 } },
+        { file = "Data/Actors/Enemy_03.lua", position = { 450, 125, 0 } },
 
-        { file = "Data\\Actors\\Enemy_01.lua", position = { -360, -75, 0 } },
-        { file = "Data\\Actors\\Enemy_02.lua", position = { -180, -75, 0 } },
-        { file = "Data\\Actors\\Enemy_03.lua", position = { 0, -75, 0 } },
-        { file = "Data\\Actors\\Enemy_02.lua", position = { 180, -75, 0 } },
-        { file = "Data\\Actors\\Enemy_01.lua", position = { 360, -75, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { -360, -75, 0 } },
+        { file = "Data/Actors/Enemy_02.lua", position = { -180, -75, 0 } },
+        { file = "Data/Actors/Enemy_03.lua", position = { 0, -75, 0 } },
+        { file = "Data/Actors/Enemy_02.lua", position = { 180, -75, 0 } },
+        { file = "Data/Actors/Enemy_01.lua", position = { 360, -75, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { -500, 25, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { -436, 25, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { -500, 25, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { -436, 25, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { -270, 25, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { -206, 25, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { -270, 25, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { -206, 25, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { -40, 25, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { 24, 25, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { -40, 25, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { 24, 25, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { 190, 25, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { 254, 25, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { 190, 25, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { 254, 25, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { 420, 25, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { 484, 25, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { 420, 25, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { 484, 25, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { -380, -175, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { -316, -175, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { -380, -175, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { -316, -175, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { -150, -175, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { -86, -175, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { -150, -175, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { -86, -175, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { 80, -175, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { 144, -175, 0 } },
+        { file = "Data/Actors/Brick_02.lua", position = { 80, -175, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { 144, -175, 0 } },
 
-        { file = "Data\\Actors\\Brick_02.lua", position = { 310, -175, 0 } },
-        { file = "Data\\Actors\\Brick_01.lua", position = { 374, -175, 0 } }
+        { file = "Data/Actors/Brick_02.lua", position = { 310, -175, 0 } },
+        { file = "Data/Actors/Brick_01.lua", position = { 374, -175, 0 } }
     }
 }
 
@@ -7,18 +7,18 @@
 #include <vector>
 
 // engine includes
-#include "Events\KeyboardEvent.h"
-#include "Events\TimerEvent.h"
-#include "GameObject\Actor.h"
-#include "Memory\SharedPointer.h"
-#include "Memory\WeakPointer.h"
-#include "Physics\Collider.h"
-#include "Time\InterfaceTickable.h"
-#include "Util\FileUtils.h"
+#include "Events/KeyboardEvent.h"
+#include "Events/TimerEvent.h"
+#include "GameObject/Actor.h"
+#include "Memory/SharedPointer.h"
+#include "Memory/WeakPointer.h"
+#include "Physics/Collider.h"
+#include "Time/InterfaceTickable.h"
+#include "Util/FileUtils.h"
 
 // game includes
-#include "Game\GameData.h"
-#include "Game\GameTypes.h"
+#include "Game/GameData.h"
+#include "Game/GameTypes.h"
 
 namespace game {
 
@@ -2,11 +2,12 @@
 #define GAME_DATA_H_
 
 // library includes
+#include <atomic>
 #include <functional>
 
 // engine includes
-#include "Data\PooledString.h"
-#include "Util\FileUtils.h"
+#include "Data/PooledString.h"
+#include "Util/FileUtils.h"
 
 namespace game {
 
@@ -52,12 +53,12 @@ private:
     GameData& operator=(const GameData& i_copy) = delete;
 
     void OnFileLoaded(const engine::util::FileUtils::FileData& i_file_data);
+    void OnAllFilesLoaded();
 
 private:
     std::function<void(void)>                               on_loading_complete_;
     std::function<void(void)>                               on_loading_failed_;
-    size_t                                                  files_left_to_load_;
-    size_t                                                  jobs_left_to_finish_;
+    std::atomic<size_t>                                     files_left_to_load_;
     engine::data::PooledString                              player_lua_file_path_;
     engine::data::PooledString                              bullet_lua_file_path_;
     engine::data::PooledString                              level_lua_file_path_;
@@ -7,10 +7,10 @@
 #include <string>
 
 // engine includes
-#include "Math\Vec3D.h"
+#include "Math/Vec3D.h"
 
 // game includes
-#include "Game\GameTypes.h"
+#include "Game/GameTypes.h"
 
 namespace game {
 
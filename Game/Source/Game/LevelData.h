@@ -7,10 +7,10 @@
 #include <vector>
 
 // engine includes
-#include "Data\PooledString.h"
-#include "GameObject\Actor.h"
-#include "Memory\SharedPointer.h"
-#include "Util\FileUtils.h"
+#include "Data/PooledString.h"
+#include "GameObject/Actor.h"
+#include "Memory/SharedPointer.h"
+#include "Util/FileUtils.h"
 
 namespace game {
 
@@ -51,6 +51,7 @@ private:
     LevelData& operator=(const LevelData&) = delete;
 
     void OnActorCreated(engine::memory::SharedPointer<engine::gameobject::Actor>);
+    void OnAllActorsCreated();
 
 private:
     std::function<void(void)>                           on_loading_complete_;
@@ -58,7 +59,6 @@ private:
     Level                                               level_;
     std::mutex                                          actors_created_mutex_;
     size_t                                              actors_left_to_create_;
-    size_t                                              jobs_left_to_finish_;
 
     friend class Game;
 
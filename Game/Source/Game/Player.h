@@ -6,11 +6,11 @@
 #include <vector>
 
 // engine includes
-#include "GameObject\Actor.h"
-#include "Events\KeyboardEvent.h"
-#include "Events\TimerEvent.h"
-#include "Memory\SharedPointer.h"
-#include "Time\InterfaceTickable.h"
+#include "GameObject/Actor.h"
+#include "Events/KeyboardEvent.h"
+#include "Events/TimerEvent.h"
+#include "Memory/SharedPointer.h"
+#include "Time/InterfaceTickable.h"
 
 // forward declaration
 namespace engine {
@@ -1,22 +1,25 @@
-#include "Game\Game.h"
+#include "Game/Game.h"
+
+// library includes
+#include <stdio.h>
 
 // engine includes 
-#include "Assert\Assert.h"
-#include "Common\Engine.h"
-#include "Common\HelperMacros.h"
-#include "Events\EventDispatcher.h"
-#include "GameObject\ActorCreator.h"
-#include "Jobs\CreateActorFromFileJob.h"
-#include "Jobs\FileLoadJob.h"
-#include "Jobs\JobSystem.h"
-#include "Logger\Logger.h"
-#include "Time\Updater.h"
-#include "Util\FileUtils.h"
+#include "Assert/Assert.h"
+#include "Common/Engine.h"
+#include "Common/HelperMacros.h"
+#include "Events/EventDispatcher.h"
+#include "GameObject/ActorCreator.h"
+#include "Jobs/CreateActorFromFileJob.h"
+#include "Jobs/FileLoadJob.h"
+#include "Jobs/JobSystem.h"
+#include "Logger/Logger.h"
+#include "Time/Updater.h"
+#include "Util/FileUtils.h"
 
 // game includes
-#include "Game\GameUtils.h"
-#include "Game\LevelData.h"
-#include "Game\Player.h"
+#include "Game/GameUtils.h"
+#include "Game/LevelData.h"
+#include "Game/Player.h"
 
 namespace game {
 
@@ -25,7 +28,8 @@ bool StartUp()
     LOG("-------------------- Game StartUp --------------------");
 
     // create a team of workers for the game
-    if (!engine::jobs::JobSystem::Get()->CreateTeam(engine::data::PooledString("GameTeam"), 10))
+    // level loading floods this team with small jobs, so let its workers steal from each other
+    if (!engine::jobs::JobSystem::Get()->CreateTeam(engine::data::PooledString("GameTeam"), 10, engine::jobs::SchedulingPolicy::WorkStealing))
     {
         LOG_ERROR("Could not create a job team for the game!");
         return false;
@@ -111,6 +115,8 @@ bool Game::Init()
 
     // register for collision events
     engine::physics::Collider::Get()->SetCollisionListener(this);
+    // bullets are fast & bricks are thin, so respond to collisions in order of their time of impact
+    engine::physics::Collider::Get()->SetIsContinuousCollisionEnabled(true);
 
     // create a new keyboard event
     keyboard_event_ = engine::events::KeyboardEvent::Create();
@@ -199,6 +205,9 @@ void Game::OnLevelLoadingComplete()
     fire_enemy_bullet_event_ = engine::events::TimerEvent::Create(std::bind(&Game::OnFireEnemyBulletTimerElapsed, this), level_data_->level_.enemy_fire_rate_, -1);
     engine::time::Updater::Get()->AddTimerEvent(fire_enemy_bullet_event_);
 
+    // the bricks never move during a level, so the collider only needs to build their tree once
+    engine::physics::Collider::Get()->BakeStaticObjects();
+
     game_state_ = GameStates::kGameStateRunning;
 }
 
@@ -375,7 +384,7 @@ void Game::CreateLevel()
     level_data_ = new LevelData();
 
     char buf[512];
-    sprintf_s(buf, "%s%02d.lua", game_data_.GetLevelLuaFilePath().GetString(), level_number_);
+    snprintf(buf, sizeof(buf), "%s%02d.lua", game_data_.GetLevelLuaFilePath().GetString(), level_number_);
 
     level_data_->LoadLevel(engine::util::FileUtils::Get()->GetFileFromCache(engine::data::HashedString::Hash(buf)), std::bind(&Game::OnLevelLoadingComplete, this), std::bind(&Game::OnLevelLoadingFailed, this));
 }
@@ -402,7 +411,7 @@ void Game::CreateEnemyBullets()
     for (uint8_t i = 0; i < BULLETS_PER_ENEMY_IN_POOL * 3; ++i)
     {
         char buf[512];
-        sprintf_s(buf, "%s_%02d.lua", game_data_.GetBulletLuaFilePath().GetString(), (i % BULLETS_PER_ENEMY_IN_POOL) + 1);
+        snprintf(buf, sizeof(buf), "%s_%02d.lua", game_data_.GetBulletLuaFilePath().GetString(), (i % BULLETS_PER_ENEMY_IN_POOL) + 1);
 
         engine::jobs::JobSystem::Get()->AddJob(new engine::jobs::CreateActorFromFileJob(engine::util::FileUtils::Get()->GetFileFromCache(engine::data::HashedString::Hash(buf)), 
             std::bind(&Game::OnEnemyBulletCreated, this, std::placeholders::_1)), job_team);
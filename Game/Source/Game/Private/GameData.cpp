@@ -1,26 +1,27 @@
-#include "Game\GameData.h"
+#include "Game/GameData.h"
 
 // external includes
 #include "lua.hpp"
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Events\TimerEvent.h"
-#include "Jobs\FileLoadJob.h"
-#include "Jobs\JobSystem.h"
-#include "Logger\Logger.h"
-#include "Time\Updater.h"
-#include "Util\LuaHelper.h"
+#include "Assert/Assert.h"
+#include "Events/TimerEvent.h"
+#include "Jobs/FileLoadJob.h"
+#include "Jobs/FunctionJob.h"
+#include "Jobs/JobCounter.h"
+#include "Jobs/JobSystem.h"
+#include "Logger/Logger.h"
+#include "Time/Updater.h"
+#include "Util/LuaHelper.h"
 
 namespace game {
 
 // static member initializations
-const char* GameData::GAME_CONFIG_FILE = "Data\\GameConfig.lua";
+const char* GameData::GAME_CONFIG_FILE = "Data/GameConfig.lua";
 
 GameData::GameData() : on_loading_complete_(nullptr),
     on_loading_failed_(nullptr),
     files_left_to_load_(0),
-    jobs_left_to_finish_(0),
     player_lua_file_path_(""),
     bullet_lua_file_path_(""),
     level_lua_file_path_(""),
@@ -83,6 +84,9 @@ void GameData::LoadAssetsListedInConfig(const std::function<void(void)>& i_on_lo
     size_t index = 0;
     const engine::data::PooledString game_team("GameTeam");
 
+    // counts the jobs that load the assets
+    const engine::jobs::JobHandle files_loaded = engine::jobs::JobCounter::Create();
+
     lua_pushnil(lua_state);
 
     // loop through all assets in the asset list
@@ -92,14 +96,13 @@ void GameData::LoadAssetsListedInConfig(const std::function<void(void)>& i_on_lo
         {
             // update counters
             ++files_left_to_load_;
-            ++jobs_left_to_finish_;
 
             // extract the file name for this asset
             const engine::data::PooledString asset_file_name = engine::util::LuaHelper::CreatePooledString(lua_state, "file_name");
 
             // create a job to load this asset
             engine::jobs::FileLoadJob* file_load_job = new engine::jobs::FileLoadJob(asset_file_name, std::bind(&GameData::OnFileLoaded, this, std::placeholders::_1), true);
-            engine::jobs::JobSystem::Get()->AddJob(file_load_job, game_team);
+            engine::jobs::JobSystem::Get()->AddJob(file_load_job, game_team, files_loaded);
         }
         else
         {
@@ -122,21 +125,22 @@ void GameData::LoadAssetsListedInConfig(const std::function<void(void)>& i_on_lo
     ASSERT(stack_items == 0);
 
     lua_close(lua_state);
+
+    // finish loading once every asset has been loaded
+    engine::jobs::JobSystem::Get()->AddJobAfter(new engine::jobs::FunctionJob(std::bind(&GameData::OnAllFilesLoaded, this), "AssetsLoadedJob"), game_team, files_loaded);
 }
 
 void GameData::OnFileLoaded(const engine::util::FileUtils::FileData& i_file_data)
 {
     // update counters
-    --jobs_left_to_finish_;
     files_left_to_load_ -= (i_file_data.file_contents && i_file_data.file_size > 0) ? 1 : 0;
+}
 
-    // check if all jobs have finished
-    if (jobs_left_to_finish_ == 0)
-    {
-        // call the appropriate callback function based on whether all files were loaded
-        // create a timer event so the callback is called from the main thread
-        engine::time::Updater::Get()->AddTimerEvent(engine::events::TimerEvent::Create(files_left_to_load_ == 0 ? on_loading_complete_ : on_loading_failed_, 0.001f, 0));
-    }
+void GameData::OnAllFilesLoaded()
+{
+    // call the appropriate callback function based on whether all files were loaded
+    // create a timer event so the callback is called from the main thread
+    engine::time::Updater::Get()->AddTimerEvent(engine::events::TimerEvent::Create(files_left_to_load_ == 0 ? on_loading_complete_ : on_loading_failed_, 0.001f, 0));
 }
 
 } // namespace monsterchase
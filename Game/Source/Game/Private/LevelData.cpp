@@ -1,23 +1,24 @@
-#include "Game\LevelData.h"
+#include "Game/LevelData.h"
 
 // external includes
 #include "lua.hpp"
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Events\TimerEvent.h"
-#include "Jobs\CreateActorFromFileAtPositionJob.h"
-#include "Jobs\JobSystem.h"
-#include "Logger\Logger.h"
-#include "Time\Updater.h"
-#include "Util\LuaHelper.h"
+#include "Assert/Assert.h"
+#include "Events/TimerEvent.h"
+#include "Jobs/CreateActorFromFileAtPositionJob.h"
+#include "Jobs/FunctionJob.h"
+#include "Jobs/JobCounter.h"
+#include "Jobs/JobSystem.h"
+#include "Logger/Logger.h"
+#include "Time/Updater.h"
+#include "Util/LuaHelper.h"
 
 namespace game {
 
 LevelData::LevelData() : on_loading_complete_(nullptr),
     on_loading_failed_(nullptr),
-    actors_left_to_create_(0),
-    jobs_left_to_finish_(0)
+    actors_left_to_create_(0)
 {}
 
 LevelData::~LevelData()
@@ -73,6 +74,9 @@ void LevelData::LoadLevel(const engine::util::FileUtils::FileData& i_level_file_
     size_t index = 0;
     static const engine::data::PooledString game_team("GameTeam");
 
+    // counts the jobs that create this level's actors
+    const engine::jobs::JobHandle actors_created = engine::jobs::JobCounter::Create();
+
     lua_pushnil(lua_state);
 
     // loop through all actors
@@ -84,7 +88,6 @@ void LevelData::LoadLevel(const engine::util::FileUtils::FileData& i_level_file_
 
             // update counters
             ++actors_left_to_create_;
-            ++jobs_left_to_finish_;
 
             // extract this actor's asset file information
             char file_name[512];
@@ -101,7 +104,7 @@ void LevelData::LoadLevel(const engine::util::FileUtils::FileData& i_level_file_
 
             // create a job to create this actor
             engine::jobs::CreateActorFromFileAtPositionJob* create_actor_job = new engine::jobs::CreateActorFromFileAtPositionJob(file_data, position, std::bind(&LevelData::OnActorCreated, this, std::placeholders::_1));
-            engine::jobs::JobSystem::Get()->AddJob(create_actor_job, game_team);
+            engine::jobs::JobSystem::Get()->AddJob(create_actor_job, game_team, actors_created);
         }
         else
         {
@@ -124,6 +127,9 @@ void LevelData::LoadLevel(const engine::util::FileUtils::FileData& i_level_file_
     ASSERT(stack_items == 0);
 
     lua_close(lua_state);
+
+    // finish loading once every actor has been created
+    engine::jobs::JobSystem::Get()->AddJobAfter(new engine::jobs::FunctionJob(std::bind(&LevelData::OnAllActorsCreated, this), "LevelLoadedJob"), game_team, actors_created);
 }
 
 void LevelData::OnActorCreated(engine::memory::SharedPointer<engine::gameobject::Actor> i_actor_created)
@@ -135,8 +141,6 @@ void LevelData::OnActorCreated(engine::memory::SharedPointer<engine::gameobject:
 
     std::lock_guard<std::mutex> lock(actors_created_mutex_);
 
-    --jobs_left_to_finish_;
-
     if (i_actor_created)
     {
         --actors_left_to_create_;
@@ -156,13 +160,13 @@ void LevelData::OnActorCreated(engine::memory::SharedPointer<engine::gameobject:
             LOG_ERROR("%s found invalid type for actor with name %s", __FUNCTION__, i_actor_created->GetName().GetString());
         }
     }
+}
 
-    if (jobs_left_to_finish_ == 0)
-    {
-        // call the appropriate callback function based on whether all files were loaded
-        // create a timer event so the callback is called from the main thread
-        engine::time::Updater::Get()->AddTimerEvent(engine::events::TimerEvent::Create(actors_left_to_create_ == 0 ? on_loading_complete_ : on_loading_failed_, 0.001f, 0));
-    }
+void LevelData::OnAllActorsCreated()
+{
+    // call the appropriate callback function based on whether all actors were created
+    // create a timer event so the callback is called from the main thread
+    engine::time::Updater::Get()->AddTimerEvent(engine::events::TimerEvent::Create(actors_left_to_create_ == 0 ? on_loading_complete_ : on_loading_failed_, 0.001f, 0));
 }
 
 } // namespace game
@@ -4,20 +4,26 @@
 #endif // BUILD_DEBUG
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Common\Engine.h"
+#include "Assert/Assert.h"
+#include "Common/Engine.h"
 #include "GLib.h"
-#include "Logger\Logger.h"
+#include "Logger/Logger.h"
 
 // game includes
-#include "Game\Game.h"
+#include "Game/Game.h"
 
 #ifdef ENABLE_TESTS
+void RunHeadlessTests();
 void RunTests();
 #endif // ENABLE_TESTS
 
 int WINAPI wWinMain( HINSTANCE i_h_instance, HINSTANCE i_h_prev_instance, LPWSTR i_lp_cmd_line, int i_n_cmd_show )
 {
+#ifdef ENABLE_TESTS
+    // tests that start an engine of their own must be done before the game's engine starts
+    RunHeadlessTests();
+#endif // ENABLE_TESTS
+
     // init engine
     if (engine::StartUp(i_h_instance, i_n_cmd_show, "Game", game::Game::SCREEN_WIDTH, game::Game::SCREEN_HEIGHT))
     {
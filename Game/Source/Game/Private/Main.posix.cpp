@@ -0,0 +1,59 @@
+// library includes
+#include <stdlib.h>
+
+// engine includes
+#include "Common/Engine.h"
+#include "Events/TimerEvent.h"
+#include "Logger/Logger.h"
+#include "Time/Updater.h"
+
+// game includes
+#include "Game/Game.h"
+
+#ifdef ENABLE_TESTS
+void RunHeadlessTests();
+void RunTests();
+#endif // ENABLE_TESTS
+
+// how long the game is simulated for when no duration is passed in
+static const float DEFAULT_SIMULATION_SECONDS = 60.0f;
+
+// runs the game headless & as fast as possible, for i_argv[1] seconds of game time, from the directory the game's Data folder is in
+int main(int i_argc, char** i_argv)
+{
+    const float simulation_seconds = i_argc > 1 ? float(atof(i_argv[1])) : DEFAULT_SIMULATION_SECONDS;
+    bool success = false;
+
+#ifdef ENABLE_TESTS
+    // tests that start an engine of their own must be done before the game's engine starts
+    RunHeadlessTests();
+#endif // ENABLE_TESTS
+
+    // init engine
+    if (engine::StartUpHeadless())
+    {
+#ifdef ENABLE_TESTS
+        RunTests();
+        LOG("\n");
+#endif // ENABLE_TESTS
+
+        // init game
+        success = game::StartUp();
+        if (success)
+        {
+            // there's no window to close, so stop once the game has been simulated for long enough
+            engine::time::Updater::Get()->AddTimerEvent(engine::events::TimerEvent::Create([]() { engine::InitiateShutdown(); }, simulation_seconds, 0));
+
+            engine::Run();
+        }
+
+        // cleanup game
+        game::Shutdown();
+    }
+
+    // cleanup
+    engine::Shutdown();
+
+    // servers & benchmark jobs are told when the game couldn't start
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
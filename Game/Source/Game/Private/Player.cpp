@@ -1,21 +1,22 @@
-#include "Game\Player.h"
+#include "Game/Player.h"
 
 // library includes
 #include <functional>
+#include <stdio.h>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Data\PooledString.h"
-#include "Jobs\CreateActorFromFileJob.h"
-#include "Jobs\JobSystem.h"
-#include "Events\EventDispatcher.h"
-#include "Logger\Logger.h"
-#include "Time\Updater.h"
+#include "Assert/Assert.h"
+#include "Data/PooledString.h"
+#include "Jobs/CreateActorFromFileJob.h"
+#include "Jobs/JobSystem.h"
+#include "Events/EventDispatcher.h"
+#include "Logger/Logger.h"
+#include "Time/Updater.h"
 
 // game includes
-#include "Game\Game.h"
-#include "Game\GameData.h"
-#include "Game\LevelData.h"
+#include "Game/Game.h"
+#include "Game/GameData.h"
+#include "Game/LevelData.h"
 
 namespace game {
 
@@ -121,7 +122,7 @@ void Player::CreateActors(const engine::data::PooledString& i_lua_file_name)
 
     // generate bullet's file name
     char buf[512];
-    sprintf_s(buf, "%s.lua", Game::GetInstance()->GetGameData().GetBulletLuaFilePath().GetString());
+    snprintf(buf, sizeof(buf), "%s.lua", Game::GetInstance()->GetGameData().GetBulletLuaFilePath().GetString());
 
     const engine::util::FileUtils::FileData bullet_file_data = engine::util::FileUtils::Get()->GetFileFromCache(engine::data::HashedString::Hash(buf));
     for (size_t i = 0; i < Player::BULLET_POOL_SIZE; ++i)
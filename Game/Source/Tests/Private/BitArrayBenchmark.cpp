@@ -0,0 +1,71 @@
+// library includes
+#include <stdlib.h>
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Data/BitArray.h"
+#include "Logger/Logger.h"
+#include "Memory/AllocatorUtil.h"
+#include "Memory/BlockAllocator.h"
+#include "Memory/FixedSizeAllocator.h"
+#include "Time/TimerUtil.h"
+
+const size_t        BIT_ARRAY_BENCHMARK_BLOCK_SIZE = 16;
+const size_t        BIT_ARRAY_BENCHMARK_NUM_ITERATIONS = 100000;
+const unsigned int  BIT_ARRAY_BENCHMARK_SEED = 1234;
+
+// keeps a pool 99% full & frees a random block before every allocation
+void RunNearFullPool(const size_t i_num_blocks)
+{
+    using engine::memory::BlockAllocator;
+    using engine::memory::FixedSizeAllocator;
+
+    // give the pool a block allocator of its own since the default allocator is too small for the largest pool
+    const size_t memory_size = i_num_blocks * (BIT_ARRAY_BENCHMARK_BLOCK_SIZE + 64) + 1024 * 1024;
+    void* memory = engine::memory::AlignedMalloc(memory_size, DEFAULT_BYTE_ALIGNMENT);
+    BlockAllocator* block_allocator = BlockAllocator::Create(memory, memory_size, engine::memory::AllocationPolicy::SegregatedFit);
+    FixedSizeAllocator* fsa = FixedSizeAllocator::Create(BIT_ARRAY_BENCHMARK_BLOCK_SIZE, i_num_blocks, block_allocator);
+
+    const size_t num_live_blocks = i_num_blocks - i_num_blocks / 100;
+    std::vector<void*> live_blocks;
+    live_blocks.reserve(num_live_blocks);
+    for (size_t i = 0; i < num_live_blocks; ++i)
+    {
+        live_blocks.push_back(fsa->Alloc());
+    }
+
+    srand(BIT_ARRAY_BENCHMARK_SEED);
+
+    const double start_tick = engine::time::TimerUtil::GetCounter();
+
+    for (size_t i = 0; i < BIT_ARRAY_BENCHMARK_NUM_ITERATIONS; ++i)
+    {
+        void*& block = live_blocks[(size_t(rand()) * RAND_MAX + rand()) % num_live_blocks];
+        fsa->Free(block);
+        block = fsa->Alloc();
+        ASSERT(block);
+    }
+
+    const double elapsed_ms = (engine::time::TimerUtil::GetCounter() - start_tick) / engine::time::TimerUtil::GetFrequency();
+
+    LOG("%zu blocks: %zu free & alloc pairs in %f ms (%f ns per pair)", i_num_blocks, BIT_ARRAY_BENCHMARK_NUM_ITERATIONS, elapsed_ms, elapsed_ms * 1000000.0 / BIT_ARRAY_BENCHMARK_NUM_ITERATIONS);
+
+    for (void* block : live_blocks)
+    {
+        fsa->Free(block);
+    }
+
+    FixedSizeAllocator::Destroy(fsa);
+    BlockAllocator::Destroy(block_allocator);
+    engine::memory::AlignedFree(memory);
+}
+
+void BenchmarkBitArray()
+{
+    LOG("-------------------- Running Bit Array Benchmark --------------------");
+
+    RunNearFullPool(1000);
+    RunNearFullPool(64 * 1000);
+    RunNearFullPool(1000 * 1000);
+}
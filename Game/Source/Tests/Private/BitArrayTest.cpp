@@ -1,9 +1,9 @@
 #include <stdint.h>
 
-#include "Logger\Logger.h"
-#include "Assert\Assert.h"
-#include "Memory\BlockAllocator.h"
-#include "Data\BitArray.h"
+#include "Logger/Logger.h"
+#include "Assert/Assert.h"
+#include "Memory/BlockAllocator.h"
+#include "Data/BitArray.h"
 
 void TestBitArray()
 {
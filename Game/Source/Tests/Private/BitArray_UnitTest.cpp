@@ -1,6 +1,6 @@
-#include "Data\BitArray.h"
-#include "Logger\Logger.h"
-#include "Memory\BlockAllocator.h"
+#include "Data/BitArray.h"
+#include "Logger/Logger.h"
+#include "Memory/BlockAllocator.h"
 
 void BitArray_UnitTest(const size_t i_bitCount)
 {
@@ -55,6 +55,63 @@ void BitArray_UnitTest(const size_t i_bitCount)
     engine::memory::BlockAllocator::GetDefaultAllocator()->Free(pMyArray);
 }
 
+void BitArray_SummaryUnitTest(const size_t i_bitCount)
+{
+    using namespace engine::data;
+
+    const size_t bit_array_memory_size = BitArray::GetRequiredMemorySize(i_bitCount);
+    void* bit_array_memory = engine::memory::BlockAllocator::GetDefaultAllocator()->Alloc(bit_array_memory_size);
+
+    BitArray* pMyArray = BitArray::Create(i_bitCount, bit_array_memory);
+
+    // fill the array using the hinted search, every bit found must be clear
+    size_t bit = 0;
+    for (size_t i = 0; i < i_bitCount; ++i)
+    {
+        bool success = pMyArray->FindClearBit(bit);
+        assert(success && bit < i_bitCount && pMyArray->IsBitClear(bit));
+        pMyArray->SetBit(bit);
+    }
+    assert(pMyArray->FindClearBit(bit) == false);
+    assert(pMyArray->GetFirstClearBit(bit) == false);
+    assert(pMyArray->AreAllSet());
+
+    // punch holes and find all of them again, the search may start anywhere
+    const size_t hole_stride = 7;
+    size_t num_holes = 0;
+    for (size_t i = 0; i < i_bitCount; i += hole_stride)
+    {
+        pMyArray->ClearBit(i);
+        ++num_holes;
+    }
+
+    bool success = pMyArray->GetFirstClearBit(bit);
+    assert(success && bit == 0);
+
+    for (size_t i = 0; i < num_holes; ++i)
+    {
+        success = pMyArray->FindClearBit(bit);
+        assert(success && (bit % hole_stride) == 0 && pMyArray->IsBitClear(bit));
+        pMyArray->SetBit(bit);
+    }
+    assert(pMyArray->FindClearBit(bit) == false);
+
+    // the summary must follow the bulk operations too
+    pMyArray->ClearAll();
+    assert(pMyArray->AreAllClear());
+    pMyArray->SetBit(i_bitCount - 1);
+    success = pMyArray->GetFirstSetBit(bit);
+    assert(success && bit == i_bitCount - 1);
+
+    pMyArray->ToggleAll();
+    success = pMyArray->GetFirstClearBit(bit);
+    assert(success && bit == i_bitCount - 1);
+    success = pMyArray->FindClearBit(bit);
+    assert(success && bit == i_bitCount - 1);
+
+    engine::memory::BlockAllocator::GetDefaultAllocator()->Free(pMyArray);
+}
+
 void RunBitArray_UnitTest()
 {
     LOG("-------------------- Running BitArray_UnitTest --------------------");
@@ -69,5 +126,12 @@ void RunBitArray_UnitTest()
     LOG("Testing with %zu bits...", bit_count);
     BitArray_UnitTest(bit_count);
 
+    const size_t summary_bit_counts[] = { 1, 63, 64, 65, 4095, 4096, 4097, 100000 };
+    for (size_t summary_bit_count : summary_bit_counts)
+    {
+        LOG("Testing summary with %zu bits...", summary_bit_count);
+        BitArray_SummaryUnitTest(summary_bit_count);
+    }
+
     LOG("-------------------- Finished BitArray_UnitTest --------------------");
 }
\ No newline at end of file
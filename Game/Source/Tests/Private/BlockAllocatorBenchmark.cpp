@@ -0,0 +1,102 @@
+// library includes
+#include <stdlib.h>
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+#include "Memory/AllocatorUtil.h"
+#include "Memory/BlockAllocator.h"
+#include "Time/TimerUtil.h"
+
+const size_t        BENCHMARK_MEMORY_SIZE = 8 * 1024 * 1024;
+const size_t        BENCHMARK_NUM_SLOTS = 4096;
+const size_t        BENCHMARK_NUM_ITERATIONS = 200000;
+const unsigned int  BENCHMARK_SEED = 1234;
+
+// mostly small requests with the occasional large one, like the engine's own traffic
+size_t GetRandomBenchmarkAllocationSize()
+{
+    const int bucket = rand() % 100;
+    if (bucket < 60)
+    {
+        return 8 + rand() % 120;
+    }
+    else if (bucket < 90)
+    {
+        return 128 + rand() % 896;
+    }
+    return 1024 + rand() % 15360;
+}
+
+size_t GetRandomBenchmarkAlignment()
+{
+    static const size_t alignments[] = { 4, 8, 16, 64 };
+    return alignments[rand() % 4];
+}
+
+void RunBlockAllocatorChurn(engine::memory::AllocationPolicy i_policy, const char* i_policy_name)
+{
+    using engine::memory::BlockAllocator;
+
+    void* memory = engine::memory::AlignedMalloc(BENCHMARK_MEMORY_SIZE, DEFAULT_BYTE_ALIGNMENT);
+    BlockAllocator* allocator = BlockAllocator::Create(memory, BENCHMARK_MEMORY_SIZE, i_policy);
+    const size_t initial_free_size = allocator->GetTotalFreeMemorySize();
+
+    std::vector<void*> slots(BENCHMARK_NUM_SLOTS, nullptr);
+    size_t num_failed = 0;
+
+    // both policies see the exact same sequence of requests
+    srand(BENCHMARK_SEED);
+
+    const double start_tick = engine::time::TimerUtil::GetCounter();
+
+    for (size_t i = 0; i < BENCHMARK_NUM_ITERATIONS; ++i)
+    {
+        void*& slot = slots[rand() % BENCHMARK_NUM_SLOTS];
+        if (slot != nullptr)
+        {
+            allocator->Free(slot);
+            slot = nullptr;
+        }
+        else
+        {
+            const size_t size = GetRandomBenchmarkAllocationSize();
+            const size_t alignment = GetRandomBenchmarkAlignment();
+            slot = allocator->Alloc(size, alignment);
+            ASSERT(slot == nullptr || (reinterpret_cast<uintptr_t>(slot) & (alignment - 1)) == 0);
+            num_failed += slot == nullptr ? 1 : 0;
+        }
+    }
+
+    const double elapsed_ms = (engine::time::TimerUtil::GetCounter() - start_tick) / engine::time::TimerUtil::GetFrequency();
+    const size_t num_outstanding = allocator->GetNumOustandingBlocks();
+
+    // release everything that is still live
+    for (void* slot : slots)
+    {
+        if (slot != nullptr)
+        {
+            allocator->Free(slot);
+        }
+    }
+    allocator->Defragment();
+
+    // every byte should have come back
+    ASSERT(allocator->GetNumOustandingBlocks() == 0);
+    ASSERT(allocator->GetTotalFreeMemorySize() == initial_free_size);
+
+    LOG("%s: %zu operations in %f ms (%f ns per operation), %zu failed, %zu outstanding at the end", i_policy_name,
+        BENCHMARK_NUM_ITERATIONS, elapsed_ms, elapsed_ms * 1000000.0 / BENCHMARK_NUM_ITERATIONS, num_failed, num_outstanding);
+
+    BlockAllocator::Destroy(allocator);
+    engine::memory::AlignedFree(memory);
+}
+
+void BenchmarkBlockAllocator()
+{
+    LOG("-------------------- Running Block Allocator Benchmark --------------------");
+
+    RunBlockAllocatorChurn(engine::memory::AllocationPolicy::FirstFit, "FirstFit");
+    RunBlockAllocatorChurn(engine::memory::AllocationPolicy::SegregatedFit, "SegregatedFit");
+}
@@ -8,6 +8,7 @@
 
 // engine includes
 #include "Logger/Logger.h"
+#include "Memory/AllocatorUtil.h"
 
 //#define SIMULATE_MEMORY_OVERWRITE
 
@@ -18,7 +19,7 @@ void BlockAllocatorTest::Init(size_t i_total_memory)
 {
     LOG("Testing BlockAllocator TOTAL_MEM:%zu", i_total_memory);
 
-    memory_ = _aligned_malloc(i_total_memory, DEFAULT_BYTE_ALIGNMENT);
+    memory_ = engine::memory::AlignedMalloc(i_total_memory, DEFAULT_BYTE_ALIGNMENT);
 
     block_allocator_ = engine::memory::BlockAllocator::Create(memory_, i_total_memory);
 #ifdef BUILD_DEBUG
@@ -32,7 +33,7 @@ void BlockAllocatorTest::Reset()
     engine::memory::BlockAllocator::Destroy(block_allocator_);
     block_allocator_ = nullptr;
 
-    _aligned_free(memory_);
+    engine::memory::AlignedFree(memory_);
     memory_ = nullptr;
 }
 
@@ -0,0 +1,184 @@
+// library includes
+#include <algorithm>
+#include <stdint.h>
+#include <stdlib.h>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+#include "Memory/FrameAllocator.h"
+#include "Physics/Broadphase.h"
+
+const size_t        BROADPHASE_TEST_NUM_PROXIES = 2000;
+const float         BROADPHASE_TEST_WORLD_SIZE = 2000.0f;
+
+// layer 0 collides with 0 & 1, layer 1 with 0, 1 & 2, layer 2 only with 1 & layer 3 with nothing
+const engine::physics::CollisionFilter BROADPHASE_TEST_FILTERS[] = { { 0x0001, 0x0003 }, { 0x0002, 0x0007 }, { 0x0004, 0x0002 }, { 0x0008, 0x0000 }, { 0x0000, 0xffff } };
+
+void FindSortedPairs(engine::physics::Broadphase& i_broadphase, const engine::memory::FrameVector<engine::physics::BroadphaseProxy>& i_proxies, engine::memory::FrameVector<engine::physics::BroadphasePair>& o_pairs)
+{
+    o_pairs.clear();
+    i_broadphase.FindPairs(i_proxies.data(), i_proxies.size(), o_pairs);
+    std::sort(o_pairs.begin(), o_pairs.end(), [](const engine::physics::BroadphasePair& i_lhs, const engine::physics::BroadphasePair& i_rhs) {
+        return i_lhs.first < i_rhs.first || (i_lhs.first == i_rhs.first && i_lhs.second < i_rhs.second);
+    });
+}
+
+// every pair of proxies that should be reported, found without any of the broadphase's shortcuts
+void FindExpectedPairs(const engine::memory::FrameVector<engine::physics::BroadphaseProxy>& i_proxies, engine::memory::FrameVector<engine::physics::BroadphasePair>& o_pairs)
+{
+    o_pairs.clear();
+    for (uint32_t i = 0; i < i_proxies.size(); ++i)
+    {
+        for (uint32_t j = i + 1; j < i_proxies.size(); ++j)
+        {
+            const engine::physics::BroadphaseProxy& proxy_a = i_proxies[i];
+            const engine::physics::BroadphaseProxy& proxy_b = i_proxies[j];
+            if ((proxy_a.is_dynamic || proxy_b.is_dynamic) &&
+                engine::physics::ShouldCollide(proxy_a.collision_filter, proxy_b.collision_filter) &&
+                proxy_a.min_x <= proxy_b.max_x && proxy_b.min_x <= proxy_a.max_x &&
+                proxy_a.min_y <= proxy_b.max_y && proxy_b.min_y <= proxy_a.max_y)
+            {
+                o_pairs.push_back({ i, j });
+            }
+        }
+    }
+}
+
+bool ArePairsEqual(const engine::memory::FrameVector<engine::physics::BroadphasePair>& i_lhs, const engine::memory::FrameVector<engine::physics::BroadphasePair>& i_rhs)
+{
+    if (i_lhs.size() != i_rhs.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < i_lhs.size(); ++i)
+    {
+        if (i_lhs[i].first != i_rhs[i].first || i_lhs[i].second != i_rhs[i].second)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void TestBroadphase()
+{
+    using engine::physics::Broadphase;
+    using engine::physics::BroadphasePair;
+    using engine::physics::BroadphaseProxy;
+    using engine::physics::BroadphaseType;
+
+    LOG("-------------------- Running Broadphase_UnitTest --------------------");
+
+    srand(7);
+
+    // a mix of small movers, static blocks & a few proxies larger than the grid can bucket
+    engine::memory::FrameVector<BroadphaseProxy> proxies;
+    for (uint32_t i = 0; i < BROADPHASE_TEST_NUM_PROXIES; ++i)
+    {
+        const float size = (i % 100 == 0) ? 1000.0f : 2.0f + float(rand() % 60);
+        BroadphaseProxy proxy;
+        proxy.min_x = float(rand() % int(BROADPHASE_TEST_WORLD_SIZE)) - BROADPHASE_TEST_WORLD_SIZE * 0.5f;
+        proxy.min_y = float(rand() % int(BROADPHASE_TEST_WORLD_SIZE)) - BROADPHASE_TEST_WORLD_SIZE * 0.5f;
+        proxy.max_x = proxy.min_x + size;
+        proxy.max_y = proxy.min_y + size * 0.5f;
+        proxy.id = i;
+        proxy.collision_filter = BROADPHASE_TEST_FILTERS[rand() % 5];
+        proxy.is_dynamic = rand() % 3 == 0;
+        proxy.key = i;
+        proxies.push_back(proxy);
+    }
+
+    engine::memory::FrameVector<BroadphasePair> expected_pairs;
+    FindExpectedPairs(proxies, expected_pairs);
+    ASSERT(expected_pairs.size() > 0);
+
+    // every type reports exactly the expected pairs, each of them once
+    Broadphase broadphase;
+    for (const BroadphaseProxy& proxy : proxies)
+    {
+        broadphase.AddProxy(proxy.key);
+    }
+    engine::memory::FrameVector<BroadphasePair> pairs;
+    const BroadphaseType types[] = { BroadphaseType::AllPairs, BroadphaseType::UniformGrid, BroadphaseType::SweepAndPrune, BroadphaseType::DynamicTree };
+    for (const BroadphaseType type : types)
+    {
+        broadphase.SetType(type);
+        FindSortedPairs(broadphase, proxies, pairs);
+        bool success = ArePairsEqual(pairs, expected_pairs);
+        ASSERT(success);
+        ASSERT(broadphase.GetNumPairsTested() < BROADPHASE_TEST_NUM_PROXIES * (BROADPHASE_TEST_NUM_PROXIES - 1) / 2);
+    }
+
+    // layers whose masks don't have each other are never tested against each other
+    const engine::physics::CollisionLayerMatrix& layer_matrix = broadphase.GetLayerMatrix();
+    ASSERT(layer_matrix.GetLayersCollide(0, 1) && layer_matrix.GetLayersCollide(1, 2) && layer_matrix.GetLayersCollide(2, 1));
+    ASSERT(!layer_matrix.GetLayersCollide(0, 2) && !layer_matrix.GetLayersCollide(2, 2) && !layer_matrix.GetLayersCollide(3, 3));
+
+    // sweep & prune keeps last frame's order & the dynamic tree keeps last frame's fat boxes, so move everything a little & check again
+    for (BroadphaseProxy& proxy : proxies)
+    {
+        const float move = float(rand() % 21 - 10);
+        proxy.min_x += move;
+        proxy.max_x += move;
+    }
+    FindExpectedPairs(proxies, expected_pairs);
+    FindSortedPairs(broadphase, proxies, pairs);
+    bool success = ArePairsEqual(pairs, expected_pairs);
+    ASSERT(success);
+    ASSERT(broadphase.GetNumMovedProxies() > 0 && broadphase.GetNumMovedProxies() < BROADPHASE_TEST_NUM_PROXIES);
+
+    // proxies that stay inside their fat boxes cost the tree nothing
+    FindSortedPairs(broadphase, proxies, pairs);
+    success = ArePairsEqual(pairs, expected_pairs) && broadphase.GetNumMovedProxies() == 0;
+    ASSERT(success);
+
+    // removed keys lose their pairs, even when they're added again right away for proxies somewhere else
+    for (size_t i = BROADPHASE_TEST_NUM_PROXIES / 2; i < BROADPHASE_TEST_NUM_PROXIES; ++i)
+    {
+        BroadphaseProxy& proxy = proxies[i];
+        broadphase.RemoveProxy(proxy.key);
+        if (i % 2)
+        {
+            broadphase.AddProxy(proxy.key);
+            proxy.min_y += BROADPHASE_TEST_WORLD_SIZE * 0.5f;
+            proxy.max_y += BROADPHASE_TEST_WORLD_SIZE * 0.5f;
+        }
+    }
+    proxies.erase(std::remove_if(proxies.begin(), proxies.end(), [](const BroadphaseProxy& i_proxy) {
+        return i_proxy.key >= BROADPHASE_TEST_NUM_PROXIES / 2 && i_proxy.key % 2 == 0;
+    }), proxies.end());
+    for (uint32_t i = 0; i < proxies.size(); ++i)
+    {
+        proxies[i].id = i;
+    }
+    FindExpectedPairs(proxies, expected_pairs);
+    FindSortedPairs(broadphase, proxies, pairs);
+    success = ArePairsEqual(pairs, expected_pairs) && broadphase.GetTree().GetNumProxies() == proxies.size() && broadphase.GetTree().Validate();
+    ASSERT(success);
+
+    // a smaller cell size changes nothing but the work done
+    broadphase.SetType(BroadphaseType::UniformGrid);
+    broadphase.SetCellSize(16.0f);
+    FindSortedPairs(broadphase, proxies, pairs);
+    success = ArePairsEqual(pairs, expected_pairs);
+    ASSERT(success);
+
+    // enemy bullets that only hit the player & enemies that only hit player bullets are skipped entirely, even when they all overlap
+    const engine::physics::CollisionFilter enemy_bullet_filter = { 0x0010, 0x0001 };
+    const engine::physics::CollisionFilter enemy_filter = { 0x0020, 0x0002 };
+    engine::memory::FrameVector<BroadphaseProxy> enemy_proxies;
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        enemy_proxies.push_back({ 0.0f, 0.0f, 10.0f, 10.0f, i, i % 2 ? enemy_bullet_filter : enemy_filter, true, uint32_t(BROADPHASE_TEST_NUM_PROXIES) + i });
+        broadphase.AddProxy(enemy_proxies.back().key);
+    }
+    for (const BroadphaseType type : types)
+    {
+        broadphase.SetType(type);
+        FindSortedPairs(broadphase, enemy_proxies, pairs);
+        ASSERT(pairs.size() == 0 && broadphase.GetNumPairsTested() == 0);
+    }
+
+    LOG("-------------------- Finished Broadphase_UnitTest --------------------");
+}
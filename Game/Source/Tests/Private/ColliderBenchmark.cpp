@@ -0,0 +1,159 @@
+// library includes
+#include <stdlib.h>
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "GameObject/GameObject.h"
+#include "Logger/Logger.h"
+#include "Math/AABB.h"
+#include "Math/Transform.h"
+#include "Memory/BlockAllocator.h"
+#include "Memory/FrameAllocator.h"
+#include "Physics/Broadphase.h"
+#include "Physics/Collider.h"
+#include "Physics/Physics.h"
+#include "Physics/PhysicsObject.h"
+#include "Time/TimerUtil.h"
+
+const size_t        COLLIDER_BENCHMARK_NUM_BRICKS = 2000;
+const size_t        COLLIDER_BENCHMARK_NUM_BULLETS = 8000;
+const size_t        COLLIDER_BENCHMARK_NUM_FRAMES = 30;
+const size_t        COLLIDER_BENCHMARK_NUM_ALL_PAIRS_FRAMES = 2;
+const float         COLLIDER_BENCHMARK_DT = 1000.0f / 60.0f;
+const float         COLLIDER_BENCHMARK_WORLD_WIDTH = 4000.0f;
+const float         COLLIDER_BENCHMARK_WORLD_HEIGHT = 2000.0f;
+const float         COLLIDER_BENCHMARK_BULLET_SPEED = 0.6f;
+
+// remembers the order in which collisions were reported
+class CollisionCounter : public engine::physics::InterfaceCollisionListener
+{
+public:
+    void OnCollision(const engine::physics::CollisionPair& i_collision_pair)
+    {
+        objects_.push_back(i_collision_pair.object_a);
+        objects_.push_back(i_collision_pair.object_b);
+    }
+
+    std::vector<engine::memory::WeakPointer<engine::physics::PhysicsObject>> objects_;
+};
+
+void BenchmarkCollider()
+{
+    using engine::gameobject::GameObject;
+    using engine::physics::BroadphaseType;
+    using engine::physics::Collider;
+    using engine::physics::Physics;
+    using engine::physics::PhysicsObject;
+    using engine::physics::PhysicsObjectType;
+
+    LOG("-------------------- Running Collider Benchmark --------------------");
+
+    // the engine usually owns these, create them if they don't exist yet
+    const bool owns_frame_allocator = engine::memory::FrameAllocator::Get() == nullptr;
+    engine::memory::FrameAllocator* frame_allocator = engine::memory::FrameAllocator::Create(DEFAULT_BLOCK_SIZE, engine::memory::BlockAllocator::GetDefaultAllocator());
+    const bool owns_collider = Collider::Get() == nullptr;
+    Collider* collider = Collider::Create();
+    const bool owns_physics = Physics::Get() == nullptr;
+    Physics::Create();
+
+    srand(11);
+
+    // rows of bricks with bullets flying up & down between them
+    std::vector<engine::memory::SharedPointer<GameObject>> game_objects;
+    std::vector<engine::memory::SharedPointer<PhysicsObject>> physics_objects;
+    std::vector<engine::math::Vec3D> bullet_velocities;
+    for (size_t i = 0; i < COLLIDER_BENCHMARK_NUM_BRICKS + COLLIDER_BENCHMARK_NUM_BULLETS; ++i)
+    {
+        const bool is_brick = i < COLLIDER_BENCHMARK_NUM_BRICKS;
+        const engine::math::Vec3D position(float(rand() % int(COLLIDER_BENCHMARK_WORLD_WIDTH)), float(rand() % int(COLLIDER_BENCHMARK_WORLD_HEIGHT)), 0.0f);
+        const engine::math::AABB aabb = { engine::math::Vec3D::ZERO, is_brick ? engine::math::Vec3D(20.0f, 10.0f, 0.0f) : engine::math::Vec3D(2.0f, 6.0f, 0.0f) };
+
+        game_objects.push_back(GameObject::Create(aabb, engine::math::Transform(position)));
+        physics_objects.push_back(PhysicsObject::Create(game_objects.back(), 1.0f, 0.0f, is_brick ? PhysicsObjectType::kPhysicsObjectStatic : PhysicsObjectType::kPhysicsObjectDynamic, PhysicsObject::DEFAULT_COLLISION_FILTER, true));
+        if (!is_brick)
+        {
+            bullet_velocities.push_back(engine::math::Vec3D(0.0f, rand() % 2 ? COLLIDER_BENCHMARK_BULLET_SPEED : -COLLIDER_BENCHMARK_BULLET_SPEED, 0.0f));
+        }
+        collider->AddPhysicsObject(physics_objects.back());
+    }
+    // frames are timed without Run, so apply the adds here
+    collider->ApplyCommands();
+
+    CollisionCounter collision_counter;
+    collider->SetCollisionListener(&collision_counter);
+    const BroadphaseType original_type = collider->GetBroadphase().GetType();
+
+    // the last pass bakes the bricks into the static tree, so only the bullets are left in the broadphase
+    const BroadphaseType types[] = { BroadphaseType::AllPairs, BroadphaseType::UniformGrid, BroadphaseType::SweepAndPrune, BroadphaseType::DynamicTree, BroadphaseType::UniformGrid };
+    const char* type_names[] = { "AllPairs", "UniformGrid", "SweepAndPrune", "DynamicTree", "UniformGrid & StaticBVH" };
+    const size_t baked_type = sizeof(types) / sizeof(types[0]) - 1;
+    size_t expected_num_candidates = 0;
+    std::vector<engine::memory::WeakPointer<PhysicsObject>> expected_objects;
+
+    for (size_t type = 0; type < sizeof(types) / sizeof(types[0]); ++type)
+    {
+        collider->GetBroadphase().SetType(types[type]);
+        if (type == baked_type)
+        {
+            collider->BakeStaticObjects();
+        }
+        const size_t num_frames = types[type] == BroadphaseType::AllPairs ? COLLIDER_BENCHMARK_NUM_ALL_PAIRS_FRAMES : COLLIDER_BENCHMARK_NUM_FRAMES;
+
+        double elapsed_ms = 0.0;
+        for (size_t frame = 0; frame < num_frames; ++frame)
+        {
+            // every frame sees the same scene, responding to collisions would change the bullets' velocities
+            for (size_t i = 0; i < COLLIDER_BENCHMARK_NUM_BULLETS; ++i)
+            {
+                physics_objects[COLLIDER_BENCHMARK_NUM_BRICKS + i]->SetVelocity(bullet_velocities[i]);
+            }
+            collision_counter.objects_.clear();
+
+            const double start_tick = engine::time::TimerUtil::GetCounter();
+            collider->DetectCollisions(COLLIDER_BENCHMARK_DT);
+            elapsed_ms += (engine::time::TimerUtil::GetCounter() - start_tick) / engine::time::TimerUtil::GetFrequency();
+
+            collider->RespondToCollisions(COLLIDER_BENCHMARK_DT);
+            frame_allocator->Reset();
+        }
+
+        // every broadphase must hand the same candidates to the narrowphase & the collisions must be reported in the same order
+        if (type == 0)
+        {
+            expected_num_candidates = collider->GetNumCandidatePairs();
+            expected_objects = collision_counter.objects_;
+        }
+        ASSERT(collider->GetNumCandidatePairs() == expected_num_candidates);
+        ASSERT(collision_counter.objects_ == expected_objects);
+
+        LOG("%s: %zu objects, %zu proxies moved, %zu pairs tested, %zu candidate pairs, %zu collisions, %zu reused contacts, %f ms per frame", type_names[type], physics_objects.size(),
+            collider->GetBroadphase().GetNumMovedProxies(), collider->GetBroadphase().GetNumPairsTested(), collider->GetNumCandidatePairs(), collision_counter.objects_.size() / 2, collider->GetNumReusedContacts(), elapsed_ms / num_frames);
+    }
+
+    collider->SetCollisionListener(nullptr);
+    for (const engine::memory::SharedPointer<PhysicsObject>& physics_object : physics_objects)
+    {
+        collider->RemovePhysicsObject(physics_object);
+    }
+    collider->ApplyCommands();
+    // nothing is left to bake, so this throws the tree away
+    collider->BakeStaticObjects();
+    collider->GetBroadphase().SetType(original_type);
+    physics_objects.clear();
+
+    if (owns_physics)
+    {
+        Physics::Destroy();
+    }
+    if (owns_collider)
+    {
+        Collider::Destroy();
+    }
+    if (owns_frame_allocator)
+    {
+        engine::memory::FrameAllocator::Destroy();
+    }
+
+    LOG("-------------------- Finished Collider Benchmark --------------------");
+}
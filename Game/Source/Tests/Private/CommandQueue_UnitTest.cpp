@@ -0,0 +1,139 @@
+// library includes
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Data/CommandQueue.h"
+#include "GameObject/GameObject.h"
+#include "Logger/Logger.h"
+#include "Math/AABB.h"
+#include "Math/Transform.h"
+#include "Physics/Collider.h"
+#include "Physics/Physics.h"
+#include "Physics/PhysicsObject.h"
+
+const size_t        COMMAND_QUEUE_TEST_NUM_PRODUCERS = 4;
+const size_t        COMMAND_QUEUE_TEST_NUM_COMMANDS = 20000;
+const size_t        COMMAND_QUEUE_TEST_NUM_OBJECTS = 64;
+
+struct CommandQueueTestCommand
+{
+    uint32_t                    producer;
+    uint32_t                    sequence;
+};
+
+void TestCommandQueueProducers()
+{
+    engine::data::CommandQueue<CommandQueueTestCommand> queue;
+    ASSERT(queue.IsEmpty());
+
+    // several threads push while this one keeps applying, each producer's commands must arrive in the order they were pushed
+    std::vector<std::thread> producers;
+    for (uint32_t producer = 0; producer < COMMAND_QUEUE_TEST_NUM_PRODUCERS; ++producer)
+    {
+        producers.push_back(std::thread([&queue, producer]() {
+            for (uint32_t sequence = 0; sequence < COMMAND_QUEUE_TEST_NUM_COMMANDS; ++sequence)
+            {
+                queue.Push({ producer, sequence });
+            }
+        }));
+    }
+
+    uint32_t next_sequences[COMMAND_QUEUE_TEST_NUM_PRODUCERS] = { 0 };
+    size_t num_applied = 0;
+    bool is_in_order = true;
+    while (num_applied < COMMAND_QUEUE_TEST_NUM_PRODUCERS * COMMAND_QUEUE_TEST_NUM_COMMANDS)
+    {
+        num_applied += queue.Apply([&next_sequences, &is_in_order](const CommandQueueTestCommand& i_command) {
+            is_in_order = is_in_order && i_command.sequence == next_sequences[i_command.producer];
+            ++next_sequences[i_command.producer];
+        });
+    }
+
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+
+    ASSERT(is_in_order);
+    ASSERT(queue.IsEmpty());
+    ASSERT(queue.Apply([](const CommandQueueTestCommand&) {}) == 0);
+    LOG("%zu commands from %zu producers applied in order", num_applied, COMMAND_QUEUE_TEST_NUM_PRODUCERS);
+}
+
+void TestCommandQueuePhysicsObjects()
+{
+    using engine::physics::Collider;
+    using engine::physics::Physics;
+    using engine::physics::PhysicsObject;
+    using engine::physics::PhysicsObjectType;
+
+    // the engine usually owns these, create them if they don't exist yet
+    const bool owns_collider = Collider::Get() == nullptr;
+    Collider* collider = Collider::Create();
+    const bool owns_physics = Physics::Get() == nullptr;
+    Physics* physics = Physics::Create();
+    const size_t num_initial_objects = physics->GetNumPhysicsObjects();
+
+    std::vector<engine::memory::SharedPointer<engine::gameobject::GameObject>> game_objects;
+    std::vector<engine::memory::SharedPointer<PhysicsObject>> physics_objects;
+    const engine::math::AABB aabb = { engine::math::Vec3D::ZERO, engine::math::Vec3D(10.0f, 10.0f, 0.0f) };
+    for (size_t i = 0; i < COMMAND_QUEUE_TEST_NUM_OBJECTS; ++i)
+    {
+        game_objects.push_back(engine::gameobject::GameObject::Create(aabb, engine::math::Transform(engine::math::Vec3D(float(i) * 100.0f, 0.0f, 0.0f))));
+        physics_objects.push_back(physics->CreatePhysicsObject(game_objects.back(), 1.0f, 0.0f, i % 2 ? PhysicsObjectType::kPhysicsObjectDynamic : PhysicsObjectType::kPhysicsObjectStatic, PhysicsObject::DEFAULT_COLLISION_FILTER, true));
+    }
+
+    // adds only take effect once the commands are applied
+    ASSERT(physics->GetNumPhysicsObjects() == num_initial_objects);
+    ASSERT(!physics->GetWorld().GetIsSimulated(physics_objects[0]->GetHandle()));
+    collider->ApplyCommands();
+    physics->ApplyCommands();
+    ASSERT(physics->GetNumPhysicsObjects() == num_initial_objects + COMMAND_QUEUE_TEST_NUM_OBJECTS);
+
+    // remove every third object, the others are moved into the gaps & must still be found afterwards
+    size_t num_removed = 0;
+    for (size_t i = 0; i < COMMAND_QUEUE_TEST_NUM_OBJECTS; i += 3)
+    {
+        physics->RemovePhysicsObject(physics_objects[i]);
+        ++num_removed;
+    }
+    collider->ApplyCommands();
+    physics->ApplyCommands();
+    ASSERT(physics->GetNumPhysicsObjects() == num_initial_objects + COMMAND_QUEUE_TEST_NUM_OBJECTS - num_removed);
+
+    for (size_t i = 0; i < COMMAND_QUEUE_TEST_NUM_OBJECTS; ++i)
+    {
+        ASSERT(physics->GetWorld().GetIsSimulated(physics_objects[i]->GetHandle()) == (i % 3 != 0));
+        if (i % 3 != 0)
+        {
+            physics->RemovePhysicsObject(physics_objects[i]);
+        }
+    }
+    collider->ApplyCommands();
+    physics->ApplyCommands();
+    ASSERT(physics->GetNumPhysicsObjects() == num_initial_objects);
+
+    physics_objects.clear();
+
+    if (owns_physics)
+    {
+        Physics::Destroy();
+    }
+    if (owns_collider)
+    {
+        Collider::Destroy();
+    }
+}
+
+void TestCommandQueue()
+{
+    LOG("-------------------- Running CommandQueue_UnitTest --------------------");
+
+    TestCommandQueueProducers();
+    TestCommandQueuePhysicsObjects();
+
+    LOG("-------------------- Finished CommandQueue_UnitTest --------------------");
+}
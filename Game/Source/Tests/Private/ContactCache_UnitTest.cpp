@@ -0,0 +1,156 @@
+// library includes
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "GameObject/GameObject.h"
+#include "Logger/Logger.h"
+#include "Math/AABB.h"
+#include "Math/Transform.h"
+#include "Physics/Collider.h"
+#include "Physics/ContactCache.h"
+#include "Physics/Physics.h"
+#include "Physics/PhysicsObject.h"
+
+// a step every object moves a whole number of units in, so objects moving together stay exactly the same distance apart
+const float         CONTACT_CACHE_TEST_DT = 16.0f;
+const float         CONTACT_CACHE_TEST_SPEED = 0.5f;
+const uint32_t      CONTACT_CACHE_TEST_NUM_CONTACTS = 1000;
+
+// counts the events of every kind
+class ContactCacheTestListener : public engine::physics::InterfaceCollisionListener
+{
+public:
+    ContactCacheTestListener() : num_collisions_(0),
+        num_enters_(0),
+        num_stays_(0),
+        num_exits_(0)
+    {}
+
+    void OnCollision(const engine::physics::CollisionPair& i_collision_pair) { ++num_collisions_; }
+    void OnCollisionEnter(const engine::physics::CollisionPair& i_collision_pair) { ++num_enters_; }
+    void OnCollisionStay(const engine::physics::CollisionPair& i_collision_pair) { ++num_stays_; }
+    void OnCollisionExit(const engine::physics::CollisionPair& i_collision_pair) { ++num_exits_; }
+
+    size_t num_collisions_;
+    size_t num_enters_;
+    size_t num_stays_;
+    size_t num_exits_;
+};
+
+engine::memory::SharedPointer<engine::physics::PhysicsObject> CreateContactCacheTestObject(std::vector<engine::memory::SharedPointer<engine::gameobject::GameObject>>& io_game_objects, float i_x)
+{
+    const engine::math::AABB aabb = { engine::math::Vec3D::ZERO, engine::math::Vec3D(10.0f, 10.0f, 0.0f) };
+    io_game_objects.push_back(engine::gameobject::GameObject::Create(aabb, engine::math::Transform(engine::math::Vec3D(i_x, 0.0f, 0.0f))));
+    return engine::physics::Physics::Get()->CreatePhysicsObject(io_game_objects.back(), 1.0f, 0.0f, engine::physics::PhysicsObjectType::kPhysicsObjectDynamic, engine::physics::PhysicsObject::DEFAULT_COLLISION_FILTER, true);
+}
+
+void TestContactCache()
+{
+    using engine::physics::Collider;
+    using engine::physics::ContactCache;
+    using engine::physics::Physics;
+    using engine::physics::PhysicsObject;
+
+    LOG("-------------------- Running ContactCache_UnitTest --------------------");
+
+    // the cache itself: keys don't depend on the order of the handles & contacts that aren't added again are removed
+    {
+        ContactCache contact_cache;
+        ASSERT(ContactCache::GetKey(3, 7) == ContactCache::GetKey(7, 3) && ContactCache::GetKey(3, 7) != ContactCache::GetKey(3, 8));
+
+        const engine::physics::CollisionPair collision = { 0.0f, engine::math::Vec3D::ZERO };
+        const engine::physics::ContactState state = { engine::math::Vec3D::ZERO, engine::math::Vec3D::ZERO, 0.0f, 0.0f, CONTACT_CACHE_TEST_DT };
+        engine::memory::FrameVector<engine::physics::CollisionPair> exited_collisions;
+
+        contact_cache.BeginFrame();
+        contact_cache.AddContact(3, 7, collision, state);
+        contact_cache.AddContact(1, 2, collision, state);
+        contact_cache.EndFrame(exited_collisions);
+        ASSERT(contact_cache.GetNumContacts() == 2 && exited_collisions.empty());
+        ASSERT(contact_cache.Find(7, 3)->num_frames == 1);
+
+        contact_cache.BeginFrame();
+        contact_cache.AddContact(7, 3, collision, state);
+        contact_cache.EndFrame(exited_collisions);
+        ASSERT(contact_cache.GetNumContacts() == 1 && exited_collisions.size() == 1);
+        ASSERT(contact_cache.Find(3, 7)->num_frames == 2 && contact_cache.Find(1, 2) == nullptr);
+
+        // enough contacts to grow the table, dropping every other one must leave the rest where they can be found
+        contact_cache.Clear();
+        contact_cache.BeginFrame();
+        for (engine::physics::PhysicsHandle i = 0; i < CONTACT_CACHE_TEST_NUM_CONTACTS; ++i)
+        {
+            contact_cache.AddContact(i, i + CONTACT_CACHE_TEST_NUM_CONTACTS, collision, state);
+        }
+        contact_cache.BeginFrame();
+        for (engine::physics::PhysicsHandle i = 0; i < CONTACT_CACHE_TEST_NUM_CONTACTS; i += 2)
+        {
+            contact_cache.AddContact(i + CONTACT_CACHE_TEST_NUM_CONTACTS, i, collision, state);
+        }
+        exited_collisions.clear();
+        contact_cache.EndFrame(exited_collisions);
+        ASSERT(contact_cache.GetNumContacts() == CONTACT_CACHE_TEST_NUM_CONTACTS / 2 && exited_collisions.size() == CONTACT_CACHE_TEST_NUM_CONTACTS / 2);
+        for (engine::physics::PhysicsHandle i = 0; i < CONTACT_CACHE_TEST_NUM_CONTACTS; ++i)
+        {
+            const engine::physics::Contact* contact = contact_cache.Find(i, i + CONTACT_CACHE_TEST_NUM_CONTACTS);
+            ASSERT(i % 2 == 0 ? contact != nullptr && contact->num_frames == 2 : contact == nullptr);
+        }
+    }
+
+    // the engine usually owns these, create them if they don't exist yet
+    const bool owns_collider = Collider::Get() == nullptr;
+    Collider* collider = Collider::Create();
+    const bool owns_physics = Physics::Get() == nullptr;
+    Physics* physics = Physics::Create();
+
+    ContactCacheTestListener listener;
+    collider->SetCollisionListener(&listener);
+
+    // two overlapping objects moving together keep touching & stay in exactly the same relative state
+    std::vector<engine::memory::SharedPointer<engine::gameobject::GameObject>> game_objects;
+    const engine::memory::SharedPointer<PhysicsObject> a = CreateContactCacheTestObject(game_objects, 0.0f);
+    const engine::memory::SharedPointer<PhysicsObject> b = CreateContactCacheTestObject(game_objects, 15.0f);
+    a->ApplyImpulse(engine::math::Vec3D(CONTACT_CACHE_TEST_SPEED, 0.0f, 0.0f));
+    b->ApplyImpulse(engine::math::Vec3D(CONTACT_CACHE_TEST_SPEED, 0.0f, 0.0f));
+
+    collider->Run(CONTACT_CACHE_TEST_DT);
+    physics->Run(CONTACT_CACHE_TEST_DT);
+    ASSERT(listener.num_collisions_ == 1 && listener.num_enters_ == 1 && listener.num_stays_ == 0 && listener.num_exits_ == 0);
+    ASSERT(collider->GetNumReusedContacts() == 0 && collider->GetContactCache().GetNumContacts() == 1);
+
+    // the second frame the pair is in the same state, so it reuses last frame's collision instead of being tested again
+    collider->Run(CONTACT_CACHE_TEST_DT);
+    physics->Run(CONTACT_CACHE_TEST_DT);
+    ASSERT(listener.num_collisions_ == 2 && listener.num_enters_ == 1 && listener.num_stays_ == 1 && listener.num_exits_ == 0);
+    ASSERT(collider->GetNumReusedContacts() == 1);
+    ASSERT(collider->GetContactCache().Find(a->GetHandle(), b->GetHandle())->num_frames == 2);
+
+    // once they're apart, they stop touching exactly once
+    game_objects[1]->SetPosition(engine::math::Vec3D(500.0f, 0.0f, 0.0f));
+    collider->Run(CONTACT_CACHE_TEST_DT);
+    physics->Run(CONTACT_CACHE_TEST_DT);
+    collider->Run(CONTACT_CACHE_TEST_DT);
+    physics->Run(CONTACT_CACHE_TEST_DT);
+    ASSERT(listener.num_collisions_ == 2 && listener.num_enters_ == 1 && listener.num_stays_ == 1 && listener.num_exits_ == 1);
+    ASSERT(collider->GetContactCache().GetNumContacts() == 0);
+
+    LOG("%zu enter, %zu stay & %zu exit events", listener.num_enters_, listener.num_stays_, listener.num_exits_);
+
+    collider->SetCollisionListener(nullptr);
+    physics->RemovePhysicsObject(a);
+    physics->RemovePhysicsObject(b);
+    collider->ApplyCommands();
+    physics->ApplyCommands();
+
+    if (owns_physics)
+    {
+        Physics::Destroy();
+    }
+    if (owns_collider)
+    {
+        Collider::Destroy();
+    }
+
+    LOG("-------------------- Finished ContactCache_UnitTest --------------------");
+}
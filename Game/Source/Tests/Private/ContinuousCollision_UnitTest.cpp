@@ -0,0 +1,185 @@
+// library includes
+#include <algorithm>
+#include <math.h>
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "GameObject/GameObject.h"
+#include "Logger/Logger.h"
+#include "Math/AABB.h"
+#include "Math/Transform.h"
+#include "Physics/Collider.h"
+#include "Physics/Physics.h"
+#include "Physics/PhysicsObject.h"
+
+const float         CONTINUOUS_COLLISION_TEST_DT = 1000.0f / 60.0f;
+// just below PhysicsObject::MAX_VELOCITY_LENGTH_SQUARED & fast enough to pass through both bricks in a single step
+const float         CONTINUOUS_COLLISION_TEST_BULLET_SPEED = 2.4f;
+
+// remembers the order in which the bricks were hit & which bricks started, kept & stopped touching
+class ContinuousCollisionTestListener : public engine::physics::InterfaceCollisionListener
+{
+public:
+    void OnCollision(const engine::physics::CollisionPair& i_collision_pair)
+    {
+        times_.push_back(i_collision_pair.time);
+        bricks_.push_back(i_collision_pair.object_b.Lock());
+    }
+    void OnCollisionEnter(const engine::physics::CollisionPair& i_collision_pair) { entered_bricks_.push_back(i_collision_pair.object_b.Lock()); }
+    void OnCollisionStay(const engine::physics::CollisionPair& i_collision_pair) { stayed_bricks_.push_back(i_collision_pair.object_b.Lock()); }
+    void OnCollisionExit(const engine::physics::CollisionPair& i_collision_pair) { exited_bricks_.push_back(i_collision_pair.object_b.Lock()); }
+
+    std::vector<float> times_;
+    std::vector<engine::memory::SharedPointer<engine::physics::PhysicsObject>> bricks_;
+    std::vector<engine::memory::SharedPointer<engine::physics::PhysicsObject>> entered_bricks_;
+    std::vector<engine::memory::SharedPointer<engine::physics::PhysicsObject>> stayed_bricks_;
+    std::vector<engine::memory::SharedPointer<engine::physics::PhysicsObject>> exited_bricks_;
+};
+
+engine::memory::SharedPointer<engine::physics::PhysicsObject> CreateContinuousCollisionTestObject(std::vector<engine::memory::SharedPointer<engine::gameobject::GameObject>>& io_game_objects,
+    float i_x,
+    const engine::math::Vec3D& i_extents,
+    engine::physics::PhysicsObjectType i_type)
+{
+    const engine::math::AABB aabb = { engine::math::Vec3D::ZERO, i_extents };
+    io_game_objects.push_back(engine::gameobject::GameObject::Create(aabb, engine::math::Transform(engine::math::Vec3D(i_x, 0.0f, 0.0f))));
+    return engine::physics::Physics::Get()->CreatePhysicsObject(io_game_objects.back(), 1.0f, 0.0f, i_type, engine::physics::PhysicsObject::DEFAULT_COLLISION_FILTER, true);
+}
+
+// fire a bullet at two thin bricks, the far one was added first so it is found first
+void RunContinuousCollisionTestStep(ContinuousCollisionTestListener& io_listener,
+    engine::memory::SharedPointer<engine::physics::PhysicsObject>& o_near_brick,
+    engine::memory::SharedPointer<engine::physics::PhysicsObject>& o_far_brick,
+    engine::math::Vec3D& o_bullet_position,
+    engine::math::Vec3D& o_bullet_previous_position)
+{
+    using engine::physics::Collider;
+    using engine::physics::Physics;
+    using engine::physics::PhysicsObject;
+    using engine::physics::PhysicsObjectType;
+
+    Collider* collider = Collider::Get();
+    Physics* physics = Physics::Get();
+
+    std::vector<engine::memory::SharedPointer<engine::gameobject::GameObject>> game_objects;
+    const engine::memory::SharedPointer<PhysicsObject> bullet = CreateContinuousCollisionTestObject(game_objects, 0.0f, engine::math::Vec3D(2.0f, 2.0f, 0.0f), PhysicsObjectType::kPhysicsObjectDynamic);
+    o_far_brick = CreateContinuousCollisionTestObject(game_objects, 30.0f, engine::math::Vec3D(2.0f, 20.0f, 0.0f), PhysicsObjectType::kPhysicsObjectStatic);
+    o_near_brick = CreateContinuousCollisionTestObject(game_objects, 20.0f, engine::math::Vec3D(2.0f, 20.0f, 0.0f), PhysicsObjectType::kPhysicsObjectStatic);
+    bullet->ApplyImpulse(engine::math::Vec3D(CONTINUOUS_COLLISION_TEST_BULLET_SPEED, 0.0f, 0.0f));
+
+    // only bodies the physics system simulates can be moved to their impacts
+    physics->ApplyCommands();
+
+    io_listener.times_.clear();
+    io_listener.bricks_.clear();
+    collider->Run(CONTINUOUS_COLLISION_TEST_DT);
+    physics->Run(CONTINUOUS_COLLISION_TEST_DT);
+
+    o_bullet_position = game_objects[0]->GetPosition();
+    o_bullet_previous_position = game_objects[0]->GetPreviousPosition();
+
+    for (const engine::memory::SharedPointer<PhysicsObject>& physics_object : { bullet, o_far_brick, o_near_brick })
+    {
+        physics->RemovePhysicsObject(physics_object);
+    }
+    collider->ApplyCommands();
+    physics->ApplyCommands();
+}
+
+void TestContinuousCollision()
+{
+    using engine::physics::Collider;
+    using engine::physics::Physics;
+    using engine::physics::PhysicsObject;
+
+    LOG("-------------------- Running ContinuousCollision_UnitTest --------------------");
+
+    // the engine usually owns these, create them if they don't exist yet
+    const bool owns_collider = Collider::Get() == nullptr;
+    Collider* collider = Collider::Create();
+    const bool owns_physics = Physics::Get() == nullptr;
+    Physics::Create();
+
+    ContinuousCollisionTestListener listener;
+    collider->SetCollisionListener(&listener);
+    const bool was_continuous_collision_enabled = collider->GetIsContinuousCollisionEnabled();
+    const uint8_t original_max_impact_iterations = collider->GetMaxImpactIterations();
+
+    engine::memory::SharedPointer<PhysicsObject> near_brick;
+    engine::memory::SharedPointer<PhysicsObject> far_brick;
+    engine::math::Vec3D position;
+    engine::math::Vec3D previous_position;
+
+    // in the order they were found, the bullet bounces off the far brick & the whole step is integrated from where it started
+    collider->SetIsContinuousCollisionEnabled(false);
+    RunContinuousCollisionTestStep(listener, near_brick, far_brick, position, previous_position);
+    ASSERT(listener.bricks_.size() == 2 && listener.bricks_[0] == far_brick);
+    ASSERT(position.x() < 0.0f);
+
+    // by time of impact, the bullet is stopped by the near brick at x = 16 & bounces back for the rest of the step
+    collider->SetIsContinuousCollisionEnabled(true);
+    collider->SetMaxImpactIterations(COLLIDER_DEFAULT_MAX_IMPACT_ITERATIONS);
+    RunContinuousCollisionTestStep(listener, near_brick, far_brick, position, previous_position);
+    ASSERT(listener.bricks_.size() == 1 && listener.bricks_[0] == near_brick);
+    const float impact_time = 16.0f / CONTINUOUS_COLLISION_TEST_BULLET_SPEED;
+    ASSERT(fabs(listener.times_[0] - impact_time) < 0.001f);
+    ASSERT(fabs(position.x() - (16.0f - CONTINUOUS_COLLISION_TEST_BULLET_SPEED * (CONTINUOUS_COLLISION_TEST_DT - impact_time))) < 0.01f);
+    // rendering still interpolates from where the bullet started the step
+    ASSERT(previous_position.x() == 0.0f);
+    LOG("Bullet stopped by the near brick at t = %f, ended the step at x = %f", impact_time, position.x());
+
+    // without any impact iterations, collisions are still ordered by time but nothing is moved or tested again
+    collider->SetMaxImpactIterations(0);
+    RunContinuousCollisionTestStep(listener, near_brick, far_brick, position, previous_position);
+    ASSERT(listener.bricks_.size() == 2 && listener.bricks_[0] == near_brick && listener.bricks_[1] == far_brick);
+    ASSERT(listener.times_[0] <= listener.times_[1]);
+
+    // the far brick was found, but the test from the near brick's impact dropped it, so it never starts or stops touching
+    collider->SetMaxImpactIterations(COLLIDER_DEFAULT_MAX_IMPACT_ITERATIONS);
+    std::vector<engine::memory::SharedPointer<engine::gameobject::GameObject>> game_objects;
+    const engine::memory::SharedPointer<PhysicsObject> bullet = CreateContinuousCollisionTestObject(game_objects, 0.0f, engine::math::Vec3D(2.0f, 2.0f, 0.0f), engine::physics::PhysicsObjectType::kPhysicsObjectDynamic);
+    far_brick = CreateContinuousCollisionTestObject(game_objects, 30.0f, engine::math::Vec3D(2.0f, 20.0f, 0.0f), engine::physics::PhysicsObjectType::kPhysicsObjectStatic);
+    near_brick = CreateContinuousCollisionTestObject(game_objects, 20.0f, engine::math::Vec3D(2.0f, 20.0f, 0.0f), engine::physics::PhysicsObjectType::kPhysicsObjectStatic);
+    bullet->ApplyImpulse(engine::math::Vec3D(CONTINUOUS_COLLISION_TEST_BULLET_SPEED, 0.0f, 0.0f));
+    Physics::Get()->ApplyCommands();
+
+    listener.bricks_.clear();
+    listener.entered_bricks_.clear();
+    listener.stayed_bricks_.clear();
+    listener.exited_bricks_.clear();
+    collider->Run(CONTINUOUS_COLLISION_TEST_DT);
+    Physics::Get()->Run(CONTINUOUS_COLLISION_TEST_DT);
+    ASSERT(listener.bricks_.size() == 1 && listener.bricks_[0] == near_brick);
+    ASSERT(listener.entered_bricks_.size() == 1 && listener.entered_bricks_[0] == near_brick);
+    ASSERT(collider->GetContactCache().Find(bullet->GetHandle(), far_brick->GetHandle()) == nullptr);
+
+    // the bullet bounced away from the near brick, which is the only one it stops touching
+    collider->Run(CONTINUOUS_COLLISION_TEST_DT);
+    Physics::Get()->Run(CONTINUOUS_COLLISION_TEST_DT);
+    ASSERT(listener.stayed_bricks_.empty());
+    ASSERT(std::count(listener.exited_bricks_.begin(), listener.exited_bricks_.end(), near_brick) == 1);
+    ASSERT(std::count(listener.exited_bricks_.begin(), listener.exited_bricks_.end(), far_brick) == 0);
+
+    for (const engine::memory::SharedPointer<PhysicsObject>& physics_object : { bullet, far_brick, near_brick })
+    {
+        Physics::Get()->RemovePhysicsObject(physics_object);
+    }
+    collider->ApplyCommands();
+    Physics::Get()->ApplyCommands();
+
+    collider->SetMaxImpactIterations(original_max_impact_iterations);
+    collider->SetIsContinuousCollisionEnabled(was_continuous_collision_enabled);
+    collider->SetCollisionListener(nullptr);
+
+    if (owns_physics)
+    {
+        Physics::Destroy();
+    }
+    if (owns_collider)
+    {
+        Collider::Destroy();
+    }
+
+    LOG("-------------------- Finished ContinuousCollision_UnitTest --------------------");
+}
@@ -0,0 +1,107 @@
+// library includes
+#include <stdint.h>
+#include <stdlib.h>
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+#include "Physics/DynamicTree.h"
+
+const size_t        DYNAMIC_TREE_TEST_NUM_PROXIES = 1000;
+const float         DYNAMIC_TREE_TEST_WORLD_SIZE = 2000.0f;
+
+engine::physics::DynamicTreeBox GetRandomTreeBox()
+{
+    const float size = 2.0f + float(rand() % 60);
+    const float min_x = float(rand() % int(DYNAMIC_TREE_TEST_WORLD_SIZE)) - DYNAMIC_TREE_TEST_WORLD_SIZE * 0.5f;
+    const float min_y = float(rand() % int(DYNAMIC_TREE_TEST_WORLD_SIZE)) - DYNAMIC_TREE_TEST_WORLD_SIZE * 0.5f;
+    return { min_x, min_y, min_x + size, min_y + size };
+}
+
+// every proxy the tree finds must overlap the box & every proxy that overlaps the box must be found
+bool IsQueryExact(const engine::physics::DynamicTree& i_tree, const std::vector<int32_t>& i_proxies, const engine::physics::DynamicTreeBox& i_box)
+{
+    using engine::physics::DynamicTree;
+
+    size_t num_found = 0;
+    bool success = true;
+    i_tree.Query(i_box, [&i_tree, &i_box, &num_found, &success](int32_t i_proxy) {
+        success = success && DynamicTree::Overlaps(i_tree.GetFatBox(i_proxy), i_box);
+        ++num_found;
+        return true;
+    });
+
+    size_t num_expected = 0;
+    for (const int32_t proxy : i_proxies)
+    {
+        num_expected += proxy != DYNAMIC_TREE_NULL_NODE && DynamicTree::Overlaps(i_tree.GetFatBox(proxy), i_box) ? 1 : 0;
+    }
+
+    return success && num_found == num_expected;
+}
+
+void TestDynamicTree()
+{
+    using engine::physics::DynamicTree;
+    using engine::physics::DynamicTreeBox;
+
+    LOG("-------------------- Running DynamicTree_UnitTest --------------------");
+
+    srand(11);
+
+    // proxies added in a sorted order would make an unbalanced tree a list, balancing keeps it shallow
+    DynamicTree tree;
+    std::vector<int32_t> proxies;
+    for (uint32_t i = 0; i < DYNAMIC_TREE_TEST_NUM_PROXIES; ++i)
+    {
+        const float x = float(i) * 4.0f;
+        proxies.push_back(tree.CreateProxy({ x, 0.0f, x + 2.0f, 2.0f }, i));
+        ASSERT(tree.GetUserData(proxies.back()) == i);
+    }
+    bool success = tree.Validate() && tree.GetNumProxies() == DYNAMIC_TREE_TEST_NUM_PROXIES && tree.GetHeight() < 32;
+    ASSERT(success);
+
+    // moves that stay inside the fat box leave the tree alone
+    const DynamicTreeBox nudged_box = { 1.0f, 1.0f, 3.0f, 3.0f };
+    success = !tree.MoveProxy(proxies[0], nudged_box);
+    ASSERT(success);
+    const DynamicTreeBox far_box = { 1.0f, 100.0f, 3.0f, 102.0f };
+    success = tree.MoveProxy(proxies[0], far_box) && DynamicTree::Contains(tree.GetFatBox(proxies[0]), far_box) && tree.Validate();
+    ASSERT(success);
+
+    // scatter everything, then remove every third proxy
+    for (const int32_t proxy : proxies)
+    {
+        tree.MoveProxy(proxy, GetRandomTreeBox());
+    }
+    for (size_t i = 0; i < proxies.size(); i += 3)
+    {
+        tree.DestroyProxy(proxies[i]);
+        proxies[i] = DYNAMIC_TREE_NULL_NODE;
+    }
+    success = tree.Validate() && tree.GetNumProxies() == DYNAMIC_TREE_TEST_NUM_PROXIES - (DYNAMIC_TREE_TEST_NUM_PROXIES + 2) / 3;
+    ASSERT(success);
+
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        const DynamicTreeBox box = GetRandomTreeBox();
+        success = IsQueryExact(tree, proxies, { box.min_x, box.min_y, box.max_x + 200.0f, box.max_y + 200.0f });
+        ASSERT(success);
+    }
+
+    // freed nodes are reused
+    const size_t num_proxies = tree.GetNumProxies();
+    for (size_t i = 0; i < proxies.size(); i += 3)
+    {
+        proxies[i] = tree.CreateProxy(GetRandomTreeBox(), uint32_t(i));
+    }
+    success = tree.Validate() && tree.GetNumProxies() == num_proxies + (DYNAMIC_TREE_TEST_NUM_PROXIES + 2) / 3;
+    ASSERT(success);
+
+    tree.Clear();
+    success = tree.Validate() && tree.GetNumProxies() == 0 && tree.GetHeight() == 0;
+    ASSERT(success);
+
+    LOG("-------------------- Finished DynamicTree_UnitTest --------------------");
+}
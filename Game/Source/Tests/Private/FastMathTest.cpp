@@ -2,15 +2,15 @@
 #include <stdio.h>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Logger\Logger.h"
-#include "Math\MathUtil.h"
-#include "Math\Mat44.h"
-#include "Math\Mat44-SSE.h"
-#include "Math\Vec3D.h"
-#include "Math\Vec4D.h"
-#include "Math\Vec3D-SSE.h"
-#include "Math\Vec4D-SSE.h"
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+#include "Math/MathUtil.h"
+#include "Math/Mat44.h"
+#include "Math/Mat44-SSE.h"
+#include "Math/Vec3D.h"
+#include "Math/Vec4D.h"
+#include "Math/Vec3D-SSE.h"
+#include "Math/Vec4D-SSE.h"
 
 void TestFastMath()
 {
@@ -1,11 +1,13 @@
 // library includes
+#include <thread>
 #include <vector>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Logger\Logger.h"
-#include "Memory\BlockAllocator.h"
-#include "Memory\FixedSizeAllocator.h"
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+#include "Memory/BlockAllocator.h"
+#include "Memory/FixedSizeAllocator.h"
+#include "Memory/ThreadCache.h"
 
 void ExhaustAllocator(engine::memory::FixedSizeAllocator* i_fsa)
 {
@@ -106,6 +108,98 @@ void ExhaustAllocator(engine::memory::FixedSizeAllocator* i_fsa)
     LOG("-------------------- Finished exhausting FixedSizeAllocator block_size:%zu num_blocks:%zu --------------------", i_fsa->GetBlockSize(), i_fsa->GetNumBlocks());
 }
 
+void TestThreadCache(engine::memory::FixedSizeAllocator* i_fsa)
+{
+    ASSERT(i_fsa);
+    LOG("-------------------- Testing ThreadCache block_size:%zu num_blocks:%zu --------------------", i_fsa->GetBlockSize(), i_fsa->GetNumBlocks());
+
+    engine::memory::ThreadCache* thread_cache = engine::memory::ThreadCache::Get();
+    if (thread_cache == nullptr)
+    {
+        LOG("ThreadCache is disabled...skipping test!");
+        return;
+    }
+
+    // a cached block is not allocated until a user takes it
+    void* pointer = thread_cache->Alloc(0, i_fsa, i_fsa->GetBlockSize());
+    ASSERT(pointer);
+    ASSERT(i_fsa->Contains(pointer));
+    ASSERT(i_fsa->IsAllocated(pointer));
+    ASSERT(i_fsa->GetNumOustandingBlocks() == THREAD_CACHE_BATCH_SIZE);
+
+    // a freed block stays cached but is no longer allocated
+    bool success = thread_cache->Free(0, i_fsa, pointer);
+    ASSERT(success);
+    ASSERT(!i_fsa->IsAllocated(pointer));
+
+    // freeing it again must fail on both paths
+    success = thread_cache->Free(0, i_fsa, pointer);
+    ASSERT(!success);
+    success = i_fsa->Free(pointer);
+    ASSERT(!success);
+
+    // exhaust the allocator through the cache
+    std::vector<void*> allocations;
+    const size_t num_blocks = i_fsa->GetNumBlocks();
+    for (size_t i = 0; i < num_blocks; ++i)
+    {
+        pointer = thread_cache->Alloc(0, i_fsa, i_fsa->GetBlockSize());
+        ASSERT(pointer);
+        allocations.push_back(pointer);
+    }
+    ASSERT(thread_cache->Alloc(0, i_fsa, i_fsa->GetBlockSize()) == nullptr);
+
+    for (void* allocation : allocations)
+    {
+        ASSERT(i_fsa->IsAllocated(allocation));
+        success = thread_cache->Free(0, i_fsa, allocation);
+        ASSERT(success);
+    }
+    thread_cache->Flush();
+    ASSERT(i_fsa->GetNumOustandingBlocks() == 0);
+
+    // churn from several threads, each thread flushes its own cache when it exits
+    const size_t num_threads = 4;
+    const size_t num_iterations = 10000;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        threads.push_back(std::thread([i_fsa, num_iterations]() {
+            engine::memory::ThreadCache* thread_cache = engine::memory::ThreadCache::Get();
+            void* pointers[8] = { nullptr };
+            for (size_t j = 0; j < num_iterations; ++j)
+            {
+                void*& slot = pointers[j % 8];
+                if (slot)
+                {
+                    const bool success = thread_cache->Free(0, i_fsa, slot);
+                    ASSERT(success);
+                    slot = nullptr;
+                }
+                else
+                {
+                    slot = thread_cache->Alloc(0, i_fsa, i_fsa->GetBlockSize());
+                }
+            }
+            for (void* slot : pointers)
+            {
+                if (slot)
+                {
+                    const bool success = thread_cache->Free(0, i_fsa, slot);
+                    ASSERT(success);
+                }
+            }
+        }));
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT(i_fsa->GetNumOustandingBlocks() == 0);
+
+    LOG("-------------------- Finished testing ThreadCache block_size:%zu num_blocks:%zu --------------------", i_fsa->GetBlockSize(), i_fsa->GetNumBlocks());
+}
+
 void TestFixedSizeAllocator()
 {
     LOG("-------------------- Running FixedSizeAllocator_UnitTest --------------------");
@@ -113,6 +207,7 @@ void TestFixedSizeAllocator()
 
     engine::memory::FixedSizeAllocator*         fsa_48 = engine::memory::FixedSizeAllocator::Create(48, 100, default_allocator);
     ExhaustAllocator(fsa_48);
+    TestThreadCache(fsa_48);
     engine::memory::FixedSizeAllocator::Destroy(fsa_48);
     LOG("-------------------- Finished FixedSizeAllocator_UnitTest --------------------");
 }
@@ -0,0 +1,114 @@
+// library includes
+#include <math.h>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "GameObject/GameObject.h"
+#include "Logger/Logger.h"
+#include "Math/AABB.h"
+#include "Math/Transform.h"
+#include "Physics/Physics.h"
+#include "Physics/PhysicsObject.h"
+#include "Time/FixedTimestep.h"
+
+const float         FIXED_TIMESTEP_TEST_FREQUENCY = 50.0f;
+const uint8_t       FIXED_TIMESTEP_TEST_MAX_STEPS = 3;
+const float         FIXED_TIMESTEP_TEST_EPSILON = 0.0001f;
+
+bool AreFixedTimestepValuesEqual(float i_lhs, float i_rhs)
+{
+    return fabsf(i_lhs - i_rhs) < FIXED_TIMESTEP_TEST_EPSILON;
+}
+
+void TestFixedTimestepAccumulator()
+{
+    engine::time::FixedTimestep fixed_timestep(FIXED_TIMESTEP_TEST_FREQUENCY, FIXED_TIMESTEP_TEST_MAX_STEPS);
+    ASSERT(AreFixedTimestepValuesEqual(fixed_timestep.GetStepTime(), 20.0f));
+
+    // short frames take no step until enough time has built up
+    ASSERT(fixed_timestep.Advance(15.0f) == 0);
+    ASSERT(AreFixedTimestepValuesEqual(fixed_timestep.GetInterpolation(), 0.75f));
+    ASSERT(fixed_timestep.Advance(15.0f) == 1);
+    ASSERT(AreFixedTimestepValuesEqual(fixed_timestep.GetInterpolation(), 0.5f));
+
+    // long frames take several steps
+    ASSERT(fixed_timestep.Advance(50.0f) == 3);
+    ASSERT(AreFixedTimestepValuesEqual(fixed_timestep.GetInterpolation(), 0.0f));
+
+    // a frame that is too long takes the maximum number of steps, the rest of its whole steps are dropped
+    ASSERT(fixed_timestep.Advance(205.0f) == FIXED_TIMESTEP_TEST_MAX_STEPS);
+    ASSERT(AreFixedTimestepValuesEqual(fixed_timestep.GetInterpolation(), 0.25f));
+    ASSERT(fixed_timestep.Advance(10.0f) == 0);
+    ASSERT(AreFixedTimestepValuesEqual(fixed_timestep.GetInterpolation(), 0.75f));
+
+    // the same frame times always produce the same steps
+    engine::time::FixedTimestep other_fixed_timestep(FIXED_TIMESTEP_TEST_FREQUENCY, FIXED_TIMESTEP_TEST_MAX_STEPS);
+    fixed_timestep.Reset();
+    size_t num_steps = 0;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        const float frame_time = float(i % 7) * 9.0f;
+        const uint8_t steps = fixed_timestep.Advance(frame_time);
+        ASSERT(steps == other_fixed_timestep.Advance(frame_time));
+        num_steps += steps;
+    }
+    LOG("%zu fixed steps over 1000 frames", num_steps);
+}
+
+void TestFixedTimestepInterpolation()
+{
+    using engine::physics::Physics;
+    using engine::physics::PhysicsObject;
+    using engine::physics::PhysicsObjectType;
+
+    // the engine usually owns this, create it if it doesn't exist yet
+    const bool owns_physics = Physics::Get() == nullptr;
+    Physics* physics = Physics::Create();
+
+    const engine::math::AABB aabb = { engine::math::Vec3D::ZERO, engine::math::Vec3D(10.0f, 10.0f, 0.0f) };
+    engine::memory::SharedPointer<engine::gameobject::GameObject> game_object = engine::gameobject::GameObject::Create(aabb, engine::math::Transform(engine::math::Vec3D(100.0f, 0.0f, 0.0f)));
+    engine::memory::SharedPointer<PhysicsObject> physics_object = physics->CreatePhysicsObject(game_object, 1.0f, 0.0f, PhysicsObjectType::kPhysicsObjectDynamic);
+
+    // nothing has moved yet
+    ASSERT(AreFixedTimestepValuesEqual(game_object->GetInterpolatedPosition(0.5f).x(), 100.0f));
+
+    // a step keeps the position from before it
+    physics_object->SetVelocity(engine::math::Vec3D(0.5f, 0.0f, 0.0f));
+    physics->Run(20.0f);
+    ASSERT(AreFixedTimestepValuesEqual(game_object->GetPreviousPosition().x(), 100.0f));
+    ASSERT(AreFixedTimestepValuesEqual(game_object->GetPosition().x(), 110.0f));
+    ASSERT(AreFixedTimestepValuesEqual(game_object->GetInterpolatedPosition(0.0f).x(), 100.0f));
+    ASSERT(AreFixedTimestepValuesEqual(game_object->GetInterpolatedPosition(0.25f).x(), 102.5f));
+    ASSERT(AreFixedTimestepValuesEqual(game_object->GetInterpolatedPosition(1.0f).x(), 110.0f));
+
+    // teleporting a game object isn't interpolated
+    game_object->SetPosition(engine::math::Vec3D(500.0f, 0.0f, 0.0f));
+    ASSERT(AreFixedTimestepValuesEqual(game_object->GetInterpolatedPosition(0.25f).x(), 500.0f));
+
+    physics->Run(20.0f);
+    ASSERT(AreFixedTimestepValuesEqual(game_object->GetInterpolatedPosition(0.5f).x(), 505.0f));
+
+    // a body that stops being integrated stays where it stopped
+    physics_object->SetIsActive(false);
+    physics->Run(20.0f);
+    ASSERT(AreFixedTimestepValuesEqual(game_object->GetInterpolatedPosition(0.5f).x(), 510.0f));
+
+    physics->RemovePhysicsObject(physics_object);
+    physics->ApplyCommands();
+    physics_object = nullptr;
+
+    if (owns_physics)
+    {
+        Physics::Destroy();
+    }
+}
+
+void TestFixedTimestep()
+{
+    LOG("-------------------- Running FixedTimestep_UnitTest --------------------");
+
+    TestFixedTimestepAccumulator();
+    TestFixedTimestepInterpolation();
+
+    LOG("-------------------- Finished FixedTimestep_UnitTest --------------------");
+}
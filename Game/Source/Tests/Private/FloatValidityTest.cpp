@@ -1,5 +1,5 @@
-#include "Logger\Logger.h"
-#include "Math\MathUtil.h"
+#include "Logger/Logger.h"
+#include "Math/MathUtil.h"
 
 void TestFloatValidity()
 {
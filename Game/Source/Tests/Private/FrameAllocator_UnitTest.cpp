@@ -0,0 +1,64 @@
+// library includes
+#include <stdint.h>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+#include "Memory/BlockAllocator.h"
+#include "Memory/FrameAllocator.h"
+
+void TestFrameAllocator()
+{
+    using engine::memory::FrameAllocator;
+
+    LOG("-------------------- Running FrameAllocator_UnitTest --------------------");
+
+    // the engine usually owns the frame allocator, create one if it doesn't exist yet
+    const bool owns_frame_allocator = FrameAllocator::Get() == nullptr;
+    FrameAllocator* frame_allocator = FrameAllocator::Create(DEFAULT_BLOCK_SIZE, engine::memory::BlockAllocator::GetDefaultAllocator());
+    ASSERT(frame_allocator);
+    frame_allocator->Reset();
+    ASSERT(frame_allocator->GetUsedSize() == 0);
+
+    // allocations are aligned, in range & don't overlap
+    uint8_t* previous = nullptr;
+    const size_t alignments[] = { 1, 4, 16, 64 };
+    for (size_t i = 0; i < 64; ++i)
+    {
+        const size_t alignment = alignments[i % 4];
+        uint8_t* pointer = static_cast<uint8_t*>(frame_allocator->Alloc(24, alignment));
+        ASSERT(pointer && frame_allocator->Contains(pointer));
+        ASSERT((reinterpret_cast<uintptr_t>(pointer) & (alignment - 1)) == 0);
+        ASSERT(previous == nullptr || pointer >= previous + 24);
+        previous = pointer;
+    }
+
+    // an allocation that doesn't fit fails without consuming anything
+    const size_t used_size = frame_allocator->GetUsedSize();
+    ASSERT(frame_allocator->Alloc(frame_allocator->GetSize()) == nullptr);
+    ASSERT(frame_allocator->GetUsedSize() == used_size);
+
+    // reset releases everything & remembers the usage
+    frame_allocator->Reset();
+    ASSERT(frame_allocator->GetUsedSize() == 0);
+    ASSERT(frame_allocator->GetHighWaterMark() >= used_size);
+
+    // frame vectors grow inside the frame's memory
+    {
+        engine::memory::FrameVector<size_t> numbers;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            numbers.push_back(i);
+        }
+        ASSERT(frame_allocator->Contains(numbers.data()));
+        ASSERT(numbers[999] == 999);
+    }
+    frame_allocator->Reset();
+
+    if (owns_frame_allocator)
+    {
+        FrameAllocator::Destroy();
+    }
+
+    LOG("-------------------- Finished FrameAllocator_UnitTest --------------------");
+}
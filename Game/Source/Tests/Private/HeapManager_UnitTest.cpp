@@ -6,8 +6,9 @@
 #include <vector>
 
 // engine includes
-#include "Memory\BlockAllocator.h"
-#include "Logger\Logger.h"
+#include "Memory/AllocatorUtil.h"
+#include "Memory/BlockAllocator.h"
+#include "Logger/Logger.h"
 
 #define TEST_SINGLE_LARGE_ALLOCATION
 #define __TRACK_ALLOCATIONS
@@ -21,7 +22,7 @@ bool HeapManager_UnitTest()
     const unsigned int  numDescriptors = 2048;
 
     // Allocate memory for my test heap.
-    void * pHeapMemory = _aligned_malloc( sizeHeap, 4 );
+    void * pHeapMemory = engine::memory::AlignedMalloc( sizeHeap, 4 );
     assert( pHeapMemory );
 
     // Create a heap manager for my test heap.
@@ -260,7 +261,7 @@ bool HeapManager_UnitTest()
     BlockAllocator::Destroy(pHeapManager);
     pHeapManager = nullptr;
 
-    _aligned_free( pHeapMemory );
+    engine::memory::AlignedFree( pHeapMemory );
 
     LOG("-------------------- Finished HeapManager_UnitTest --------------------");
 
@@ -1,11 +1,19 @@
+// library includes
+#include <atomic>
+#include <stdio.h>
+#include <thread>
+#include <vector>
 
 // engine includes
-#include "Data\HashedString.h"
-#include "Data\PooledString.h"
-#include "Jobs\InterfaceJob.h"
-#include "Jobs\JobSystem.h"
-#include "Jobs\JobQueue.h"
-#include "Logger\Logger.h"
+#include "Data/HashedString.h"
+#include "Data/PooledString.h"
+#include "Jobs/FunctionJob.h"
+#include "Jobs/InterfaceJob.h"
+#include "Jobs/JobCounter.h"
+#include "Jobs/JobSystem.h"
+#include "Jobs/JobQueue.h"
+#include "Logger/Logger.h"
+#include "Time/TimerUtil.h"
 
 class SimpleSleepJob : public engine::jobs::InterfaceJob
 {
@@ -77,7 +85,7 @@ void TestJobSystem()
         for (uint16_t i = 0; i < num_jobs; ++i)
         {
             char buf[256] = { 0 };
-            sprintf_s(buf, "SimpleSleepJob-%zu", ++total_jobs);
+            snprintf(buf, sizeof(buf), "SimpleSleepJob-%zu", ++total_jobs);
 
             engine::jobs::InterfaceJob* new_job = new SimpleSleepJob(engine::data::PooledString(buf));
             if (job_system->AddJob(new_job, (rand() % 10 < 4) ? team01_name : team02_name) == false)
@@ -101,4 +109,276 @@ void TestJobSystem()
     LOG("--------------------------------------------");
     LOG("JOB SYSTEM SHUTDOWN COMPLETE\nTOTAL %zu JOBS CREATED", total_jobs);
     LOG("--------------------------------------------");
-}
\ No newline at end of file
+}
+
+const size_t        JOB_DEPENDENCY_TEST_NUM_JOBS = 64;
+
+// a job that counts itself & optionally spawns children counted against the same counter
+class DependentJob : public engine::jobs::InterfaceJob
+{
+public:
+    DependentJob(std::atomic<size_t>* i_num_finished, const engine::jobs::JobHandle& i_counter, const engine::data::PooledString& i_team_name, size_t i_num_children) : num_finished_(i_num_finished),
+        counter_(i_counter),
+        team_name_(i_team_name),
+        num_children_(i_num_children)
+    {}
+
+    void DoWork()
+    {
+        // this job keeps the counter above zero until its children have been counted
+        for (size_t i = 0; i < num_children_; ++i)
+        {
+            engine::jobs::JobSystem::Get()->AddJob(new DependentJob(num_finished_, counter_, team_name_, 0), team_name_, counter_);
+        }
+        num_finished_->fetch_add(1);
+    }
+
+private:
+    std::atomic<size_t>*                num_finished_;
+    engine::jobs::JobHandle             counter_;
+    engine::data::PooledString          team_name_;
+    size_t                              num_children_;
+};
+
+void TestJobDependencies()
+{
+    using engine::jobs::JobCounter;
+    using engine::jobs::JobHandle;
+
+    LOG("-------------------- Running Job Dependency Test --------------------");
+
+    engine::jobs::JobSystem* job_system = engine::jobs::JobSystem::Create();
+
+    const engine::data::PooledString loading_team("DependencyLoadingTeam");
+    const engine::data::PooledString creating_team("DependencyCreatingTeam");
+    job_system->CreateTeam(loading_team, 4, engine::jobs::SchedulingPolicy::WorkStealing);
+    job_system->CreateTeam(creating_team, 2);
+
+    // stage one fans out on one team
+    std::atomic<size_t> num_loaded(0);
+    JobHandle loaded = JobCounter::Create();
+    for (size_t i = 0; i < JOB_DEPENDENCY_TEST_NUM_JOBS; ++i)
+    {
+        job_system->AddJob(new DependentJob(&num_loaded, loaded, loading_team, 3), loading_team, loaded);
+    }
+
+    // stage two only starts on the other team once all of stage one & its children have finished
+    std::atomic<size_t> num_loaded_when_created(0);
+    std::atomic<size_t> num_created(0);
+    JobHandle created = JobCounter::Create();
+    for (size_t i = 0; i < JOB_DEPENDENCY_TEST_NUM_JOBS; ++i)
+    {
+        job_system->AddJobAfter(new engine::jobs::FunctionJob([&]() {
+            num_loaded_when_created.fetch_add(num_loaded.load() == JOB_DEPENDENCY_TEST_NUM_JOBS * 4 ? 1 : 0);
+            num_created.fetch_add(1);
+        }), creating_team, loaded, created);
+    }
+
+    // stage three runs once stage two has finished
+    std::atomic<bool> is_finished(false);
+    JobHandle finished = JobCounter::Create();
+    job_system->AddJobAfter(new engine::jobs::FunctionJob([&]() { is_finished = num_created.load() == JOB_DEPENDENCY_TEST_NUM_JOBS; }), loading_team, created, finished);
+
+    // the main thread helps until everything has finished
+    bool success = job_system->Wait(finished, loading_team);
+    ASSERT(success);
+    ASSERT(loaded->IsDone() && created->IsDone());
+    ASSERT(num_loaded.load() == JOB_DEPENDENCY_TEST_NUM_JOBS * 4);
+    ASSERT(num_loaded_when_created.load() == JOB_DEPENDENCY_TEST_NUM_JOBS);
+    ASSERT(is_finished);
+
+    // depending on a counter that has already dropped to zero adds the job right away
+    std::atomic<bool> has_run(false);
+    JobHandle late = JobCounter::Create();
+    job_system->AddJobAfter(new engine::jobs::FunctionJob([&]() { has_run = true; }), creating_team, finished, late);
+    success = job_system->Wait(late, creating_team);
+    ASSERT(success);
+    ASSERT(has_run);
+
+    // the job system is the engine's, its teams are shut down along with it
+    LOG("-------------------- Finished Job Dependency Test --------------------");
+}
+
+void TestParallelFor()
+{
+    LOG("-------------------- Running Parallel For Test --------------------");
+
+    engine::jobs::JobSystem* job_system = engine::jobs::JobSystem::Create();
+
+    const engine::data::PooledString shared_team("ParallelForSharedTeam");
+    const engine::data::PooledString stealing_team("ParallelForStealingTeam");
+    job_system->CreateTeam(shared_team, 3);
+    job_system->CreateTeam(stealing_team, 4, engine::jobs::SchedulingPolicy::WorkStealing);
+
+    // every index is visited exactly once, whatever the range & grain
+    const size_t ranges[] = { 0, 1, 63, 64, 65, 1000, 100000 };
+    const size_t grain_sizes[] = { 1, 7, 64, 4096 };
+    std::vector<uint8_t> visits;
+    for (const size_t range : ranges)
+    {
+        for (const size_t grain_size : grain_sizes)
+        {
+            for (const engine::data::PooledString& team_name : { shared_team, stealing_team })
+            {
+                visits.assign(range + 2, 0);
+                job_system->ParallelFor(1, range + 1, grain_size, [&visits](size_t i_begin, size_t i_end) {
+                    for (size_t i = i_begin; i < i_end; ++i)
+                    {
+                        ++visits[i];
+                    }
+                }, team_name);
+
+                ASSERT(visits[0] == 0 && visits[range + 1] == 0);
+                for (size_t i = 1; i <= range; ++i)
+                {
+                    ASSERT(visits[i] == 1);
+                }
+            }
+        }
+    }
+
+    // a batch of jobs is counted as a whole
+    std::atomic<size_t> num_finished(0);
+    engine::jobs::JobHandle counter = engine::jobs::JobCounter::Create();
+    engine::jobs::InterfaceJob* jobs[JOB_DEPENDENCY_TEST_NUM_JOBS];
+    for (size_t i = 0; i < JOB_DEPENDENCY_TEST_NUM_JOBS; ++i)
+    {
+        jobs[i] = new DependentJob(&num_finished, counter, stealing_team, 0);
+    }
+    bool success = job_system->AddJobs(jobs, JOB_DEPENDENCY_TEST_NUM_JOBS, stealing_team, counter);
+    ASSERT(success);
+    success = job_system->Wait(counter, stealing_team);
+    ASSERT(success);
+    ASSERT(num_finished.load() == JOB_DEPENDENCY_TEST_NUM_JOBS);
+
+    // the job system is the engine's, its teams are shut down along with it
+    LOG("-------------------- Finished Parallel For Test --------------------");
+}
+
+const size_t        JOB_BENCHMARK_NUM_ROOT_JOBS = 256;
+const size_t        JOB_BENCHMARK_NUM_CHILD_JOBS = 15;
+const size_t        JOB_BENCHMARK_WORK_ITERATIONS = 2000;
+
+// a tiny job like the ones level loading spawns, root jobs fan out into children from the worker they run on
+class CountingJob : public engine::jobs::InterfaceJob
+{
+public:
+    CountingJob(std::atomic<size_t>* i_num_finished, const engine::data::PooledString& i_team_name, bool i_is_root) : num_finished_(i_num_finished),
+        team_name_(i_team_name),
+        is_root_(i_is_root)
+    {}
+
+    void DoWork()
+    {
+        if (is_root_)
+        {
+            for (size_t i = 0; i < JOB_BENCHMARK_NUM_CHILD_JOBS; ++i)
+            {
+                engine::jobs::JobSystem::Get()->AddJob(new CountingJob(num_finished_, team_name_, false), team_name_);
+            }
+        }
+
+        volatile size_t sum = 0;
+        for (size_t i = 0; i < JOB_BENCHMARK_WORK_ITERATIONS; ++i)
+        {
+            sum += i;
+        }
+
+        num_finished_->fetch_add(1);
+    }
+
+private:
+    std::atomic<size_t>*                num_finished_;
+    engine::data::PooledString          team_name_;
+    bool                                is_root_;
+};
+
+void RunJobSystemBenchmark(engine::jobs::SchedulingPolicy i_policy, const char* i_policy_name, size_t i_num_workers)
+{
+    engine::jobs::JobSystem* job_system = engine::jobs::JobSystem::Get();
+
+    char buf[256] = { 0 };
+    snprintf(buf, sizeof(buf), "Benchmark%s-%zu", i_policy_name, i_num_workers);
+    const engine::data::PooledString team_name(buf);
+    job_system->CreateTeam(team_name, i_num_workers, i_policy);
+
+    std::atomic<size_t> num_finished(0);
+    const size_t num_jobs = JOB_BENCHMARK_NUM_ROOT_JOBS * (JOB_BENCHMARK_NUM_CHILD_JOBS + 1);
+
+    const double start_tick = engine::time::TimerUtil::GetCounter();
+
+    for (size_t i = 0; i < JOB_BENCHMARK_NUM_ROOT_JOBS; ++i)
+    {
+        job_system->AddJob(new CountingJob(&num_finished, team_name, true), team_name);
+    }
+    while (num_finished.load() < num_jobs)
+    {
+        std::this_thread::yield();
+    }
+
+    const double elapsed_ms = (engine::time::TimerUtil::GetCounter() - start_tick) / engine::time::TimerUtil::GetFrequency();
+
+    LOG("%s with %zu workers: %zu jobs in %f ms (%.0f jobs per second)", i_policy_name, i_num_workers, num_jobs, elapsed_ms, num_jobs * 1000.0 / elapsed_ms);
+}
+
+const size_t        PARALLEL_FOR_BENCHMARK_NUM_ELEMENTS = 1 << 20;
+const size_t        PARALLEL_FOR_BENCHMARK_GRAIN_SIZE = 1024;
+
+void RunParallelForBenchmark(engine::jobs::SchedulingPolicy i_policy, const char* i_policy_name, size_t i_num_workers)
+{
+    engine::jobs::JobSystem* job_system = engine::jobs::JobSystem::Get();
+
+    char buf[256] = { 0 };
+    snprintf(buf, sizeof(buf), "ParallelForBenchmark%s-%zu", i_policy_name, i_num_workers);
+    const engine::data::PooledString team_name(buf);
+    job_system->CreateTeam(team_name, i_num_workers, i_policy);
+
+    std::vector<float> values(PARALLEL_FOR_BENCHMARK_NUM_ELEMENTS, 1.0f);
+    const std::function<void(size_t, size_t)> update = [&values](size_t i_begin, size_t i_end) {
+        for (size_t i = i_begin; i < i_end; ++i)
+        {
+            values[i] = values[i] * 0.99f + 0.01f;
+        }
+    };
+
+    // one heap allocated job per chunk, submitted one at a time
+    double start_tick = engine::time::TimerUtil::GetCounter();
+    engine::jobs::JobHandle counter = engine::jobs::JobCounter::Create();
+    for (size_t i = 0; i < PARALLEL_FOR_BENCHMARK_NUM_ELEMENTS; i += PARALLEL_FOR_BENCHMARK_GRAIN_SIZE)
+    {
+        job_system->AddJob(new engine::jobs::FunctionJob([&update, i]() { update(i, i + PARALLEL_FOR_BENCHMARK_GRAIN_SIZE); }), team_name, counter);
+    }
+    job_system->Wait(counter, team_name);
+    const double job_per_chunk_ms = (engine::time::TimerUtil::GetCounter() - start_tick) / engine::time::TimerUtil::GetFrequency();
+
+    // one allocation & one submission for the whole loop
+    start_tick = engine::time::TimerUtil::GetCounter();
+    job_system->ParallelFor(0, PARALLEL_FOR_BENCHMARK_NUM_ELEMENTS, PARALLEL_FOR_BENCHMARK_GRAIN_SIZE, update, team_name);
+    const double parallel_for_ms = (engine::time::TimerUtil::GetCounter() - start_tick) / engine::time::TimerUtil::GetFrequency();
+
+    // on the calling thread only
+    start_tick = engine::time::TimerUtil::GetCounter();
+    update(0, PARALLEL_FOR_BENCHMARK_NUM_ELEMENTS);
+    const double serial_ms = (engine::time::TimerUtil::GetCounter() - start_tick) / engine::time::TimerUtil::GetFrequency();
+
+    LOG("%s with %zu workers: %zu elements, job per chunk %f ms, ParallelFor %f ms, serial %f ms", i_policy_name, i_num_workers, PARALLEL_FOR_BENCHMARK_NUM_ELEMENTS, job_per_chunk_ms, parallel_for_ms, serial_ms);
+}
+
+void BenchmarkJobSystem()
+{
+    LOG("-------------------- Running Job System Benchmark --------------------");
+
+    engine::jobs::JobSystem::Create();
+
+    for (size_t num_workers = 1; num_workers <= 8; num_workers *= 2)
+    {
+        RunJobSystemBenchmark(engine::jobs::SchedulingPolicy::SharedQueue, "SharedQueue", num_workers);
+        RunJobSystemBenchmark(engine::jobs::SchedulingPolicy::WorkStealing, "WorkStealing", num_workers);
+    }
+
+    for (size_t num_workers = 1; num_workers <= 8; num_workers *= 2)
+    {
+        RunParallelForBenchmark(engine::jobs::SchedulingPolicy::SharedQueue, "SharedQueue", num_workers);
+        RunParallelForBenchmark(engine::jobs::SchedulingPolicy::WorkStealing, "WorkStealing", num_workers);
+    }
+}
@@ -1,10 +1,10 @@
 // engine includes
-#include "Assert\Assert.h"
-#include "Logger\Logger.h"
-#include "Math\Mat44.h"
-#include "Math\Vec4D.h"
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+#include "Math/Mat44.h"
+#include "Math/Vec4D.h"
 
-#include "Math\Transform.h"
+#include "Math/Transform.h"
 
 void TestMat44()
 {
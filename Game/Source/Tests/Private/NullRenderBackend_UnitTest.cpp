@@ -0,0 +1,124 @@
+// library includes
+#include <stdint.h>
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Common/Engine.h"
+#include "Events/TimerEvent.h"
+#include "GameObject/GameObject.h"
+#include "Logger/Logger.h"
+#include "Memory/SharedPointer.h"
+#include "Renderer/NullRenderBackend.h"
+#include "Renderer/Renderer.h"
+#include "Time/Updater.h"
+
+const size_t        NULL_RENDER_BACKEND_TEST_NUM_SPRITES = 64;
+const size_t        NULL_RENDER_BACKEND_TEST_NUM_FRAMES = 120;
+const size_t        NULL_RENDER_BACKEND_TEST_NUM_RENDERABLES = 48;
+const float         NULL_RENDER_BACKEND_TEST_RUN_SECONDS = 1.0f;
+
+// the backend on its own, drawing whatever it's asked to
+void TestNullRenderBackendDraws()
+{
+    engine::render::NullRenderBackend backend;
+    uint8_t texture_data[16] = { 0 };
+
+    // sprites can't be made without a texture
+    ASSERT(backend.CreateSprite(nullptr, 0, 32, 32) == nullptr);
+
+    std::vector<GLib::Sprites::Sprite*> sprites;
+    for (size_t i = 0; i < NULL_RENDER_BACKEND_TEST_NUM_SPRITES; ++i)
+    {
+        GLib::Sprites::Sprite* sprite = backend.CreateSprite(texture_data, sizeof(texture_data), 32, 32);
+        ASSERT(sprite);
+        sprites.push_back(sprite);
+    }
+    ASSERT(backend.GetNumSprites() == NULL_RENDER_BACKEND_TEST_NUM_SPRITES);
+
+    // draw a different number of sprites every frame
+    uint64_t num_draw_calls = 0;
+    for (size_t frame = 0; frame < NULL_RENDER_BACKEND_TEST_NUM_FRAMES; ++frame)
+    {
+        const size_t num_sprites = frame % (NULL_RENDER_BACKEND_TEST_NUM_SPRITES + 1);
+
+        backend.BeginFrame();
+        for (size_t i = 0; i < num_sprites; ++i)
+        {
+            backend.DrawSprite(*sprites[i], float(i), float(frame), 0.0f);
+        }
+        backend.EndFrame();
+
+        num_draw_calls += num_sprites;
+        ASSERT(backend.GetNumDrawCallsLastFrame() == num_sprites);
+    }
+    ASSERT(backend.GetNumFrames() == NULL_RENDER_BACKEND_TEST_NUM_FRAMES);
+    ASSERT(backend.GetNumDrawCalls() == num_draw_calls);
+
+    // the headless backend never asks to quit
+    bool quit_requested = false;
+    backend.Service(quit_requested);
+    ASSERT(quit_requested == false);
+
+    for (size_t i = 0; i < sprites.size(); ++i)
+    {
+        backend.ReleaseSprite(sprites[i]);
+    }
+    ASSERT(backend.GetNumSprites() == 0);
+
+    LOG("Drew %llu sprites over %llu frames", static_cast<unsigned long long>(backend.GetNumDrawCalls()), static_cast<unsigned long long>(backend.GetNumFrames()));
+}
+
+// the engine running headless, every frame must draw every visible renderable
+void TestNullRenderBackendEngine()
+{
+    engine::render::Renderer* renderer = engine::render::Renderer::Get();
+    engine::render::NullRenderBackend* backend = static_cast<engine::render::NullRenderBackend*>(renderer->GetBackend());
+    ASSERT(backend->GetNumFrames() == 0 && backend->GetNumSprites() == 0);
+
+    uint8_t texture_data[16] = { 0 };
+    std::vector<engine::memory::SharedPointer<engine::gameobject::GameObject>> game_objects;
+    std::vector<engine::memory::SharedPointer<engine::render::RenderableObject>> renderables;
+    for (size_t i = 0; i < NULL_RENDER_BACKEND_TEST_NUM_RENDERABLES; ++i)
+    {
+        game_objects.push_back(engine::gameobject::GameObject::Create());
+        renderables.push_back(renderer->CreateRenderableObject(backend->CreateSprite(texture_data, sizeof(texture_data), 32, 32), game_objects.back()));
+    }
+
+    // a hidden renderable is never drawn
+    game_objects.push_back(engine::gameobject::GameObject::Create());
+    renderables.push_back(renderer->CreateRenderableObject(backend->CreateSprite(texture_data, sizeof(texture_data), 32, 32), game_objects.back()));
+    renderables.back()->SetIsVisible(false);
+
+    // a timer that's still pending at shutdown holds on to a renderable, so it's released after the renderer is gone
+    engine::memory::SharedPointer<engine::render::RenderableObject> late_renderable = renderables.front();
+    engine::time::Updater::Get()->AddTimerEvent(engine::events::TimerEvent::Create([late_renderable]() {}, NULL_RENDER_BACKEND_TEST_RUN_SECONDS * 100.0f, 0));
+
+    // the frame limiter is off, so every frame advances exactly 1/60th of a second
+    engine::time::Updater::Get()->AddTimerEvent(engine::events::TimerEvent::Create([]() { engine::InitiateShutdown(); }, NULL_RENDER_BACKEND_TEST_RUN_SECONDS, 0));
+    engine::Run();
+
+    ASSERT(backend->GetNumFrames() > 0);
+    ASSERT(backend->GetNumDrawCallsLastFrame() == NULL_RENDER_BACKEND_TEST_NUM_RENDERABLES);
+    ASSERT(backend->GetNumDrawCalls() == backend->GetNumFrames() * NULL_RENDER_BACKEND_TEST_NUM_RENDERABLES);
+    ASSERT(backend->GetNumSprites() == NULL_RENDER_BACKEND_TEST_NUM_RENDERABLES + 1);
+
+    LOG("Ran the engine for %llu frames of %zu renderables", static_cast<unsigned long long>(backend->GetNumFrames()), NULL_RENDER_BACKEND_TEST_NUM_RENDERABLES);
+}
+
+void TestNullRenderBackend()
+{
+    LOG("-------------------- Running NullRenderBackend_UnitTest --------------------");
+
+    // the engine is started with a backend of its own, so it can't already be running
+    bool success = engine::StartUpHeadless();
+    ASSERT(success);
+
+    TestNullRenderBackendDraws();
+    TestNullRenderBackendEngine();
+
+    // the renderables are still tracked by the renderer & the updater, shutting down releases them
+    engine::Shutdown();
+
+    LOG("-------------------- Finished NullRenderBackend_UnitTest --------------------");
+}
@@ -0,0 +1,168 @@
+// library includes
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "GameObject/GameObject.h"
+#include "Logger/Logger.h"
+#include "Math/AABB.h"
+#include "Math/Transform.h"
+#include "Physics/Collider.h"
+#include "Physics/Physics.h"
+#include "Physics/PhysicsObject.h"
+
+const float         PHYSICS_ISLANDS_TEST_DT = 1000.0f / 60.0f;
+const size_t        PHYSICS_ISLANDS_TEST_GRID_SIZE = 10;
+const size_t        PHYSICS_ISLANDS_TEST_MAX_STEPS = 120;
+
+engine::memory::SharedPointer<engine::physics::PhysicsObject> CreatePhysicsIslandsTestObject(std::vector<engine::memory::SharedPointer<engine::gameobject::GameObject>>& io_game_objects,
+    float i_x,
+    engine::physics::PhysicsObjectType i_type)
+{
+    const engine::math::AABB aabb = { engine::math::Vec3D::ZERO, engine::math::Vec3D(10.0f, 10.0f, 0.0f) };
+    io_game_objects.push_back(engine::gameobject::GameObject::Create(aabb, engine::math::Transform(engine::math::Vec3D(i_x, 0.0f, 0.0f))));
+    return engine::physics::Physics::Get()->CreatePhysicsObject(io_game_objects.back(), 1.0f, 0.0f, i_type, engine::physics::PhysicsObject::DEFAULT_COLLISION_FILTER, true);
+}
+
+void TestPhysicsIslands()
+{
+    using engine::physics::Collider;
+    using engine::physics::Physics;
+    using engine::physics::PhysicsObject;
+    using engine::physics::PhysicsObjectType;
+
+    LOG("-------------------- Running PhysicsIslands_UnitTest --------------------");
+
+    // the engine usually owns these, create them if they don't exist yet
+    const bool owns_collider = Collider::Get() == nullptr;
+    Collider* collider = Collider::Create();
+    const bool owns_physics = Physics::Get() == nullptr;
+    Physics* physics = Physics::Create();
+
+    // a row of bodies, each overlapping its neighbours: a - b - c - wall - d, and e off on its own
+    std::vector<engine::memory::SharedPointer<engine::gameobject::GameObject>> game_objects;
+    const engine::memory::SharedPointer<PhysicsObject> a = CreatePhysicsIslandsTestObject(game_objects, 0.0f, PhysicsObjectType::kPhysicsObjectDynamic);
+    const engine::memory::SharedPointer<PhysicsObject> b = CreatePhysicsIslandsTestObject(game_objects, 15.0f, PhysicsObjectType::kPhysicsObjectDynamic);
+    const engine::memory::SharedPointer<PhysicsObject> c = CreatePhysicsIslandsTestObject(game_objects, 30.0f, PhysicsObjectType::kPhysicsObjectDynamic);
+    const engine::memory::SharedPointer<PhysicsObject> wall = CreatePhysicsIslandsTestObject(game_objects, 45.0f, PhysicsObjectType::kPhysicsObjectStatic);
+    const engine::memory::SharedPointer<PhysicsObject> d = CreatePhysicsIslandsTestObject(game_objects, 60.0f, PhysicsObjectType::kPhysicsObjectDynamic);
+    const engine::memory::SharedPointer<PhysicsObject> e = CreatePhysicsIslandsTestObject(game_objects, 500.0f, PhysicsObjectType::kPhysicsObjectDynamic);
+
+    // nothing is awake, so nothing is tested
+    collider->Run(PHYSICS_ISLANDS_TEST_DT);
+    physics->Run(PHYSICS_ISLANDS_TEST_DT);
+    ASSERT(collider->GetNumCandidatePairs() == 0);
+    ASSERT(!a->GetIsAwake() && !b->GetIsAwake() && !c->GetIsAwake() && !d->GetIsAwake() && !e->GetIsAwake());
+
+    // touching a sleeping body wakes it up, one neighbour per frame since sleeping bodies aren't tested against each other
+    a->ApplyImpulse(engine::math::Vec3D(0.05f, 0.0f, 0.0f));
+    e->ApplyImpulse(engine::math::Vec3D(0.0f, 0.01f, 0.0f));
+    collider->Run(PHYSICS_ISLANDS_TEST_DT);
+    ASSERT(collider->GetNumCandidatePairs() == 1);
+    physics->Run(PHYSICS_ISLANDS_TEST_DT);
+    ASSERT(a->GetIsAwake() && b->GetIsAwake() && !c->GetIsAwake());
+    ASSERT(e->GetIsAwake());
+
+    collider->Run(PHYSICS_ISLANDS_TEST_DT);
+    ASSERT(collider->GetNumCandidatePairs() == 2);
+    physics->Run(PHYSICS_ISLANDS_TEST_DT);
+    ASSERT(a->GetIsAwake() && b->GetIsAwake() && c->GetIsAwake());
+
+    // b & c have stopped but are kept awake by a, the static wall doesn't join islands so d stays asleep
+    collider->Run(PHYSICS_ISLANDS_TEST_DT);
+    ASSERT(collider->GetNumCandidatePairs() == 3);
+    physics->Run(PHYSICS_ISLANDS_TEST_DT);
+    ASSERT(a->GetIsAwake() && b->GetIsAwake() && c->GetIsAwake());
+    ASSERT(!d->GetIsAwake());
+
+    // once every body of the island has been resting for long enough, the whole island falls asleep at once, as does a body on its own
+    // b & c stopped first, but they aren't put to sleep before a is
+    a->SetVelocity(engine::math::Vec3D::ZERO);
+    e->SetVelocity(engine::math::Vec3D::ZERO);
+    size_t num_steps = 0;
+    while (a->GetIsAwake() && num_steps++ < PHYSICS_ISLANDS_TEST_MAX_STEPS)
+    {
+        collider->Run(PHYSICS_ISLANDS_TEST_DT);
+        physics->Run(PHYSICS_ISLANDS_TEST_DT);
+        ASSERT(b->GetIsAwake() == a->GetIsAwake() && c->GetIsAwake() == a->GetIsAwake() && e->GetIsAwake() == a->GetIsAwake());
+    }
+    ASSERT(num_steps >= size_t(PHYSICS_WORLD_TIME_TO_SLEEP / PHYSICS_ISLANDS_TEST_DT));
+    ASSERT(!a->GetIsAwake() && !b->GetIsAwake() && !c->GetIsAwake() && !d->GetIsAwake() && !e->GetIsAwake());
+    collider->Run(PHYSICS_ISLANDS_TEST_DT);
+    ASSERT(collider->GetNumCandidatePairs() == 0);
+
+    LOG("%zu bodies, islands woke up & fell asleep together after %zu steps at rest", game_objects.size(), num_steps);
+
+    for (const engine::memory::SharedPointer<PhysicsObject>& physics_object : { a, b, c, wall, d, e })
+    {
+        physics->RemovePhysicsObject(physics_object);
+    }
+    collider->ApplyCommands();
+    physics->ApplyCommands();
+
+    // a grid of bodies, each overlapping its neighbours, stops giving the broadphase work once it falls asleep
+    std::vector<engine::memory::SharedPointer<PhysicsObject>> grid;
+    for (size_t x = 0; x < PHYSICS_ISLANDS_TEST_GRID_SIZE; ++x)
+    {
+        for (size_t y = 0; y < PHYSICS_ISLANDS_TEST_GRID_SIZE; ++y)
+        {
+            grid.push_back(CreatePhysicsIslandsTestObject(game_objects, x * 15.0f, PhysicsObjectType::kPhysicsObjectDynamic));
+            game_objects.back()->SetPosition(engine::math::Vec3D(x * 15.0f, y * 15.0f, 0.0f));
+        }
+    }
+
+    for (const engine::memory::SharedPointer<PhysicsObject>& physics_object : grid)
+    {
+        physics_object->ApplyImpulse(engine::math::Vec3D(0.0f, 0.01f, 0.0f));
+    }
+    collider->Run(PHYSICS_ISLANDS_TEST_DT);
+    const size_t num_awake_candidate_pairs = collider->GetNumCandidatePairs();
+    const size_t num_awake_pairs_tested = collider->GetBroadphase().GetNumPairsTested();
+    ASSERT(num_awake_candidate_pairs > 0 && num_awake_pairs_tested > 0);
+    ASSERT(collider->GetNumSleepingObjects() == 0);
+
+    for (const engine::memory::SharedPointer<PhysicsObject>& physics_object : grid)
+    {
+        physics_object->SetVelocity(engine::math::Vec3D::ZERO);
+    }
+    num_steps = 0;
+    while (collider->GetNumSleepingObjects() < grid.size() && num_steps++ < PHYSICS_ISLANDS_TEST_MAX_STEPS)
+    {
+        physics->Run(PHYSICS_ISLANDS_TEST_DT);
+        collider->Run(PHYSICS_ISLANDS_TEST_DT);
+    }
+
+    // sleeping bodies aren't cached, bucketed or paired with each other
+    ASSERT(collider->GetNumSleepingObjects() == grid.size());
+    ASSERT(collider->GetNumCandidatePairs() == 0);
+    ASSERT(collider->GetBroadphase().GetNumPairsTested() == 0);
+
+    // waking a single body only pairs it with its neighbours
+    grid[grid.size() / 2 + PHYSICS_ISLANDS_TEST_GRID_SIZE / 2]->ApplyImpulse(engine::math::Vec3D(0.0f, 0.01f, 0.0f));
+    collider->Run(PHYSICS_ISLANDS_TEST_DT);
+    ASSERT(collider->GetNumSleepingObjects() == grid.size() - 1);
+    ASSERT(collider->GetNumCandidatePairs() > 0 && collider->GetNumCandidatePairs() <= 8);
+    ASSERT(collider->GetBroadphase().GetNumPairsTested() == 0);
+
+    LOG("%zu sleeping bodies, %zu candidate pairs & %zu pairs tested while awake, %zu candidate pairs with one awake", grid.size(),
+        num_awake_candidate_pairs, num_awake_pairs_tested, collider->GetNumCandidatePairs());
+
+    for (const engine::memory::SharedPointer<PhysicsObject>& physics_object : grid)
+    {
+        physics->RemovePhysicsObject(physics_object);
+    }
+    collider->ApplyCommands();
+    physics->ApplyCommands();
+    ASSERT(collider->GetNumSleepingObjects() == 0);
+
+    if (owns_physics)
+    {
+        Physics::Destroy();
+    }
+    if (owns_collider)
+    {
+        Collider::Destroy();
+    }
+
+    LOG("-------------------- Finished PhysicsIslands_UnitTest --------------------");
+}
@@ -0,0 +1,190 @@
+// library includes
+#include <stdlib.h>
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "GameObject/GameObject.h"
+#include "Logger/Logger.h"
+#include "Math/AABB.h"
+#include "Math/Transform.h"
+#include "Physics/Physics.h"
+#include "Physics/PhysicsObject.h"
+#include "Physics/PhysicsWorld.h"
+
+// not a multiple of the block size, so a partially filled block is tested too
+const size_t        PHYSICS_WORLD_TEST_NUM_OBJECTS = 300;
+const size_t        PHYSICS_WORLD_TEST_NUM_STEPS = 200;
+const size_t        PHYSICS_WORLD_TEST_NUM_REPLACED = 40;
+const float         PHYSICS_WORLD_TEST_DT = 1000.0f / 60.0f;
+const unsigned int  PHYSICS_WORLD_TEST_SEED = 1234;
+
+// the state of a physics object, updated the way PhysicsObject::Update used to update it
+struct PhysicsWorldTestBody
+{
+    engine::memory::SharedPointer<engine::gameobject::GameObject>       game_object;
+    engine::memory::SharedPointer<engine::physics::PhysicsObject>       physics_object;
+    engine::math::Vec3D                                                 velocity;
+    engine::math::Vec3D                                                 position;
+    float                                                               sleep_time;
+    bool                                                                is_awake;
+    bool                                                                is_simulated;
+};
+
+float GetRandomPhysicsWorldValue(float i_min, float i_max)
+{
+    return i_min + (i_max - i_min) * (float(rand()) / float(RAND_MAX));
+}
+
+PhysicsWorldTestBody CreatePhysicsWorldTestBody()
+{
+    using engine::physics::Physics;
+    using engine::physics::PhysicsObject;
+    using engine::physics::PhysicsObjectType;
+
+    const engine::math::Vec3D position(GetRandomPhysicsWorldValue(-500.0f, 500.0f), GetRandomPhysicsWorldValue(-500.0f, 500.0f), 0.0f);
+    const engine::math::AABB aabb = { engine::math::Vec3D::ZERO, engine::math::Vec3D(10.0f, 10.0f, 0.0f) };
+    const PhysicsObjectType types[] = { PhysicsObjectType::kPhysicsObjectStatic, PhysicsObjectType::kPhysicsObjectKinematic, PhysicsObjectType::kPhysicsObjectDynamic };
+
+    PhysicsWorldTestBody body;
+    body.game_object = engine::gameobject::GameObject::Create(aabb, engine::math::Transform(position));
+    body.physics_object = PhysicsObject::Create(body.game_object, GetRandomPhysicsWorldValue(0.5f, 3.0f), GetRandomPhysicsWorldValue(0.0f, 0.2f), types[rand() % 3]);
+
+    // most objects are simulated, some are set in motion & a few of those are then deactivated
+    body.is_simulated = rand() % 8 != 0;
+    if (body.is_simulated)
+    {
+        Physics::Get()->AddPhysicsObject(body.physics_object);
+    }
+    if (rand() % 4 != 0)
+    {
+        body.physics_object->ApplyImpulse(engine::math::Vec3D(GetRandomPhysicsWorldValue(-2.0f, 2.0f), GetRandomPhysicsWorldValue(-2.0f, 2.0f), 0.0f));
+    }
+    if (rand() % 16 == 0)
+    {
+        body.physics_object->SetIsActive(false);
+    }
+
+    body.velocity = body.physics_object->GetVelocity();
+    body.position = position;
+    body.sleep_time = 0.0f;
+    body.is_awake = body.physics_object->GetIsAwake();
+    return body;
+}
+
+void UpdatePhysicsWorldTestBody(PhysicsWorldTestBody& io_body, float i_dt)
+{
+    using engine::physics::PhysicsObject;
+    using engine::physics::PhysicsObjectType;
+
+    if (!io_body.is_simulated || !io_body.physics_object->GetIsActive() || !io_body.is_awake || io_body.physics_object->GetType() == PhysicsObjectType::kPhysicsObjectStatic)
+    {
+        return;
+    }
+
+    engine::math::Vec3D prev_velocity = io_body.velocity;
+    io_body.velocity += (io_body.velocity * -io_body.physics_object->GetDrag());
+
+    if (io_body.velocity.LengthSquared() <= PhysicsObject::MIN_VELOCITY_LENGTH_SQUARED)
+    {
+        io_body.velocity = engine::math::Vec3D::ZERO;
+        prev_velocity = engine::math::Vec3D::ZERO;
+        io_body.sleep_time += i_dt;
+    }
+    else
+    {
+        io_body.sleep_time = 0.0f;
+    }
+
+    io_body.position = io_body.position + ((prev_velocity + io_body.velocity) * 0.5f) * i_dt;
+
+    // nothing touches, so every body is an island of its own & falls asleep once it has rested for long enough
+    if (io_body.sleep_time >= PHYSICS_WORLD_TIME_TO_SLEEP)
+    {
+        io_body.is_awake = false;
+    }
+}
+
+void TestPhysicsWorld()
+{
+    using engine::physics::Physics;
+    using engine::physics::PhysicsWorld;
+
+    LOG("-------------------- Running PhysicsWorld_UnitTest --------------------");
+
+    // the engine usually owns this, create it if it doesn't exist yet
+    const bool owns_physics = Physics::Get() == nullptr;
+    Physics* physics = Physics::Create();
+    const PhysicsWorld& world = physics->GetWorld();
+    const size_t num_initial_bodies = world.GetNumBodies();
+
+    srand(PHYSICS_WORLD_TEST_SEED);
+
+    std::vector<PhysicsWorldTestBody> bodies;
+    for (size_t i = 0; i < PHYSICS_WORLD_TEST_NUM_OBJECTS; ++i)
+    {
+        bodies.push_back(CreatePhysicsWorldTestBody());
+    }
+    ASSERT(world.GetNumBodies() == num_initial_bodies + PHYSICS_WORLD_TEST_NUM_OBJECTS);
+
+    size_t num_fell_asleep = 0;
+    for (size_t step = 0; step < PHYSICS_WORLD_TEST_NUM_STEPS; ++step)
+    {
+        // half way through, replace some objects so that their handles are reused
+        if (step == PHYSICS_WORLD_TEST_NUM_STEPS / 2)
+        {
+            for (size_t i = 0; i < PHYSICS_WORLD_TEST_NUM_REPLACED; ++i)
+            {
+                PhysicsWorldTestBody& body = bodies[i * 7];
+                const engine::physics::PhysicsHandle old_handle = body.physics_object->GetHandle();
+                if (body.is_simulated)
+                {
+                    physics->RemovePhysicsObject(body.physics_object);
+                    physics->ApplyCommands();
+                }
+                body.physics_object = nullptr;
+                body = CreatePhysicsWorldTestBody();
+                ASSERT(body.physics_object->GetHandle() == old_handle);
+            }
+            ASSERT(world.GetNumBodies() == num_initial_bodies + PHYSICS_WORLD_TEST_NUM_OBJECTS);
+        }
+
+        physics->Run(PHYSICS_WORLD_TEST_DT);
+
+        // the world must agree exactly with the per-object update
+        for (PhysicsWorldTestBody& body : bodies)
+        {
+            const bool was_awake = body.is_awake;
+            UpdatePhysicsWorldTestBody(body, PHYSICS_WORLD_TEST_DT);
+            num_fell_asleep += was_awake && !body.is_awake ? 1 : 0;
+
+            const engine::math::Vec3D velocity = body.physics_object->GetVelocity();
+            const engine::math::Vec3D& position = body.game_object->GetPosition();
+            ASSERT(velocity.x() == body.velocity.x() && velocity.y() == body.velocity.y() && velocity.z() == body.velocity.z());
+            ASSERT(position.x() == body.position.x() && position.y() == body.position.y() && position.z() == body.position.z());
+            ASSERT(body.physics_object->GetIsAwake() == body.is_awake);
+        }
+    }
+
+    // make sure bodies were integrated until they came to a stop
+    ASSERT(num_fell_asleep > 0);
+    LOG("%zu bodies, %zu fell asleep over %zu steps", bodies.size(), num_fell_asleep, PHYSICS_WORLD_TEST_NUM_STEPS);
+
+    for (PhysicsWorldTestBody& body : bodies)
+    {
+        if (body.is_simulated)
+        {
+            physics->RemovePhysicsObject(body.physics_object);
+        }
+    }
+    physics->ApplyCommands();
+    bodies.clear();
+    ASSERT(world.GetNumBodies() == num_initial_bodies);
+
+    if (owns_physics)
+    {
+        Physics::Destroy();
+    }
+
+    LOG("-------------------- Finished PhysicsWorld_UnitTest --------------------");
+}
@@ -0,0 +1,128 @@
+// library includes
+#include <stdint.h>
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Common/Engine.h"
+#include "GameObject/GameObject.h"
+#include "Logger/Logger.h"
+#include "Math/Transform.h"
+#include "Math/Vec3D.h"
+#include "Memory/AllocatorUtil.h"
+#include "Memory/SharedPointer.h"
+#include "Renderer/NullRenderBackend.h"
+#include "Renderer/Renderer.h"
+
+const size_t        RENDER_THREAD_TEST_NUM_RENDERABLES = 32;
+const size_t        RENDER_THREAD_TEST_NUM_FRAMES = 60;
+const size_t        RENDER_THREAD_TEST_NUM_STARTS = 3;
+
+// remembers where every sprite of every frame was drawn, in the order they were drawn
+class RecordingRenderBackend : public engine::render::NullRenderBackend
+{
+public:
+    void DrawSprite(const GLib::Sprites::Sprite& i_sprite, float i_x, float i_y, float i_angle) override
+    {
+        NullRenderBackend::DrawSprite(i_sprite, i_x, i_y, i_angle);
+        drawn_x_.push_back(i_x);
+    }
+
+    std::vector<float>                          drawn_x_;
+};
+
+// every frame moves the game objects to x = frame, so the frame a snapshot was captured in can be told from where it was drawn
+void RunRenderThreadFrames(std::vector<engine::memory::SharedPointer<engine::gameobject::GameObject>>& i_game_objects, size_t& io_frame, size_t i_num_frames)
+{
+    engine::render::Renderer* renderer = engine::render::Renderer::Get();
+
+    for (size_t i = 0; i < i_num_frames; ++i, ++io_frame)
+    {
+        for (size_t j = 0; j < i_game_objects.size(); ++j)
+        {
+            i_game_objects[j]->SetPosition(engine::math::Vec3D(float(io_frame), float(j), 0.0f));
+        }
+        renderer->Run();
+    }
+}
+
+// every frame must have been drawn exactly once & after the frame before it
+void ValidateDrawnFrames(const RecordingRenderBackend& i_backend, size_t i_num_frames)
+{
+    ASSERT(i_backend.GetNumFrames() == i_num_frames);
+    ASSERT(i_backend.drawn_x_.size() == i_num_frames * RENDER_THREAD_TEST_NUM_RENDERABLES);
+
+    for (size_t i = 0; i < i_backend.drawn_x_.size(); ++i)
+    {
+        ASSERT(i_backend.drawn_x_[i] == float(i / RENDER_THREAD_TEST_NUM_RENDERABLES));
+    }
+}
+
+void TestRenderThread()
+{
+    LOG("-------------------- Running RenderThread_UnitTest --------------------");
+
+    // the renderer is given a backend of the test's own, so the engine can't already be running
+    engine::memory::CreateAllocators();
+    RecordingRenderBackend* backend = new RecordingRenderBackend();
+    bool success = engine::StartUp(backend);
+    ASSERT(success);
+
+    {
+        engine::render::Renderer* renderer = engine::render::Renderer::Get();
+        ASSERT(renderer->GetBackend() == backend);
+
+        uint8_t texture_data[16] = { 0 };
+        std::vector<engine::memory::SharedPointer<engine::gameobject::GameObject>> game_objects;
+        std::vector<engine::memory::SharedPointer<engine::render::RenderableObject>> renderables;
+        for (size_t i = 0; i < RENDER_THREAD_TEST_NUM_RENDERABLES; ++i)
+        {
+            game_objects.push_back(engine::gameobject::GameObject::Create());
+            renderables.push_back(renderer->CreateRenderableObject(backend->CreateSprite(texture_data, sizeof(texture_data), 8, 8), game_objects.back()));
+        }
+
+        size_t frame = 0;
+
+        // stopping a render thread that was never started does nothing
+        renderer->StopRenderThread();
+        ASSERT(renderer->IsRenderThreadRunning() == false);
+
+        // the thread can be started & stopped over & over, stopping draws the last snapshot that was handed over
+        for (size_t i = 0; i < RENDER_THREAD_TEST_NUM_STARTS; ++i)
+        {
+            renderer->StartRenderThread();
+            ASSERT(renderer->IsRenderThreadRunning());
+            renderer->StartRenderThread();
+
+            RunRenderThreadFrames(game_objects, frame, RENDER_THREAD_TEST_NUM_FRAMES);
+
+            renderer->StopRenderThread();
+            ASSERT(renderer->IsRenderThreadRunning() == false);
+            renderer->StopRenderThread();
+
+            ValidateDrawnFrames(*backend, frame);
+        }
+
+        // without the thread, every frame is drawn by Run itself
+        RunRenderThreadFrames(game_objects, frame, RENDER_THREAD_TEST_NUM_FRAMES);
+        ValidateDrawnFrames(*backend, frame);
+
+        LOG("Drew %llu frames of %zu sprites, %zu of them on the render thread", static_cast<unsigned long long>(backend->GetNumFrames()),
+            RENDER_THREAD_TEST_NUM_RENDERABLES, RENDER_THREAD_TEST_NUM_STARTS * RENDER_THREAD_TEST_NUM_FRAMES);
+
+        // the snapshots let go of the renderables once they've both been captured again
+        for (size_t i = 0; i < renderables.size(); ++i)
+        {
+            renderer->RemoveRenderableObject(renderables[i]);
+        }
+        renderables.clear();
+        renderer->Run();
+        renderer->Run();
+        ASSERT(backend->GetNumSprites() == 0);
+    }
+
+    // also deletes the backend
+    engine::Shutdown();
+
+    LOG("-------------------- Finished RenderThread_UnitTest --------------------");
+}
@@ -0,0 +1,227 @@
+// library includes
+#include <algorithm>
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "GameObject/GameObject.h"
+#include "Logger/Logger.h"
+#include "Math/AABB.h"
+#include "Math/Transform.h"
+#include "Physics/Collider.h"
+#include "Physics/Physics.h"
+#include "Physics/PhysicsObject.h"
+
+const size_t        SCENE_QUERY_TEST_NUM_OBJECTS = 400;
+const size_t        SCENE_QUERY_TEST_NUM_QUERIES = 300;
+const float         SCENE_QUERY_TEST_WORLD_SIZE = 1000.0f;
+const float         SCENE_QUERY_TEST_DT = 1000.0f / 60.0f;
+const unsigned int  SCENE_QUERY_TEST_SEED = 4321;
+
+// every other object is on a second layer, so masks can be checked
+const engine::physics::CollisionFilter SCENE_QUERY_TEST_FILTERS[] = { { 0x0001, 0xffff }, { 0x0002, 0xffff } };
+
+float GetRandomSceneQueryValue(float i_min, float i_max)
+{
+    return i_min + (i_max - i_min) * (float(rand()) / float(RAND_MAX));
+}
+
+// the bounds of an object that isn't rotated
+void GetSceneQueryTestBounds(const engine::memory::SharedPointer<engine::gameobject::GameObject>& i_game_object, float& o_min_x, float& o_min_y, float& o_max_x, float& o_max_y)
+{
+    const engine::math::Vec3D& position = i_game_object->GetPosition();
+    const engine::math::AABB& aabb = i_game_object->GetAABB();
+    o_min_x = position.x() + aabb.center.x() - aabb.extents.x();
+    o_min_y = position.y() + aabb.center.y() - aabb.extents.y();
+    o_max_x = position.x() + aabb.center.x() + aabb.extents.x();
+    o_max_y = position.y() + aabb.center.y() + aabb.extents.y();
+}
+
+// the distance along a ray to where it enters an object, or FLT_MAX if it misses it or starts inside it
+float GetSceneQueryTestRayDistance(const engine::memory::SharedPointer<engine::gameobject::GameObject>& i_game_object, const engine::math::Vec3D& i_origin, const engine::math::Vec3D& i_direction)
+{
+    float bounds_min[2], bounds_max[2];
+    GetSceneQueryTestBounds(i_game_object, bounds_min[0], bounds_min[1], bounds_max[0], bounds_max[1]);
+    const float origin[2] = { i_origin.x(), i_origin.y() };
+    const float direction[2] = { i_direction.x(), i_direction.y() };
+    if (origin[0] >= bounds_min[0] && origin[0] <= bounds_max[0] && origin[1] >= bounds_min[1] && origin[1] <= bounds_max[1])
+    {
+        return FLT_MAX;
+    }
+
+    float t_enter = 0.0f;
+    float t_exit = FLT_MAX;
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        const float t_0 = (bounds_min[axis] - origin[axis]) / direction[axis];
+        const float t_1 = (bounds_max[axis] - origin[axis]) / direction[axis];
+        t_enter = std::max(t_enter, std::min(t_0, t_1));
+        t_exit = std::min(t_exit, std::max(t_0, t_1));
+    }
+    return t_enter <= t_exit ? t_enter : FLT_MAX;
+}
+
+void TestSceneQuery()
+{
+    using engine::gameobject::GameObject;
+    using engine::physics::Collider;
+    using engine::physics::NearestQuery;
+    using engine::physics::Physics;
+    using engine::physics::PhysicsObject;
+    using engine::physics::RaycastQuery;
+    using engine::physics::SceneQueryHit;
+
+    LOG("-------------------- Running SceneQuery_UnitTest --------------------");
+
+    // the engine usually owns these, create them if they don't exist yet
+    const bool owns_collider = Collider::Get() == nullptr;
+    Collider* collider = Collider::Create();
+    const bool owns_physics = Physics::Get() == nullptr;
+    Physics* physics = Physics::Create();
+
+    srand(SCENE_QUERY_TEST_SEED);
+
+    // small & medium boxes, with a few too large for the grid
+    std::vector<engine::memory::SharedPointer<GameObject>> game_objects;
+    std::vector<engine::memory::SharedPointer<PhysicsObject>> physics_objects;
+    for (size_t i = 0; i < SCENE_QUERY_TEST_NUM_OBJECTS; ++i)
+    {
+        const float size = i % 100 == 0 ? 600.0f : GetRandomSceneQueryValue(2.0f, 40.0f);
+        const engine::math::Vec3D position(GetRandomSceneQueryValue(0.0f, SCENE_QUERY_TEST_WORLD_SIZE), GetRandomSceneQueryValue(0.0f, SCENE_QUERY_TEST_WORLD_SIZE), 0.0f);
+        const engine::math::AABB aabb = { engine::math::Vec3D::ZERO, engine::math::Vec3D(size, size * 0.5f, 0.0f) };
+        game_objects.push_back(GameObject::Create(aabb, engine::math::Transform(position)));
+        physics_objects.push_back(physics->CreatePhysicsObject(game_objects.back(), 1.0f, 0.0f, engine::physics::PhysicsObjectType::kPhysicsObjectStatic, SCENE_QUERY_TEST_FILTERS[i % 2], true));
+    }
+
+    // queries are answered from the proxies of the collider's last run
+    collider->Run(SCENE_QUERY_TEST_DT);
+    ASSERT(collider->GetSceneQuery().GetNumObjects() >= SCENE_QUERY_TEST_NUM_OBJECTS);
+
+    std::vector<RaycastQuery> raycast_queries;
+    std::vector<NearestQuery> nearest_queries;
+    for (size_t i = 0; i < SCENE_QUERY_TEST_NUM_QUERIES; ++i)
+    {
+        const engine::math::Vec3D origin(GetRandomSceneQueryValue(-100.0f, SCENE_QUERY_TEST_WORLD_SIZE + 100.0f), GetRandomSceneQueryValue(-100.0f, SCENE_QUERY_TEST_WORLD_SIZE + 100.0f), 0.0f);
+        // some rays run along an axis
+        engine::math::Vec3D direction(GetRandomSceneQueryValue(-1.0f, 1.0f), GetRandomSceneQueryValue(-1.0f, 1.0f), 0.0f);
+        direction = i % 10 == 0 ? engine::math::Vec3D(1.0f, 0.0f, 0.0f) : (i % 10 == 1 ? engine::math::Vec3D(0.0f, -1.0f, 0.0f) : direction);
+        const uint16_t mask = i % 3 == 0 ? SCENE_QUERY_TEST_FILTERS[1].category : SCENE_QUERY_ALL_LAYERS;
+        raycast_queries.push_back({ origin, direction, GetRandomSceneQueryValue(10.0f, 800.0f), mask });
+        nearest_queries.push_back({ origin, GetRandomSceneQueryValue(10.0f, 300.0f), mask });
+    }
+
+    // every query must find exactly what testing every object finds
+    size_t num_ray_hits = 0;
+    size_t num_nearest_hits = 0;
+    size_t num_overlaps = 0;
+    std::vector<engine::memory::WeakPointer<PhysicsObject>> overlaps;
+    for (size_t i = 0; i < SCENE_QUERY_TEST_NUM_QUERIES; ++i)
+    {
+        const RaycastQuery& raycast_query = raycast_queries[i];
+        const NearestQuery& nearest_query = nearest_queries[i];
+        const engine::math::Vec3D direction = raycast_query.direction.Normalize();
+        const engine::math::AABB box = { nearest_query.point, engine::math::Vec3D(nearest_query.max_distance * 0.5f, nearest_query.max_distance * 0.25f, 0.0f) };
+
+        float expected_ray_distance = raycast_query.max_distance;
+        float expected_nearest_distance = nearest_query.max_distance;
+        bool expected_ray_hit = false;
+        bool expected_nearest_hit = false;
+        std::vector<PhysicsObject*> expected_overlaps;
+        for (size_t j = 0; j < game_objects.size(); ++j)
+        {
+            if ((physics_objects[j]->GetCollisionFilter().category & raycast_query.mask) == 0)
+            {
+                continue;
+            }
+
+            const float ray_distance = GetSceneQueryTestRayDistance(game_objects[j], raycast_query.origin, direction);
+            if (ray_distance <= expected_ray_distance)
+            {
+                expected_ray_distance = ray_distance;
+                expected_ray_hit = true;
+            }
+
+            float min_x, min_y, max_x, max_y;
+            GetSceneQueryTestBounds(game_objects[j], min_x, min_y, max_x, max_y);
+            const float closest_x = std::min(std::max(nearest_query.point.x(), min_x), max_x);
+            const float closest_y = std::min(std::max(nearest_query.point.y(), min_y), max_y);
+            const float nearest_distance = sqrtf((closest_x - nearest_query.point.x()) * (closest_x - nearest_query.point.x()) + (closest_y - nearest_query.point.y()) * (closest_y - nearest_query.point.y()));
+            if (nearest_distance <= expected_nearest_distance)
+            {
+                expected_nearest_distance = nearest_distance;
+                expected_nearest_hit = true;
+            }
+
+            if (min_x <= box.center.x() + box.extents.x() && box.center.x() - box.extents.x() <= max_x &&
+                min_y <= box.center.y() + box.extents.y() && box.center.y() - box.extents.y() <= max_y)
+            {
+                expected_overlaps.push_back(&*physics_objects[j]);
+            }
+        }
+
+        SceneQueryHit hit;
+        const bool has_ray_hit = collider->Raycast(raycast_query.origin, raycast_query.direction, raycast_query.max_distance, hit, raycast_query.mask);
+        ASSERT(has_ray_hit == expected_ray_hit);
+        ASSERT(!has_ray_hit || fabs(hit.distance - expected_ray_distance) < 0.001f);
+        num_ray_hits += has_ray_hit ? 1 : 0;
+
+        const bool has_nearest_hit = collider->QueryNearest(nearest_query.point, nearest_query.max_distance, hit, nearest_query.mask);
+        ASSERT(has_nearest_hit == expected_nearest_hit);
+        ASSERT(!has_nearest_hit || fabs(hit.distance - expected_nearest_distance) < 0.001f);
+        num_nearest_hits += has_nearest_hit ? 1 : 0;
+
+        // each object is reported once, even if it is in several cells
+        overlaps.clear();
+        collider->OverlapAABB(box, overlaps, raycast_query.mask);
+        std::vector<PhysicsObject*> found_overlaps;
+        for (const engine::memory::WeakPointer<PhysicsObject>& overlap : overlaps)
+        {
+            found_overlaps.push_back(&*overlap.Lock());
+        }
+        std::sort(found_overlaps.begin(), found_overlaps.end());
+        std::sort(expected_overlaps.begin(), expected_overlaps.end());
+        ASSERT(found_overlaps == expected_overlaps);
+        num_overlaps += found_overlaps.size();
+    }
+    ASSERT(num_ray_hits > 0 && num_nearest_hits > 0 && num_overlaps > 0);
+
+    // batches find the same objects as single queries
+    std::vector<SceneQueryHit> hits(SCENE_QUERY_TEST_NUM_QUERIES);
+    collider->Raycast(raycast_queries.data(), raycast_queries.size(), hits.data());
+    for (size_t i = 0; i < SCENE_QUERY_TEST_NUM_QUERIES; ++i)
+    {
+        SceneQueryHit hit;
+        const bool has_hit = collider->GetSceneQuery().Raycast(raycast_queries[i], hit);
+        ASSERT(has_hit == bool(hits[i].object) && (!has_hit || hit.distance == hits[i].distance));
+    }
+    collider->QueryNearest(nearest_queries.data(), nearest_queries.size(), hits.data());
+    for (size_t i = 0; i < SCENE_QUERY_TEST_NUM_QUERIES; ++i)
+    {
+        SceneQueryHit hit;
+        const bool has_hit = collider->GetSceneQuery().QueryNearest(nearest_queries[i], hit);
+        ASSERT(has_hit == bool(hits[i].object) && (!has_hit || hit.distance == hits[i].distance));
+    }
+
+    LOG("%zu queries: %zu rays hit, %zu nearest objects found & %zu overlaps", SCENE_QUERY_TEST_NUM_QUERIES, num_ray_hits, num_nearest_hits, num_overlaps);
+
+    for (const engine::memory::SharedPointer<PhysicsObject>& physics_object : physics_objects)
+    {
+        physics->RemovePhysicsObject(physics_object);
+    }
+    collider->ApplyCommands();
+    physics->ApplyCommands();
+
+    if (owns_physics)
+    {
+        Physics::Destroy();
+    }
+    if (owns_collider)
+    {
+        Collider::Destroy();
+    }
+
+    LOG("-------------------- Finished SceneQuery_UnitTest --------------------");
+}
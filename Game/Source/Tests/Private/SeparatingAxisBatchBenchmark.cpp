@@ -0,0 +1,102 @@
+// library includes
+#include <stdlib.h>
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+#include "Math/MathUtil.h"
+#include "Physics/Collider.h"
+#include "Physics/SeparatingAxisBatch.h"
+#include "Time/TimerUtil.h"
+
+const size_t        SEPARATING_AXIS_BENCHMARK_NUM_PAIRS = 20000;
+const size_t        SEPARATING_AXIS_BENCHMARK_NUM_ITERATIONS = 100;
+const float         SEPARATING_AXIS_BENCHMARK_DT = 1000.0f / 60.0f;
+const unsigned int  SEPARATING_AXIS_BENCHMARK_SEED = 1234;
+
+void BenchmarkSeparatingAxisBatch()
+{
+    using engine::physics::Collider;
+    using engine::physics::SeparatingAxis;
+    using engine::physics::SeparatingAxisBatch;
+
+    LOG("-------------------- Running SeparatingAxisBatch Benchmark --------------------");
+
+    srand(SEPARATING_AXIS_BENCHMARK_SEED);
+
+    // relative velocity, center, extents, other center & other extents of every axis of every pair
+    const uint8_t num_axes = static_cast<uint8_t>(SeparatingAxis::Count);
+    std::vector<float> inputs(SEPARATING_AXIS_BENCHMARK_NUM_PAIRS * num_axes * 5);
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        const float random = float(rand()) / float(RAND_MAX);
+        switch (i % 5)
+        {
+        case 0:
+            inputs[i] = random - 0.5f;
+            break;
+        case 3:
+            inputs[i] = random * 80.0f - 40.0f;
+            break;
+        default:
+            inputs[i] = random * 20.0f;
+            break;
+        }
+    }
+
+    SeparatingAxisBatch batch;
+    batch.Reset(SEPARATING_AXIS_BENCHMARK_NUM_PAIRS);
+    for (size_t i = 0; i < SEPARATING_AXIS_BENCHMARK_NUM_PAIRS; ++i)
+    {
+        for (uint8_t axis = 0; axis < num_axes; ++axis)
+        {
+            const float* axis_inputs = &inputs[(i * num_axes + axis) * 5];
+            batch.SetAxis(i, static_cast<SeparatingAxis>(axis), axis_inputs[0], axis_inputs[1], axis_inputs[2], axis_inputs[3], axis_inputs[4]);
+        }
+    }
+
+    // the scalar test, as the collider used to run it on one pair at a time
+    size_t num_scalar_collisions = 0;
+    double start_tick = engine::time::TimerUtil::GetCounter();
+    for (size_t iteration = 0; iteration < SEPARATING_AXIS_BENCHMARK_NUM_ITERATIONS; ++iteration)
+    {
+        for (size_t i = 0; i < SEPARATING_AXIS_BENCHMARK_NUM_PAIRS; ++i)
+        {
+            bool is_separated = false;
+            float t_close[static_cast<uint8_t>(SeparatingAxis::Count)] = { 0.0f };
+            float t_open[static_cast<uint8_t>(SeparatingAxis::Count)] = { 0.0f };
+            for (uint8_t axis = 0; axis < num_axes; ++axis)
+            {
+                const float* axis_inputs = &inputs[(i * num_axes + axis) * 5];
+                is_separated |= Collider::CheckSeparationForAxis(axis_inputs[0], axis_inputs[1], axis_inputs[2], axis_inputs[3], axis_inputs[4], SEPARATING_AXIS_BENCHMARK_DT, t_close[axis], t_open[axis]);
+            }
+
+            const float t_close_latest = engine::math::GetMaxOfFour(t_close[0], t_close[1], t_close[2], t_close[3]);
+            const float t_open_earliest = engine::math::GetMinOfFour(t_open[0], t_open[1], t_open[2], t_open[3]);
+            num_scalar_collisions += (!is_separated && !(t_close_latest > t_open_earliest)) ? 1 : 0;
+        }
+    }
+    const double scalar_ms = (engine::time::TimerUtil::GetCounter() - start_tick) / engine::time::TimerUtil::GetFrequency();
+
+    // the same pairs, several at a time
+    size_t num_batch_collisions = 0;
+    start_tick = engine::time::TimerUtil::GetCounter();
+    for (size_t iteration = 0; iteration < SEPARATING_AXIS_BENCHMARK_NUM_ITERATIONS; ++iteration)
+    {
+        batch.Run(SEPARATING_AXIS_BENCHMARK_DT);
+        for (size_t i = 0; i < SEPARATING_AXIS_BENCHMARK_NUM_PAIRS; ++i)
+        {
+            num_batch_collisions += batch.IsColliding(i) ? 1 : 0;
+        }
+    }
+    const double batch_ms = (engine::time::TimerUtil::GetCounter() - start_tick) / engine::time::TimerUtil::GetFrequency();
+
+    ASSERT(num_scalar_collisions == num_batch_collisions);
+
+    LOG("%zu pairs, %zu collisions", SEPARATING_AXIS_BENCHMARK_NUM_PAIRS, num_scalar_collisions / SEPARATING_AXIS_BENCHMARK_NUM_ITERATIONS);
+    LOG("Scalar: %f ms per run", scalar_ms / SEPARATING_AXIS_BENCHMARK_NUM_ITERATIONS);
+    LOG("Batch of %d: %f ms per run (%f times faster)", SEPARATING_AXIS_BATCH_WIDTH, batch_ms / SEPARATING_AXIS_BENCHMARK_NUM_ITERATIONS, scalar_ms / batch_ms);
+
+    LOG("-------------------- Finished SeparatingAxisBatch Benchmark --------------------");
+}
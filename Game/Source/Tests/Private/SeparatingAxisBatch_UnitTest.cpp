@@ -0,0 +1,98 @@
+// library includes
+#include <stdlib.h>
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "Logger/Logger.h"
+#include "Math/MathUtil.h"
+#include "Physics/Collider.h"
+#include "Physics/SeparatingAxisBatch.h"
+
+// not a multiple of the batch width, so the padding is tested too
+const size_t        SEPARATING_AXIS_TEST_NUM_PAIRS = 4099;
+const float         SEPARATING_AXIS_TEST_DT = 1000.0f / 60.0f;
+const unsigned int  SEPARATING_AXIS_TEST_SEED = 1234;
+// relative velocity, center, extents, other center & other extents
+const size_t        SEPARATING_AXIS_TEST_NUM_INPUTS = 5;
+
+float GetRandomSeparatingAxisValue(float i_min, float i_max)
+{
+    return i_min + (i_max - i_min) * (float(rand()) / float(RAND_MAX));
+}
+
+void TestSeparatingAxisBatch()
+{
+    using engine::physics::Collider;
+    using engine::physics::SeparatingAxis;
+    using engine::physics::SeparatingAxisBatch;
+
+    LOG("-------------------- Running SeparatingAxisBatch_UnitTest --------------------");
+
+    srand(SEPARATING_AXIS_TEST_SEED);
+
+    const uint8_t num_axes = static_cast<uint8_t>(SeparatingAxis::Count);
+    std::vector<float> inputs(SEPARATING_AXIS_TEST_NUM_PAIRS * num_axes * SEPARATING_AXIS_TEST_NUM_INPUTS);
+
+    SeparatingAxisBatch batch;
+    batch.Reset(SEPARATING_AXIS_TEST_NUM_PAIRS);
+    ASSERT(batch.GetNumPairs() == SEPARATING_AXIS_TEST_NUM_PAIRS);
+
+    for (size_t i = 0; i < SEPARATING_AXIS_TEST_NUM_PAIRS; ++i)
+    {
+        for (uint8_t axis = 0; axis < num_axes; ++axis)
+        {
+            // mix in axes without any velocity & with velocities right around the epsilon
+            float velocity = GetRandomSeparatingAxisValue(-0.5f, 0.5f);
+            switch (rand() % 8)
+            {
+            case 0:
+                velocity = 0.0f;
+                break;
+            case 1:
+                velocity = GetRandomSeparatingAxisValue(-2.0f, 2.0f) * MAX_EPSILON;
+                break;
+            }
+
+            float* axis_inputs = &inputs[(i * num_axes + axis) * SEPARATING_AXIS_TEST_NUM_INPUTS];
+            axis_inputs[0] = velocity;
+            axis_inputs[1] = GetRandomSeparatingAxisValue(-5.0f, 5.0f);
+            axis_inputs[2] = GetRandomSeparatingAxisValue(1.0f, 20.0f);
+            axis_inputs[3] = GetRandomSeparatingAxisValue(-40.0f, 40.0f);
+            axis_inputs[4] = GetRandomSeparatingAxisValue(1.0f, 20.0f);
+
+            batch.SetAxis(i, static_cast<SeparatingAxis>(axis), axis_inputs[0], axis_inputs[1], axis_inputs[2], axis_inputs[3], axis_inputs[4]);
+        }
+    }
+
+    batch.Run(SEPARATING_AXIS_TEST_DT);
+
+    // the batch must agree exactly with the scalar test
+    size_t num_colliding = 0;
+    for (size_t i = 0; i < SEPARATING_AXIS_TEST_NUM_PAIRS; ++i)
+    {
+        bool is_separated = false;
+        float t_close[static_cast<uint8_t>(SeparatingAxis::Count)] = { 0.0f };
+        float t_open[static_cast<uint8_t>(SeparatingAxis::Count)] = { 0.0f };
+        for (uint8_t axis = 0; axis < num_axes; ++axis)
+        {
+            const float* axis_inputs = &inputs[(i * num_axes + axis) * SEPARATING_AXIS_TEST_NUM_INPUTS];
+            is_separated |= Collider::CheckSeparationForAxis(axis_inputs[0], axis_inputs[1], axis_inputs[2], axis_inputs[3], axis_inputs[4], SEPARATING_AXIS_TEST_DT, t_close[axis], t_open[axis]);
+            ASSERT(batch.GetCloseTime(i, static_cast<SeparatingAxis>(axis)) == t_close[axis]);
+        }
+
+        const float t_close_latest = engine::math::GetMaxOfFour(t_close[0], t_close[1], t_close[2], t_close[3]);
+        const float t_open_earliest = engine::math::GetMinOfFour(t_open[0], t_open[1], t_open[2], t_open[3]);
+        const bool is_colliding = !is_separated && !(t_close_latest > t_open_earliest);
+
+        ASSERT(batch.IsColliding(i) == is_colliding);
+        ASSERT(batch.GetCloseTime(i) == t_close_latest);
+        num_colliding += is_colliding ? 1 : 0;
+    }
+
+    // make sure both outcomes were exercised
+    ASSERT(num_colliding > 0 && num_colliding < SEPARATING_AXIS_TEST_NUM_PAIRS);
+    LOG("%zu of %zu pairs collided", num_colliding, SEPARATING_AXIS_TEST_NUM_PAIRS);
+
+    LOG("-------------------- Finished SeparatingAxisBatch_UnitTest --------------------");
+}
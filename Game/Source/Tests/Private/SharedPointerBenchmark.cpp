@@ -0,0 +1,85 @@
+// library includes
+#include <thread>
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "GameObject/GameObject.h"
+#include "Logger/Logger.h"
+#include "Memory/SharedPointer.h"
+#include "Memory/WeakPointer.h"
+#include "Time/TimerUtil.h"
+
+const size_t        SHARED_POINTER_BENCHMARK_NUM_OBJECTS = 64;
+const size_t        SHARED_POINTER_BENCHMARK_NUM_ITERATIONS = 1000000;
+const size_t        SHARED_POINTER_BENCHMARK_MAX_THREADS = 8;
+
+// copies & destroys shared pointers to objects that every other thread is copying too
+void CopySharedPointers(const std::vector<engine::memory::SharedPointer<engine::gameobject::GameObject>>& i_objects, size_t i_first_index)
+{
+    for (size_t i = 0; i < SHARED_POINTER_BENCHMARK_NUM_ITERATIONS; ++i)
+    {
+        engine::memory::SharedPointer<engine::gameobject::GameObject> copy(i_objects[(i_first_index + i) % SHARED_POINTER_BENCHMARK_NUM_OBJECTS]);
+        ASSERT(copy);
+    }
+}
+
+// locks & releases weak pointers, the way the collider walks its objects
+void LockWeakPointers(const std::vector<engine::memory::WeakPointer<engine::gameobject::GameObject>>& i_objects, size_t i_first_index)
+{
+    for (size_t i = 0; i < SHARED_POINTER_BENCHMARK_NUM_ITERATIONS; ++i)
+    {
+        engine::memory::SharedPointer<engine::gameobject::GameObject> locked = i_objects[(i_first_index + i) % SHARED_POINTER_BENCHMARK_NUM_OBJECTS].Lock();
+        ASSERT(locked);
+    }
+}
+
+template<class Objects>
+void RunSharedPointerThreads(const char* i_name, void (*i_work)(const Objects&, size_t), const Objects& i_objects, size_t i_num_threads)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(i_num_threads);
+
+    const double start_tick = engine::time::TimerUtil::GetCounter();
+
+    for (size_t i = 0; i < i_num_threads; ++i)
+    {
+        threads.push_back(std::thread(i_work, std::cref(i_objects), i * 7));
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    const double elapsed_ms = (engine::time::TimerUtil::GetCounter() - start_tick) / engine::time::TimerUtil::GetFrequency();
+    const size_t num_operations = i_num_threads * SHARED_POINTER_BENCHMARK_NUM_ITERATIONS;
+
+    LOG("%s with %zu threads: %zu operations in %f ms (%f ns per operation)", i_name, i_num_threads, num_operations, elapsed_ms, elapsed_ms * 1000000.0 / num_operations);
+}
+
+void BenchmarkSharedPointer()
+{
+    LOG("-------------------- Running Shared Pointer Benchmark --------------------");
+
+    std::vector<engine::memory::SharedPointer<engine::gameobject::GameObject>> objects;
+    std::vector<engine::memory::WeakPointer<engine::gameobject::GameObject>> weak_objects;
+    for (size_t i = 0; i < SHARED_POINTER_BENCHMARK_NUM_OBJECTS; ++i)
+    {
+        objects.push_back(engine::gameobject::GameObject::Create());
+        weak_objects.push_back(objects.back());
+    }
+
+    for (size_t num_threads = 1; num_threads <= SHARED_POINTER_BENCHMARK_MAX_THREADS; num_threads *= 2)
+    {
+        RunSharedPointerThreads("Copy & destroy", CopySharedPointers, objects, num_threads);
+        RunSharedPointerThreads("Lock & release", LockWeakPointers, weak_objects, num_threads);
+    }
+
+#ifdef BUILD_DEBUG
+    // every copy must have been released
+    for (const auto& object : objects)
+    {
+        ASSERT(object.GetStrongCount() == 1 && object.GetWeakCount() == 1);
+    }
+#endif
+}
@@ -3,12 +3,13 @@
 #include <vector>
 
 // engine includes
-#include "GameObject\GameObject.h"
-#include "Logger\Logger.h"
-#include "Math\Vec3D.h"
-#include "Memory\SharedPointer.h"
-#include "Memory\UniquePointer.h"
-#include "Memory\WeakPointer.h"
+#include "GameObject/GameObject.h"
+#include "Logger/Logger.h"
+#include "Math/Vec3D.h"
+#include "Memory/RefCounted.h"
+#include "Memory/SharedPointer.h"
+#include "Memory/UniquePointer.h"
+#include "Memory/WeakPointer.h"
 
 void TestSharedPointerConstructorsAndAssignment()
 {
@@ -229,6 +230,86 @@ void TestWeakPointer()
     LOG("------------------------------");
 }
 
+// counts its live instances so the tests can tell exactly when it was destroyed
+struct SmartPointersTestObject
+{
+    explicit SmartPointersTestObject(int i_value) : value(i_value) { ++num_alive; }
+    ~SmartPointersTestObject() { --num_alive; }
+
+    int                             value;
+    static int                      num_alive;
+};
+int SmartPointersTestObject::num_alive = 0;
+
+struct SmartPointersTestRefCountedObject : public engine::memory::RefCounted
+{
+    explicit SmartPointersTestRefCountedObject(int i_value) : value(i_value) { ++num_alive; }
+    ~SmartPointersTestRefCountedObject() { --num_alive; }
+
+    int                             value;
+    static int                      num_alive;
+};
+int SmartPointersTestRefCountedObject::num_alive = 0;
+
+void TestMakeShared()
+{
+    // block that tests shared pointers whose object & counter share an allocation
+    {
+        engine::memory::WeakPointer<SmartPointersTestObject> weak_ptr0;
+        {
+            engine::memory::SharedPointer<SmartPointersTestObject> strong_ptr0 = engine::memory::MakeShared<SmartPointersTestObject>(42);
+            LOG("MakeShared construction %s", (strong_ptr0 && strong_ptr0->value == 42 && SmartPointersTestObject::num_alive == 1) ? "OK!" : "NOT OK!");
+
+            engine::memory::SharedPointer<SmartPointersTestObject> strong_ptr1(strong_ptr0);
+            weak_ptr0 = strong_ptr1;
+            LOG("MakeShared copy & weak pointer %s", (strong_ptr1 == strong_ptr0 && weak_ptr0.Lock() == strong_ptr0) ? "OK!" : "NOT OK!");
+#ifdef BUILD_DEBUG
+            LOG("StrongCount:%ld  WeakCount:%ld", strong_ptr1.GetStrongCount(), strong_ptr1.GetWeakCount());
+#endif
+        }
+
+        // the object is gone but the weak pointer can still safely look at the counter
+        LOG("MakeShared destruction %s", (SmartPointersTestObject::num_alive == 0 && weak_ptr0.HasExpired() && !weak_ptr0.Lock()) ? "OK!" : "NOT OK!");
+    }
+
+    LOG("------------------------------");
+}
+
+void TestIntrusiveSharedPointer()
+{
+    // block that tests shared pointers to objects that carry their own counter
+    {
+        engine::memory::WeakPointer<SmartPointersTestRefCountedObject> weak_ptr0;
+        {
+            SmartPointersTestRefCountedObject* object = new SmartPointersTestRefCountedObject(7);
+            engine::memory::SharedPointer<SmartPointersTestRefCountedObject> strong_ptr0(object);
+
+            // a second shared pointer from the same raw pointer shares the counter instead of double deleting
+            engine::memory::SharedPointer<SmartPointersTestRefCountedObject> strong_ptr1(object);
+            LOG("Intrusive shared pointers from one raw pointer %s", (strong_ptr0 == strong_ptr1 && object->GetRefCounter()->strong_count == 2) ? "OK!" : "NOT OK!");
+
+            weak_ptr0 = strong_ptr1;
+            strong_ptr0 = nullptr;
+            LOG("Intrusive shared pointer release %s", (SmartPointersTestRefCountedObject::num_alive == 1 && !weak_ptr0.HasExpired()) ? "OK!" : "NOT OK!");
+#ifdef BUILD_DEBUG
+            LOG("StrongCount:%ld  WeakCount:%ld", strong_ptr1.GetStrongCount(), strong_ptr1.GetWeakCount());
+#endif
+        }
+        LOG("Intrusive shared pointer destruction %s", (SmartPointersTestRefCountedObject::num_alive == 0 && weak_ptr0.HasExpired() && !weak_ptr0.Lock()) ? "OK!" : "NOT OK!");
+
+        // intrusive objects can be made in a single allocation too
+        engine::memory::SharedPointer<SmartPointersTestRefCountedObject> strong_ptr2 = engine::memory::MakeShared<SmartPointersTestRefCountedObject>(9);
+        engine::memory::SharedPointer<SmartPointersTestRefCountedObject> strong_ptr3(strong_ptr2.operator->());
+        LOG("Intrusive MakeShared %s", (strong_ptr3 == strong_ptr2 && strong_ptr3->GetRefCounter()->strong_count == 2) ? "OK!" : "NOT OK!");
+
+        // objects that are never shared can still be deleted directly
+        delete new SmartPointersTestRefCountedObject(3);
+        LOG("Intrusive direct delete %s", (SmartPointersTestRefCountedObject::num_alive == 1) ? "OK!" : "NOT OK!");
+    }
+
+    LOG("------------------------------");
+}
+
 void TestUniquePointer()
 {
     // block that tests unique pointer constructor & operators
@@ -301,6 +382,8 @@ void TestSmartPointers()
     TestSharedPointerConstructorsAndAssignment();
     TestSharedPointerOperators();
     TestWeakPointer();
+    TestMakeShared();
+    TestIntrusiveSharedPointer();
     TestUniquePointer();
 
     TestSmartPointersWithVector();
@@ -0,0 +1,307 @@
+// library includes
+#include <algorithm>
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vector>
+
+// engine includes
+#include "Assert/Assert.h"
+#include "GameObject/GameObject.h"
+#include "Logger/Logger.h"
+#include "Math/AABB.h"
+#include "Math/Transform.h"
+#include "Physics/Collider.h"
+#include "Physics/Physics.h"
+#include "Physics/PhysicsObject.h"
+#include "Physics/StaticBVH.h"
+
+const size_t        STATIC_BVH_TEST_NUM_PROXIES = 2000;
+const size_t        STATIC_BVH_TEST_NUM_QUERIES = 300;
+const size_t        STATIC_BVH_TEST_NUM_STATIC_OBJECTS = 600;
+const size_t        STATIC_BVH_TEST_NUM_DYNAMIC_OBJECTS = 300;
+const float         STATIC_BVH_TEST_WORLD_SIZE = 1000.0f;
+const float         STATIC_BVH_TEST_DT = 1000.0f / 60.0f;
+const unsigned int  STATIC_BVH_TEST_SEED = 2468;
+
+// some static objects are on a layer nothing else collides with, so filtered pairs can be checked
+const engine::physics::CollisionFilter STATIC_BVH_TEST_FILTERS[] = { { 0x0001, 0xffff }, { 0x0002, 0x0002 } };
+
+float GetRandomStaticBVHValue(float i_min, float i_max)
+{
+    return i_min + (i_max - i_min) * (float(rand()) / float(RAND_MAX));
+}
+
+// the distance along a ray to where it enters a proxy, or FLT_MAX if it misses it
+float GetStaticBVHTestRayDistance(const engine::physics::BroadphaseProxy& i_proxy, float i_origin_x, float i_origin_y, float i_direction_x, float i_direction_y)
+{
+    const float bounds_min[2] = { i_proxy.min_x, i_proxy.min_y };
+    const float bounds_max[2] = { i_proxy.max_x, i_proxy.max_y };
+    const float origin[2] = { i_origin_x, i_origin_y };
+    const float direction[2] = { i_direction_x, i_direction_y };
+
+    float t_enter = 0.0f;
+    float t_exit = FLT_MAX;
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        const float t_0 = (bounds_min[axis] - origin[axis]) / direction[axis];
+        const float t_1 = (bounds_max[axis] - origin[axis]) / direction[axis];
+        t_enter = std::max(t_enter, std::min(t_0, t_1));
+        t_exit = std::min(t_exit, std::max(t_0, t_1));
+    }
+    return t_enter <= t_exit ? t_enter : FLT_MAX;
+}
+
+float GetStaticBVHTestPointDistance(const engine::physics::BroadphaseProxy& i_proxy, float i_x, float i_y)
+{
+    const float dx = std::max(std::max(i_proxy.min_x - i_x, i_x - i_proxy.max_x), 0.0f);
+    const float dy = std::max(std::max(i_proxy.min_y - i_y, i_y - i_proxy.max_y), 0.0f);
+    return sqrtf(dx * dx + dy * dy);
+}
+
+// remembers the handles of every pair that collided, in the order the collider responded to them
+class StaticBVHTestListener : public engine::physics::InterfaceCollisionListener
+{
+public:
+    void OnCollision(const engine::physics::CollisionPair& i_collision_pair) override
+    {
+        collisions.push_back({ i_collision_pair.object_a.Lock()->GetHandle(), i_collision_pair.object_b.Lock()->GetHandle() });
+    }
+
+    std::vector<std::pair<engine::physics::PhysicsHandle, engine::physics::PhysicsHandle>> collisions;
+};
+
+// every query on the tree must find exactly what testing every proxy finds
+void TestStaticBVHQueries()
+{
+    using engine::physics::BroadphaseProxy;
+    using engine::physics::StaticBVH;
+
+    // mostly small proxies, some stacked on the same spot & a few long walls
+    std::vector<BroadphaseProxy> proxies(STATIC_BVH_TEST_NUM_PROXIES);
+    for (size_t i = 0; i < STATIC_BVH_TEST_NUM_PROXIES; ++i)
+    {
+        const float x = i % 50 == 0 ? 500.0f : GetRandomStaticBVHValue(0.0f, STATIC_BVH_TEST_WORLD_SIZE);
+        const float y = i % 50 == 0 ? 500.0f : GetRandomStaticBVHValue(0.0f, STATIC_BVH_TEST_WORLD_SIZE);
+        const float width = i % 200 == 1 ? 800.0f : GetRandomStaticBVHValue(1.0f, 20.0f);
+        const float height = GetRandomStaticBVHValue(1.0f, 20.0f);
+        proxies[i] = { x, y, x + width, y + height, uint32_t(i), { 0x0001, 0xffff }, false, uint32_t(i) };
+    }
+
+    StaticBVH bvh;
+    bvh.Build(proxies.data(), proxies.size());
+    bool success = bvh.GetNumProxies() == STATIC_BVH_TEST_NUM_PROXIES && bvh.GetNumNodes() > 0 && bvh.GetNumNodes() < STATIC_BVH_TEST_NUM_PROXIES;
+    ASSERT(success);
+
+    size_t num_overlaps = 0;
+    size_t num_ray_hits = 0;
+    size_t num_nearest_hits = 0;
+    for (size_t i = 0; i < STATIC_BVH_TEST_NUM_QUERIES; ++i)
+    {
+        const float x = GetRandomStaticBVHValue(-100.0f, STATIC_BVH_TEST_WORLD_SIZE + 100.0f);
+        const float y = GetRandomStaticBVHValue(-100.0f, STATIC_BVH_TEST_WORLD_SIZE + 100.0f);
+        const float size = GetRandomStaticBVHValue(1.0f, 100.0f);
+
+        // some rays run along an axis
+        float direction_x = GetRandomStaticBVHValue(-1.0f, 1.0f);
+        float direction_y = GetRandomStaticBVHValue(-1.0f, 1.0f);
+        direction_x = i % 10 == 0 ? 0.0f : direction_x;
+        direction_y = i % 10 == 1 ? 0.0f : direction_y;
+        const float length = sqrtf(direction_x * direction_x + direction_y * direction_y);
+        direction_x /= length;
+        direction_y /= length;
+        const float max_distance = GetRandomStaticBVHValue(10.0f, 800.0f);
+
+        std::vector<uint32_t> expected_overlaps;
+        float expected_ray_distance = FLT_MAX;
+        float expected_nearest_distance = FLT_MAX;
+        for (const BroadphaseProxy& proxy : proxies)
+        {
+            if (proxy.min_x <= x + size && x <= proxy.max_x && proxy.min_y <= y + size && y <= proxy.max_y)
+            {
+                expected_overlaps.push_back(proxy.id);
+            }
+
+            const float ray_distance = GetStaticBVHTestRayDistance(proxy, x, y, direction_x, direction_y);
+            expected_ray_distance = ray_distance <= max_distance ? std::min(expected_ray_distance, ray_distance) : expected_ray_distance;
+            const float nearest_distance = GetStaticBVHTestPointDistance(proxy, x, y);
+            expected_nearest_distance = nearest_distance <= max_distance ? std::min(expected_nearest_distance, nearest_distance) : expected_nearest_distance;
+        }
+
+        std::vector<uint32_t> found_overlaps;
+        bvh.Query(x, y, x + size, y + size, [&found_overlaps](const BroadphaseProxy& i_proxy) {
+            found_overlaps.push_back(i_proxy.id);
+        });
+        std::sort(found_overlaps.begin(), found_overlaps.end());
+        std::sort(expected_overlaps.begin(), expected_overlaps.end());
+        ASSERT(found_overlaps == expected_overlaps);
+        num_overlaps += found_overlaps.size();
+
+        float ray_distance = FLT_MAX;
+        bvh.Raycast(x, y, direction_x, direction_y, max_distance, [&ray_distance, max_distance, x, y, direction_x, direction_y](const BroadphaseProxy& i_proxy) {
+            const float distance = GetStaticBVHTestRayDistance(i_proxy, x, y, direction_x, direction_y);
+            ray_distance = distance <= max_distance ? std::min(ray_distance, distance) : ray_distance;
+            return std::min(ray_distance, max_distance);
+        });
+        ASSERT(ray_distance == expected_ray_distance);
+        num_ray_hits += ray_distance != FLT_MAX ? 1 : 0;
+
+        float nearest_distance = FLT_MAX;
+        bvh.QueryNearest(x, y, max_distance, [&nearest_distance, max_distance, x, y](const BroadphaseProxy& i_proxy) {
+            const float distance = GetStaticBVHTestPointDistance(i_proxy, x, y);
+            nearest_distance = distance <= max_distance ? std::min(nearest_distance, distance) : nearest_distance;
+            return std::min(nearest_distance, max_distance);
+        });
+        ASSERT(nearest_distance == expected_nearest_distance);
+        num_nearest_hits += nearest_distance != FLT_MAX ? 1 : 0;
+    }
+    ASSERT(num_overlaps > 0 && num_ray_hits > 0 && num_nearest_hits > 0);
+
+    LOG("%zu proxies in %zu nodes, %zu queries: %zu overlaps, %zu rays hit & %zu nearest proxies found", bvh.GetNumProxies(), bvh.GetNumNodes(),
+        STATIC_BVH_TEST_NUM_QUERIES, num_overlaps, num_ray_hits, num_nearest_hits);
+
+    bvh.Clear();
+    success = bvh.GetNumProxies() == 0 && bvh.GetNumNodes() == 0;
+    ASSERT(success);
+}
+
+// baking the static objects must not change what collides or what queries find
+void TestStaticBVHBake()
+{
+    using engine::gameobject::GameObject;
+    using engine::physics::Collider;
+    using engine::physics::Physics;
+    using engine::physics::PhysicsObject;
+    using engine::physics::SceneQueryHit;
+
+    // the engine usually owns these, create them if they don't exist yet
+    const bool owns_collider = Collider::Get() == nullptr;
+    Collider* collider = Collider::Create();
+    const bool owns_physics = Physics::Get() == nullptr;
+    Physics* physics = Physics::Create();
+
+    std::vector<engine::memory::SharedPointer<GameObject>> game_objects;
+    std::vector<engine::memory::SharedPointer<PhysicsObject>> physics_objects;
+    std::vector<engine::math::Vec3D> velocities;
+    for (size_t i = 0; i < STATIC_BVH_TEST_NUM_STATIC_OBJECTS + STATIC_BVH_TEST_NUM_DYNAMIC_OBJECTS; ++i)
+    {
+        const bool is_static = i < STATIC_BVH_TEST_NUM_STATIC_OBJECTS;
+        const float size = GetRandomStaticBVHValue(2.0f, 20.0f);
+        const engine::math::Vec3D position(GetRandomStaticBVHValue(0.0f, STATIC_BVH_TEST_WORLD_SIZE), GetRandomStaticBVHValue(0.0f, STATIC_BVH_TEST_WORLD_SIZE), 0.0f);
+        const engine::math::AABB aabb = { engine::math::Vec3D::ZERO, engine::math::Vec3D(size, size, 0.0f) };
+        game_objects.push_back(GameObject::Create(aabb, engine::math::Transform(position)));
+        physics_objects.push_back(physics->CreatePhysicsObject(game_objects.back(), 1.0f, 0.0f,
+            is_static ? engine::physics::PhysicsObjectType::kPhysicsObjectStatic : engine::physics::PhysicsObjectType::kPhysicsObjectDynamic,
+            STATIC_BVH_TEST_FILTERS[is_static && i % 7 == 0 ? 1 : 0], true));
+        velocities.push_back(is_static ? engine::math::Vec3D::ZERO : engine::math::Vec3D(GetRandomStaticBVHValue(-1.0f, 1.0f), GetRandomStaticBVHValue(-1.0f, 1.0f), 0.0f));
+    }
+
+    // every run starts from the same velocities, so every run should find the same collisions
+    StaticBVHTestListener listener;
+    collider->SetCollisionListener(&listener);
+    const auto run_collider = [&]() {
+        for (size_t i = 0; i < physics_objects.size(); ++i)
+        {
+            physics_objects[i]->SetVelocity(velocities[i]);
+        }
+        listener.collisions.clear();
+        collider->Run(STATIC_BVH_TEST_DT);
+    };
+
+    std::vector<SceneQueryHit> expected_hits;
+    const auto raycast = [&](std::vector<SceneQueryHit>& o_hits) {
+        o_hits.clear();
+        for (size_t i = 0; i < STATIC_BVH_TEST_NUM_QUERIES; ++i)
+        {
+            const engine::math::Vec3D origin(float(i) * STATIC_BVH_TEST_WORLD_SIZE / float(STATIC_BVH_TEST_NUM_QUERIES), -10.0f, 0.0f);
+            SceneQueryHit hit;
+            o_hits.push_back(collider->Raycast(origin, engine::math::Vec3D(0.1f, 1.0f, 0.0f), STATIC_BVH_TEST_WORLD_SIZE, hit) ? hit : SceneQueryHit());
+        }
+    };
+
+    run_collider();
+    const size_t expected_candidate_pairs = collider->GetNumCandidatePairs();
+    const auto expected_collisions = listener.collisions;
+    raycast(expected_hits);
+    ASSERT(!expected_collisions.empty() && collider->GetStaticBVH().GetNumProxies() == 0);
+
+    collider->BakeStaticObjects();
+    bool success = collider->GetStaticBVH().GetNumProxies() == STATIC_BVH_TEST_NUM_STATIC_OBJECTS;
+    ASSERT(success);
+
+    run_collider();
+    success = collider->GetNumCandidatePairs() == expected_candidate_pairs && listener.collisions == expected_collisions;
+    ASSERT(success);
+
+    std::vector<SceneQueryHit> hits;
+    raycast(hits);
+    for (size_t i = 0; i < hits.size(); ++i)
+    {
+        success = bool(hits[i].object) == bool(expected_hits[i].object) && (!hits[i].object || (hits[i].object.Lock() == expected_hits[i].object.Lock() && hits[i].distance == expected_hits[i].distance));
+        ASSERT(success);
+    }
+
+    // baking again gives the same tree
+    collider->BakeStaticObjects();
+    run_collider();
+    success = collider->GetStaticBVH().GetNumProxies() == STATIC_BVH_TEST_NUM_STATIC_OBJECTS && listener.collisions == expected_collisions;
+    ASSERT(success);
+
+    // removed objects leave a gap in the tree until the next bake, but are never found again
+    for (size_t i = 0; i < STATIC_BVH_TEST_NUM_STATIC_OBJECTS; i += 2)
+    {
+        physics->RemovePhysicsObject(physics_objects[i]);
+    }
+    physics->ApplyCommands();
+    run_collider();
+    for (const auto& collision : listener.collisions)
+    {
+        success = std::find(expected_collisions.begin(), expected_collisions.end(), collision) != expected_collisions.end();
+        ASSERT(success);
+        for (size_t i = 0; i < STATIC_BVH_TEST_NUM_STATIC_OBJECTS; i += 2)
+        {
+            ASSERT(collision.first != physics_objects[i]->GetHandle() && collision.second != physics_objects[i]->GetHandle());
+        }
+    }
+
+    collider->BakeStaticObjects();
+    success = collider->GetStaticBVH().GetNumProxies() == STATIC_BVH_TEST_NUM_STATIC_OBJECTS / 2;
+    ASSERT(success);
+
+    LOG("%zu candidate pairs & %zu collisions with & without the static tree", expected_candidate_pairs, expected_collisions.size());
+
+    collider->SetCollisionListener(nullptr);
+    for (size_t i = 0; i < physics_objects.size(); ++i)
+    {
+        if (i >= STATIC_BVH_TEST_NUM_STATIC_OBJECTS || i % 2 == 1)
+        {
+            physics->RemovePhysicsObject(physics_objects[i]);
+        }
+    }
+    collider->ApplyCommands();
+    physics->ApplyCommands();
+    collider->BakeStaticObjects();
+    ASSERT(collider->GetStaticBVH().GetNumProxies() == 0);
+
+    if (owns_physics)
+    {
+        Physics::Destroy();
+    }
+    if (owns_collider)
+    {
+        Collider::Destroy();
+    }
+}
+
+void TestStaticBVH()
+{
+    LOG("-------------------- Running StaticBVH_UnitTest --------------------");
+
+    srand(STATIC_BVH_TEST_SEED);
+
+    TestStaticBVHQueries();
+    TestStaticBVHBake();
+
+    LOG("-------------------- Finished StaticBVH_UnitTest --------------------");
+}
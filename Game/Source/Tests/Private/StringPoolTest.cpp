@@ -3,12 +3,12 @@
 #include <vector>
 
 // engine includes
-#include "Assert\Assert.h"
-#include "Data\HashedString.h"
-#include "Data\PooledString.h"
-#include "Data\StringPool.h"
-#include "Logger\Logger.h"
-#include "Memory\BlockAllocator.h"
+#include "Assert/Assert.h"
+#include "Data/HashedString.h"
+#include "Data/PooledString.h"
+#include "Data/StringPool.h"
+#include "Logger/Logger.h"
+#include "Memory/BlockAllocator.h"
 
 char* MakeRandomWord(size_t i_length)
 {
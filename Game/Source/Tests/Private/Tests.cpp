@@ -1,11 +1,11 @@
 #ifdef ENABLE_TESTS
 
 // engine includes
-#include "Logger\Logger.h"
+#include "Logger/Logger.h"
 
 /************************ MEMORY TESTS ************************/
 #ifdef ENABLE_ALLOCATOR_TEST
-#include "Tests\BlockAllocatorTest.h"
+#include "Tests/BlockAllocatorTest.h"
 
 bool HeapManager_UnitTest();
 
@@ -21,6 +21,28 @@ void TestFixedSizeAllocator();
 //#define ENABLE_JOB_SYSTEM_TEST
 //#define ENABLE_MAT44_TEST
 //#define ENABLE_FAST_MATH_TEST
+//#define ENABLE_BLOCK_ALLOCATOR_BENCHMARK
+//#define ENABLE_BIT_ARRAY_BENCHMARK
+//#define ENABLE_FRAME_ALLOCATOR_TEST
+//#define ENABLE_SHARED_POINTER_BENCHMARK
+//#define ENABLE_JOB_SYSTEM_BENCHMARK
+//#define ENABLE_JOB_DEPENDENCY_TEST
+//#define ENABLE_PARALLEL_FOR_TEST
+//#define ENABLE_BROADPHASE_TEST
+//#define ENABLE_COLLIDER_BENCHMARK
+//#define ENABLE_SEPARATING_AXIS_TEST
+//#define ENABLE_SEPARATING_AXIS_BENCHMARK
+//#define ENABLE_PHYSICS_WORLD_TEST
+//#define ENABLE_PHYSICS_ISLANDS_TEST
+//#define ENABLE_FIXED_TIMESTEP_TEST
+//#define ENABLE_COMMAND_QUEUE_TEST
+//#define ENABLE_CONTINUOUS_COLLISION_TEST
+//#define ENABLE_CONTACT_CACHE_TEST
+//#define ENABLE_SCENE_QUERY_TEST
+//#define ENABLE_DYNAMIC_TREE_TEST
+//#define ENABLE_STATIC_BVH_TEST
+//#define ENABLE_NULL_RENDER_BACKEND_TEST
+//#define ENABLE_RENDER_THREAD_TEST
 
 #ifdef ENABLE_VECTOR_CONST_TEST
 void TestVectorConstness();
@@ -54,6 +76,94 @@ void TestMat44();
 void TestFastMath();
 #endif
 
+#ifdef ENABLE_BLOCK_ALLOCATOR_BENCHMARK
+void BenchmarkBlockAllocator();
+#endif
+
+#ifdef ENABLE_BIT_ARRAY_BENCHMARK
+void BenchmarkBitArray();
+#endif
+
+#ifdef ENABLE_FRAME_ALLOCATOR_TEST
+void TestFrameAllocator();
+#endif
+
+#ifdef ENABLE_SHARED_POINTER_BENCHMARK
+void BenchmarkSharedPointer();
+#endif
+
+#ifdef ENABLE_JOB_SYSTEM_BENCHMARK
+void BenchmarkJobSystem();
+#endif
+
+#ifdef ENABLE_JOB_DEPENDENCY_TEST
+void TestJobDependencies();
+#endif // ENABLE_JOB_DEPENDENCY_TEST
+
+#ifdef ENABLE_PARALLEL_FOR_TEST
+void TestParallelFor();
+#endif // ENABLE_PARALLEL_FOR_TEST
+
+#ifdef ENABLE_BROADPHASE_TEST
+void TestBroadphase();
+#endif // ENABLE_BROADPHASE_TEST
+
+#ifdef ENABLE_COLLIDER_BENCHMARK
+void BenchmarkCollider();
+#endif // ENABLE_COLLIDER_BENCHMARK
+
+#ifdef ENABLE_SEPARATING_AXIS_TEST
+void TestSeparatingAxisBatch();
+#endif // ENABLE_SEPARATING_AXIS_TEST
+
+#ifdef ENABLE_SEPARATING_AXIS_BENCHMARK
+void BenchmarkSeparatingAxisBatch();
+#endif // ENABLE_SEPARATING_AXIS_BENCHMARK
+
+#ifdef ENABLE_PHYSICS_WORLD_TEST
+void TestPhysicsWorld();
+#endif // ENABLE_PHYSICS_WORLD_TEST
+
+#ifdef ENABLE_PHYSICS_ISLANDS_TEST
+void TestPhysicsIslands();
+#endif // ENABLE_PHYSICS_ISLANDS_TEST
+
+#ifdef ENABLE_FIXED_TIMESTEP_TEST
+void TestFixedTimestep();
+#endif // ENABLE_FIXED_TIMESTEP_TEST
+
+#ifdef ENABLE_COMMAND_QUEUE_TEST
+void TestCommandQueue();
+#endif // ENABLE_COMMAND_QUEUE_TEST
+
+#ifdef ENABLE_CONTINUOUS_COLLISION_TEST
+void TestContinuousCollision();
+#endif // ENABLE_CONTINUOUS_COLLISION_TEST
+
+#ifdef ENABLE_CONTACT_CACHE_TEST
+void TestContactCache();
+#endif // ENABLE_CONTACT_CACHE_TEST
+
+#ifdef ENABLE_SCENE_QUERY_TEST
+void TestSceneQuery();
+#endif // ENABLE_SCENE_QUERY_TEST
+
+#ifdef ENABLE_DYNAMIC_TREE_TEST
+void TestDynamicTree();
+#endif // ENABLE_DYNAMIC_TREE_TEST
+
+#ifdef ENABLE_STATIC_BVH_TEST
+void TestStaticBVH();
+#endif // ENABLE_STATIC_BVH_TEST
+
+#ifdef ENABLE_NULL_RENDER_BACKEND_TEST
+void TestNullRenderBackend();
+#endif // ENABLE_NULL_RENDER_BACKEND_TEST
+
+#ifdef ENABLE_RENDER_THREAD_TEST
+void TestRenderThread();
+#endif // ENABLE_RENDER_THREAD_TEST
+
 /************************ RUN TESTS ************************/
 void RunTests()
 {
@@ -97,6 +207,106 @@ void RunTests()
     TestFastMath();
 #endif // ENABLE_FAST_MATH_TEST
 
+#ifdef ENABLE_BLOCK_ALLOCATOR_BENCHMARK
+    LOG("\n");
+    BenchmarkBlockAllocator();
+#endif // ENABLE_BLOCK_ALLOCATOR_BENCHMARK
+
+#ifdef ENABLE_BIT_ARRAY_BENCHMARK
+    LOG("\n");
+    BenchmarkBitArray();
+#endif // ENABLE_BIT_ARRAY_BENCHMARK
+
+#ifdef ENABLE_FRAME_ALLOCATOR_TEST
+    LOG("\n");
+    TestFrameAllocator();
+#endif // ENABLE_FRAME_ALLOCATOR_TEST
+
+#ifdef ENABLE_SHARED_POINTER_BENCHMARK
+    LOG("\n");
+    BenchmarkSharedPointer();
+#endif // ENABLE_SHARED_POINTER_BENCHMARK
+
+#ifdef ENABLE_JOB_SYSTEM_BENCHMARK
+    LOG("\n");
+    BenchmarkJobSystem();
+#endif // ENABLE_JOB_SYSTEM_BENCHMARK
+
+#ifdef ENABLE_JOB_DEPENDENCY_TEST
+    LOG("\n");
+    TestJobDependencies();
+#endif // ENABLE_JOB_DEPENDENCY_TEST
+
+#ifdef ENABLE_PARALLEL_FOR_TEST
+    LOG("\n");
+    TestParallelFor();
+#endif // ENABLE_PARALLEL_FOR_TEST
+
+#ifdef ENABLE_BROADPHASE_TEST
+    LOG("\n");
+    TestBroadphase();
+#endif // ENABLE_BROADPHASE_TEST
+
+#ifdef ENABLE_COLLIDER_BENCHMARK
+    LOG("\n");
+    BenchmarkCollider();
+#endif // ENABLE_COLLIDER_BENCHMARK
+
+#ifdef ENABLE_SEPARATING_AXIS_TEST
+    LOG("\n");
+    TestSeparatingAxisBatch();
+#endif // ENABLE_SEPARATING_AXIS_TEST
+
+#ifdef ENABLE_SEPARATING_AXIS_BENCHMARK
+    LOG("\n");
+    BenchmarkSeparatingAxisBatch();
+#endif // ENABLE_SEPARATING_AXIS_BENCHMARK
+
+#ifdef ENABLE_PHYSICS_WORLD_TEST
+    LOG("\n");
+    TestPhysicsWorld();
+#endif // ENABLE_PHYSICS_WORLD_TEST
+
+#ifdef ENABLE_PHYSICS_ISLANDS_TEST
+    LOG("\n");
+    TestPhysicsIslands();
+#endif // ENABLE_PHYSICS_ISLANDS_TEST
+
+#ifdef ENABLE_FIXED_TIMESTEP_TEST
+    LOG("\n");
+    TestFixedTimestep();
+#endif // ENABLE_FIXED_TIMESTEP_TEST
+
+#ifdef ENABLE_COMMAND_QUEUE_TEST
+    LOG("\n");
+    TestCommandQueue();
+#endif // ENABLE_COMMAND_QUEUE_TEST
+
+#ifdef ENABLE_CONTINUOUS_COLLISION_TEST
+    LOG("\n");
+    TestContinuousCollision();
+#endif // ENABLE_CONTINUOUS_COLLISION_TEST
+
+#ifdef ENABLE_CONTACT_CACHE_TEST
+    LOG("\n");
+    TestContactCache();
+#endif // ENABLE_CONTACT_CACHE_TEST
+
+#ifdef ENABLE_SCENE_QUERY_TEST
+    LOG("\n");
+    TestSceneQuery();
+#endif // ENABLE_SCENE_QUERY_TEST
+
+#ifdef ENABLE_DYNAMIC_TREE_TEST
+    LOG("\n");
+    TestDynamicTree();
+#endif // ENABLE_DYNAMIC_TREE_TEST
+
+#ifdef ENABLE_STATIC_BVH_TEST
+    LOG("\n");
+    TestStaticBVH();
+#endif // ENABLE_STATIC_BVH_TEST
+
 #ifdef ENABLE_ALLOCATOR_TEST
     LOG("\n");
     TestFixedSizeAllocator();
@@ -117,4 +327,19 @@ void RunTests()
 #endif // ENABLE_ALLOCATOR_TEST
 }
 
+/************************ RUN HEADLESS TESTS ************************/
+// these start & shut down an engine of their own, so they must be run while the engine isn't running
+void RunHeadlessTests()
+{
+#ifdef ENABLE_NULL_RENDER_BACKEND_TEST
+    LOG("\n");
+    TestNullRenderBackend();
+#endif // ENABLE_NULL_RENDER_BACKEND_TEST
+
+#ifdef ENABLE_RENDER_THREAD_TEST
+    LOG("\n");
+    TestRenderThread();
+#endif // ENABLE_RENDER_THREAD_TEST
+}
+
 #endif // ENABLE_TESTS
\ No newline at end of file
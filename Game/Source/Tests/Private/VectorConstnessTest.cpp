@@ -2,20 +2,20 @@
 #include <stdio.h>
 
 // engine includes
-#include "Logger\Logger.h"
-#include "Math\Vec2D.h"
-#include "Math\Vec3D.h"
+#include "Logger/Logger.h"
+#include "Math/Vec2D.h"
+#include "Math/Vec3D.h"
 
 void VecToString(const engine::math::Vec2D& i_vec, char* o_buf)
 {
     ASSERT(o_buf);
-    sprintf_s(o_buf, 128, "%f, %f", i_vec.x(), i_vec.y());
+    snprintf(o_buf, 128, "%f, %f", i_vec.x(), i_vec.y());
 }
 
 void VecToString(const engine::math::Vec3D& i_vec, char* o_buf)
 {
     ASSERT(o_buf);
-    sprintf_s(o_buf, 128, "%f, %f, %f", i_vec.x(), i_vec.y(), i_vec.z());
+    snprintf(o_buf, 128, "%f, %f, %f", i_vec.x(), i_vec.y(), i_vec.z());
 }
 
 void TestVectorConstness()